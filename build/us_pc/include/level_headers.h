@@ -0,0 +1,38 @@
+
+
+
+#include "levels/bbh/header.h"
+#include "levels/ccm/header.h"
+#include "levels/castle_inside/header.h"
+#include "levels/hmc/header.h"
+#include "levels/ssl/header.h"
+#include "levels/bob/header.h"
+#include "levels/sl/header.h"
+#include "levels/wdw/header.h"
+#include "levels/jrb/header.h"
+#include "levels/thi/header.h"
+#include "levels/ttc/header.h"
+#include "levels/rr/header.h"
+#include "levels/castle_grounds/header.h"
+#include "levels/bitdw/header.h"
+#include "levels/vcutm/header.h"
+#include "levels/bitfs/header.h"
+#include "levels/sa/header.h"
+#include "levels/bits/header.h"
+#include "levels/lll/header.h"
+#include "levels/ddd/header.h"
+#include "levels/wf/header.h"
+#include "levels/ending/header.h"
+#include "levels/castle_courtyard/header.h"
+#include "levels/pss/header.h"
+#include "levels/cotmc/header.h"
+#include "levels/totwc/header.h"
+#include "levels/bowser_1/header.h"
+#include "levels/wmotr/header.h"
+
+#include "levels/bowser_2/header.h"
+#include "levels/bowser_3/header.h"
+
+#include "levels/ttm/header.h"
+
+
@@ -0,0 +1,18 @@
+#ifndef TEXT_MENU_STRINGS_H
+#define TEXT_MENU_STRINGS_H
+
+// These strings use a different table defined in menu_hud_lut
+// Unlike text_strings.h.in, the charmap is different and 
+// uses char values from charmap_menu.txt
+
+/**
+ * File Select JP HUD Text
+ */
+#define TEXT_JPHUD_MARIO 0x0F,0x10,0x11,0xFF
+#define TEXT_JPHUD_SELECT_FILE 0x00,0x01,0x02,0x03,0x04,0x05,0x06,0x07,0xFF
+#define TEXT_JPHUD_CHECK_FILE 0x15,0x16,0x12,0x09,0x13,0x08,0x14,0x0D,0x17,0xFF
+#define TEXT_JPHUD_COPY_FILE 0x00,0x01,0x02,0x03,0x09,0x0A,0x0B,0x0C,0x0D,0xFF
+#define TEXT_JPHUD_ERASE_FILE 0x00,0x01,0x02,0x03,0x0E,0x0C,0xFF
+#define TEXT_JPHUD_SOUND_SELECT 0x18,0x19,0x1A,0x1B,0x04,0x05,0x06,0x07,0xFF
+
+#endif // TEXT_MENU_STRINGS_H
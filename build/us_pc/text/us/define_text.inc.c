@@ -0,0 +1,666 @@
+static const u8 Debug0[] = {
+    0x1C,0x1D,0x0A,0x10,0x0E,0x9E,0x1C,0x0E,0x15,0x0E,0x0C,0x1D,0xFE,0x9E,0x51,0xF0,0x51,0x48,0x68,0xF4,0xFE,0x9E,0x01,0x9E,0x8E,0x72,0x9D,0x82,0x9D,0xFE,0x9E,0x02,0x9E,0x8B,0xD5,0x71,0x70,0x9F,0xF0,0x89,0xF0,0x8B,0x98,0xFE,0x9E,0x03,0x9E,0x7C,0x88,0x9F,0x7C,0x96,0x71,0xF0,0x7F,0x9F,0xFE,0x9E,0x04,0x9E,0x72,0xD8,0x9F,0x7F,0x9F,0x96,0x9D,0xF0,0x83,0xFE,0x9E,0x9E,0x9E,0x77,0xD1,0xF1,0x89,0x01,0xF0,0x49,0x42,0xFE,0x9E,0x62,0xF0,0x53,0x68,0xFF
+};
+static const u8 Debug1[] = {
+    0x19,0x0A,0x1E,0x1C,0x0E,0x9E,0x9E,0x9E,0x9E,0xFE,0x9E,0x51,0xF0,0x51,0x48,0x68,0xF4,0xFE,0x9E,0x63,0x61,0x68,0x9E,0xF4,0xFF
+};
+static const struct DialogEntry debug_text_entry_0 = {
+    1, 8, 30, 200, Debug0
+};
+static const struct DialogEntry debug_text_entry_1 = {
+    1, 3, 100, 150, Debug1
+};
+const struct DialogEntry *const seg2_debug_text_table[] = {
+    &debug_text_entry_0, &debug_text_entry_1, NULL,
+};
+static const u8 dialog_text_DIALOG_000[] = { 0x20,0x32,0x3A,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x35,0x28,0x9E,0x36,0x30,0x24,0x26,0x2E,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x30,0x2C,0x27,0x27,0x2F,0x28,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x25,0x24,0x37,0x37,0x2F,0x28,0x29,0x2C,0x28,0x2F,0x27,0x3F,0xFE,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x29,0x2C,0x31,0x27,0x9E,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0xFE,0x1C,0x37,0x24,0x35,0x36,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x36,0x37,0x32,0x2F,0x28,0xFE,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0xFE,0x3A,0x32,0x35,0x2F,0x27,0x36,0x3F,0xFE,0x0F,0x2C,0x35,0x36,0x37,0x6F,0x9E,0x37,0x24,0x2F,0x2E,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x0B,0x38,0x27,0x27,0x3C,0x3F,0x9E,0xE1,0x19,0x35,0x28,0x36,0x36,0x9E,0x55,0xFE,0x37,0x32,0x9E,0x37,0x24,0x2F,0x2E,0x3F,0xE3,0x9E,0x11,0x28,0x3E,0x2F,0x2F,0x9E,0x26,0x28,0x35,0x37,0x24,0x2C,0x31,0x2F,0x3C,0xFE,0x2B,0x28,0x2F,0x33,0x9E,0xD2,0x9E,0x32,0x38,0x37,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x36,0x32,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x2B,0x2C,0x36,0x9E,0x26,0x32,0x30,0x35,0x24,0x27,0x28,0x36,0x9E,0x2C,0x31,0x9E,0x32,0xD1,0x35,0xFE,0x24,0x35,0x28,0x24,0x36,0x3F,0xFE,0x1D,0x32,0x9E,0x35,0x28,0x24,0x27,0x9E,0x36,0x2C,0x2A,0x31,0x36,0x6F,0x9E,0x36,0x37,0x32,0x33,0x6F,0x9E,0x29,0x24,0x26,0x28,0xFE,0xD1,0x30,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x55,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0xFE,0x32,0x35,0x9E,0x55,0x9E,0x37,0x32,0x9E,0x36,0x26,0x35,0x32,0x2F,0x2F,0x9E,0x24,0x2B,0x28,0x24,0x27,0x3F,0x9E,0x22,0x32,0x38,0xFE,0x26,0x24,0x31,0x9E,0x37,0x24,0x2F,0x2E,0x9E,0x37,0x32,0x9E,0x36,0x32,0x30,0x28,0x9E,0x32,0xD1,0x35,0xFE,0x26,0x2B,0x24,0x35,0x24,0x26,0x37,0x28,0x35,0x36,0x9E,0x25,0x3C,0x9E,0x29,0x24,0x26,0x2C,0x31,0x2A,0x9E,0xD1,0x30,0xFE,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x2C,0x31,0x2A,0x9E,0x55,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_001[] = { 0x20,0x24,0x37,0x26,0x2B,0x9E,0x32,0x38,0x37,0xF2,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x27,0x28,0x35,0xFE,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x2B,0x28,0x35,0x28,0x6F,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x2F,0x2C,0x24,0x25,0x2F,0x28,0xFE,0x37,0x32,0x9E,0x25,0x28,0x9E,0x33,0x2F,0x24,0x36,0x37,0x28,0x35,0x28,0x27,0x9E,0x25,0x3C,0x9E,0x24,0xFE,0x3A,0x24,0x37,0x28,0x35,0x9E,0x25,0x32,0x30,0x25,0xF2,0xFE,0x1D,0x2B,0x32,0x36,0x28,0x9E,0x28,0x31,0x28,0x30,0x3C,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x36,0x9E,0x2F,0x32,0x39,0x28,0xFE,0x37,0x32,0x9E,0x29,0x2C,0x2A,0x2B,0x37,0x6F,0x9E,0x24,0x31,0x27,0x9E,0xD1,0x3C,0x3E,0x35,0x28,0xFE,0x24,0x2F,0x3A,0x24,0x3C,0x36,0x9E,0x29,0x2C,0x31,0x27,0x2C,0x31,0x2A,0x9E,0x3A,0x24,0x3C,0x36,0x9E,0x37,0x32,0xFE,0x24,0x37,0x37,0x24,0x26,0x2E,0x3F,0xFE,0x1D,0x2B,0x2C,0x36,0x9E,0x30,0x28,0x24,0x27,0x32,0x3A,0x9E,0x2B,0x24,0x36,0x9E,0x25,0x28,0x26,0x32,0x30,0x28,0xFE,0x24,0x9E,0x25,0x24,0x37,0x37,0x2F,0x28,0x29,0x2C,0x28,0x2F,0x27,0x9E,0x28,0x39,0x28,0x35,0x9E,0x36,0x2C,0x31,0x26,0x28,0xFE,0xD1,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x2A,0x32,0x37,0x9E,0x2B,0x2C,0x36,0xFE,0x33,0x24,0x3A,0x36,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x3F,0xFE,0x0C,0x24,0x31,0x9E,0xD2,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0xFE,0x29,0x32,0x35,0x9E,0x38,0x36,0xF4,0x9E,0x0C,0x35,0x32,0x36,0x36,0x9E,0xD1,0x9E,0x25,0x35,0x2C,0x27,0x2A,0x28,0xFE,0x24,0x31,0x27,0x9E,0x2A,0x32,0x9E,0x2F,0x28,0x29,0x37,0x9E,0x38,0x33,0x9E,0xD1,0x9E,0x33,0x24,0x37,0x2B,0xFE,0x37,0x32,0x9E,0x29,0x2C,0x31,0x27,0x9E,0xD1,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x26,0x32,0x30,0x28,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0xFE,0x30,0x28,0x9E,0x24,0x29,0x37,0x28,0x35,0x9E,0xD2,0x3E,0x39,0x28,0x9E,0x35,0x28,0x37,0x35,0x2C,0x28,0x39,0x28,0x27,0xFE,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_002[] = { 0x11,0x28,0x3C,0x6F,0x9E,0xD2,0xF2,0x9E,0x12,0x37,0x3E,0x36,0x9E,0x27,0x24,0x31,0x2A,0x28,0x35,0x32,0x38,0x36,0xFE,0x24,0x2B,0x28,0x24,0x27,0x6F,0x9E,0x36,0x32,0x9E,0x2F,0x2C,0x36,0x37,0x28,0x31,0x9E,0x38,0x33,0xF2,0x9E,0x1D,0x24,0x2E,0x28,0xFE,0x30,0x3C,0x9E,0x24,0x27,0x39,0x2C,0x26,0x28,0x3F,0xFE,0xFE,0x0C,0x35,0x32,0x36,0x36,0x9E,0xD1,0x9E,0x37,0x3A,0x32,0xFE,0x25,0x35,0x2C,0x27,0x2A,0x28,0x36,0x9E,0x24,0x2B,0x28,0x24,0x27,0x6F,0x9E,0xD1,0x31,0xFE,0x3A,0x24,0x37,0x26,0x2B,0x9E,0x29,0x32,0x35,0x9E,0x29,0x24,0x2F,0x2F,0x2C,0x31,0x2A,0xFE,0x3A,0x24,0x37,0x28,0x35,0x9E,0x25,0x32,0x30,0x25,0x36,0x3F,0xFE,0x1D,0x2B,0x28,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x24,0x37,0x9E,0xD1,0xFE,0x37,0x32,0x33,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x30,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0x9E,0x2C,0x36,0xFE,0x39,0x28,0x35,0x3C,0x9E,0x33,0x32,0x3A,0x28,0x35,0x29,0x38,0x2F,0x9F,0x9F,0x27,0x32,0x31,0x3E,0x37,0x9E,0x2F,0x28,0x37,0xFE,0x2B,0x2C,0x30,0x9E,0x2A,0x35,0x24,0x25,0x9E,0xD2,0xF2,0xFE,0x20,0x28,0x3E,0x35,0x28,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x0B,0x38,0x27,0x27,0x2C,0x28,0x36,0x6F,0xFE,0x24,0x31,0x27,0x9E,0x3A,0x28,0x3E,0x35,0x28,0x9E,0x32,0x31,0x9E,0xD2,0x35,0x9E,0x36,0x2C,0x27,0x28,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x37,0x24,0x2F,0x2E,0x9E,0x37,0x32,0x9E,0x38,0x36,0xFE,0x3A,0x2B,0x28,0x31,0x28,0x39,0x28,0x35,0x9E,0xD2,0x3E,0x27,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x37,0x32,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_003[] = { 0x1D,0x2B,0x24,0x31,0x2E,0x9E,0xD2,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x1D,0x2B,0x28,0x9E,0x0B,0x2C,0x2A,0xFE,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x2C,0x36,0x9E,0x31,0x32,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x25,0x38,0x37,0x9E,0x24,0xFE,0x25,0x2C,0x2A,0x9E,0x27,0x38,0x27,0x9E,0x31,0x32,0x3A,0xF2,0x9E,0x0B,0x38,0x37,0x9E,0xD1,0xFE,0x25,0x24,0x37,0x37,0x2F,0x28,0x9E,0x29,0x32,0x35,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x9E,0x2B,0x24,0x36,0xFE,0x2D,0x38,0x36,0x37,0x9E,0x25,0x28,0x2A,0x38,0x31,0x3F,0xFE,0x18,0xD1,0x35,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0x9E,0x24,0x35,0x28,0x9E,0x2B,0x32,0x2F,0x27,0x2C,0x31,0x2A,0xFE,0xD1,0x9E,0x32,0xD1,0x35,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x3F,0x9E,0x12,0x29,0xFE,0xD2,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0x30,0x32,0x35,0x28,0x9E,0x1C,0x37,0x24,0x35,0x36,0x6F,0xFE,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x32,0x33,0x28,0x31,0x9E,0x31,0x28,0x3A,0x9E,0x27,0x32,0x32,0x35,0x36,0xFE,0x37,0x2B,0x24,0x37,0x9E,0x2F,0x28,0x24,0x27,0x9E,0x37,0x32,0x9E,0x31,0x28,0x3A,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x36,0xF2,0xFE,0x16,0x3C,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x0B,0x38,0x27,0x27,0x2C,0x28,0x36,0x9E,0x24,0x35,0x28,0xFE,0x3A,0x24,0x2C,0x37,0x2C,0x31,0x2A,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0x9E,0x0B,0x28,0x9E,0x36,0x38,0x35,0x28,0xFE,0x37,0x32,0x9E,0x37,0x24,0x2F,0x2E,0x9E,0x37,0x32,0x9E,0xD1,0x30,0x9F,0x9F,0xD1,0x3C,0x3E,0x2F,0x2F,0xFE,0x36,0x28,0x37,0x9E,0x38,0x33,0x9E,0x26,0x24,0x31,0x31,0x32,0x31,0x36,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_004[] = { 0x20,0x28,0x3E,0x35,0x28,0x9E,0x33,0x28,0x24,0x26,0x28,0x9F,0x2F,0x32,0x39,0x2C,0x31,0x2A,0xFE,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x36,0x6F,0x9E,0x36,0x32,0x9E,0x3A,0x28,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x38,0x36,0x28,0xFE,0x26,0x24,0x31,0x31,0x32,0x31,0x36,0x3F,0xFE,0x0B,0x38,0x37,0x9E,0x2C,0x29,0x9E,0xD2,0x3E,0x27,0x9E,0x2F,0x2C,0x2E,0x28,0xFE,0x37,0x32,0x9E,0x25,0x2F,0x24,0x36,0x37,0x9E,0x32,0x29,0x29,0x6F,0x9E,0x3A,0x28,0x9E,0x27,0x32,0x31,0x3E,0x37,0xFE,0x30,0x2C,0x31,0x27,0x3F,0x9E,0x11,0x28,0x2F,0x33,0x9E,0xD2,0x35,0x36,0x28,0x2F,0x29,0x3F,0xFE,0x20,0x28,0x3E,0x2F,0x2F,0x9E,0x33,0x35,0x28,0x33,0x24,0x35,0x28,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x26,0x24,0x31,0x31,0x32,0x31,0x36,0x9E,0x2C,0x31,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x9E,0x29,0x32,0x35,0xFE,0xD2,0x9E,0x37,0x32,0x9E,0x38,0x36,0x28,0x3F,0x9E,0x0B,0x32,0x31,0x9E,0x1F,0x32,0x3C,0x24,0x2A,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_005[] = { 0x11,0x28,0x3C,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x12,0x36,0x9E,0x2C,0x37,0x9E,0x37,0x35,0x38,0x28,0xFE,0x37,0x2B,0x24,0x37,0x9E,0xD2,0x9E,0x25,0x28,0x24,0x37,0x9E,0xD1,0x9E,0x0B,0x2C,0x2A,0xFE,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0xF4,0x9E,0x0C,0x32,0x32,0x2F,0xF2,0xFE,0x22,0x32,0x38,0x9E,0x30,0x38,0x36,0x37,0x9E,0x25,0x28,0x9E,0x36,0x37,0x35,0x32,0x31,0x2A,0x3F,0x9E,0x0A,0x31,0x27,0xFE,0x33,0x35,0x28,0x37,0x37,0x3C,0x9E,0x29,0x24,0x36,0x37,0x3F,0x9E,0x1C,0x32,0x6F,0x9E,0x2B,0x32,0x3A,0x9E,0x29,0x24,0x36,0x37,0xFE,0x24,0x35,0x28,0x9E,0xD2,0x6F,0x9E,0x24,0x31,0x3C,0x3A,0x24,0x3C,0xF4,0xFE,0x0F,0x24,0x36,0x37,0x9E,0x28,0x31,0x32,0x38,0x2A,0x2B,0x9E,0x37,0x32,0x9E,0x25,0x28,0x24,0x37,0x9E,0x30,0x28,0x3F,0x3F,0x3F,0xFE,0x14,0x32,0x32,0x33,0x24,0x9E,0xD1,0x9E,0x1A,0x38,0x2C,0x26,0x2E,0xF4,0x9E,0x12,0x9E,0x27,0x32,0x31,0x3E,0x37,0xFE,0x37,0x2B,0x2C,0x31,0x2E,0x9E,0x36,0x32,0x3F,0x9E,0x13,0x38,0x36,0x37,0x9E,0x37,0x35,0x3C,0x9E,0x30,0x28,0x3F,0xFE,0x11,0x32,0x3A,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x24,0x9E,0x35,0x24,0x26,0x28,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x30,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0x37,0x32,0x33,0x6F,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x9E,0xD1,0xFE,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x3A,0x24,0x36,0xF4,0xFE,0x20,0x2B,0x24,0x27,0x27,0x3C,0x24,0x9E,0x36,0x24,0x3C,0xF4,0x9E,0x20,0x2B,0x28,0x31,0x9E,0x12,0x9E,0x36,0x24,0x3C,0xFE,0xF5,0x10,0x32,0x6F,0xF6,0x9E,0x2F,0x28,0x37,0x9E,0xD1,0x9E,0x35,0x24,0x26,0x28,0x9E,0x25,0x28,0x2A,0x2C,0x31,0xF2,0xFE,0xFE,0x1B,0x28,0x24,0x27,0x3C,0x3F,0x3F,0x3F,0x3F,0xFE,0xFE,0xD0,0xD0,0x10,0x32,0xF2,0xD0,0xD0,0xD0,0xD0,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x10,0x32,0xFF };
+static const u8 dialog_text_DIALOG_006[] = { 0x11,0x28,0x3C,0xF2,0xF2,0xF2,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x37,0x35,0x3C,0x9E,0x37,0x32,0x9E,0x36,0x26,0x24,0x30,0xFE,0x16,0x0E,0x3F,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x2A,0x32,0x37,0x37,0x24,0x9E,0x35,0x38,0x31,0xFE,0xD1,0x9E,0x3A,0x2B,0x32,0x2F,0x28,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3F,0xFE,0x15,0x24,0x37,0x28,0x35,0x3F,0x9E,0x15,0x32,0x32,0x2E,0x9E,0x30,0x28,0x9E,0x38,0x33,0x9E,0x3A,0x2B,0x28,0x31,0xFE,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x35,0x24,0x26,0x28,0x9E,0x29,0x32,0x35,0xFE,0x35,0x28,0x24,0x2F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_007[] = { 0x11,0x38,0x29,0x29,0x29,0x3F,0x3F,0x3F,0x29,0x29,0x29,0x3F,0x3F,0x3F,0x33,0x38,0x29,0x29,0x29,0x3F,0x3F,0x3F,0xFE,0x20,0x2B,0x32,0x24,0xF2,0x9E,0x22,0x32,0x38,0x3F,0x3F,0x3F,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x3F,0x3F,0x3F,0x24,0x35,0x28,0x3F,0x3F,0x3F,0xFE,0x29,0x24,0x36,0x37,0xF2,0x9E,0x0A,0x9E,0x2B,0x38,0x30,0x24,0x31,0x9E,0x25,0x2F,0x38,0x35,0xF2,0xFE,0x11,0x28,0x35,0x28,0x9E,0xD2,0x9E,0x2A,0x32,0x9F,0x9F,0xD2,0x3E,0x39,0x28,0x9E,0x3A,0x32,0x31,0xFE,0x2C,0x37,0x6F,0x9E,0x29,0x24,0x2C,0x35,0x9E,0x24,0x31,0x27,0x9E,0x36,0x34,0x38,0x24,0x35,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_008[] = { 0x0B,0x0E,0x20,0x0A,0x1B,0x0E,0x9E,0x18,0x0F,0x9E,0x0C,0x11,0x0A,0x12,0x17,0x9E,0x0C,0x11,0x18,0x16,0x19,0xFE,0x0E,0x3B,0x37,0x35,0x28,0x30,0x28,0x9E,0x0D,0x24,0x31,0x2A,0x28,0x35,0xF2,0xFE,0x10,0x28,0x37,0x9E,0x26,0x2F,0x32,0x36,0x28,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x56,0x50,0xFE,0x29,0x32,0x35,0x9E,0x24,0x9E,0x25,0x28,0x37,0x37,0x28,0x35,0x9E,0x2F,0x32,0x32,0x2E,0x3F,0xFE,0x1C,0x26,0x24,0x35,0x3C,0x6F,0x9E,0x2B,0x38,0x2B,0xF4,0xFE,0x1C,0x28,0x28,0x9E,0xD1,0x9E,0x1B,0x28,0x27,0x9E,0x0C,0x32,0x2C,0x31,0x9E,0x32,0x31,0x9E,0x37,0x32,0x33,0xFE,0x32,0x29,0x9E,0xD1,0x9E,0x36,0x37,0x24,0x2E,0x28,0xF4,0xFE,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0x28,0x2C,0x2A,0x2B,0x37,0x9E,0x32,0x29,0xFE,0xD1,0x30,0x6F,0x9E,0x24,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x24,0x33,0x33,0x28,0x24,0x35,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x30,0x28,0x24,0x27,0x32,0x3A,0xFE,0x24,0x26,0x35,0x32,0x36,0x36,0x9E,0xD1,0x9E,0x25,0x35,0x2C,0x27,0x2A,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_009[] = { 0x15,0x32,0x31,0x2A,0x9E,0x37,0x2C,0x30,0x28,0x6F,0x9E,0x31,0x32,0x9E,0x36,0x28,0x28,0xF2,0x9E,0x20,0x32,0x3A,0x6F,0xFE,0x2B,0x24,0x39,0x28,0x9E,0xD2,0x9E,0x2A,0x32,0x37,0x37,0x28,0x31,0x9E,0x29,0x24,0x36,0x37,0xF2,0xFE,0x11,0x24,0x39,0x28,0x9E,0xD2,0x9E,0x25,0x28,0x28,0x31,0x9E,0x37,0x35,0x24,0x2C,0x31,0x2C,0x31,0x2A,0xFE,0x32,0x31,0x9E,0xD1,0x9E,0x36,0x2F,0x3C,0x6F,0x9E,0x32,0x35,0x9E,0x2C,0x36,0x9E,0x2C,0x37,0x9E,0xD1,0xFE,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF4,0xFE,0x12,0x3E,0x39,0x28,0x9E,0x25,0x28,0x28,0x31,0x9E,0x29,0x28,0x28,0x2F,0x2C,0x31,0x2A,0x9E,0x27,0x32,0x3A,0x31,0xFE,0x24,0x25,0x32,0x38,0x37,0x9E,0x2F,0x32,0x36,0x2C,0x31,0x2A,0x9E,0xD1,0x9E,0x2F,0x24,0x36,0x37,0xFE,0x35,0x24,0x26,0x28,0x3F,0x9E,0x1D,0x2B,0x2C,0x36,0x9E,0x2C,0x36,0x9E,0x30,0x3C,0x9E,0x2B,0x32,0x30,0x28,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x9F,0x9F,0x2B,0x32,0x3A,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x24,0xFE,0x35,0x28,0x30,0x24,0x37,0x26,0x2B,0xF4,0xFE,0x1D,0x2B,0x28,0x9E,0x2A,0x32,0x24,0x2F,0x9E,0x2C,0x36,0x9E,0x2C,0x31,0xFE,0x20,0x2C,0x31,0x27,0x36,0x3A,0x28,0x33,0x37,0x9E,0x1F,0x24,0x2F,0x2F,0x28,0x3C,0x3F,0xFE,0x1B,0x28,0x24,0x27,0x3C,0xF4,0xFE,0xFE,0xD0,0xD0,0x10,0x32,0xD0,0xD0,0xD0,0xD0,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x10,0x32,0xFF };
+static const u8 dialog_text_DIALOG_010[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x36,0x37,0x28,0x33,0x33,0x28,0x27,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x3F,0x9E,0x20,0x28,0x24,0x35,0x2C,0x31,0x2A,0xFE,0xD1,0x9E,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0xFE,0x36,0x32,0x24,0x35,0x9E,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0x9E,0xD1,0x9E,0x36,0x2E,0x3C,0x3F,0xFE,0x17,0x32,0x3A,0x9E,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0x36,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x33,0x32,0x33,0xFE,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x24,0x2F,0x2F,0x9E,0xD1,0x9E,0x35,0x28,0x27,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x36,0xFE,0xD2,0x9E,0x29,0x2C,0x31,0x27,0x3F,0xFE,0xFE,0x20,0x32,0x38,0x2F,0x27,0x9E,0xD2,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x37,0x32,0x9E,0x1C,0x24,0x39,0x28,0xF4,0xFE,0xFE,0xD0,0xD0,0x22,0x28,0x36,0xD0,0xD0,0xD0,0xD0,0x17,0x32,0xFF };
+static const u8 dialog_text_DIALOG_011[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x36,0x37,0x28,0x33,0x33,0x28,0x27,0x9E,0x32,0x31,0xFE,0xD1,0x9E,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0xF2,0xFE,0x1D,0x2B,0x28,0x9E,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x33,0x9E,0x30,0x24,0x2E,0x28,0x36,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9E,0x2C,0x31,0x39,0x2C,0x31,0x26,0x2C,0x25,0x2F,0x28,0x3F,0xFE,0x17,0x32,0x3A,0x9E,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x33,0x36,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x33,0x32,0x33,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x2A,0x35,0x28,0x28,0x31,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x36,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x27,0x3F,0xFE,0xFE,0x20,0x32,0x38,0x2F,0x27,0x9E,0xD2,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x37,0x32,0x9E,0x1C,0x24,0x39,0x28,0xF4,0xFE,0xFE,0xD0,0xD0,0x22,0x28,0x36,0xD0,0xD0,0xD0,0xD0,0x17,0x32,0xFF };
+static const u8 dialog_text_DIALOG_012[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x36,0x37,0x28,0x33,0x33,0x28,0x27,0x9E,0x32,0x31,0xFE,0xD1,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x3F,0xFE,0x1D,0x2B,0x28,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0x9E,0x0C,0x24,0x33,0x9E,0x30,0x24,0x2E,0x28,0x36,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9E,0x27,0x2C,0x36,0x24,0x33,0x33,0x28,0x24,0x35,0x3F,0xFE,0x17,0x32,0x3A,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0x9E,0x0C,0x24,0x33,0x36,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x33,0x32,0x33,0xFE,0x29,0x35,0x32,0x30,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x25,0x2F,0x38,0x28,0xFE,0x25,0x2F,0x32,0x26,0x2E,0x36,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x27,0x3F,0xFE,0xFE,0x20,0x32,0x38,0x2F,0x27,0x9E,0xD2,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x37,0x32,0x9E,0x1C,0x24,0x39,0x28,0xF4,0xFE,0xFE,0xD0,0xD0,0x22,0x28,0x36,0xD0,0xD0,0xD0,0xD0,0x17,0x32,0xFF };
+static const u8 dialog_text_DIALOG_013[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x28,0x27,0x9E,0x01,0x00,0x00,0xFE,0x26,0x32,0x2C,0x31,0x36,0xF2,0x9E,0x16,0x24,0x35,0x2C,0x32,0x9E,0x2A,0x24,0x2C,0x31,0x36,0x9E,0x30,0x32,0x35,0x28,0xFE,0x33,0x32,0x3A,0x28,0x35,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFE,0x0D,0x32,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x1C,0x24,0x39,0x28,0xF4,0xFE,0xD0,0xD0,0x22,0x28,0x36,0xD0,0xD0,0xD0,0xD0,0x17,0x32,0xFF };
+static const u8 dialog_text_DIALOG_014[] = { 0x20,0x32,0x3A,0xF2,0x9E,0x0A,0x31,0x32,0xD1,0x35,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0xF2,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9E,0x2A,0x24,0x2C,0x31,0x36,0x9E,0x30,0x32,0x35,0x28,0x9E,0x26,0x32,0x38,0x35,0x24,0x2A,0x28,0xFE,0x29,0x35,0x32,0x30,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFE,0x0D,0x32,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x1C,0x24,0x39,0x28,0xF4,0xFE,0xFE,0xD0,0xD0,0x22,0x32,0x38,0x9E,0x0B,0x28,0x37,0xD0,0xD0,0x17,0x32,0x37,0x9E,0x17,0x32,0x3A,0xFF };
+static const u8 dialog_text_DIALOG_015[] = { 0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x33,0x38,0x31,0x26,0x2B,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0x9E,0x37,0x32,0xFE,0x2E,0x31,0x32,0x26,0x2E,0x9E,0xD1,0x30,0x9E,0x27,0x32,0x3A,0x31,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0xFE,0x37,0x32,0x9E,0x2D,0x38,0x30,0x33,0x6F,0x9E,0x55,0x9E,0x37,0x32,0x9E,0x33,0x38,0x31,0x26,0x2B,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0xD1,0x31,0x9E,0x55,0x9E,0x37,0x32,0x9E,0x14,0x2C,0x26,0x2E,0x3F,0xFE,0x1D,0x32,0x9E,0x33,0x2C,0x26,0x2E,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x38,0x33,0x6F,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0x55,0x6F,0x9E,0x37,0x32,0x32,0x3F,0x9E,0x1D,0x32,0x9E,0x37,0x2B,0x35,0x32,0x3A,0xFE,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x2B,0x32,0x2F,0x27,0x2C,0x31,0x2A,0x6F,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0x55,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_016[] = { 0x11,0x32,0x33,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x36,0x2B,0x2C,0x31,0x3C,0x9E,0x36,0x2B,0x28,0x2F,0x2F,0x9E,0x24,0x31,0x27,0xFE,0x35,0x2C,0x27,0x28,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x39,0x28,0x35,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0xFE,0x2A,0x32,0xF2,0x9E,0x1C,0x2B,0x35,0x28,0x27,0x9E,0x37,0x2B,0x32,0x36,0x28,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_017[] = { 0x12,0x3E,0x30,0x9E,0xD1,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x6F,0x9E,0x2F,0x32,0x35,0x27,0xFE,0x32,0x29,0x9E,0x24,0x2F,0x2F,0x9E,0x25,0x2F,0x24,0x36,0x37,0x2C,0x31,0x2A,0x9E,0x30,0x24,0x37,0x37,0x28,0x35,0x6F,0xFE,0x2E,0x2C,0x31,0x2A,0x9E,0x32,0x29,0x9E,0x2E,0x24,0x9F,0x25,0x32,0x32,0x30,0x36,0x9E,0xD1,0xFE,0x3A,0x32,0x35,0x2F,0x27,0x9E,0x32,0x39,0x28,0x35,0xF2,0xFE,0x11,0x32,0x3A,0x9E,0x27,0x24,0x35,0x28,0x9E,0xD2,0x9E,0x36,0x26,0x24,0x2F,0x28,0x9E,0x30,0x3C,0xFE,0x30,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0xF4,0x9E,0x0B,0x3C,0x9E,0x3A,0x2B,0x24,0x37,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0xFE,0x27,0x32,0x9E,0xD2,0x9E,0x36,0x28,0x37,0x9E,0x29,0x32,0x32,0x37,0x9E,0x32,0x31,0x9E,0x30,0x3C,0xFE,0x2C,0x30,0x33,0x28,0x35,0x2C,0x24,0x2F,0x9E,0x30,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0x37,0x32,0x33,0xF4,0xFE,0x22,0x32,0x38,0x9E,0x30,0x24,0x3C,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x28,0x2F,0x38,0x27,0x28,0x27,0x9E,0x30,0x3C,0xFE,0x2A,0x38,0x24,0x35,0x27,0x36,0x6F,0x9E,0x25,0x38,0x37,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x31,0x28,0x39,0x28,0x35,0xFE,0x28,0x36,0x26,0x24,0x33,0x28,0x9E,0x30,0x3C,0x9E,0x2A,0x35,0x24,0x36,0x33,0x3F,0x3F,0x3F,0xFE,0xFE,0x3F,0x3F,0x3F,0x24,0x31,0x27,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x31,0x28,0x39,0x28,0x35,0x9E,0x37,0x24,0x2E,0x28,0xFE,0x24,0x3A,0x24,0x3C,0x9E,0x30,0x3C,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x3F,0x9E,0x12,0xFE,0x2B,0x28,0x35,0x28,0x25,0x3C,0x9E,0x26,0x2B,0x24,0x2F,0x2F,0x28,0x31,0x2A,0x28,0x9E,0xD2,0x6F,0xFE,0x16,0x24,0x35,0x2C,0x32,0xF2,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x12,0xFE,0x2B,0x32,0x2F,0x27,0x6F,0x9E,0xD2,0x9E,0x30,0x38,0x36,0x37,0x9E,0x33,0x35,0x32,0x39,0x28,0xFE,0xD2,0x35,0x36,0x28,0x2F,0x29,0x9E,0x2C,0x31,0x9E,0x25,0x24,0x37,0x37,0x2F,0x28,0x3F,0xFE,0xFE,0x0C,0x24,0x31,0x9E,0xD2,0x9E,0x33,0x2C,0x26,0x2E,0x9E,0x30,0x28,0x9E,0x38,0x33,0x9E,0x29,0x35,0x32,0x30,0xFE,0xD1,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x38,0x35,0x2F,0x9E,0x30,0x28,0x9E,0x37,0x32,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x35,0x32,0x3C,0x24,0x2F,0x9E,0x37,0x38,0x35,0x29,0xF4,0x9E,0x12,0x9E,0x37,0x2B,0x2C,0x31,0x2E,0xFE,0x37,0x2B,0x24,0x37,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x31,0x32,0x37,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_018[] = { 0x12,0x3E,0x30,0x9E,0x36,0x2F,0x28,0x28,0x33,0x2C,0x31,0x2A,0x9E,0x25,0x28,0x26,0x24,0x38,0x36,0x28,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x12,0x3E,0x30,0x9E,0x36,0x2F,0x28,0x28,0x33,0x3C,0x3F,0x9E,0x12,0x9E,0x27,0x32,0x31,0x3E,0x37,0xFE,0x2F,0x2C,0x2E,0x28,0x9E,0x25,0x28,0x2C,0x31,0x2A,0x9E,0x27,0x2C,0x36,0x37,0x38,0x35,0x25,0x28,0x27,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x3A,0x24,0x2F,0x2E,0x9E,0x34,0x38,0x2C,0x28,0x37,0x2F,0x3C,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_019[] = { 0x1C,0x2B,0x2B,0x2B,0xF2,0x9E,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x3A,0x24,0x2F,0x2E,0xFE,0x34,0x38,0x2C,0x28,0x37,0x2F,0x3C,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x2B,0x24,0x2F,0x2F,0x3A,0x24,0x3C,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_020[] = { 0x0D,0x28,0x24,0x35,0x9E,0x16,0x24,0x35,0x2C,0x32,0xE6,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0x9E,0x12,0x3E,0x39,0x28,0x9E,0x25,0x24,0x2E,0x28,0x27,0xFE,0x24,0x9E,0x26,0x24,0x2E,0x28,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0xFE,0x22,0x32,0x38,0x35,0x36,0x9E,0x37,0x35,0x38,0x2F,0x3C,0x9F,0x9F,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x1D,0x32,0x24,0x27,0x36,0x37,0x32,0x32,0x2F,0xFF };
+static const u8 dialog_text_DIALOG_021[] = { 0x20,0x28,0x2F,0x26,0x32,0x30,0x28,0x3F,0xFE,0x17,0x32,0x9E,0x32,0x31,0x28,0x3E,0x36,0x9E,0x2B,0x32,0x30,0x28,0xF2,0xFE,0x17,0x32,0x3A,0x9E,0x36,0x26,0x35,0x24,0x30,0x9F,0x9F,0xFE,0x24,0x31,0x27,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x26,0x32,0x30,0x28,0x9E,0x25,0x24,0x26,0x2E,0xF2,0xFE,0x10,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_022[] = { 0x22,0x32,0x38,0x9E,0x31,0x28,0x28,0x27,0x9E,0x24,0x9E,0x2E,0x28,0x3C,0x9E,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x27,0x32,0x32,0x35,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_023[] = { 0x1D,0x2B,0x2C,0x36,0x9E,0x2E,0x28,0x3C,0x9E,0x27,0x32,0x28,0x36,0x31,0x3E,0x37,0x9E,0x29,0x2C,0x37,0xF2,0xFE,0x16,0x24,0x3C,0x25,0x28,0x9E,0x2C,0x37,0x3E,0x36,0x9E,0x29,0x32,0x35,0x9E,0xD1,0xFE,0x25,0x24,0x36,0x28,0x30,0x28,0x31,0x37,0x3F,0x3F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_024[] = { 0x22,0x32,0x38,0x9E,0x31,0x28,0x28,0x27,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x37,0x32,0xFE,0x32,0x33,0x28,0x31,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x27,0x32,0x32,0x35,0x3F,0x9E,0x1B,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0x24,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x29,0x35,0x32,0x30,0x9E,0x24,0x31,0x9E,0x28,0x31,0x28,0x30,0x3C,0xFE,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0x32,0x31,0x28,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3E,0x36,0xFE,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_025[] = { 0x12,0x37,0x9E,0x37,0x24,0x2E,0x28,0x36,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0x03,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x27,0x32,0x32,0x35,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x31,0x28,0x28,0x27,0x9E,0xE0,0x9E,0x30,0x32,0x35,0x28,0xFE,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_026[] = { 0x12,0x37,0x9E,0x37,0x24,0x2E,0x28,0x36,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0x08,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x27,0x32,0x32,0x35,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x31,0x28,0x28,0x27,0x9E,0xE0,0x9E,0x30,0x32,0x35,0x28,0xFE,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_027[] = { 0x12,0x37,0x9E,0x37,0x24,0x2E,0x28,0x36,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0x03,0x00,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x27,0x32,0x32,0x35,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x31,0x28,0x28,0x27,0x9E,0xE0,0x9E,0x30,0x32,0x35,0x28,0xFE,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_028[] = { 0x12,0x37,0x9E,0x37,0x24,0x2E,0x28,0x36,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0x05,0x00,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x27,0x32,0x32,0x35,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x31,0x28,0x28,0x27,0x9E,0xE0,0x9E,0x30,0x32,0x35,0x28,0xFE,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_029[] = { 0x1D,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x27,0x32,0x32,0x35,0x9E,0x37,0x2B,0x24,0x37,0xFE,0x2F,0x28,0x24,0x27,0x36,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0xF5,0x28,0x31,0x27,0x2F,0x28,0x36,0x36,0xF6,0xFE,0x36,0x37,0x24,0x2C,0x35,0x36,0x6F,0x9E,0xD2,0x9E,0x31,0x28,0x28,0x27,0x9E,0x07,0x00,0xFE,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFE,0x0B,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_030[] = { 0x11,0x28,0x2F,0x2F,0x32,0xF2,0x9E,0x1D,0x2B,0x28,0x9E,0x15,0x24,0x2E,0x2C,0x37,0x38,0x9E,0x0B,0x35,0x32,0x36,0x3F,0x6F,0xFE,0x26,0x38,0x37,0x37,0x2C,0x31,0x2A,0x9E,0x2C,0x31,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x24,0x9E,0x2F,0x2C,0x39,0x28,0xFE,0x38,0x33,0x27,0x24,0x37,0x28,0x9E,0x32,0x31,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3E,0x36,0xFE,0x33,0x35,0x32,0x2A,0x35,0x28,0x36,0x36,0x3F,0x9E,0x11,0x28,0x3E,0x36,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x37,0x32,0xFE,0x2F,0x28,0x24,0x35,0x31,0x9E,0x24,0x9E,0x37,0x28,0x26,0x2B,0x31,0x2C,0x34,0x38,0x28,0x9E,0x29,0x32,0x35,0xFE,0x36,0x31,0x28,0x24,0x2E,0x2C,0x31,0x2A,0x9E,0x38,0x33,0x9E,0x32,0x31,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0x3F,0xFE,0x1D,0x2B,0x28,0x9E,0x37,0x35,0x2C,0x26,0x2E,0x9E,0x2C,0x36,0x9E,0x37,0x2B,0x2C,0x36,0xE6,0x9E,0x11,0x28,0x9E,0x2B,0x24,0x36,0xFE,0x37,0x32,0x9E,0x3A,0x24,0x2F,0x2E,0x9E,0x39,0x28,0x35,0x3C,0x9E,0x36,0x2F,0x32,0x3A,0x2F,0x3C,0x9E,0x2C,0x31,0xFE,0x32,0x35,0x27,0x28,0x35,0x9E,0x37,0x32,0x9E,0x3A,0x24,0x2F,0x2E,0x9E,0x34,0x38,0x2C,0x28,0x37,0x2F,0x3C,0x3F,0xFE,0xFE,0xFE,0xFE,0x0A,0x31,0x27,0x9E,0x3A,0x35,0x24,0x33,0x33,0x2C,0x31,0x2A,0x9E,0x38,0x33,0x9E,0x29,0x2C,0x2F,0x30,0x2C,0x31,0x2A,0xFE,0x37,0x28,0x26,0x2B,0x31,0x2C,0x34,0x38,0x28,0x36,0x9E,0x35,0x28,0x33,0x32,0x35,0x37,0x28,0x27,0x9E,0x32,0x31,0xFE,0x28,0x24,0x35,0x2F,0x2C,0x28,0x35,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x24,0xFE,0x2F,0x32,0x32,0x2E,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x38,0x36,0x2C,0x31,0x2A,0x9E,0x56,0x53,0x9E,0x24,0x31,0x27,0xFE,0x56,0x52,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0x56,0x51,0x9E,0x37,0x32,0x9E,0x39,0x2C,0x28,0x3A,0x9E,0xD1,0xFE,0x24,0x26,0x37,0x2C,0x32,0x31,0x9E,0x29,0x35,0x32,0x30,0x9E,0x24,0x9E,0x27,0x2C,0x36,0x37,0x24,0x31,0x26,0x28,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x30,0x32,0x39,0x28,0x9E,0xD1,0xFE,0x26,0x24,0x30,0x28,0x35,0x24,0x9E,0x24,0x31,0x3C,0x9E,0x29,0x24,0x35,0xD1,0x35,0x6F,0x9E,0xD1,0xFE,0x25,0x38,0x3D,0x3D,0x28,0x35,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x36,0x32,0x38,0x31,0x27,0x3F,0x9E,0x1D,0x2B,0x2C,0x36,0x9E,0x2C,0x36,0xFE,0xD1,0x9E,0x15,0x24,0x2E,0x2C,0x37,0x38,0x9E,0x0B,0x35,0x32,0x36,0x3F,0x6F,0xFE,0x36,0x2C,0x2A,0x31,0x2C,0x31,0x2A,0x9E,0x32,0x29,0x29,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_031[] = { 0x17,0x32,0x9E,0x3A,0x24,0x3C,0xF2,0x9E,0x22,0x32,0x38,0x9E,0x25,0x28,0x24,0x37,0x9E,0x30,0x28,0x3F,0x3F,0x3F,0xFE,0x24,0x2A,0x24,0x2C,0x31,0xF2,0xF2,0x9E,0x0A,0x31,0x27,0x9E,0x12,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x36,0x33,0x28,0x31,0x37,0xFE,0x30,0x3C,0x9E,0x28,0x31,0x37,0x2C,0x35,0x28,0x9E,0x36,0x24,0x39,0x2C,0x31,0x2A,0x36,0x9E,0x32,0x31,0xFE,0xD1,0x36,0x28,0x9E,0x31,0x28,0x3A,0x9E,0x14,0x32,0x32,0x33,0x24,0xFE,0x16,0x24,0x26,0x2B,0x9E,0x01,0x9E,0x1C,0x33,0x35,0x2C,0x31,0x37,0x9E,0x36,0x2B,0x32,0x28,0x36,0xF2,0xFE,0x11,0x28,0x35,0x28,0x6F,0x9E,0x12,0x9E,0x2A,0x38,0x28,0x36,0x36,0x9E,0x12,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0xFE,0x2B,0x24,0x31,0x27,0x9E,0x32,0x39,0x28,0x35,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x37,0x32,0xFE,0xD1,0x9E,0x3A,0x2C,0x31,0x31,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x35,0x24,0x26,0x28,0x3F,0xFE,0x0C,0x32,0x31,0x2A,0x35,0x24,0x37,0x36,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_032[] = { 0x12,0x29,0x9E,0xD2,0x9E,0x2A,0x28,0x37,0x9E,0xD1,0x9E,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0x6F,0xFE,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x29,0x2F,0x3C,0xF2,0x9E,0x19,0x38,0x37,0x9E,0xD1,0x9E,0x26,0x24,0x33,0xFE,0x32,0x31,0x6F,0x9E,0xD1,0x31,0x9E,0x27,0x32,0x9E,0x24,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0xFE,0x13,0x38,0x30,0x33,0x9F,0x9F,0x2D,0x38,0x30,0x33,0x9E,0x37,0x2B,0x35,0x28,0x28,0x9E,0x37,0x2C,0x30,0x28,0x36,0xFE,0x2C,0x31,0x9E,0x24,0x9E,0x35,0x32,0x3A,0x9F,0x9F,0x37,0x32,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x32,0x29,0x29,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x29,0x2F,0x3C,0x9E,0x28,0x39,0x28,0x31,0x9E,0x2B,0x2C,0x2A,0x2B,0x28,0x35,0xFE,0x2C,0x29,0x9E,0xD2,0x9E,0x25,0x2F,0x24,0x36,0x37,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x24,0xFE,0x26,0x24,0x31,0x31,0x32,0x31,0x9E,0x3A,0x28,0x24,0x35,0x2C,0x31,0x2A,0x9E,0xD1,0xFE,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0xF2,0xFE,0xFE,0x1E,0x36,0x28,0x9E,0xD1,0x9E,0x56,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x36,0x9E,0x37,0x32,0x9E,0x2F,0x32,0x32,0x2E,0xFE,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0x9E,0x29,0x2F,0x3C,0x2C,0x31,0x2A,0x6F,0x9E,0x24,0x31,0x27,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x9E,0x37,0x32,0x9E,0x2F,0x24,0x31,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_033[] = { 0x0C,0x2C,0x24,0x32,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x24,0x26,0x2B,0x28,0x27,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x1D,0x32,0x24,0x27,0x36,0x37,0x32,0x32,0x2F,0x3E,0x36,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x9E,0x39,0x2C,0x24,0x9E,0x24,0x9E,0x3A,0x24,0x35,0x33,0x9E,0x33,0x2C,0x33,0x28,0x3F,0xFE,0x1E,0x36,0x2C,0x31,0x2A,0x9E,0xD1,0x9E,0x26,0x32,0x31,0x37,0x35,0x32,0x2F,0x2F,0x28,0x35,0x9E,0x2C,0x36,0x9E,0x24,0xFE,0x33,0x2C,0x28,0x26,0x28,0x9E,0x32,0x29,0x9E,0x26,0x24,0x2E,0x28,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x24,0x31,0x27,0x9E,0x55,0x9E,0x37,0x32,0x9E,0x24,0x37,0x37,0x24,0x26,0x2E,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x55,0x9E,0x37,0x32,0x9E,0x35,0x28,0x24,0x27,0x9E,0x36,0x2C,0x2A,0x31,0x36,0x6F,0xFE,0x37,0x32,0x32,0x3F,0x9E,0x1E,0x36,0x28,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0xFE,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x28,0x31,0x37,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x26,0x32,0x31,0x37,0x35,0x32,0x2F,0x2F,0x28,0x35,0x9E,0x37,0x32,0x9E,0x30,0x32,0x39,0x28,0x9E,0x16,0x24,0x35,0x2C,0x32,0xFE,0x24,0x35,0x32,0x38,0x31,0x27,0x3F,0x9E,0x17,0x32,0x3A,0x6F,0x9E,0x2B,0x28,0x24,0x27,0x9E,0x29,0x32,0x35,0xFE,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_034[] = { 0x10,0x32,0x32,0x27,0x9E,0x24,0x29,0x37,0x28,0x35,0x31,0x32,0x32,0x31,0x3F,0x9E,0x1D,0x2B,0x28,0xFE,0x15,0x24,0x2E,0x2C,0x37,0x38,0x9E,0x0B,0x35,0x32,0x36,0x3F,0x6F,0x9E,0x2B,0x28,0x35,0x28,0x6F,0xFE,0x35,0x28,0x33,0x32,0x35,0x37,0x2C,0x31,0x2A,0x9E,0x2F,0x2C,0x39,0x28,0x9E,0x29,0x35,0x32,0x30,0x9E,0x2D,0x38,0x36,0x37,0xFE,0x32,0x38,0x37,0x36,0x2C,0x27,0x28,0x9E,0xD1,0x9E,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x3E,0x36,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFE,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9E,0x2B,0x24,0x36,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x35,0x35,0x2C,0x39,0x28,0x27,0xFE,0x32,0x31,0x9E,0xD1,0x9E,0x36,0x26,0x28,0x31,0x28,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x3A,0x28,0x3E,0x2F,0x2F,0xFE,0x25,0x28,0x9E,0x29,0x2C,0x2F,0x30,0x2C,0x31,0x2A,0x9E,0xD1,0x9E,0x24,0x26,0x37,0x2C,0x32,0x31,0x9E,0x2F,0x2C,0x39,0x28,0xFE,0x24,0x36,0x9E,0x2B,0x28,0x9E,0x28,0x31,0x37,0x28,0x35,0x36,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0xFE,0x24,0x31,0x27,0x9E,0x33,0x38,0x35,0x36,0x38,0x28,0x36,0x9E,0xD1,0x9E,0x30,0x2C,0x36,0x36,0x2C,0x31,0x2A,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFE,0x0A,0x36,0x9E,0x36,0x28,0x24,0x36,0x32,0x31,0x28,0x27,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x30,0x28,0x31,0x6F,0xFE,0x3A,0x28,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x36,0x2B,0x32,0x32,0x37,0x2C,0x31,0x2A,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD1,0xFE,0x35,0x28,0x26,0x32,0x30,0x30,0x28,0x31,0x27,0x28,0x27,0x9E,0x24,0x31,0x2A,0x2F,0x28,0x6F,0x9E,0x25,0x38,0x37,0xFE,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x26,0x2B,0x24,0x31,0x2A,0x28,0x9E,0xD1,0xFE,0x26,0x24,0x30,0x28,0x35,0x24,0x9E,0x24,0x31,0x2A,0x2F,0x28,0x9E,0x25,0x3C,0x9E,0x33,0x35,0x28,0x36,0x36,0x2C,0x31,0x2A,0xFE,0xD1,0x9E,0x56,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x36,0x3F,0xFE,0x12,0x29,0x9E,0x3A,0x28,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x24,0x27,0x2D,0x38,0x36,0x37,0x9E,0xD1,0xFE,0x39,0x2C,0x28,0x3A,0x9E,0x24,0x31,0x3C,0x9E,0x29,0x38,0x35,0xD1,0x35,0x6F,0x9E,0x3A,0x28,0x3E,0x2F,0x2F,0xFE,0x25,0x38,0x3D,0x3D,0x3F,0x9E,0x1D,0x32,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x24,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x24,0x37,0xFE,0xD1,0x9E,0x36,0x38,0x35,0x35,0x32,0x38,0x31,0x27,0x2C,0x31,0x2A,0x36,0x6F,0x9E,0x36,0x37,0x32,0x33,0xFE,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x56,0x50,0x3F,0xFE,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x35,0x28,0x36,0x38,0x30,0x28,0x9E,0x33,0x2F,0x24,0x3C,0x3F,0xFE,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x9E,0x30,0x32,0x27,0x28,0x36,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0xD1,0x9E,0x58,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x3F,0x9E,0x1C,0x2C,0x2A,0x31,0x36,0x9E,0x24,0x2F,0x32,0x31,0x2A,0xFE,0xD1,0x9E,0x3A,0x24,0x3C,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x35,0x28,0x39,0x2C,0x28,0x3A,0x9E,0xD1,0x36,0x28,0xFE,0x2C,0x31,0x36,0x37,0x35,0x38,0x26,0x37,0x2C,0x32,0x31,0x36,0x3F,0xFE,0xFE,0x0F,0x32,0x35,0x9E,0x31,0x32,0x3A,0x6F,0x9E,0x35,0x28,0x33,0x32,0x35,0x37,0x2C,0x31,0x2A,0x9E,0x2F,0x2C,0x39,0x28,0x6F,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x2B,0x24,0x36,0x9E,0x25,0x28,0x28,0x31,0x9E,0xD1,0xFE,0x15,0x24,0x2E,0x2C,0x37,0x38,0x9E,0x0B,0x35,0x32,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_035[] = { 0x1D,0x2B,0x28,0x35,0x28,0x9E,0x24,0x35,0x28,0x9E,0x29,0x32,0x38,0x35,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x6F,0x9E,0x32,0x35,0xFE,0xF5,0x56,0x6F,0xF6,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x36,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0x56,0x50,0xFE,0x37,0x32,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x38,0x36,0x2C,0x31,0x2A,0x9E,0xD1,0xFE,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x3F,0xFE,0xFE,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x38,0x36,0x38,0x24,0x2F,0x2F,0x3C,0x9E,0x36,0x28,0x28,0x9E,0x16,0x24,0x35,0x2C,0x32,0xFE,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0x9E,0x15,0x24,0x2E,0x2C,0x37,0x38,0x3E,0x36,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x3F,0xFE,0x12,0x37,0x9E,0x2C,0x36,0x9E,0xD1,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0xFE,0x35,0x28,0x26,0x32,0x30,0x30,0x28,0x31,0x27,0x28,0x27,0x9E,0x29,0x32,0x35,0x9E,0x31,0x32,0x35,0x30,0x24,0x2F,0xFE,0x33,0x2F,0x24,0x3C,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x26,0x2B,0x24,0x31,0x2A,0x28,0x9E,0x24,0x31,0x2A,0x2F,0x28,0x36,0x9E,0x25,0x3C,0xFE,0x33,0x35,0x28,0x36,0x36,0x2C,0x31,0x2A,0x9E,0x56,0x53,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x33,0x35,0x28,0x36,0x36,0xFE,0x58,0x6F,0x9E,0xD1,0x9E,0x39,0x2C,0x28,0x3A,0x9E,0x36,0x3A,0x2C,0x37,0x26,0x2B,0x28,0x36,0x9E,0x37,0x32,0xFE,0x16,0x24,0x35,0x2C,0x32,0x3E,0x36,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x6F,0x9E,0x3A,0x2B,0x2C,0x26,0x2B,0xFE,0x2C,0x36,0x9E,0x27,0x2C,0x35,0x28,0x26,0x37,0x2F,0x3C,0x9E,0x25,0x28,0x2B,0x2C,0x31,0x27,0x9E,0x2B,0x2C,0x30,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x58,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x9E,0x37,0x32,0x9E,0x35,0x28,0x37,0x38,0x35,0x31,0xFE,0x37,0x32,0x9E,0x15,0x24,0x2E,0x2C,0x37,0x38,0x3E,0x36,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0xFE,0x56,0x51,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0x9E,0x16,0x24,0x35,0x2C,0x32,0x9E,0x29,0x35,0x32,0x30,0xFE,0x24,0x29,0x24,0x35,0x6F,0x9E,0x38,0x36,0x2C,0x31,0x2A,0x9E,0x28,0x2C,0xD1,0x35,0xFE,0x15,0x24,0x2E,0x2C,0x37,0x38,0x3E,0x36,0x9E,0x32,0x35,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3E,0x36,0x9E,0x39,0x2C,0x28,0x3A,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_036[] = { 0x18,0x0B,0x1C,0x0E,0x1B,0x1F,0x0A,0x1D,0x12,0x18,0x17,0x9E,0x19,0x15,0x0A,0x1D,0x0F,0x18,0x1B,0x16,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x56,0x50,0x9E,0x37,0x32,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x24,0x9E,0x2F,0x32,0x32,0x2E,0xFE,0x24,0x35,0x32,0x38,0x31,0x27,0x3F,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x30,0x2C,0x36,0x36,0xFE,0x24,0x31,0x3C,0x37,0x2B,0x2C,0x31,0x2A,0xF2,0xFE,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x58,0x9E,0x37,0x32,0x9E,0x36,0x3A,0x2C,0x37,0x26,0x2B,0x9E,0x37,0x32,0xFE,0x16,0x24,0x35,0x2C,0x32,0x3E,0x36,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x3F,0x9E,0x12,0x37,0xFE,0x24,0x2F,0x3A,0x24,0x3C,0x36,0x9E,0x29,0x32,0x2F,0x2F,0x32,0x3A,0x36,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x58,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x9E,0x37,0x32,0x9E,0x36,0x3A,0x2C,0x37,0x26,0x2B,0xFE,0x37,0x32,0x9E,0x15,0x24,0x2E,0x2C,0x37,0x38,0x3E,0x36,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x3F,0xFE,0x19,0x24,0x38,0x36,0x28,0x9E,0xD1,0x9E,0x2A,0x24,0x30,0x28,0x9E,0x24,0x31,0x27,0xFE,0x36,0x3A,0x2C,0x37,0x26,0x2B,0x9E,0xD1,0x9E,0x30,0x32,0x27,0x28,0x9E,0x37,0x32,0x9E,0xF5,0x29,0x2C,0x3B,0xF6,0xFE,0xD1,0x9E,0x26,0x24,0x30,0x28,0x35,0x24,0x9E,0x2C,0x31,0x9E,0x33,0x2F,0x24,0x26,0x28,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0xFE,0x2B,0x32,0x2F,0x27,0x2C,0x31,0x2A,0x9E,0x58,0x3F,0x9E,0x10,0x2C,0x39,0x28,0x9E,0x2C,0x37,0x9E,0x24,0x9E,0x37,0x35,0x3C,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_037[] = { 0x12,0x9E,0x3A,0x2C,0x31,0xF2,0x9E,0x22,0x32,0x38,0x9E,0x2F,0x32,0x36,0x28,0xF2,0xFE,0x11,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFE,0x22,0x32,0x38,0x3E,0x35,0x28,0x9E,0x31,0x32,0x9E,0x36,0x2F,0x32,0x38,0x26,0x2B,0x6F,0x9E,0x25,0x38,0x37,0x9E,0x12,0x3E,0x30,0xFE,0x24,0x9E,0x25,0x28,0x37,0x37,0x28,0x35,0x9E,0x36,0x2F,0x28,0x27,0x27,0x28,0x35,0xF2,0xFE,0x0B,0x28,0x37,0x37,0x28,0x35,0x9E,0x2F,0x38,0x26,0x2E,0x9E,0x31,0x28,0x3B,0x37,0x9E,0x37,0x2C,0x30,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_038[] = { 0x1B,0x28,0x24,0x26,0x37,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0xFE,0x33,0x32,0x3A,0x28,0x35,0x6F,0x9E,0xD1,0x9E,0x27,0x32,0x32,0x35,0x9E,0x36,0x2F,0x32,0x3A,0x2F,0x3C,0xFE,0x32,0x33,0x28,0x31,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_039[] = { 0x17,0x32,0x9E,0x39,0x2C,0x36,0x2C,0x37,0x32,0x35,0x36,0x9E,0x24,0x2F,0x2F,0x32,0x3A,0x28,0x27,0x6F,0xFE,0x25,0x3C,0x9E,0x27,0x28,0x26,0x35,0x28,0x28,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0xFE,0xFE,0x12,0x9E,0x36,0x2B,0x24,0x2F,0x2F,0x9E,0x31,0x28,0x39,0x28,0x35,0x9E,0x36,0x38,0x35,0x35,0x28,0x31,0x27,0x28,0x35,0x9E,0x30,0x3C,0xFE,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x29,0x32,0x35,0x9E,0xD1,0x3C,0x9E,0x2B,0x32,0x2F,0x27,0x9E,0xD1,0xFE,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x9E,0x2C,0x31,0xFE,0xD1,0x2C,0x35,0x9E,0x2A,0x2F,0x32,0x3A,0x3F,0xFE,0x1D,0x2B,0x28,0x3C,0x9E,0x3A,0x28,0x35,0x28,0x9E,0x24,0x9E,0x2A,0x2C,0x29,0x37,0x9E,0x29,0x35,0x32,0x30,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x6F,0x9E,0xD1,0x9E,0x14,0x32,0x32,0x33,0x24,0x9E,0x14,0x2C,0x31,0x2A,0xFE,0x2B,0x2C,0x30,0x36,0x28,0x2F,0x29,0x6F,0x9E,0x24,0x31,0x27,0x9E,0xD1,0x3C,0x9E,0x2F,0x2C,0x28,0x9E,0x3A,0x28,0x2F,0x2F,0xFE,0x2B,0x2C,0x27,0x27,0x28,0x31,0x9E,0x3A,0x2C,0x37,0x2B,0x2C,0x31,0x9E,0x30,0x3C,0x9E,0x35,0x28,0x24,0x2F,0x30,0x3F,0xFE,0x17,0x32,0x37,0x9E,0x24,0x9E,0x3A,0x2B,0x2C,0x36,0x33,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0x2C,0x35,0xFE,0x3A,0x2B,0x28,0x35,0x28,0x24,0x25,0x32,0x38,0x37,0x36,0x9E,0x36,0x2B,0x24,0x2F,0x2F,0x9E,0x2F,0x28,0x24,0x39,0x28,0xFE,0x30,0x3C,0x9E,0x2F,0x2C,0x33,0x36,0x3F,0x9E,0x18,0x2B,0x6F,0x9E,0x24,0x2F,0x2F,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x6F,0xFE,0x33,0x28,0x35,0x2B,0x24,0x33,0x36,0x9E,0x32,0x31,0x28,0x9E,0x2B,0x2C,0x31,0x37,0xE6,0xFE,0x11,0x28,0x28,0x27,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x31,0x24,0x30,0x28,0x36,0x9E,0x24,0x37,0xFE,0xD1,0x9E,0x25,0x28,0x2A,0x2C,0x31,0x31,0x2C,0x31,0x2A,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x3F,0xFE,0xD0,0xD0,0x9F,0x9F,0x1D,0x2B,0x28,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0xFF };
+static const u8 dialog_text_DIALOG_040[] = { 0x20,0x24,0x35,0x31,0x2C,0x31,0x2A,0xF2,0xFE,0x0C,0x32,0x2F,0x27,0x6F,0x9E,0x0C,0x32,0x2F,0x27,0x9E,0x0C,0x35,0x28,0x39,0x24,0x36,0x36,0x28,0xFE,0x0B,0x28,0x2F,0x32,0x3A,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_041[] = { 0x12,0x9E,0x3A,0x2C,0x31,0xF2,0x9E,0x22,0x32,0x38,0x9E,0x2F,0x32,0x36,0x28,0xF2,0xFE,0x11,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFE,0xFE,0x1D,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x3A,0x2B,0x24,0x37,0x9E,0xD2,0x9E,0x2A,0x28,0x37,0x9E,0x29,0x32,0x35,0xFE,0x30,0x28,0x36,0x36,0x2C,0x31,0x3E,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x14,0x32,0x32,0x33,0x24,0x9E,0xD1,0xFE,0x1A,0x38,0x2C,0x26,0x2E,0x3F,0xFE,0x0B,0x28,0x37,0x37,0x28,0x35,0x9E,0x2F,0x38,0x26,0x2E,0x9E,0x31,0x28,0x3B,0x37,0x9E,0x37,0x2C,0x30,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_042[] = { 0x0C,0x24,0x38,0x37,0x2C,0x32,0x31,0xF2,0x9E,0x17,0x24,0x35,0x35,0x32,0x3A,0x9E,0x0B,0x35,0x2C,0x27,0x2A,0x28,0xF2,0xFE,0x0C,0x35,0x32,0x36,0x36,0x9E,0x36,0x2F,0x32,0x3A,0x2F,0x3C,0xF2,0xFE,0xFE,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x28,0x27,0x2A,0x28,0xFE,0x32,0x29,0x9E,0xD1,0x9E,0x26,0x2F,0x2C,0x29,0x29,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x24,0x31,0x2A,0x9E,0x32,0x31,0x6F,0xFE,0x24,0x31,0x27,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x26,0x2F,0x2C,0x30,0x25,0x9E,0x32,0x29,0x29,0x9E,0xD1,0xFE,0x28,0x27,0x2A,0x28,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x30,0x32,0x39,0x28,0x9E,0x36,0x2F,0x32,0x3A,0x2F,0x3C,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x2F,0x28,0x37,0x9E,0x2A,0x32,0x6F,0xFE,0x28,0x2C,0xD1,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x9E,0x32,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0xFE,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x27,0x2C,0x35,0x28,0x26,0x37,0x2C,0x32,0x31,0x9E,0x32,0x29,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3E,0x36,0x9E,0x25,0x24,0x26,0x2E,0x3F,0xFE,0x1D,0x32,0x9E,0x26,0x2F,0x2C,0x30,0x25,0x9E,0x38,0x33,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x1E,0x33,0x9E,0x32,0x31,0xFE,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x3F,0x9E,0x1D,0x32,0xFE,0x36,0x26,0x38,0x35,0x35,0x3C,0x9E,0x38,0x33,0x9E,0x34,0x38,0x2C,0x26,0x2E,0x2F,0x3C,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0xFE,0xD1,0x9E,0x54,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_043[] = { 0x12,0x29,0x9E,0xD2,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x32,0x2F,0x27,0x9E,0xD1,0xFE,0x54,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x2B,0x24,0x31,0x2A,0x9E,0x32,0x31,0xFE,0x37,0x32,0x9E,0x36,0x32,0x30,0x28,0x9E,0x32,0x25,0x2D,0x28,0x26,0x37,0x36,0x9E,0x32,0x39,0x28,0x35,0x2B,0x28,0x24,0x27,0x3F,0xFE,0x12,0x37,0x3E,0x36,0x9E,0xD1,0x9E,0x36,0x24,0x30,0x28,0x9E,0x24,0x36,0x9E,0x2A,0x35,0x24,0x25,0x25,0x2C,0x31,0x2A,0xFE,0x24,0x9E,0x29,0x2F,0x3C,0x2C,0x31,0x2A,0x9E,0x25,0x2C,0x35,0x27,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_044[] = { 0x20,0x2B,0x32,0x32,0x32,0x3E,0x36,0x9E,0xD1,0x35,0x28,0xF4,0x9E,0x20,0x2B,0x32,0x32,0x32,0xFE,0x3A,0x32,0x2E,0x28,0x9E,0x30,0x28,0x9E,0x38,0x33,0xF4,0x9E,0x12,0x37,0x3E,0x36,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0xFE,0x27,0x24,0x3C,0x2F,0x2C,0x2A,0x2B,0x37,0x9F,0x9F,0x12,0x9E,0x36,0x2B,0x32,0x38,0x2F,0x27,0x9E,0x25,0x28,0xFE,0x36,0x2F,0x28,0x28,0x33,0x2C,0x31,0x2A,0xF2,0xFE,0xFE,0x11,0x28,0x3C,0x6F,0x9E,0x24,0x36,0x9E,0x2F,0x32,0x31,0x2A,0x9E,0x24,0x36,0x9E,0x12,0x3E,0x30,0xFE,0x24,0x3A,0x24,0x2E,0x28,0x6F,0x9E,0x3A,0x2B,0x3C,0x9E,0x31,0x32,0x37,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x24,0xFE,0x36,0x2B,0x32,0x35,0x37,0x9E,0x29,0x2F,0x2C,0x2A,0x2B,0x37,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x30,0x28,0xF4,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x32,0x2F,0x27,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x2A,0x35,0x24,0x25,0xFE,0x32,0x31,0x3F,0x9E,0x1B,0x28,0x2F,0x28,0x24,0x36,0x28,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x2F,0x28,0x37,0x9E,0x2A,0x32,0x3F,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x37,0x24,0x2E,0x28,0x9E,0xD2,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x39,0x28,0x35,0xFE,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x2A,0x32,0x6F,0x9E,0x24,0x36,0x9E,0x2F,0x32,0x31,0x2A,0xFE,0x24,0x36,0x9E,0x30,0x3C,0x9E,0x3A,0x2C,0x31,0x2A,0x36,0x9E,0x2B,0x32,0x2F,0x27,0x9E,0x32,0x38,0x37,0x3F,0xFE,0x20,0x24,0x37,0x26,0x2B,0x9E,0x30,0x3C,0x9E,0x36,0x2B,0x24,0x27,0x32,0x3A,0x6F,0x9E,0x24,0x31,0x27,0xFE,0x2A,0x35,0x24,0x25,0x9E,0x32,0x31,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_045[] = { 0x20,0x2B,0x28,0x3A,0xF2,0x9E,0x12,0x3E,0x30,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x25,0x32,0x38,0x37,0xFE,0x29,0x2F,0x24,0x33,0x33,0x28,0x27,0x9E,0x32,0x38,0x37,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x36,0x2B,0x32,0x38,0x2F,0x27,0xFE,0x2F,0x24,0x3C,0x9E,0x32,0x29,0x29,0x9E,0xD1,0x9E,0x33,0x24,0x36,0x37,0x24,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0xFE,0x1D,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x2C,0x37,0x9E,0x29,0x32,0x35,0x9E,0x31,0x32,0x3A,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0xFE,0x54,0x9E,0x37,0x32,0x9E,0x2F,0x28,0x37,0x9E,0x2A,0x32,0x3F,0x9E,0x18,0x2E,0x24,0x3C,0x6F,0xFE,0x25,0x3C,0x28,0x9E,0x25,0x3C,0x3C,0x3C,0x3C,0x3C,0x3C,0x28,0x28,0x28,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_046[] = { 0x22,0x32,0x38,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x30,0x24,0x36,0x37,0x28,0x35,0x9E,0x37,0x2B,0x35,0x28,0x28,0xFE,0x2C,0x30,0x33,0x32,0x35,0x37,0x24,0x31,0x37,0x9E,0x2D,0x38,0x30,0x33,0x2C,0x31,0x2A,0xFE,0x37,0x28,0x26,0x2B,0x31,0x2C,0x34,0x38,0x28,0x36,0x3F,0xFE,0x0F,0x2C,0x35,0x36,0x37,0x9E,0x37,0x35,0x3C,0x9E,0xD1,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0x9E,0x13,0x38,0x30,0x33,0x3F,0xFE,0xFE,0x1B,0x38,0x31,0x9E,0x29,0x24,0x36,0x37,0x6F,0x9E,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x37,0x2B,0x35,0x28,0x28,0xFE,0x37,0x2C,0x30,0x28,0x36,0x6F,0x9E,0x32,0x31,0x28,0x6F,0x9E,0x37,0x3A,0x32,0x6F,0x9E,0x37,0x2B,0x35,0x28,0x28,0x3F,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x37,0x2C,0x30,0x28,0x9E,0xD1,0x9E,0x2D,0x38,0x30,0x33,0x36,0xFE,0x35,0x2C,0x2A,0x2B,0x37,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x2B,0x32,0x33,0x6F,0x9E,0x36,0x2E,0x2C,0x33,0x6F,0xFE,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x2B,0x2C,0x2A,0x2B,0x3F,0xFE,0x17,0x28,0x3B,0x37,0x6F,0x9E,0x2A,0x32,0x9E,0x29,0x32,0x35,0x9E,0x27,0x2C,0x36,0x37,0x24,0x31,0x26,0x28,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0x9E,0x15,0x32,0x31,0x2A,0x9E,0x13,0x38,0x30,0x33,0x3F,0x9E,0x1B,0x38,0x31,0x6F,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x9E,0x37,0x32,0x9E,0x26,0x35,0x32,0x38,0x26,0x2B,0x9E,0xD1,0x31,0x9E,0x54,0xFE,0x37,0x32,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x29,0x24,0x35,0x3F,0xFE,0xFE,0x1D,0x32,0x9E,0x27,0x32,0x9E,0xD1,0x9E,0x20,0x24,0x2F,0x2F,0x9E,0x14,0x2C,0x26,0x2E,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0xFE,0x54,0x9E,0x37,0x32,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x24,0x37,0x9E,0x24,0x9E,0x3A,0x24,0x2F,0x2F,0x6F,0x9E,0xD1,0x31,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x2B,0x2C,0x37,0xFE,0xD1,0x9E,0x3A,0x24,0x2F,0x2F,0x3F,0xFE,0xFE,0x10,0x32,0x37,0x9E,0x37,0x2B,0x24,0x37,0xF4,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0x9E,0x13,0x38,0x30,0x33,0x6F,0xFE,0x15,0x32,0x31,0x2A,0x9E,0x13,0x38,0x30,0x33,0x6F,0x9E,0x20,0x24,0x2F,0x2F,0x9E,0x14,0x2C,0x26,0x2E,0x3F,0xFE,0x19,0x35,0x24,0x26,0x37,0x2C,0x26,0x28,0x6F,0x9E,0x33,0x35,0x24,0x26,0x37,0x2C,0x26,0x28,0x6F,0xFE,0x33,0x35,0x24,0x26,0x37,0x2C,0x26,0x28,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x36,0x37,0x24,0x31,0x27,0xFE,0x24,0x9E,0x26,0x2B,0x24,0x31,0x26,0x28,0x9E,0x3A,0x2C,0x37,0x2B,0x32,0x38,0x37,0x9E,0xD1,0x30,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_047[] = { 0x11,0x2C,0xF2,0x9E,0x12,0x3E,0x2F,0x2F,0x9E,0x33,0x35,0x28,0x33,0x24,0x35,0x28,0x9E,0xD1,0xFE,0x26,0x24,0x31,0x31,0x32,0x31,0x9E,0x29,0x32,0x35,0x9E,0xD2,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_048[] = { 0x1C,0x31,0x32,0x3A,0x9E,0x16,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0x9E,0x1C,0x38,0x30,0x30,0x2C,0x37,0xFE,0x20,0x24,0x37,0x26,0x2B,0x9E,0x29,0x32,0x35,0x9E,0x36,0x2F,0x2C,0x33,0x33,0x28,0x35,0x3C,0xFE,0x26,0x32,0x31,0x27,0x2C,0x37,0x2C,0x32,0x31,0x36,0xF2,0x9E,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x28,0x31,0x37,0x28,0x35,0xFE,0xD1,0x9E,0x26,0x32,0x37,0x37,0x24,0x2A,0x28,0x9E,0x29,0x2C,0x35,0x36,0x37,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_049[] = { 0x1B,0x28,0x30,0x28,0x30,0x25,0x28,0x35,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x37,0x35,0x2C,0x26,0x2E,0x3C,0x9E,0x20,0x24,0x2F,0x2F,0xFE,0x14,0x2C,0x26,0x2E,0x9E,0x2D,0x38,0x30,0x33,0xF4,0x9E,0x12,0x37,0x3E,0x36,0x9E,0x24,0xFE,0x37,0x28,0x26,0x2B,0x31,0x2C,0x34,0x38,0x28,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0xFE,0x30,0x24,0x36,0x37,0x28,0x35,0x9E,0x2C,0x31,0x9E,0x32,0x35,0x27,0x28,0x35,0x9E,0x37,0x32,0x9E,0x35,0x28,0x24,0x26,0x2B,0xFE,0x2B,0x2C,0x2A,0x2B,0x9E,0x33,0x2F,0x24,0x26,0x28,0x36,0x3F,0xFE,0x1E,0x36,0x28,0x9E,0x2C,0x37,0x9E,0x37,0x32,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x29,0x35,0x32,0x30,0x9E,0x3A,0x24,0x2F,0x2F,0xFE,0x37,0x32,0x9E,0x3A,0x24,0x2F,0x2F,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0xD1,0xFE,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x27,0x2C,0x35,0x28,0x26,0x37,0x2C,0x32,0x31,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0xFE,0x25,0x32,0x38,0x31,0x26,0x28,0x9E,0x37,0x32,0x9E,0x2A,0x24,0x2C,0x31,0x9E,0x30,0x32,0x30,0x28,0x31,0x37,0x38,0x30,0x3F,0xFE,0x19,0x35,0x24,0x26,0x37,0x2C,0x26,0x28,0x9E,0x30,0x24,0x2E,0x28,0x36,0x9E,0x33,0x28,0x35,0x29,0x28,0x26,0x37,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_050[] = { 0x11,0x32,0x2F,0x27,0x9E,0x57,0x9E,0x37,0x32,0x9E,0x26,0x35,0x32,0x38,0x26,0x2B,0x9E,0x24,0x31,0x27,0xFE,0x36,0x2F,0x2C,0x27,0x28,0x9E,0x27,0x32,0x3A,0x31,0x9E,0x24,0x9E,0x36,0x2F,0x32,0x33,0x28,0x3F,0xFE,0x18,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x24,0x2C,0x35,0x9E,0x37,0x32,0x9E,0x19,0x32,0x38,0x31,0x27,0x9E,0xD1,0x9E,0x10,0x35,0x32,0x38,0x31,0x27,0xF2,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x36,0x37,0x32,0x33,0x6F,0x9E,0x26,0x35,0x32,0x38,0x26,0x2B,0x6F,0x9E,0xD1,0x31,0xFE,0x2D,0x38,0x30,0x33,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x27,0x32,0x9E,0x24,0xFE,0x0B,0x24,0x26,0x2E,0x3A,0x24,0x35,0x27,0x9E,0x1C,0x32,0x30,0x28,0x35,0x36,0x24,0x38,0x2F,0x37,0xF2,0xFE,0x10,0x32,0x37,0x9E,0x37,0x2B,0x24,0x37,0xF4,0xFE,0x1D,0x2B,0x28,0x35,0x28,0x3E,0x36,0x9E,0x30,0x32,0x35,0x28,0x3F,0x9E,0x0C,0x35,0x32,0x38,0x26,0x2B,0x9E,0x24,0x31,0x27,0xFE,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x37,0x32,0x9E,0x27,0x32,0x9E,0x24,0xFE,0x15,0x32,0x31,0x2A,0x9E,0x13,0x38,0x30,0x33,0xF2,0x9E,0x18,0x35,0x9E,0x26,0x35,0x32,0x38,0x26,0x2B,0x9E,0x24,0x31,0x27,0xFE,0x3A,0x24,0x2F,0x2E,0x9E,0x37,0x32,0x3F,0x3F,0x3F,0x31,0x28,0x39,0x28,0x35,0x9E,0x30,0x2C,0x31,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_051[] = { 0x0C,0x2F,0x2C,0x30,0x25,0x2C,0x31,0x2A,0x3E,0x36,0x9E,0x28,0x24,0x36,0x3C,0xF2,0x9E,0x20,0x2B,0x28,0x31,0x9E,0xD2,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x24,0x37,0x9E,0x37,0x35,0x28,0x28,0x36,0x6F,0x9E,0x33,0x32,0x2F,0x28,0x36,0x9E,0x32,0x35,0xFE,0x33,0x2C,0x2F,0x2F,0x24,0x35,0x36,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x2A,0x35,0x24,0x25,0x9E,0xD1,0x30,0xFE,0x24,0x38,0x37,0x32,0x30,0x24,0x37,0x2C,0x26,0x24,0x2F,0x2F,0x3C,0x3F,0x9E,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x32,0x29,0x29,0x9E,0x25,0x24,0x26,0x2E,0x3A,0x24,0x35,0x27,0x3F,0xFE,0xFE,0x1D,0x32,0x9E,0x35,0x32,0x37,0x24,0x37,0x28,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0xD1,0xFE,0x32,0x25,0x2D,0x28,0x26,0x37,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x1B,0x2C,0x2A,0x2B,0x37,0x9E,0x32,0x35,0xFE,0x15,0x28,0x29,0x37,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x35,0x28,0x24,0x26,0x2B,0x9E,0xD1,0x9E,0x37,0x32,0x33,0x6F,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0x1E,0x33,0x9E,0x37,0x32,0x9E,0x27,0x32,0x9E,0x24,0xFE,0x2B,0x24,0x31,0x27,0x36,0x37,0x24,0x31,0x27,0xF2,0xFE,0x13,0x38,0x30,0x33,0x9E,0x32,0x29,0x29,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD1,0xFE,0x2B,0x24,0x31,0x27,0x36,0x37,0x24,0x31,0x27,0x9E,0x29,0x32,0x35,0x9E,0x24,0x9E,0x2B,0x2C,0x2A,0x2B,0x6F,0xFE,0x36,0x37,0x3C,0x2F,0x2C,0x31,0x3E,0x9E,0x27,0x2C,0x36,0x30,0x32,0x38,0x31,0x37,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_052[] = { 0x1C,0x37,0x32,0x33,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x9E,0x37,0x32,0xFE,0x26,0x35,0x32,0x38,0x26,0x2B,0x6F,0x9E,0xD1,0x31,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0xFE,0x37,0x32,0x9E,0x27,0x32,0x9E,0x24,0x9E,0x2B,0x2C,0x2A,0x2B,0x6F,0x9E,0x0B,0x24,0x26,0x2E,0x3A,0x24,0x35,0x27,0xFE,0x1C,0x32,0x30,0x28,0x35,0x36,0x24,0x38,0x2F,0x37,0xF2,0xFE,0xFE,0x1D,0x32,0x9E,0x33,0x28,0x35,0x29,0x32,0x35,0x30,0x9E,0x24,0x9E,0x1C,0x2C,0x27,0x28,0xFE,0x1C,0x32,0x30,0x28,0x35,0x36,0x24,0x38,0x2F,0x37,0x6F,0x9E,0x35,0x38,0x31,0x6F,0x9E,0x27,0x32,0x9E,0x24,0xFE,0x36,0x2B,0x24,0x35,0x33,0x9E,0x1E,0x9F,0x37,0x38,0x35,0x31,0x9E,0x24,0x31,0x27,0x9E,0x2D,0x38,0x30,0x33,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x26,0x24,0x37,0x26,0x2B,0x9E,0x2F,0x32,0x37,0x36,0x9E,0x32,0x29,0xFE,0x24,0x2C,0x35,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x25,0x32,0x37,0x2B,0x9E,0x2D,0x38,0x30,0x33,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_053[] = { 0x1C,0x32,0x30,0x28,0x37,0x2C,0x30,0x28,0x36,0x6F,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x33,0x24,0x36,0x36,0xFE,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0x9E,0x24,0x9E,0x26,0x32,0x2C,0x31,0x9E,0x35,0x2C,0x31,0x2A,0x9E,0x32,0x35,0xFE,0x29,0x2C,0x31,0x27,0x9E,0x24,0x9E,0x36,0x28,0x26,0x35,0x28,0x37,0x9E,0x33,0x32,0x2C,0x31,0x37,0x9E,0x2C,0x31,0x9E,0x24,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x6F,0x9E,0x24,0x9E,0x35,0x28,0x27,0x9E,0x31,0x38,0x30,0x25,0x28,0x35,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x24,0x33,0x33,0x28,0x24,0x35,0x3F,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x37,0x35,0x2C,0x2A,0x2A,0x28,0x35,0x9E,0x29,0x2C,0x39,0x28,0x9E,0x35,0x28,0x27,0xFE,0x31,0x38,0x30,0x25,0x28,0x35,0x36,0x6F,0x9E,0x24,0x9E,0x36,0x28,0x26,0x35,0x28,0x37,0x9E,0x1C,0x37,0x24,0x35,0xFE,0x3A,0x2C,0x2F,0x2F,0x9E,0x36,0x2B,0x32,0x3A,0x9E,0x38,0x33,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_054[] = { 0x20,0x28,0x2F,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x36,0x31,0x32,0x3A,0xFE,0x36,0x2F,0x2C,0x27,0x28,0xF2,0x9E,0x11,0x32,0x33,0x9E,0x32,0x31,0xF2,0x9E,0x1D,0x32,0x9E,0x36,0x33,0x28,0x28,0x27,0xFE,0x38,0x33,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x29,0x32,0x35,0x3A,0x24,0x35,0x27,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x3F,0x9E,0x1D,0x32,0x9E,0x36,0x2F,0x32,0x3A,0xFE,0x27,0x32,0x3A,0x31,0x6F,0x9E,0x33,0x38,0x2F,0x2F,0x9E,0x25,0x24,0x26,0x2E,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_055[] = { 0x11,0x28,0x3C,0x9F,0x28,0x3C,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0x25,0x38,0x27,0x27,0x3C,0x6F,0xFE,0x2B,0x32,0x3A,0x3D,0x2C,0x37,0x9E,0x2A,0x32,0x2C,0x31,0x3E,0xF4,0x9E,0x1C,0x37,0x28,0x33,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0xFE,0x38,0x33,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x24,0x9E,0x29,0x24,0x36,0x37,0xFE,0x36,0x2F,0x28,0x27,0x27,0x2C,0x31,0x3E,0x9E,0x2E,0x2C,0x31,0x27,0x9E,0x32,0x29,0x9E,0x2A,0x38,0x3C,0x3F,0xFE,0x12,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x36,0x33,0x28,0x28,0x27,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0x12,0x9E,0x36,0x28,0x28,0xFE,0x2C,0x37,0x6F,0x9E,0x3C,0x28,0x36,0x9E,0x36,0x2C,0x35,0x28,0x28,0x9F,0x9F,0x12,0x3E,0x30,0x9E,0xD1,0xFE,0x3A,0x32,0x35,0x2F,0x27,0x9E,0x26,0x2B,0x24,0x30,0x33,0x2C,0x32,0x31,0x9E,0x36,0x2F,0x28,0x27,0x27,0x28,0x35,0x6F,0xFE,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0x3F,0x9E,0x20,0x2B,0x24,0x27,0x27,0x3C,0x24,0x9E,0x36,0x24,0x3C,0xF4,0xFE,0x11,0x32,0x3A,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x24,0x9E,0x35,0x24,0x26,0x28,0xF4,0xFE,0x1B,0x28,0x24,0x27,0x3C,0x3F,0x3F,0x3F,0xFE,0xFE,0xD0,0xD0,0x10,0x32,0xD0,0xD0,0xD0,0xD0,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x10,0x32,0xFF };
+static const u8 dialog_text_DIALOG_056[] = { 0x22,0x32,0x38,0x9E,0x25,0x35,0x35,0x35,0x35,0x9F,0x32,0x2E,0x28,0x9E,0x30,0x3C,0x9E,0x35,0x28,0x26,0x32,0x35,0x27,0xF2,0xFE,0x1E,0x31,0x25,0x28,0x2F,0x2C,0x28,0x39,0x24,0x25,0x2F,0x28,0xF2,0x9E,0x12,0x9E,0x2E,0x31,0x28,0x3A,0xFE,0x37,0x2B,0x24,0x37,0x9E,0xD2,0x9E,0x3A,0x28,0x35,0x28,0x9E,0xD1,0x9E,0x26,0x32,0x32,0x2F,0x28,0x36,0x37,0x3F,0xFE,0x17,0x32,0x3A,0x9E,0xD2,0x3E,0x39,0x28,0x9E,0x33,0x35,0x32,0x39,0x28,0x31,0xFE,0x37,0x2B,0x24,0x37,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x24,0x2F,0x36,0x32,0x9E,0xD1,0xFE,0x29,0x24,0x36,0x37,0x28,0x36,0x37,0xF2,0xFE,0x12,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x24,0x3A,0x24,0x35,0x27,0x9E,0xD2,0x9E,0x24,0x9E,0x2A,0x32,0x2F,0x27,0xFE,0x30,0x28,0x27,0x24,0x2F,0x6F,0x9E,0x25,0x38,0x37,0x9E,0x2B,0x28,0x35,0x28,0x6F,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x1C,0x37,0x24,0x35,0x9E,0x2C,0x31,0x36,0x37,0x28,0x24,0x27,0x3F,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0xFE,0x28,0x24,0x35,0x31,0x28,0x27,0x9E,0x2C,0x37,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_057[] = { 0x0E,0x2A,0x24,0x27,0xF2,0x9E,0x16,0x3C,0x9E,0x25,0x24,0x25,0x3C,0xF2,0xF2,0x9E,0x11,0x24,0x39,0x28,0x9E,0xD2,0xFE,0x36,0x28,0x28,0x31,0x9E,0x30,0x3C,0x9E,0x25,0x24,0x25,0x3C,0xF4,0xF4,0xF4,0x9E,0x1C,0x2B,0x28,0x3E,0x36,0xFE,0xD1,0x9E,0x30,0x32,0x36,0x37,0x9E,0x33,0x35,0x28,0x26,0x2C,0x32,0x38,0x36,0x9E,0x25,0x24,0x25,0x3C,0x9E,0x2C,0x31,0xFE,0xD1,0x9E,0x3A,0x2B,0x32,0x2F,0x28,0x9E,0x3A,0x2C,0x27,0x28,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x3F,0xFE,0xE1,0x1D,0x2B,0x28,0x3C,0x9E,0x36,0x24,0x3C,0x9E,0x36,0x2B,0x28,0x9E,0x2B,0x24,0x36,0x9E,0x30,0x3C,0xFE,0x25,0x28,0x24,0x2E,0x3F,0x3F,0x3F,0xE3,0x9E,0x12,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x26,0x24,0x31,0x3E,0x37,0xFE,0x35,0x28,0x30,0x28,0x30,0x25,0x28,0x35,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x9E,0x12,0x9E,0x2F,0x28,0x29,0x37,0xFE,0x2B,0x28,0x35,0x3F,0xFE,0x15,0x28,0x37,0x3E,0x36,0x9E,0x36,0x28,0x28,0x3F,0x3F,0x3F,0x12,0x9E,0x36,0x37,0x32,0x33,0x33,0x28,0x27,0xFE,0x29,0x32,0x35,0x9E,0x2B,0x28,0x35,0x35,0x2C,0x31,0x2A,0x9E,0x24,0x31,0x27,0x9E,0x2C,0x26,0x28,0x9E,0x26,0x38,0x25,0x28,0x36,0x6F,0xFE,0xD1,0x31,0x9E,0x12,0x3F,0x3F,0x3F,0x32,0x32,0x2B,0x2B,0xF2,0x9E,0x12,0x9E,0x2D,0x38,0x36,0x37,0xFE,0x27,0x32,0x31,0x3E,0x37,0x9E,0x2E,0x31,0x32,0x3A,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_058[] = { 0x22,0x32,0x38,0x9E,0x29,0x32,0x38,0x31,0x27,0x9E,0x30,0x3C,0x9E,0x33,0x35,0x28,0x26,0x2C,0x32,0x38,0x36,0x6F,0xFE,0x33,0x35,0x28,0x26,0x2C,0x32,0x38,0x36,0x9E,0x25,0x24,0x25,0x3C,0xF2,0x9E,0x20,0x2B,0x28,0x35,0x28,0xFE,0x2B,0x24,0x39,0x28,0x9E,0xD2,0x9E,0x25,0x28,0x28,0x31,0xF4,0x9E,0x11,0x32,0x3A,0x9E,0x26,0x24,0x31,0xFE,0x12,0x9E,0x28,0x39,0x28,0x35,0x9E,0x37,0x2B,0x24,0x31,0x2E,0x9E,0xD2,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF4,0xFE,0x18,0x2B,0x6F,0x9E,0x12,0x9E,0x27,0x32,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x2B,0x2C,0x36,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x1C,0x37,0x24,0x35,0x3F,0x9E,0x11,0x28,0x35,0x28,0x6F,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x2C,0x37,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0x30,0x3C,0x9E,0x28,0x37,0x28,0x35,0x31,0x24,0x2F,0xFE,0x2A,0x35,0x24,0x37,0x2C,0x37,0x38,0x27,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_059[] = { 0x1D,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x31,0x32,0x37,0x9E,0x30,0x3C,0x9E,0x25,0x24,0x25,0x3C,0xF2,0x9E,0x1C,0x2B,0x28,0xFE,0x2F,0x32,0x32,0x2E,0x36,0x9E,0x31,0x32,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x30,0x28,0xF2,0xFE,0x11,0x28,0x35,0x9E,0x33,0x24,0x35,0x28,0x31,0x37,0x36,0x9E,0x30,0x38,0x36,0x37,0x9E,0x25,0x28,0xFE,0x3A,0x32,0x35,0x35,0x2C,0x28,0x27,0x9E,0x36,0x2C,0x26,0x2E,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_060[] = { 0x0A,0x1D,0x1D,0x0E,0x17,0x1D,0x12,0x18,0x17,0xF2,0xFE,0x1B,0x28,0x24,0x27,0x9E,0x0B,0x28,0x29,0x32,0x35,0x28,0x9E,0x0D,0x2C,0x39,0x2C,0x31,0x2A,0x9E,0x12,0x31,0xF2,0xFE,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x36,0x37,0x24,0x3C,0x9E,0x38,0x31,0x27,0x28,0x35,0x9E,0xD1,0xFE,0x3A,0x24,0x37,0x28,0x35,0x9E,0x29,0x32,0x35,0x9E,0x37,0x32,0x32,0x9E,0x2F,0x32,0x31,0x2A,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0xFE,0x35,0x38,0x31,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x32,0x3B,0x3C,0x2A,0x28,0x31,0x3F,0xFE,0xFE,0x1B,0x28,0x37,0x38,0x35,0x31,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x36,0x38,0x35,0x29,0x24,0x26,0x28,0x9E,0x29,0x32,0x35,0xFE,0x24,0x2C,0x35,0x9E,0x32,0x35,0x9E,0x29,0x2C,0x31,0x27,0x9E,0x24,0x31,0x9E,0x24,0x2C,0x35,0x9E,0x25,0x38,0x25,0x25,0x2F,0x28,0xFE,0x32,0x35,0x9E,0x26,0x32,0x2C,0x31,0x36,0x9E,0x37,0x32,0x9E,0x25,0x35,0x28,0x24,0xD1,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0xFE,0x38,0x31,0x27,0x28,0x35,0x3A,0x24,0x37,0x28,0x35,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x36,0x3A,0x2C,0x30,0x3F,0x9E,0x11,0x32,0x2F,0x27,0x9E,0x54,0xFE,0x37,0x32,0x9E,0x36,0x3A,0x2C,0x30,0x9E,0x36,0x2F,0x32,0x3A,0x9E,0x24,0x31,0x27,0x9E,0x36,0x37,0x28,0x24,0x27,0x3C,0x3F,0xFE,0x1D,0x24,0x33,0x9E,0x54,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x36,0x30,0x32,0x32,0x37,0x2B,0x9E,0x37,0x2C,0x30,0x2C,0x31,0x2A,0xFE,0x37,0x32,0x9E,0x2A,0x24,0x2C,0x31,0x9E,0x36,0x33,0x28,0x28,0x27,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x1E,0x33,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0xFE,0x37,0x32,0x9E,0x27,0x2C,0x39,0x28,0x3F,0xFE,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x0D,0x32,0x3A,0x31,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0xFE,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0xFE,0x35,0x28,0x37,0x38,0x35,0x31,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x36,0x38,0x35,0x29,0x24,0x26,0x28,0x3F,0xFE,0xFE,0x11,0x32,0x2F,0x27,0x9E,0x0D,0x32,0x3A,0x31,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0xFE,0x3A,0x2B,0x2C,0x2F,0x28,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x36,0x38,0x35,0x29,0x24,0x26,0x28,0x9E,0x31,0x28,0x24,0x35,0xFE,0xD1,0x9E,0x28,0x27,0x2A,0x28,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x3A,0x24,0x37,0x28,0x35,0x9E,0x37,0x32,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x32,0x38,0x37,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_061[] = { 0x0B,0x1B,0x1B,0x1B,0xF2,0x9E,0x0F,0x35,0x32,0x36,0x37,0x25,0x2C,0x37,0x28,0x9E,0x0D,0x24,0x31,0x2A,0x28,0x35,0xF2,0xFE,0x0D,0x32,0x9E,0x31,0x32,0x37,0x9E,0x36,0x3A,0x2C,0x30,0x9E,0x2B,0x28,0x35,0x28,0x3F,0xFE,0x12,0x3E,0x30,0x9E,0x36,0x28,0x35,0x2C,0x32,0x38,0x36,0x3F,0xFE,0xD0,0x9F,0x9F,0x1D,0x2B,0x28,0x9E,0x19,0x28,0x31,0x2A,0x38,0x2C,0x31,0xFF };
+static const u8 dialog_text_DIALOG_062[] = { 0x11,0x2C,0x27,0x27,0x28,0x31,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0xD1,0x9E,0x2A,0x35,0x28,0x28,0x31,0xFE,0x25,0x2F,0x32,0x26,0x2E,0x9E,0x2C,0x36,0x9E,0xD1,0x9E,0x24,0x30,0x24,0x3D,0x2C,0x31,0x2A,0xFE,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x33,0x3F,0xFE,0x20,0x28,0x24,0x35,0x2C,0x31,0x2A,0x9E,0x2C,0x37,0x6F,0x9E,0xD2,0x9E,0x3A,0x32,0x31,0x3E,0x37,0xFE,0x26,0x24,0x37,0x26,0x2B,0x9E,0x29,0x2C,0x35,0x28,0x9E,0x32,0x35,0x9E,0x25,0x28,0x9E,0x2B,0x38,0x35,0x37,0xFE,0x25,0x3C,0x9E,0x28,0x31,0x28,0x30,0x3C,0x9E,0x24,0x37,0x37,0x24,0x26,0x2E,0x36,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x28,0x39,0x28,0x31,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0xFE,0x25,0x35,0x28,0x24,0xD1,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0x9E,0x3A,0x28,0x24,0x35,0x2C,0x31,0x2A,0x9E,0x2C,0x37,0x3F,0xFE,0xFE,0x1D,0x2B,0x28,0x9E,0x32,0x31,0x2F,0x3C,0x9E,0x33,0x35,0x32,0x25,0x2F,0x28,0x30,0xE6,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x36,0x3A,0x2C,0x30,0x9E,0x2C,0x31,0x9E,0x2C,0x37,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_063[] = { 0x1D,0x2B,0x28,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0x9E,0x0C,0x24,0x33,0x9E,0x2C,0x36,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0xFE,0xD1,0x9E,0x25,0x2F,0x38,0x28,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x3F,0x9E,0x16,0x35,0x3F,0x9E,0x12,0x3F,0xFE,0x3A,0x2C,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x36,0x38,0x35,0x33,0x35,0x2C,0x36,0x28,0x27,0x6F,0x9E,0x36,0x2C,0x31,0x26,0x28,0xFE,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x2C,0x31,0x39,0x2C,0x36,0x2C,0x25,0x2F,0x28,0x9E,0x3A,0x2B,0x28,0x31,0xFE,0xD2,0x9E,0x3A,0x28,0x24,0x35,0x9E,0x2C,0x37,0xF2,0xFE,0x0E,0x39,0x28,0x31,0x9E,0xD1,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x32,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x25,0x28,0xFE,0x29,0x32,0x32,0x2F,0x28,0x27,0x9F,0x9F,0x24,0x31,0x27,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x3A,0x24,0x2F,0x2E,0xFE,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0x9E,0x36,0x28,0x26,0x35,0x28,0x37,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0x6F,0x9E,0x37,0x32,0x32,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_064[] = { 0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x33,0x38,0x37,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x20,0x2C,0x31,0x2A,0xFE,0x0C,0x24,0x33,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x26,0x32,0x30,0x28,0x36,0x9E,0x29,0x35,0x32,0x30,0x9E,0x24,0xFE,0x35,0x28,0x27,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x6F,0x9E,0x27,0x32,0x9E,0xD1,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0xFE,0x13,0x38,0x30,0x33,0x9E,0x37,0x32,0x9E,0x36,0x32,0x24,0x35,0x9E,0x2B,0x2C,0x2A,0x2B,0x9E,0x2C,0x31,0x37,0x32,0xFE,0xD1,0x9E,0x36,0x2E,0x3C,0x3F,0xFE,0x1E,0x36,0x28,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x37,0x32,0xFE,0x2A,0x38,0x2C,0x27,0x28,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3F,0x9E,0x19,0x38,0x2F,0x2F,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x37,0x32,0xFE,0x37,0x32,0x9E,0x29,0x2F,0x3C,0x9E,0x38,0x33,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x29,0x32,0x35,0x3A,0x24,0x35,0x27,0xFE,0x37,0x32,0x9E,0x31,0x32,0x36,0x28,0x9E,0x27,0x32,0x3A,0x31,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0xFE,0x37,0x32,0x9E,0x2F,0x24,0x31,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_065[] = { 0x1C,0x3A,0x2C,0x30,0x30,0x2C,0x31,0x2A,0x9E,0x15,0x28,0x36,0x36,0x32,0x31,0x36,0xF2,0xFE,0x1D,0x24,0x33,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x27,0x32,0x9E,0xD1,0x9E,0x25,0x35,0x28,0x24,0x36,0x37,0xFE,0x36,0x37,0x35,0x32,0x2E,0x28,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x37,0x2C,0x30,0x28,0x9E,0xD1,0xFE,0x37,0x24,0x33,0x36,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x36,0x3A,0x2C,0x30,0xFE,0x29,0x24,0x36,0x37,0x3F,0xFE,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x32,0x2F,0x27,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x27,0x32,0x9E,0x24,0xFE,0x36,0x2F,0x32,0x3A,0x6F,0x9E,0x36,0x37,0x28,0x24,0x27,0x3C,0x9E,0x29,0x2F,0x38,0x37,0x37,0x28,0x35,0x9E,0x2E,0x2C,0x26,0x2E,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x1E,0x33,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0xFE,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x37,0x32,0x9E,0x27,0x2C,0x39,0x28,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x33,0x38,0x2F,0x2F,0xFE,0x25,0x24,0x26,0x2E,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x36,0x37,0x2C,0x26,0x2E,0x9E,0x37,0x32,0x9E,0x2B,0x28,0x24,0x27,0xFE,0x29,0x32,0x35,0x9E,0xD1,0x9E,0x36,0x38,0x35,0x29,0x24,0x26,0x28,0x3F,0xFE,0x1D,0x32,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x3A,0x24,0x37,0x28,0x35,0x6F,0xFE,0x2B,0x32,0x2F,0x27,0x9E,0x0D,0x32,0x3A,0x31,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0xFE,0x1C,0x37,0x2C,0x26,0x2E,0x6F,0x9E,0xD1,0x31,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0x3F,0xFE,0x0E,0x24,0x36,0x3C,0x9E,0x24,0x36,0x9E,0x33,0x2C,0x28,0x6F,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0xF4,0xFE,0xFE,0xFE,0x0B,0x38,0x37,0x9E,0x35,0x28,0x30,0x28,0x30,0x25,0x28,0x35,0xE6,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x25,0x35,0x28,0x24,0xD1,0x9E,0x38,0x31,0x27,0x28,0x35,0xFE,0xD1,0x9E,0x3A,0x24,0x37,0x28,0x35,0xF2,0x9E,0x1B,0x28,0x37,0x38,0x35,0x31,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x36,0x38,0x35,0x29,0x24,0x26,0x28,0x9E,0x29,0x32,0x35,0x9E,0x24,0x2C,0x35,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD1,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x16,0x28,0x37,0x28,0x35,0x9E,0x35,0x38,0x31,0x36,0x9E,0x2F,0x32,0x3A,0x3F,0xFE,0xFE,0x0A,0x31,0x27,0x9E,0x32,0x31,0x28,0x9E,0x2F,0x24,0x36,0x37,0x9E,0x37,0x2B,0x2C,0x31,0x2A,0xE6,0x9E,0x22,0x32,0x38,0xFE,0x26,0x24,0x31,0x3E,0x37,0x9E,0x32,0x33,0x28,0x31,0x9E,0x27,0x32,0x32,0x35,0x36,0x9E,0x37,0x2B,0x24,0x37,0xFE,0x24,0x35,0x28,0x9E,0x38,0x31,0x27,0x28,0x35,0x3A,0x24,0x37,0x28,0x35,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_066[] = { 0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0x2C,0x37,0x3E,0x36,0x9E,0x19,0x28,0x24,0x26,0x2B,0xF2,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x25,0x28,0x9E,0x26,0x24,0x35,0x28,0x29,0x38,0x2F,0xF2,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0xFE,0x2C,0x36,0x9E,0x36,0x32,0x9E,0x3A,0x2C,0x26,0x2E,0x28,0x27,0xF2,0x9E,0x11,0x28,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x37,0x35,0x3C,0xFE,0x37,0x32,0x9E,0x25,0x38,0x35,0x31,0x9E,0xD2,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x2B,0x2C,0x36,0xFE,0x2B,0x32,0x35,0x35,0x2C,0x25,0x2F,0x28,0x9E,0x29,0x2F,0x24,0x30,0x28,0x9E,0x25,0x35,0x28,0x24,0x37,0x2B,0x3F,0xFE,0x1B,0x38,0x31,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x25,0x28,0x2B,0x2C,0x31,0x27,0x9E,0x24,0x31,0x27,0xFE,0x2A,0x35,0x24,0x25,0x9E,0x2B,0x2C,0x30,0x9E,0x25,0x3C,0x9E,0xD1,0x9E,0x37,0x24,0x2C,0x2F,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0xD1,0x9E,0x55,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x3F,0x9E,0x18,0x31,0x26,0x28,0x9E,0xD2,0xFE,0x2A,0x35,0x24,0x25,0x9E,0x2B,0x32,0x2F,0x27,0x6F,0x9E,0x36,0x3A,0x2C,0x31,0x2A,0x9E,0x2B,0x2C,0x30,0xFE,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x2C,0x31,0x9E,0x2A,0x35,0x28,0x24,0x37,0x9E,0x26,0x2C,0x35,0x26,0x2F,0x28,0x36,0x3F,0xFE,0x1B,0x32,0x37,0x24,0x37,0x28,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0xFE,0x37,0x32,0x9E,0x2A,0x32,0x9E,0x29,0x24,0x36,0x37,0x28,0x35,0x9E,0x24,0x31,0x27,0x9E,0x29,0x24,0x36,0x37,0x28,0x35,0x3F,0xFE,0x1D,0x2B,0x28,0x9E,0x29,0x24,0x36,0x37,0x28,0x35,0x9E,0xD2,0x9E,0x36,0x3A,0x2C,0x31,0x2A,0x9E,0x2B,0x2C,0x30,0x6F,0xFE,0xD1,0x9E,0x29,0x24,0x35,0xD1,0x35,0x9E,0x2B,0x28,0x3E,0x2F,0x2F,0x9E,0x29,0x2F,0x3C,0x3F,0xFE,0xFE,0x1E,0x36,0x28,0x9E,0xD1,0x9E,0x56,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x36,0x9E,0x37,0x32,0x9E,0x2F,0x32,0x32,0x2E,0xFE,0x24,0x35,0x32,0x38,0x31,0x27,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x2B,0x24,0x39,0x28,0xFE,0x37,0x32,0x9E,0x37,0x2B,0x35,0x32,0x3A,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2C,0x31,0x37,0x32,0x9E,0x32,0x31,0x28,0xFE,0x32,0x29,0x9E,0xD1,0x9E,0x25,0x32,0x30,0x25,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x29,0x32,0x38,0x35,0xFE,0x26,0x32,0x35,0x31,0x28,0x35,0x36,0x3F,0xFE,0x0A,0x2C,0x30,0x9E,0x3A,0x28,0x2F,0x2F,0x6F,0x9E,0xD1,0x31,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x55,0xFE,0x24,0x2A,0x24,0x2C,0x31,0x9E,0x37,0x32,0x9E,0x2F,0x24,0x38,0x31,0x26,0x2B,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x3F,0xFE,0x10,0x32,0x32,0x27,0x9E,0x2F,0x38,0x26,0x2E,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x18,0x38,0x35,0xFE,0x29,0x24,0x37,0x28,0x9E,0x2C,0x36,0x9E,0x2C,0x31,0x9E,0xD2,0x35,0x9E,0x2B,0x24,0x31,0x27,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_067[] = { 0x1D,0x32,0x38,0x2A,0x2B,0x9E,0x2F,0x38,0x26,0x2E,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x1D,0x32,0x24,0x27,0x36,0x37,0x32,0x32,0x2F,0x9E,0x2C,0x36,0x31,0x3E,0x37,0xFE,0x2B,0x28,0x35,0x28,0x3F,0x3F,0x3F,0x10,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xF2,0x9E,0x10,0x32,0xFE,0x24,0x2B,0x28,0x24,0x27,0x9F,0x9F,0x2D,0x38,0x36,0x37,0x9E,0x37,0x35,0x3C,0x9E,0x37,0x32,0x9E,0x2A,0x35,0x24,0x25,0xFE,0x30,0x28,0x9E,0x25,0x3C,0x9E,0xD1,0x9E,0x37,0x24,0x2C,0x2F,0xF2,0xFE,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x31,0x28,0x39,0x28,0x35,0x9E,0x25,0x28,0x9E,0x24,0x25,0x2F,0x28,0x9E,0x37,0x32,0xFE,0x36,0x3A,0x2C,0x31,0x2A,0x9E,0x16,0x0E,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0xF2,0x9E,0x0A,0x9E,0x3A,0x2C,0x30,0x33,0xFE,0x2F,0x2C,0x2E,0x28,0x9E,0xD2,0x9E,0x3A,0x32,0x31,0x3E,0x37,0x9E,0x37,0x2B,0x35,0x32,0x3A,0x9E,0x30,0x28,0xFE,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x2B,0x28,0x35,0x28,0xF2,0x9E,0x17,0x28,0x39,0x28,0x35,0xF2,0x9E,0x11,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_068[] = { 0x12,0x37,0x3E,0x36,0x9E,0x15,0x28,0x37,0x2B,0x24,0x2F,0x9E,0x15,0x24,0x39,0x24,0x9E,0x15,0x24,0x31,0x27,0xF2,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x26,0x24,0x37,0x26,0x2B,0x9E,0x29,0x2C,0x35,0x28,0x9E,0x32,0x35,0x9E,0x29,0x24,0x2F,0x2F,0xFE,0x2C,0x31,0x37,0x32,0x9E,0x24,0x9E,0x33,0x32,0x32,0x2F,0x9E,0x32,0x29,0x9E,0x29,0x2F,0x24,0x30,0x28,0x36,0x6F,0xFE,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x2B,0x32,0x33,0x33,0x2C,0x31,0x2A,0x9E,0x30,0x24,0x27,0x6F,0x9E,0x25,0x38,0x37,0xFE,0x27,0x32,0x31,0x3E,0x37,0x9E,0x2F,0x32,0x36,0x28,0x9E,0xD2,0x35,0x9E,0x26,0x32,0x32,0x2F,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0x9E,0x26,0x32,0x31,0x37,0x35,0x32,0x2F,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9F,0x9F,0x2D,0x38,0x36,0x37,0x9E,0x37,0x35,0x3C,0x9E,0x37,0x32,0x9E,0x2E,0x28,0x28,0x33,0xFE,0x26,0x24,0x2F,0x30,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_069[] = { 0x1C,0x32,0x30,0x28,0x37,0x2C,0x30,0x28,0x36,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x38,0x30,0x33,0x9E,0x2C,0x31,0x37,0x32,0xFE,0x2C,0x31,0x39,0x2C,0x36,0x2C,0x25,0x2F,0x28,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0x9E,0x24,0x37,0x9E,0xD1,0xFE,0x28,0x27,0x2A,0x28,0x36,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0xFE,0x3A,0x32,0x35,0x2F,0x27,0x36,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x2B,0x2C,0x37,0x9E,0x24,0x9E,0x3A,0x24,0x2F,0x2F,0xFE,0x3A,0x2B,0x2C,0x2F,0x28,0x9E,0x29,0x2F,0x3C,0x2C,0x31,0x2A,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x32,0x38,0x31,0x26,0x28,0xFE,0x25,0x24,0x26,0x2E,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_070[] = { 0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x35,0x28,0x37,0x38,0x35,0x31,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3E,0x36,0x9E,0x30,0x24,0x2C,0x31,0x9E,0x2B,0x24,0x2F,0x2F,0x9E,0x24,0x37,0x9E,0x24,0x31,0x3C,0xFE,0x37,0x2C,0x30,0x28,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0xFE,0x3A,0x32,0x35,0x2F,0x27,0x36,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x9E,0xD1,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0xFE,0x2F,0x2C,0x39,0x28,0x3F,0xFE,0x13,0x38,0x36,0x37,0x9E,0x36,0x37,0x32,0x33,0x6F,0x9E,0x36,0x37,0x24,0x31,0x27,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0x6F,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0x1C,0x37,0x24,0x35,0x37,0x9E,0x37,0x32,0x9E,0x33,0x24,0x38,0x36,0x28,0x9E,0xD1,0xFE,0x2A,0x24,0x30,0x28,0x6F,0x9E,0xD1,0x31,0x9E,0x36,0x28,0x2F,0x28,0x26,0x37,0xFE,0xF5,0x0E,0x3B,0x2C,0x37,0x9E,0x0C,0x32,0x38,0x35,0x36,0x28,0x3F,0xF6,0xFE,0xFE,0x22,0x32,0x38,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0xFE,0x24,0x2F,0x2F,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x2C,0x31,0x9E,0x32,0x31,0x28,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x9E,0x25,0x28,0x29,0x32,0x35,0x28,0x9E,0x2A,0x32,0x2C,0x31,0x2A,0x9E,0x32,0x31,0x9E,0x37,0x32,0xFE,0xD1,0x9E,0x31,0x28,0x3B,0x37,0x3F,0xFE,0xFE,0x1B,0x28,0x37,0x38,0x35,0x31,0x9E,0x2F,0x24,0x37,0x28,0x35,0x6F,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0x3E,0x35,0x28,0xFE,0x30,0x32,0x35,0x28,0x9E,0x28,0x3B,0x33,0x28,0x35,0x2C,0x28,0x31,0x26,0x28,0x27,0x6F,0x9E,0x37,0x32,0x9E,0x33,0x2C,0x26,0x2E,0xFE,0x38,0x33,0x9E,0x27,0x2C,0x29,0x29,0x2C,0x26,0x38,0x2F,0x37,0x9E,0x32,0x31,0x28,0x36,0x3F,0xFE,0xFE,0xFE,0x20,0x2B,0x28,0x31,0x28,0x39,0x28,0x35,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x27,0x9E,0x24,0x9E,0x1C,0x37,0x24,0x35,0x6F,0xFE,0x24,0x9E,0x2B,0x2C,0x31,0x37,0x9E,0x29,0x32,0x35,0x9E,0x29,0x2C,0x31,0x27,0x2C,0x31,0x2A,0x9E,0xD1,0xFE,0x31,0x28,0x3B,0x37,0x9E,0x32,0x31,0x28,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x24,0x33,0x33,0x28,0x24,0x35,0x9E,0x32,0x31,0xFE,0xD1,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3E,0x36,0x9E,0x36,0x37,0x24,0x35,0x37,0x9E,0x36,0x26,0x35,0x28,0x28,0x31,0x3F,0xFE,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x6F,0x9E,0x2B,0x32,0x3A,0x28,0x39,0x28,0x35,0x6F,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0xFE,0x24,0x31,0x3C,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x35,0x28,0x30,0x24,0x2C,0x31,0x2C,0x31,0x2A,0xFE,0x1C,0x37,0x24,0x35,0x36,0x9E,0x31,0x28,0x3B,0x37,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x27,0x32,0x31,0x3E,0x37,0xFE,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0xD1,0x9E,0x32,0x31,0x28,0xFE,0x27,0x28,0x36,0x26,0x35,0x2C,0x25,0x28,0x27,0x9E,0x25,0x3C,0x9E,0xD1,0x9E,0x2B,0x2C,0x31,0x37,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_071[] = { 0x0D,0x24,0x31,0x2A,0x28,0x35,0x9E,0x0A,0x2B,0x28,0x24,0x27,0xF2,0xFE,0x0B,0x28,0x3A,0x24,0x35,0x28,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x36,0x37,0x35,0x24,0x31,0x2A,0x28,0xFE,0x26,0x2F,0x32,0x38,0x27,0xF2,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x2C,0x31,0x2B,0x24,0x2F,0x28,0xF2,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x29,0x28,0x28,0x2F,0x9E,0x29,0x24,0x2C,0x31,0x37,0x6F,0x9E,0x35,0x38,0x31,0x9E,0x29,0x32,0x35,0xFE,0x2B,0x2C,0x2A,0x2B,0x28,0x35,0x9E,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x24,0x31,0x27,0x9E,0x29,0x35,0x28,0x36,0x2B,0xFE,0x24,0x2C,0x35,0xF2,0xFE,0x0C,0x2C,0x35,0x26,0x2F,0x28,0xE6,0x9E,0x1C,0x2B,0x28,0x2F,0x37,0x28,0x35,0xFE,0x0A,0x35,0x35,0x32,0x3A,0xE6,0x9E,0x0E,0x31,0x37,0x35,0x24,0x31,0x26,0x28,0x9F,0x0E,0x3B,0x2C,0x37,0xFF };
+static const u8 dialog_text_DIALOG_072[] = { 0x11,0x2C,0x2A,0x2B,0x9E,0x3A,0x2C,0x31,0x27,0x36,0x9E,0x24,0x2B,0x28,0x24,0x27,0xF2,0xFE,0x19,0x38,0x2F,0x2F,0x9E,0xD2,0x35,0x9E,0x0C,0x24,0x33,0x9E,0x27,0x32,0x3A,0x31,0x9E,0x37,0x2C,0x2A,0x2B,0x37,0x3F,0xFE,0x12,0x29,0x9E,0x2C,0x37,0x9E,0x25,0x2F,0x32,0x3A,0x36,0x9E,0x32,0x29,0x29,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0xFE,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x29,0x2C,0x31,0x27,0x9E,0x2C,0x37,0x9E,0x32,0x31,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x30,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_073[] = { 0x0A,0x24,0x35,0x35,0x2A,0x2B,0xF2,0x9E,0x0A,0x2B,0x32,0x3C,0x6F,0x9E,0x30,0x24,0x37,0x28,0x3C,0x3F,0x9E,0x12,0xFE,0x2B,0x24,0x39,0x28,0x9E,0x36,0x38,0x31,0x2E,0x28,0x31,0x9E,0x37,0x35,0x28,0x24,0x36,0x38,0x35,0x28,0x6F,0xFE,0x2B,0x28,0x35,0x28,0x6F,0x9E,0x12,0x9E,0x27,0x32,0x3F,0xFE,0xFE,0x0B,0x38,0x37,0x9E,0x37,0x32,0x9E,0x33,0x2F,0x38,0x26,0x2E,0x9E,0xD1,0x9E,0x33,0x2F,0x38,0x31,0x27,0x28,0x35,0x6F,0xFE,0xD2,0x9E,0x30,0x38,0x36,0x37,0x9E,0x32,0x33,0x28,0x31,0x9E,0xD1,0xFE,0x1D,0x35,0x28,0x24,0x36,0x38,0x35,0x28,0x9E,0x0C,0x2B,0x28,0x36,0x37,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x35,0x2C,0x2A,0x2B,0x37,0x9E,0x32,0x35,0x27,0x28,0x35,0x3F,0xFE,0x20,0x2B,0x24,0x37,0x9E,0x32,0x35,0x27,0x28,0x35,0x9E,0x2C,0x36,0x9E,0x37,0x2B,0x24,0x37,0x6F,0xFE,0x3C,0x28,0x9E,0x36,0x24,0x3C,0xF4,0xFE,0xFE,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x31,0x28,0x39,0x28,0x35,0x9E,0x37,0x28,0x2F,0x2F,0xF2,0xFE,0xFE,0xD0,0xD0,0x9F,0x9F,0x1D,0x2B,0x28,0x9E,0x0C,0x24,0x33,0x3E,0x31,0xFF };
+static const u8 dialog_text_DIALOG_074[] = { 0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x2A,0x35,0x24,0x25,0x9E,0x32,0x31,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x28,0x27,0x2A,0x28,0x9E,0x32,0x29,0x9E,0x24,0x9E,0x26,0x2F,0x2C,0x29,0x29,0x9E,0x32,0x35,0x9E,0x2F,0x28,0x27,0x2A,0x28,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0xD2,0x35,0x9E,0x29,0x2C,0x31,0x2A,0x28,0x35,0x37,0x2C,0x33,0x36,0x9E,0x24,0x31,0x27,0xFE,0x2B,0x24,0x31,0x2A,0x9E,0x27,0x32,0x3A,0x31,0x9E,0x29,0x35,0x32,0x30,0x9E,0x2C,0x37,0x3F,0xFE,0xFE,0x1D,0x32,0x9E,0x27,0x35,0x32,0x33,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD1,0x9E,0x28,0x27,0x2A,0x28,0x6F,0xFE,0x28,0x2C,0xD1,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0xFE,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x27,0x2C,0x35,0x28,0x26,0x37,0x2C,0x32,0x31,0x9E,0x32,0x29,0xFE,0x16,0x24,0x35,0x2C,0x32,0x3E,0x36,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x32,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0xD1,0xFE,0x57,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x3F,0xFE,0x1D,0x32,0x9E,0x2A,0x28,0x37,0x9E,0x38,0x33,0x9E,0x32,0x31,0x37,0x32,0x9E,0xD1,0x9E,0x2F,0x28,0x27,0x2A,0x28,0x6F,0xFE,0x28,0x2C,0xD1,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x1E,0x33,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x32,0x35,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0xFE,0x24,0x36,0x9E,0x36,0x32,0x32,0x31,0x9E,0x24,0x36,0x9E,0xD2,0x9E,0x2A,0x35,0x24,0x25,0x9E,0xD1,0xFE,0x2F,0x28,0x27,0x2A,0x28,0x9E,0x37,0x32,0x9E,0x26,0x2F,0x2C,0x30,0x25,0x9E,0x38,0x33,0x9E,0x34,0x38,0x2C,0x26,0x2E,0x2F,0x3C,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_075[] = { 0x16,0x24,0x35,0x2C,0x32,0xF2,0xF2,0x9E,0x16,0x3C,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x9E,0x2C,0x36,0x9E,0x2C,0x31,0xFE,0x2A,0x35,0x28,0x24,0x37,0x9E,0x33,0x28,0x35,0x2C,0x2F,0x3F,0x9E,0x12,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x37,0x2B,0x24,0x37,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2C,0x36,0x9E,0xD1,0x9E,0x26,0x24,0x38,0x36,0x28,0x3F,0x3F,0x3F,0x24,0x31,0x27,0xFE,0x12,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x32,0x31,0x2F,0x3C,0x9E,0xD2,0x9E,0x26,0x24,0x31,0xFE,0x36,0x37,0x32,0x33,0x9E,0x2B,0x2C,0x30,0xF2,0xFE,0x1D,0x2B,0x28,0x9E,0x27,0x32,0x32,0x35,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0xFE,0x37,0x2B,0x24,0x37,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x25,0x28,0x28,0x31,0x9E,0x36,0x28,0x24,0x2F,0x28,0x27,0x9E,0x25,0x3C,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x26,0x24,0x31,0x9E,0x25,0x28,0x9E,0x32,0x33,0x28,0x31,0x28,0x27,0x9E,0x32,0x31,0x2F,0x3C,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x19,0x32,0x3A,0x28,0x35,0x3F,0xFE,0xFE,0x0B,0x38,0x37,0x9E,0xD1,0x35,0x28,0x9E,0x24,0x35,0x28,0x9E,0x36,0x28,0x26,0x35,0x28,0x37,0xFE,0x33,0x24,0x37,0x2B,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x6F,0xFE,0x33,0x24,0x37,0x2B,0x36,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2B,0x24,0x36,0x31,0x3E,0x37,0xFE,0x29,0x32,0x38,0x31,0x27,0x3F,0xFE,0xFE,0x18,0x31,0x28,0x9E,0x32,0x29,0x9E,0x37,0x2B,0x32,0x36,0x28,0x9E,0x33,0x24,0x37,0x2B,0x36,0x9E,0x2C,0x36,0x9E,0x2C,0x31,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x35,0x32,0x32,0x30,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x2C,0x37,0x9E,0x2B,0x32,0x2F,0x27,0x36,0xFE,0x32,0x31,0x28,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3E,0x36,0x9E,0x1C,0x28,0x26,0x35,0x28,0x37,0xFE,0x1C,0x37,0x24,0x35,0x36,0xF2,0xFE,0xFE,0x0F,0x2C,0x31,0x27,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x1C,0x28,0x26,0x35,0x28,0x37,0x9E,0x1C,0x37,0x24,0x35,0x6F,0xFE,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x12,0x37,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x2B,0x28,0x2F,0x33,0x9E,0xD2,0xFE,0x32,0x31,0x9E,0xD2,0x35,0x9E,0x34,0x38,0x28,0x36,0x37,0x3F,0x9E,0x19,0x2F,0x28,0x24,0x36,0x28,0x6F,0xFE,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0xFE,0x2B,0x28,0x2F,0x33,0x9E,0x38,0x36,0xF2,0xFE,0x1B,0x28,0x37,0x35,0x2C,0x28,0x39,0x28,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0xFE,0x24,0x31,0x27,0x9E,0x29,0x35,0x28,0x28,0x9E,0x38,0x36,0x9E,0x29,0x35,0x32,0x30,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x24,0x3A,0x29,0x38,0x2F,0x9E,0x33,0x35,0x2C,0x36,0x32,0x31,0xF2,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_076[] = { 0x1D,0x2B,0x24,0x31,0x2E,0x36,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x2F,0x2C,0x29,0x28,0x9E,0x2C,0x36,0xFE,0x35,0x28,0x37,0x38,0x35,0x31,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0xFE,0x37,0x32,0x9E,0x2A,0x2C,0x39,0x28,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0xD1,0x9E,0x25,0x32,0x32,0x37,0xF2,0xFE,0xFE,0x11,0x28,0x35,0x28,0x6F,0x9E,0x2F,0x28,0x37,0x9E,0x30,0x28,0x9E,0x37,0x28,0x2F,0x2F,0x9E,0xD2,0x9E,0x24,0xFE,0x2F,0x2C,0x37,0x37,0x2F,0x28,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0x9E,0x12,0x31,0x9E,0xD1,0x9E,0x35,0x32,0x32,0x30,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0xD1,0x9E,0x30,0x2C,0x35,0x35,0x32,0x35,0x36,0x6F,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x26,0x24,0x35,0x28,0x29,0x38,0x2F,0x2F,0x3C,0xFE,0x29,0x32,0x35,0x9E,0x24,0x31,0x3C,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x37,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x31,0x32,0x37,0xFE,0x35,0x28,0x29,0x2F,0x28,0x26,0x37,0x28,0x27,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x30,0x2C,0x35,0x35,0x32,0x35,0x3F,0xFE,0x0A,0x31,0x27,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x2A,0x32,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x3A,0x24,0x37,0x28,0x35,0x9E,0x37,0x32,0x3A,0x31,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x29,0x2F,0x32,0x32,0x27,0xFE,0x2C,0x37,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x24,0x9E,0x2B,0x2C,0x2A,0x2B,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x2C,0x31,0x37,0x32,0xFE,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0x3F,0x9E,0x18,0x2B,0x6F,0x9E,0x25,0x3C,0x9E,0xD1,0xFE,0x3A,0x24,0x3C,0x6F,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x3A,0x2B,0x24,0x37,0x9E,0x12,0x9E,0x29,0x32,0x38,0x31,0x27,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_077[] = { 0x12,0x37,0x9E,0x2C,0x36,0x9E,0x27,0x28,0x26,0x35,0x28,0x28,0x27,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x32,0x31,0x28,0xFE,0x36,0x2B,0x24,0x2F,0x2F,0x9E,0x33,0x32,0x38,0x31,0x27,0x9E,0xD1,0x9E,0x33,0x2C,0x2F,0x2F,0x24,0x35,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_078[] = { 0x0B,0x35,0x28,0x24,0x2E,0x9E,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x0B,0x2F,0x38,0x28,0x9E,0x0C,0x32,0x2C,0x31,0xFE,0x0B,0x2F,0x32,0x26,0x2E,0x9E,0x25,0x3C,0x9E,0x19,0x32,0x38,0x31,0x27,0x2C,0x31,0x2A,0x9E,0xD1,0xFE,0x10,0x35,0x32,0x38,0x31,0x27,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0x9E,0x57,0x9E,0x0B,0x38,0x37,0x37,0x32,0x31,0x3F,0xFE,0x18,0x31,0x28,0x9E,0x0B,0x2F,0x38,0x28,0x9E,0x0C,0x32,0x2C,0x31,0x9E,0x2C,0x36,0x9E,0x3A,0x32,0x35,0x37,0x2B,0xFE,0x29,0x2C,0x39,0x28,0x9E,0x22,0x28,0x2F,0x2F,0x32,0x3A,0x9E,0x0C,0x32,0x2C,0x31,0x36,0x3F,0xFE,0x0B,0x38,0x37,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x2B,0x38,0x35,0x35,0x3C,0xF2,0xFE,0x1D,0x2B,0x28,0x9E,0x26,0x32,0x2C,0x31,0x36,0x9E,0x3A,0x2C,0x2F,0x2F,0x9E,0x27,0x2C,0x36,0x24,0x33,0x33,0x28,0x24,0x35,0xFE,0x2C,0x29,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x31,0x32,0x37,0x9E,0x34,0x38,0x2C,0x26,0x2E,0x9E,0x37,0x32,0xFE,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0xD1,0x30,0xF2,0x9E,0x1D,0x32,0x32,0x9E,0x25,0x24,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_079[] = { 0x18,0x3A,0x3A,0x3A,0x38,0x38,0xF2,0x9E,0x15,0x28,0x37,0x9E,0x30,0x28,0x9E,0x2A,0x32,0xF2,0xFE,0x1E,0x38,0x2E,0x28,0x28,0x9F,0x2E,0x28,0x28,0xF2,0x9E,0x12,0x9E,0x3A,0x24,0x36,0x9E,0x32,0x31,0x2F,0x3C,0xFE,0x37,0x28,0x24,0x36,0x2C,0x31,0x2A,0xF2,0x9E,0x0C,0x24,0x31,0x3E,0x37,0x9E,0xD2,0x9E,0x37,0x24,0x2E,0x28,0xFE,0x24,0x9E,0x2D,0x32,0x2E,0x28,0xF4,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x37,0x28,0x2F,0x2F,0x9E,0xD2,0x9E,0x3A,0x2B,0x24,0x37,0x6F,0x9E,0x2F,0x28,0x37,0x3E,0x36,0xFE,0x37,0x35,0x24,0x27,0x28,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x2F,0x28,0x37,0x9E,0x30,0x28,0x9E,0x2A,0x32,0x6F,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x2A,0x2C,0x39,0x28,0x9E,0xD2,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0xFE,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x2A,0x32,0x32,0x27,0x3F,0xFE,0x1C,0x32,0x6F,0x9E,0x2B,0x32,0x3A,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x2C,0x37,0xF4,0xFE,0xFE,0xD0,0xD0,0x0F,0x35,0x28,0x28,0x9E,0x2B,0x2C,0x30,0xD0,0x9E,0x11,0x32,0x2F,0x27,0x9E,0x32,0x31,0xFF };
+static const u8 dialog_text_DIALOG_080[] = { 0x0E,0x28,0x28,0x2B,0x9E,0x2B,0x28,0x28,0x9E,0x2B,0x28,0x28,0x9E,0x2B,0x28,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_081[] = { 0x1D,0x2B,0x28,0x9E,0x30,0x3C,0x36,0x37,0x28,0x35,0x3C,0x9E,0x2C,0x36,0x9E,0x32,0x29,0x9E,0x20,0x28,0x37,0xFE,0x32,0x35,0x9E,0x0D,0x35,0x3C,0x3F,0xFE,0x0A,0x31,0x27,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x9E,0x27,0x32,0x28,0x36,0x9E,0xD1,0xFE,0x36,0x32,0x2F,0x38,0x37,0x2C,0x32,0x31,0x9E,0x2F,0x2C,0x28,0xF4,0xFE,0x1D,0x2B,0x28,0x9E,0x26,0x2C,0x37,0x3C,0x9E,0x3A,0x28,0x2F,0x26,0x32,0x30,0x28,0x36,0x9E,0x39,0x2C,0x36,0x2C,0x37,0x32,0x35,0x36,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0x9E,0x27,0x28,0x33,0x37,0x2B,0x9E,0xD1,0x3C,0x9E,0x25,0x35,0x2C,0x31,0x2A,0xFE,0x24,0x36,0x9E,0xD1,0x3C,0x9E,0x28,0x31,0x37,0x28,0x35,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_082[] = { 0x11,0x32,0x2F,0x27,0x9E,0x32,0x31,0x9E,0x37,0x32,0x9E,0xD2,0x35,0x9E,0x2B,0x24,0x37,0xF2,0x9E,0x12,0x29,0xFE,0xD2,0x9E,0x2F,0x32,0x36,0x28,0x9E,0x2C,0x37,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0xFE,0x2C,0x31,0x2D,0x38,0x35,0x28,0x27,0x9E,0x28,0x24,0x36,0x2C,0x2F,0x3C,0x3F,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x27,0x32,0x9E,0x2F,0x32,0x36,0x28,0x9E,0xD2,0x35,0x9E,0x0C,0x24,0x33,0x6F,0xFE,0xD2,0x3E,0x2F,0x2F,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x29,0x2C,0x31,0x27,0x9E,0x2C,0x37,0x9E,0x2C,0x31,0xFE,0xD1,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x9E,0xD2,0xFE,0x2F,0x32,0x36,0x37,0x9E,0x2C,0x37,0x3F,0xFE,0x18,0x2B,0x6F,0x9E,0x25,0x32,0x3C,0x6F,0x9E,0x2C,0x37,0x3E,0x36,0x9E,0x31,0x32,0x37,0x9E,0x2F,0x32,0x32,0x2E,0x2C,0x31,0x2A,0xFE,0x2A,0x32,0x32,0x27,0x9E,0x29,0x32,0x35,0x9E,0x19,0x28,0x24,0x26,0x2B,0x3F,0x9E,0x1C,0x2B,0x28,0x3E,0x36,0xFE,0x36,0x37,0x2C,0x2F,0x2F,0x9E,0x37,0x35,0x24,0x33,0x33,0x28,0x27,0x9E,0x36,0x32,0x30,0x28,0x3A,0x2B,0x28,0x35,0x28,0xFE,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0xD1,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0xFE,0x37,0x32,0x9E,0x2B,0x28,0x2F,0x33,0x9E,0x2B,0x28,0x35,0xF2,0x9E,0x0D,0x2C,0x27,0x9E,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0xFE,0x37,0x2B,0x24,0x37,0x9E,0xD1,0x35,0x28,0x9E,0x24,0x35,0x28,0x9E,0x28,0x31,0x28,0x30,0x3C,0xFE,0x3A,0x32,0x35,0x2F,0x27,0x36,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0xD1,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0xF4,0xFE,0x22,0x38,0x33,0x3F,0x9E,0x12,0x37,0x3E,0x36,0x9E,0x37,0x35,0x38,0x28,0x3F,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x3E,0x36,0xFE,0x37,0x35,0x32,0x32,0x33,0x36,0x9E,0x24,0x35,0x28,0x9E,0xD1,0x35,0x28,0x6F,0x9E,0x37,0x32,0x32,0x3F,0xFE,0x18,0x2B,0x6F,0x9E,0x2B,0x28,0x35,0x28,0x6F,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x37,0x2B,0x2C,0x36,0x3F,0x9E,0x12,0x3E,0x39,0x28,0xFE,0x25,0x28,0x28,0x31,0x9E,0x2E,0x28,0x28,0x33,0x2C,0x31,0x2A,0x9E,0x2C,0x37,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_083[] = { 0x1D,0x2B,0x28,0x35,0x28,0x3E,0x36,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x36,0x37,0x35,0x24,0x31,0x2A,0x28,0xFE,0x24,0x25,0x32,0x38,0x37,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x26,0x2F,0x32,0x26,0x2E,0x3F,0x9E,0x0A,0x36,0x9E,0xD2,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x6F,0x9E,0x3A,0x24,0x37,0x26,0x2B,0x9E,0xD1,0xFE,0x33,0x32,0x36,0x2C,0x37,0x2C,0x32,0x31,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x25,0x2C,0x2A,0x9E,0x2B,0x24,0x31,0x27,0x3F,0xFE,0x18,0x2B,0x6F,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x3A,0x2B,0x24,0x37,0x9E,0x12,0x9E,0x29,0x32,0x38,0x31,0x27,0xF2,0xFE,0x11,0x28,0x35,0x28,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0x26,0x24,0x37,0x26,0x2B,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_084[] = { 0x22,0x28,0x28,0x32,0x3A,0x3A,0xF2,0x9E,0x1E,0x31,0x2B,0x24,0x31,0x27,0x9E,0x30,0x28,0x6F,0xFE,0x25,0x35,0x38,0x37,0x28,0xF2,0x9E,0x12,0x3E,0x30,0x9E,0x2F,0x24,0x37,0x28,0x6F,0x9E,0x36,0x32,0x9E,0x2F,0x24,0x37,0x28,0x6F,0xFE,0x12,0x9E,0x30,0x38,0x36,0x37,0x9E,0x30,0x24,0x2E,0x28,0x9E,0x2B,0x24,0x36,0x37,0x28,0xF2,0xFE,0x1D,0x2B,0x2C,0x36,0x9E,0x36,0x2B,0x2C,0x31,0x3C,0x9E,0x37,0x2B,0x2C,0x31,0x2A,0xF4,0x9E,0x16,0x2C,0x31,0x28,0xF2,0xFE,0x12,0x37,0x3E,0x36,0x9E,0x30,0x2C,0x31,0x28,0x3F,0x9E,0x0F,0x2C,0x31,0x27,0x28,0x35,0x36,0x6F,0xFE,0x2E,0x28,0x28,0x33,0x28,0x35,0x36,0x6F,0x9E,0x2F,0x32,0x36,0x28,0x35,0x36,0x3F,0x3F,0x3F,0xFE,0x15,0x24,0x37,0x28,0x6F,0x9E,0x2F,0x24,0x37,0x28,0x6F,0x9E,0x2F,0x24,0x37,0x28,0x3F,0x3F,0x3F,0xFE,0x18,0x38,0x26,0x2B,0xF2,0x9E,0x1D,0x24,0x2E,0x28,0x9E,0x2C,0x37,0x9E,0xD1,0x31,0xF2,0x9E,0x0A,0xFE,0x2A,0x2C,0x29,0x37,0x9E,0x29,0x35,0x32,0x30,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x6F,0x9E,0x2C,0x37,0x9E,0x3A,0x24,0x36,0x3F,0xFE,0x17,0x32,0x3A,0x9E,0x2F,0x28,0x37,0x9E,0x30,0x28,0x9E,0x25,0x28,0xF2,0x9E,0x12,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x24,0xFE,0x27,0x24,0x37,0x28,0xF2,0x9E,0x12,0x9E,0x26,0x24,0x31,0x31,0x32,0x37,0x9E,0x25,0x28,0x9E,0x2F,0x24,0x37,0x28,0xFE,0x29,0x32,0x35,0x9E,0x37,0x28,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_085[] = { 0x22,0x32,0x38,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x36,0x37,0x24,0x31,0x27,0x9E,0x24,0x9E,0x2A,0x2B,0x32,0x36,0x37,0xFE,0x32,0x29,0x9E,0x24,0x9E,0x26,0x2B,0x24,0x31,0x26,0x28,0x9E,0x2C,0x31,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x2B,0x32,0x38,0x36,0x28,0x3F,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x2F,0x2E,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x2B,0x28,0x35,0x28,0x6F,0xFE,0xD2,0x9E,0x27,0x28,0x36,0x28,0x35,0x39,0x28,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x24,0x9E,0x10,0x2B,0x32,0x38,0x2F,0x9E,0x16,0x28,0x27,0x24,0x2F,0x3F,0x3F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_086[] = { 0x1B,0x38,0x31,0x31,0x2C,0x31,0x2A,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0x9E,0x2C,0x31,0x9E,0x26,0x2C,0x35,0x26,0x2F,0x28,0x36,0xFE,0x30,0x24,0x2E,0x28,0x36,0x9E,0x36,0x32,0x30,0x28,0x9E,0x25,0x24,0x27,0x9E,0x2A,0x38,0x3C,0x36,0x9E,0x35,0x32,0x2F,0x2F,0xFE,0xD1,0x2C,0x35,0x9E,0x28,0x3C,0x28,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_087[] = { 0x1C,0x24,0x31,0x37,0x24,0x9E,0x0C,0x2F,0x24,0x38,0x36,0x9E,0x2C,0x36,0x31,0x3E,0x37,0x9E,0xD1,0x9E,0x32,0x31,0x2F,0x3C,0xFE,0x32,0x31,0x28,0x9E,0x3A,0x2B,0x32,0x9E,0x26,0x24,0x31,0x9E,0x2A,0x32,0x9E,0x27,0x32,0x3A,0x31,0x9E,0x24,0xFE,0x26,0x2B,0x2C,0x30,0x31,0x28,0x3C,0xF2,0x9E,0x0C,0x32,0x30,0x28,0x9E,0x32,0x31,0x9E,0x2C,0x31,0xF2,0xFE,0xD0,0x9F,0x9F,0x0C,0x24,0x25,0x2C,0x31,0x9E,0x19,0x35,0x32,0x33,0x35,0x2C,0x28,0x37,0x32,0x35,0xFF };
+static const u8 dialog_text_DIALOG_088[] = { 0x20,0x32,0x35,0x2E,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0xFE,0x0F,0x32,0x35,0x9E,0x37,0x2B,0x32,0x36,0x28,0x9E,0x3A,0x2B,0x32,0x9E,0x2A,0x28,0x37,0x9E,0x32,0x29,0x29,0xFE,0x2B,0x28,0x35,0x28,0xE6,0x9E,0x10,0x35,0x24,0x25,0x9E,0xD1,0x9E,0x33,0x32,0x2F,0x28,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x2F,0x28,0x29,0x37,0x9E,0x24,0x31,0x27,0x9E,0x36,0x2F,0x2C,0x27,0x28,0x9E,0x26,0x24,0x35,0x28,0x29,0x38,0x2F,0x2F,0x3C,0xFE,0x27,0x32,0x3A,0x31,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_089[] = { 0x0B,0x32,0x37,0x2B,0x9E,0x3A,0x24,0x3C,0x36,0x9E,0x29,0x35,0x24,0x38,0x2A,0x2B,0x37,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0x27,0x24,0x31,0x2A,0x28,0x35,0xF2,0x9E,0x20,0x24,0x37,0x26,0x2B,0x9E,0xD2,0x35,0x9E,0x29,0x28,0x28,0x37,0xF2,0xFE,0x1D,0x2B,0x32,0x36,0x28,0x9E,0x3A,0x2B,0x32,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x27,0x32,0x9E,0xD1,0xFE,0x15,0x32,0x31,0x2A,0x9E,0x13,0x38,0x30,0x33,0x6F,0x9E,0x37,0x36,0x2E,0x6F,0x9E,0x37,0x36,0x2E,0x3F,0x9E,0x16,0x24,0x2E,0x28,0xFE,0xD2,0x35,0x9E,0x3A,0x24,0x3C,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x3F,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x20,0x32,0x35,0x2E,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0xFE,0xD0,0xD0,0xD0,0x9E,0x0C,0x2F,0x32,0x38,0x27,0x3C,0x9E,0x16,0x24,0x3D,0x28,0xFE,0x15,0x28,0x29,0x37,0xE6,0x9E,0x0B,0x2F,0x24,0x26,0x2E,0x9E,0x11,0x32,0x2F,0x28,0xFE,0xD0,0xD0,0xD0,0x1E,0x31,0x27,0x28,0x35,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x15,0x24,0x2E,0x28,0xFE,0xFE,0x1B,0x28,0x27,0x9E,0x0C,0x2C,0x35,0x26,0x2F,0x28,0xE6,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0x9E,0x02,0xFE,0xD0,0xD0,0xD0,0xD0,0x9E,0x1E,0x31,0x27,0x28,0x35,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x15,0x24,0x2E,0x28,0xFE,0x0A,0x35,0x35,0x32,0x3A,0xE6,0x9E,0x22,0x32,0x38,0x9E,0x24,0x35,0x28,0x9E,0x2B,0x28,0x35,0x28,0xFF };
+static const u8 dialog_text_DIALOG_090[] = { 0x0B,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFE,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x36,0x37,0x28,0x33,0x33,0x28,0x27,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x9E,0x2C,0x31,0x37,0x32,0xFE,0x30,0x3C,0x9E,0x37,0x35,0x24,0x33,0x6F,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x36,0x9E,0x12,0x9E,0x2E,0x31,0x28,0x3A,0xFE,0xD2,0x9E,0x3A,0x32,0x38,0x2F,0x27,0xF2,0x9E,0x12,0x9E,0x3A,0x24,0x35,0x31,0x9E,0xD2,0x6F,0xFE,0xF5,0x0F,0x35,0x2C,0x28,0x31,0x27,0x6F,0xF6,0x9E,0x3A,0x24,0x37,0x26,0x2B,0x9E,0xD2,0x35,0xFE,0x36,0x37,0x28,0x33,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_091[] = { 0x0D,0x24,0x31,0x2A,0x28,0x35,0xF2,0xFE,0x1C,0x37,0x35,0x32,0x31,0x2A,0x9E,0x10,0x38,0x36,0x37,0x36,0xF2,0xFE,0x0B,0x38,0x37,0x9E,0xD1,0x9E,0x3A,0x2C,0x31,0x27,0x9E,0x30,0x24,0x2E,0x28,0x36,0x9E,0x24,0xFE,0x26,0x32,0x30,0x29,0x3C,0x9E,0x35,0x2C,0x27,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_092[] = { 0x19,0x28,0x36,0x37,0x28,0x35,0x2C,0x31,0x2A,0x9E,0x30,0x28,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x6F,0x9E,0x24,0x35,0x28,0xFE,0xD2,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF4,0x9E,0x0C,0x24,0x31,0x3E,0x37,0x9E,0xD2,0x9E,0x36,0x28,0x28,0xFE,0x37,0x2B,0x24,0x37,0x9E,0x12,0x3E,0x30,0x9E,0x2B,0x24,0x39,0x2C,0x31,0x2A,0x9E,0x24,0x9E,0x30,0x28,0x35,0x35,0x3C,0xFE,0x2F,0x2C,0x37,0x37,0x2F,0x28,0x9E,0x37,0x2C,0x30,0x28,0x6F,0x9E,0x30,0x24,0x2E,0x2C,0x31,0x2A,0xFE,0x30,0x2C,0x36,0x26,0x2B,0x2C,0x28,0x29,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x30,0x3C,0x9E,0x30,0x2C,0x31,0x2C,0x32,0x31,0x36,0xF4,0xFE,0x17,0x32,0x3A,0x6F,0x9E,0x35,0x28,0x37,0x38,0x35,0x31,0x9E,0x37,0x2B,0x32,0x36,0x28,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0xFE,0x16,0x3C,0x9E,0x37,0x35,0x32,0x32,0x33,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0xFE,0x31,0x28,0x28,0x27,0x9E,0xD1,0x30,0xF2,0x9E,0x0B,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_093[] = { 0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x22,0x32,0x38,0x9E,0x24,0x2A,0x24,0x2C,0x31,0xF2,0x9E,0x20,0x28,0x2F,0x2F,0xFE,0x37,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x29,0x2C,0x31,0x28,0x9F,0x9F,0x12,0x3E,0x39,0x28,0xFE,0x25,0x28,0x28,0x31,0x9E,0x2F,0x32,0x32,0x2E,0x2C,0x31,0x2A,0x9E,0x29,0x32,0x35,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0xFE,0x37,0x32,0x9E,0x29,0x35,0x3C,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x30,0x3C,0x9E,0x29,0x2C,0x35,0x28,0xFE,0x25,0x35,0x28,0x24,0x37,0x2B,0xF2,0xFE,0x22,0x32,0x38,0x35,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x2C,0x36,0xFE,0x38,0x36,0x28,0x2F,0x28,0x36,0x36,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x36,0x37,0x9E,0x30,0x28,0xF2,0xFE,0x22,0x32,0x38,0x35,0x9E,0x29,0x35,0x2C,0x28,0x31,0x27,0x36,0x9E,0x24,0x35,0x28,0x9E,0x24,0x2F,0x2F,0xFE,0x37,0x35,0x24,0x33,0x33,0x28,0x27,0x9E,0x3A,0x2C,0x37,0x2B,0x2C,0x31,0x9E,0xD1,0xFE,0x3A,0x24,0x2F,0x2F,0x36,0x3F,0x3F,0x3F,0xFE,0x0A,0x31,0x27,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x31,0x28,0x39,0x28,0x35,0x9E,0x36,0x28,0x28,0x9E,0xD1,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x24,0x2A,0x24,0x2C,0x31,0xF2,0xFE,0x0B,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_094[] = { 0x10,0x28,0x37,0x9E,0x24,0x9E,0x2A,0x32,0x32,0x27,0x9E,0x35,0x38,0x31,0x9E,0x38,0x33,0x9E,0xD1,0xFE,0x36,0x2F,0x32,0x33,0x28,0xF2,0x9E,0x0D,0x32,0x9E,0xD2,0x9E,0x35,0x28,0x30,0x28,0x30,0x25,0x28,0x35,0xFE,0xD1,0x9E,0x15,0x32,0x31,0x2A,0x9E,0x13,0x38,0x30,0x33,0xF4,0x9E,0x1B,0x38,0x31,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0xFE,0x57,0x6F,0x9E,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_095[] = { 0x1D,0x32,0x9E,0x35,0x28,0x24,0x27,0x9E,0x24,0x9E,0x36,0x2C,0x2A,0x31,0x6F,0x9E,0x36,0x37,0x24,0x31,0x27,0x9E,0x2C,0x31,0xFE,0x29,0x35,0x32,0x31,0x37,0x9E,0x32,0x29,0x9E,0x2C,0x37,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x55,0x6F,0xFE,0x2F,0x2C,0x2E,0x28,0x9E,0xD2,0x9E,0x27,0x2C,0x27,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x31,0x32,0x3A,0x3F,0xFE,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x37,0x24,0x2F,0x2E,0x9E,0x37,0x32,0xFE,0x24,0x9E,0x14,0x32,0x32,0x33,0x24,0x9E,0x1D,0x35,0x32,0x32,0x33,0x24,0x9E,0x32,0x35,0x9E,0x32,0xD1,0x35,0xFE,0x24,0x31,0x2C,0x30,0x24,0x2F,0x6F,0x9E,0x36,0x37,0x24,0x31,0x27,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x9E,0x2C,0x31,0xFE,0x29,0x35,0x32,0x31,0x37,0x9E,0x32,0x29,0x9E,0x2C,0x37,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0xFE,0x37,0x2B,0x24,0x37,0x9E,0x3A,0x28,0x35,0x28,0x9E,0x36,0x37,0x32,0x2F,0x28,0x31,0x9E,0x25,0x3C,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2C,0x31,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_096[] = { 0x1D,0x2B,0x28,0x9E,0x33,0x24,0x37,0x2B,0x9E,0x2C,0x36,0x9E,0x31,0x24,0x35,0x35,0x32,0x3A,0x9E,0x2B,0x28,0x35,0x28,0x3F,0xFE,0x0E,0x24,0x36,0x3C,0x9E,0x27,0x32,0x28,0x36,0x9E,0x2C,0x37,0xF2,0x9E,0x17,0x32,0x9E,0x32,0x31,0x28,0x9E,0x2C,0x36,0xFE,0x24,0x2F,0x2F,0x32,0x3A,0x28,0x27,0x9E,0x32,0x31,0x9E,0x37,0x32,0x33,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x30,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0xF2,0xFE,0x0A,0x31,0x27,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x3A,0x2B,0x24,0x37,0x3E,0x36,0xFE,0x2A,0x32,0x32,0x27,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x6F,0x9E,0xD2,0x9E,0x3A,0x32,0x31,0x3E,0x37,0xFE,0x3A,0x24,0x2E,0x28,0x9E,0x24,0x31,0x3C,0x32,0x31,0x28,0x9E,0x3A,0x2B,0x32,0x3E,0x36,0xFE,0x36,0x2F,0x28,0x28,0x33,0x2C,0x31,0x2A,0xF2,0xFE,0x16,0x32,0x39,0x28,0x9E,0x36,0x2F,0x32,0x3A,0x2F,0x3C,0x6F,0xFE,0x37,0x35,0x28,0x24,0x27,0x9E,0x2F,0x2C,0x2A,0x2B,0x37,0x2F,0x3C,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_097[] = { 0x0D,0x32,0x31,0x3E,0x37,0x9E,0x25,0x28,0x9E,0x24,0x9E,0x33,0x38,0x36,0x2B,0x32,0x39,0x28,0x35,0xF2,0xFE,0x12,0x29,0x9E,0x24,0x31,0x3C,0x32,0x31,0x28,0x9E,0x37,0x35,0x2C,0x28,0x36,0x9E,0x37,0x32,0x9E,0x36,0x2B,0x32,0x39,0x28,0xFE,0xD2,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0x6F,0x9E,0x33,0x38,0x36,0x2B,0x9E,0x25,0x24,0x26,0x2E,0xF2,0xFE,0x12,0x37,0x3E,0x36,0x9E,0x32,0x31,0x28,0x9F,0x32,0x31,0x9F,0x32,0x31,0x28,0x6F,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x24,0xFE,0x29,0x2C,0x28,0x35,0x3C,0x9E,0x29,0x2C,0x31,0x2C,0x36,0x2B,0x9E,0x29,0x32,0x35,0x9E,0xD1,0x9E,0x2F,0x32,0x36,0x28,0x35,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_098[] = { 0x0C,0x32,0x30,0x28,0x9E,0x32,0x31,0x9E,0x2C,0x31,0x9E,0x2B,0x28,0x35,0x28,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x2B,0x28,0x2B,0x6F,0x9E,0x2B,0x28,0x2B,0x6F,0x9E,0x2B,0x28,0x2B,0x3F,0x3F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_099[] = { 0x0E,0x2B,0x9E,0x2B,0x28,0x9E,0x2B,0x28,0x3F,0x3F,0x3F,0xFE,0x22,0x32,0x38,0x3E,0x35,0x28,0x9E,0x30,0x2C,0x31,0x28,0x6F,0x9E,0x31,0x32,0x3A,0x6F,0x9E,0x2B,0x28,0x28,0x9E,0x2B,0x28,0x28,0xF2,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x33,0x24,0x36,0x36,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x9E,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x3A,0x24,0x2F,0x2F,0x3F,0x9E,0x0C,0x24,0x31,0x9E,0xD2,0x9E,0x27,0x32,0xFE,0x37,0x2B,0x24,0x37,0xF4,0x9E,0x11,0x28,0x2B,0x6F,0x9E,0x2B,0x28,0x2B,0x6F,0x9E,0x2B,0x28,0x2B,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_100[] = { 0x1E,0x2E,0x2E,0x2C,0x2E,0x2C,0x3F,0x3F,0x3F,0x20,0x24,0x2E,0x2E,0x2C,0x2E,0x2C,0x3F,0x3F,0x3F,0x2E,0x28,0x28,0x9E,0x2E,0x28,0x28,0xF2,0xFE,0x11,0x24,0xF2,0x9E,0x12,0x9E,0x36,0x31,0x24,0x2A,0x2A,0x28,0x27,0x9E,0x2C,0x37,0xF2,0xFE,0x12,0x37,0x3E,0x36,0x9E,0x30,0x2C,0x31,0x28,0xF2,0x9E,0x11,0x28,0x28,0x2B,0x28,0x28,0x2B,0x28,0x28,0x28,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_101[] = { 0x0A,0x26,0x2E,0x2E,0xF2,0x9E,0x15,0x28,0x37,0x3F,0x3F,0x3F,0x2A,0x32,0x3F,0x3F,0x3F,0xFE,0x22,0x32,0x38,0x3E,0x35,0x28,0x3F,0x3F,0x3F,0x26,0x2B,0x32,0x2E,0x2C,0x31,0x2A,0x3F,0x3F,0x3F,0x30,0x28,0x3F,0x3F,0x3F,0xFE,0x0C,0x32,0x38,0x2A,0x2B,0x3F,0x3F,0x3F,0x12,0x3E,0x39,0x28,0x9E,0x25,0x28,0x28,0x31,0x9E,0x29,0x35,0x24,0x30,0x28,0x27,0xF2,0xFE,0x1D,0x2B,0x2C,0x36,0x9E,0x0C,0x24,0x33,0xF4,0x9E,0x18,0x2B,0x6F,0x9E,0x24,0x2F,0x2F,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x6F,0xFE,0x37,0x24,0x2E,0x28,0x9E,0x2C,0x37,0x3F,0x9E,0x12,0x37,0x3E,0x36,0x9E,0x24,0x9E,0x26,0x32,0x32,0x2F,0x9E,0x0C,0x24,0x33,0x6F,0xFE,0x25,0x38,0x37,0x9E,0x12,0x3E,0x2F,0x2F,0x9E,0x2A,0x2C,0x39,0x28,0x9E,0x2C,0x37,0x9E,0x25,0x24,0x26,0x2E,0x3F,0xFE,0x12,0x9E,0x37,0x2B,0x2C,0x31,0x2E,0x9E,0x2C,0x37,0x9E,0x2F,0x32,0x32,0x2E,0x36,0x9E,0x25,0x28,0x37,0x37,0x28,0x35,0x9E,0x32,0x31,0xFE,0x30,0x28,0x9E,0x37,0x2B,0x24,0x31,0x9E,0x2C,0x37,0x9E,0x27,0x32,0x28,0x36,0x9E,0x32,0x31,0x9E,0xD2,0x6F,0xFE,0x37,0x2B,0x32,0x38,0x2A,0x2B,0xF2,0x9E,0x0E,0x28,0x28,0x28,0x28,0xF2,0x9E,0x14,0x28,0x28,0x9E,0x2E,0x28,0x28,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_102[] = { 0x19,0x36,0x36,0x36,0x37,0xF2,0x9E,0x1D,0x2B,0x28,0x9E,0x0B,0x32,0x32,0x36,0x9E,0x24,0x35,0x28,0x9E,0x36,0x38,0x33,0x28,0x35,0xFE,0x36,0x2B,0x3C,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0xD1,0x30,0xFE,0x2C,0x31,0x9E,0xD1,0x9E,0x28,0x3C,0x28,0x36,0x6F,0x9E,0xD1,0x3C,0x9E,0x29,0x24,0x27,0x28,0xFE,0x24,0x3A,0x24,0x3C,0x6F,0x9E,0x25,0x38,0x37,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x37,0x38,0x35,0x31,0xFE,0xD2,0x35,0x9E,0x25,0x24,0x26,0x2E,0x6F,0x9E,0xD1,0x3C,0x9E,0x35,0x28,0x24,0x33,0x33,0x28,0x24,0x35,0x3F,0xFE,0x12,0x37,0x3E,0x36,0x9E,0x31,0x32,0x9E,0x38,0x36,0x28,0x9E,0x37,0x35,0x3C,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0x2B,0x2C,0x37,0xFE,0xD1,0x30,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD1,0x3C,0x3E,0x35,0x28,0x9E,0x29,0x24,0x27,0x2C,0x31,0x2A,0xFE,0x24,0x3A,0x24,0x3C,0x3F,0x9E,0x12,0x31,0x36,0x37,0x28,0x24,0x27,0x6F,0x9E,0x36,0x31,0x28,0x24,0x2E,0x9E,0x38,0x33,0xFE,0x25,0x28,0x2B,0x2C,0x31,0x27,0x9E,0xD1,0x30,0x9E,0x24,0x31,0x27,0x9E,0x33,0x38,0x31,0x26,0x2B,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_103[] = { 0x1E,0x33,0x32,0x31,0x9E,0x29,0x32,0x38,0x35,0x9E,0x37,0x32,0x3A,0x28,0x35,0x36,0xFE,0x32,0x31,0x28,0x9E,0x30,0x38,0x36,0x37,0x9E,0x24,0x2F,0x2C,0x2A,0x2B,0x37,0x3F,0x3F,0x3F,0xFE,0x1D,0x2B,0x28,0x31,0x9E,0x24,0x37,0x9E,0xD1,0x9E,0x33,0x28,0x24,0x2E,0xFE,0x36,0x2B,0x24,0x2F,0x2F,0x9E,0x36,0x2B,0x2C,0x31,0x28,0x9E,0xD1,0x9E,0x2F,0x2C,0x2A,0x2B,0x37,0x3F,0x3F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_104[] = { 0x1D,0x2B,0x28,0x9E,0x36,0x2B,0x24,0x27,0x32,0x3A,0x3C,0x9E,0x36,0x37,0x24,0x35,0x9E,0x2C,0x31,0x9E,0x29,0x35,0x32,0x31,0x37,0xFE,0x32,0x29,0x9E,0xD2,0x9E,0x2C,0x36,0x9E,0x24,0x9E,0xF5,0x1C,0x37,0x24,0x35,0xFE,0x16,0x24,0x35,0x2E,0x28,0x35,0x3F,0xF6,0x9E,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0xFE,0x24,0x2F,0x2F,0x9E,0x08,0x9E,0x1B,0x28,0x27,0x9E,0x0C,0x32,0x2C,0x31,0x36,0x6F,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0xFE,0x3A,0x2C,0x2F,0x2F,0x9E,0x24,0x33,0x33,0x28,0x24,0x35,0x9E,0x2B,0x28,0x35,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_105[] = { 0x1B,0x28,0x24,0x27,0x3C,0x9E,0x29,0x32,0x35,0x9E,0x25,0x2F,0x24,0x36,0x37,0x32,0x29,0x29,0xF2,0x9E,0x0C,0x32,0x30,0x28,0xFE,0x32,0x31,0x6F,0x9E,0x2B,0x32,0x33,0x9E,0x2C,0x31,0x37,0x32,0x9E,0xD1,0x9E,0x26,0x24,0x31,0x31,0x32,0x31,0xF2,0xFE,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x35,0x28,0x24,0x26,0x2B,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x32,0x31,0xFE,0xD1,0x9E,0x29,0x2F,0x32,0x24,0x37,0x2C,0x31,0x2A,0x9E,0x2C,0x36,0x2F,0x24,0x31,0x27,0x9E,0x25,0x3C,0xFE,0x38,0x36,0x2C,0x31,0x2A,0x9E,0xD1,0x9E,0x29,0x32,0x38,0x35,0x9E,0x26,0x24,0x31,0x31,0x32,0x31,0x36,0x3F,0xFE,0x1E,0x36,0x28,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x37,0x32,0xFE,0x24,0x2C,0x30,0x6F,0x9E,0xD1,0x31,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x29,0x2C,0x35,0x28,0x3F,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x2B,0x24,0x31,0x27,0x3C,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0xFE,0x2A,0x35,0x24,0x25,0x9E,0x32,0x31,0x9E,0x37,0x32,0x9E,0x37,0x35,0x28,0x28,0x36,0x9E,0x32,0x35,0x9E,0x33,0x32,0x2F,0x28,0x36,0xFE,0x37,0x32,0x9E,0x2F,0x24,0x31,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_106[] = { 0x1B,0x28,0x24,0x27,0x3C,0x9E,0x29,0x32,0x35,0x9E,0x25,0x2F,0x24,0x36,0x37,0x32,0x29,0x29,0xF2,0x9E,0x0C,0x32,0x30,0x28,0xFE,0x32,0x31,0x6F,0x9E,0x2B,0x32,0x33,0x9E,0x2C,0x31,0x37,0x32,0x9E,0xD1,0x9E,0x26,0x24,0x31,0x31,0x32,0x31,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_107[] = { 0x10,0x2B,0x32,0x36,0x37,0x36,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x27,0x32,0x31,0x3E,0x37,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x0D,0x12,0x0E,0xF2,0xFE,0x11,0x28,0x2B,0x6F,0x9E,0x2B,0x28,0x2B,0x6F,0x9E,0x2B,0x28,0x2B,0xF2,0xFE,0x0C,0x24,0x31,0x9E,0xD2,0x9E,0x2A,0x28,0x37,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x2B,0x28,0x35,0x28,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x24,0x2F,0x2C,0x39,0x28,0xF4,0xFF };
+static const u8 dialog_text_DIALOG_108[] = { 0x0B,0x32,0x32,0x32,0x32,0x32,0x32,0x9F,0x30,0xF2,0x9E,0x11,0x28,0x35,0x28,0x9E,0x26,0x32,0x30,0x28,0x36,0xFE,0xD1,0x9E,0x30,0x24,0x36,0x37,0x28,0x35,0x9E,0x32,0x29,0x9E,0x30,0x2C,0x36,0x26,0x2B,0x2C,0x28,0x29,0x6F,0xFE,0xD1,0x9E,0x37,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0x9E,0x37,0x28,0x35,0x35,0x32,0x35,0x6F,0xFE,0xD1,0x9E,0x0B,0x2C,0x2A,0x9E,0x0B,0x32,0x32,0xF2,0xFE,0x14,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0x3F,0x3F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_109[] = { 0x18,0x32,0x32,0x32,0x32,0x9E,0x17,0x32,0x32,0x32,0x32,0x32,0xF2,0xFE,0x1D,0x24,0x2F,0x2E,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x32,0x38,0x37,0x9F,0x32,0x29,0x9F,0x25,0x32,0x27,0x3C,0xFE,0x28,0x3B,0x33,0x28,0x35,0x2C,0x28,0x31,0x26,0x28,0x36,0x9F,0x9F,0x30,0x3C,0x9E,0x25,0x32,0x27,0x3C,0xFE,0x2B,0x24,0x36,0x9E,0x30,0x28,0x2F,0x37,0x28,0x27,0x9E,0x24,0x3A,0x24,0x3C,0xF2,0xFE,0x11,0x24,0x39,0x28,0x9E,0xD2,0x9E,0x35,0x38,0x31,0x9E,0x2C,0x31,0x9E,0x37,0x32,0x9E,0x24,0x31,0x3C,0xFE,0x2B,0x28,0x24,0x27,0x2B,0x38,0x31,0x37,0x28,0x35,0x36,0x9E,0x2F,0x24,0x37,0x28,0x2F,0x3C,0xF4,0xF4,0xFE,0x12,0x9E,0x26,0x32,0x38,0x2F,0x27,0x9E,0x36,0x38,0x35,0x28,0x9E,0x38,0x36,0x28,0x9E,0x24,0x9E,0x31,0x28,0x3A,0xFE,0x25,0x32,0x27,0x3C,0xF2,0xFE,0x0B,0x35,0x35,0x35,0xF2,0x9E,0x16,0x3C,0x9E,0x29,0x24,0x26,0x28,0x9E,0x30,0x2C,0x2A,0x2B,0x37,0xFE,0x29,0x35,0x28,0x28,0x3D,0x28,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x37,0x2B,0x2C,0x36,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_110[] = { 0x12,0x9E,0x31,0x28,0x28,0x27,0x9E,0x24,0x9E,0x2A,0x32,0x32,0x27,0x9E,0x2B,0x28,0x24,0x27,0x9E,0x32,0x31,0x9E,0x30,0x3C,0xFE,0x36,0x2B,0x32,0x38,0x2F,0x27,0x28,0x35,0x36,0x3F,0x9E,0x0D,0x32,0x9E,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x32,0x29,0xFE,0x24,0x31,0x3C,0x25,0x32,0x27,0x3C,0x9E,0x2C,0x31,0x9E,0x31,0x28,0x28,0x27,0x9E,0x32,0x29,0x9E,0x24,0x9E,0x2A,0x32,0x32,0x27,0xFE,0x25,0x32,0x27,0x3C,0xF4,0x9E,0x19,0x2F,0x28,0x24,0x36,0x28,0xF2,0x9E,0x12,0x3E,0x2F,0x2F,0x9E,0x29,0x32,0x2F,0x2F,0x32,0x3A,0xFE,0xD2,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x27,0x32,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_111[] = { 0x19,0x28,0x35,0x29,0x28,0x26,0x37,0xF2,0x9E,0x20,0x2B,0x24,0x37,0x9E,0x24,0x9E,0x2A,0x35,0x28,0x24,0x37,0xFE,0x31,0x28,0x3A,0x9E,0x25,0x32,0x27,0x3C,0xF2,0x9E,0x11,0x28,0x35,0x28,0x9F,0x9F,0x37,0x2B,0x2C,0x36,0x9E,0x2C,0x36,0x9E,0x24,0xFE,0x33,0x35,0x28,0x36,0x28,0x31,0x37,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0x9E,0x12,0x37,0x3E,0x36,0x9E,0x36,0x38,0x35,0x28,0xFE,0x37,0x32,0x9E,0x3A,0x24,0x35,0x30,0x9E,0xD2,0x9E,0x38,0x33,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_112[] = { 0x0C,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0x24,0x36,0x9E,0x30,0x24,0x31,0x3C,0x9E,0x26,0x32,0x2C,0x31,0x36,0x9E,0x24,0x36,0xFE,0x33,0x32,0x36,0x36,0x2C,0x25,0x2F,0x28,0xF2,0x9E,0x1D,0x2B,0x28,0x3C,0x3E,0x2F,0x2F,0x9E,0x35,0x28,0x29,0x2C,0x2F,0x2F,0xFE,0xD2,0x35,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x16,0x28,0x37,0x28,0x35,0x3F,0xFE,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x26,0x2B,0x28,0x26,0x2E,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0x9E,0x2B,0x32,0x3A,0xFE,0x30,0x24,0x31,0x3C,0x9E,0x26,0x32,0x2C,0x31,0x36,0x9E,0xD2,0x3E,0x39,0x28,0xFE,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x28,0x27,0x9E,0x2C,0x31,0x9E,0x28,0x24,0x26,0x2B,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x01,0x05,0x9E,0x28,0x31,0x28,0x30,0x3C,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x36,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x24,0x2F,0x36,0x32,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0xFE,0x33,0x32,0x3A,0x28,0x35,0x9E,0x25,0x3C,0x9E,0x37,0x32,0x38,0x26,0x2B,0x2C,0x31,0x2A,0x9E,0xD1,0xFE,0x1C,0x33,0x2C,0x31,0x31,0x2C,0x31,0x2A,0x9E,0x11,0x28,0x24,0x35,0x37,0x3F,0xFE,0xFE,0x1D,0x2B,0x28,0x9E,0x29,0x24,0x36,0x37,0x28,0x35,0x9E,0xD2,0x9E,0x35,0x38,0x31,0xFE,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0x9E,0xD1,0x9E,0x2B,0x28,0x24,0x35,0x37,0x6F,0x9E,0xD1,0xFE,0x30,0x32,0x35,0x28,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_113[] = { 0x1D,0x2B,0x28,0x35,0x28,0x9E,0x24,0x35,0x28,0x9E,0x36,0x33,0x28,0x26,0x2C,0x24,0x2F,0x9E,0x0C,0x24,0x33,0x36,0x9E,0x2C,0x31,0xFE,0xD1,0x9E,0x35,0x28,0x27,0x6F,0x9E,0x2A,0x35,0x28,0x28,0x31,0x9E,0x24,0x31,0x27,0x9E,0x25,0x2F,0x38,0x28,0xFE,0x25,0x2F,0x32,0x26,0x2E,0x36,0x3F,0x9E,0x1C,0x37,0x28,0x33,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x36,0x3A,0x2C,0x37,0x26,0x2B,0x28,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x2B,0x2C,0x27,0x27,0x28,0x31,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x36,0x9E,0x37,0x32,0x9E,0x24,0x26,0x37,0x2C,0x39,0x24,0x37,0x28,0x9E,0xD1,0xFE,0x0C,0x24,0x33,0x9E,0x0B,0x2F,0x32,0x26,0x2E,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_114[] = { 0x12,0x37,0x9E,0x30,0x24,0x2E,0x28,0x36,0x9E,0x30,0x28,0x9E,0x36,0x32,0x9E,0x30,0x24,0x27,0xF2,0x9E,0x20,0x28,0xFE,0x25,0x38,0x2C,0x2F,0x27,0x9E,0xD2,0x35,0x9E,0x2B,0x32,0x38,0x36,0x28,0x36,0x6F,0x9E,0xD2,0x35,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x36,0x3F,0x9E,0x20,0x28,0x9E,0x33,0x24,0x39,0x28,0x9E,0xD2,0x35,0xFE,0x35,0x32,0x24,0x27,0x36,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0x9E,0xD2,0xFE,0x3A,0x24,0x2F,0x2E,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x39,0x28,0x35,0x9E,0x38,0x36,0x3F,0xFE,0x0D,0x32,0x9E,0xD2,0x9E,0x28,0x39,0x28,0x35,0x9E,0x36,0x24,0x3C,0x9E,0x37,0x2B,0x24,0x31,0x2E,0xFE,0xD2,0xF4,0x9E,0x17,0x32,0xF2,0x9E,0x20,0x28,0x2F,0x2F,0x6F,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x31,0x32,0x37,0xFE,0x2A,0x32,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0x3A,0x2C,0x33,0x28,0x9E,0xD2,0x35,0x9E,0x29,0x28,0x28,0x37,0xFE,0x32,0x31,0x9E,0x30,0x28,0xF2,0x9E,0x12,0x9E,0x37,0x2B,0x2C,0x31,0x2E,0x9E,0x12,0x3E,0x2F,0x2F,0x9E,0x26,0x35,0x38,0x36,0x2B,0xFE,0xD2,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x29,0x32,0x35,0x9E,0x29,0x38,0x31,0xF2,0xFE,0x0D,0x32,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x24,0x9E,0x33,0x35,0x32,0x25,0x2F,0x28,0x30,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0x37,0x2B,0x24,0x37,0xF4,0x9E,0x13,0x38,0x36,0x37,0x9E,0x37,0x35,0x3C,0x9E,0x37,0x32,0xFE,0x33,0x32,0x38,0x31,0x27,0x9E,0x30,0x28,0x6F,0x9E,0x3A,0x2C,0x30,0x33,0xF2,0x9E,0x11,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_115[] = { 0x17,0x32,0xF2,0x9E,0x0C,0x35,0x38,0x36,0x2B,0x28,0x27,0x9E,0x24,0x2A,0x24,0x2C,0x31,0xF2,0xFE,0x12,0x3E,0x30,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x9E,0x36,0x37,0x28,0x33,0x33,0x2C,0x31,0x2A,0x9E,0x36,0x37,0x32,0x31,0x28,0x6F,0xFE,0x24,0x29,0x37,0x28,0x35,0x9E,0x24,0x2F,0x2F,0x3F,0x9E,0x12,0x9E,0x3A,0x32,0x31,0x3E,0x37,0x9E,0x2A,0x35,0x24,0x39,0x28,0x2F,0x6F,0xFE,0x28,0x35,0x6F,0x9E,0x2A,0x35,0x32,0x39,0x28,0x2F,0x3F,0x9E,0x11,0x28,0x35,0x28,0x6F,0x9E,0xD2,0x9E,0x3A,0x2C,0x31,0x3F,0xFE,0x1D,0x24,0x2E,0x28,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD2,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_116[] = { 0x20,0x2B,0x24,0x24,0x24,0x3F,0x3F,0x3F,0x3F,0x20,0x2B,0x24,0x24,0x24,0x37,0xF4,0xFE,0x0C,0x24,0x31,0x9E,0x2C,0x37,0x9E,0x25,0x28,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x24,0xFE,0x33,0x2C,0x33,0x36,0x34,0x38,0x28,0x24,0x2E,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0xD2,0x9E,0x2B,0x24,0x36,0xFE,0x27,0x28,0x29,0x38,0x36,0x28,0x27,0x9E,0xD1,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0xFE,0x2E,0x2C,0x31,0x2A,0xF4,0xF4,0xF4,0xF4,0xFE,0x22,0x32,0x38,0x9E,0x30,0x2C,0x2A,0x2B,0x37,0x9E,0x25,0x28,0x9E,0x29,0x24,0x36,0x37,0x9E,0x28,0x31,0x32,0x38,0x2A,0x2B,0xFE,0x37,0x32,0x9E,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x30,0x28,0x6F,0x9E,0x25,0x38,0x37,0x9E,0xD2,0x3E,0x2F,0x2F,0xFE,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0x9E,0x33,0x2C,0x26,0x2E,0x9E,0x38,0x33,0x9E,0xD1,0x9E,0x33,0x24,0x26,0x28,0xFE,0x2C,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x14,0x2C,0x31,0x2A,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x25,0x3C,0x9E,0xD1,0x9E,0x37,0x24,0x2C,0x2F,0x3F,0xFE,0x16,0x28,0x37,0x2B,0x2C,0x31,0x2E,0x36,0x9E,0x30,0x3C,0x9E,0x37,0x35,0x32,0x32,0x33,0x36,0x9E,0x26,0x32,0x38,0x2F,0x27,0xFE,0x2F,0x28,0x24,0x35,0x31,0x9E,0x24,0x9E,0x2F,0x28,0x36,0x36,0x32,0x31,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD2,0xF2,0xFE,0x11,0x28,0x35,0x28,0x9E,0x2C,0x36,0x9E,0xD2,0x35,0x9E,0x1C,0x37,0x24,0x35,0x6F,0x9E,0x24,0x36,0x9E,0x12,0xFE,0x33,0x35,0x32,0x30,0x2C,0x36,0x28,0x27,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x3F,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0x9E,0x30,0x28,0xFE,0x24,0x2A,0x24,0x2C,0x31,0x6F,0x9E,0x36,0x28,0x2F,0x28,0x26,0x37,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x1C,0x37,0x24,0x35,0xFE,0x29,0x35,0x32,0x30,0x9E,0xD1,0x9E,0x30,0x28,0x31,0x38,0x3F,0x9E,0x0F,0x32,0x35,0x9E,0x31,0x32,0x3A,0x6F,0xFE,0x29,0x24,0x35,0x28,0x3A,0x28,0x2F,0x2F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_117[] = { 0x20,0x2B,0x32,0x3F,0x3F,0x3F,0x3A,0x24,0x2F,0x2E,0x3F,0x3F,0x3F,0x2B,0x28,0x35,0x28,0xF4,0xFE,0x20,0x2B,0x32,0x3F,0x3F,0x3F,0x25,0x35,0x28,0x24,0x2E,0x3F,0x3F,0x3F,0x36,0x28,0x24,0x2F,0xF4,0xFE,0x20,0x24,0x2E,0x28,0x3F,0x3F,0x24,0x31,0x26,0x2C,0x28,0x31,0x37,0x3F,0x3F,0x32,0x31,0x28,0x36,0xF4,0xFE,0x20,0x28,0x9E,0x31,0x32,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x2F,0x2C,0x2A,0x2B,0x37,0x3F,0x3F,0x3F,0xFE,0x1B,0x35,0x35,0x35,0x38,0x30,0x30,0x25,0x25,0x25,0x2F,0x28,0x3F,0x3F,0x3F,0xFE,0x20,0x28,0x9E,0x31,0x32,0x9E,0x2F,0x2C,0x2E,0x28,0x3F,0x3F,0x3F,0x2C,0x31,0x37,0x35,0x38,0x27,0x28,0x35,0x36,0xF2,0xFE,0x17,0x32,0x3A,0x9E,0x25,0x24,0x37,0x37,0x2F,0x28,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x2B,0x24,0x31,0x27,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x37,0x32,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x2B,0x24,0x31,0x27,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_118[] = { 0x10,0x35,0x35,0x35,0x35,0x38,0x30,0x25,0x25,0x25,0x2F,0x28,0xF2,0xFE,0x20,0x2B,0x24,0x37,0x3F,0x3F,0x3F,0x2B,0x24,0x33,0x33,0x28,0x31,0xF4,0xFE,0x20,0x28,0x3F,0x3F,0x3F,0x26,0x35,0x38,0x36,0x2B,0x28,0x27,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x33,0x28,0x25,0x25,0x2F,0x28,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x36,0x32,0x9E,0x36,0x37,0x35,0x32,0x31,0x2A,0xF2,0xFE,0x22,0x32,0x38,0x9E,0x35,0x38,0x2F,0x28,0x9E,0x24,0x31,0x26,0x2C,0x28,0x31,0x37,0x9E,0x33,0x3C,0x35,0x24,0x30,0x2C,0x27,0xF2,0xFE,0x0F,0x32,0x35,0x9E,0x37,0x32,0x27,0x24,0x3C,0x3F,0x3F,0x3F,0xFE,0x17,0x32,0x3A,0x6F,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x32,0x29,0x9E,0x19,0x32,0x3A,0x28,0x35,0x3F,0xFE,0x20,0x28,0x3F,0x3F,0x3F,0x36,0x2F,0x28,0x28,0x33,0x3F,0x3F,0x3F,0x27,0x24,0x35,0x2E,0x31,0x28,0x36,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_119[] = { 0x10,0x35,0x35,0x35,0xF2,0x9E,0x12,0x9E,0x3A,0x24,0x36,0x9E,0x24,0x9E,0x25,0x2C,0x37,0xFE,0x26,0x24,0x35,0x28,0x2F,0x28,0x36,0x36,0x3F,0x9E,0x1D,0x2B,0x2C,0x36,0x9E,0x2C,0x36,0x9E,0x31,0x32,0x37,0x9E,0x24,0x36,0x9E,0x12,0xFE,0x2B,0x24,0x27,0x9E,0x33,0x2F,0x24,0x31,0x31,0x28,0x27,0x3F,0x3F,0x3F,0x25,0x38,0x37,0x9E,0x12,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0xFE,0x2B,0x32,0x2F,0x27,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x12,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0x9E,0x2B,0x24,0x39,0x28,0xFE,0x19,0x28,0x24,0x26,0x2B,0x3F,0xFE,0x0B,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x2A,0x28,0x37,0x9E,0x31,0x32,0xFE,0x30,0x32,0x35,0x28,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x29,0x35,0x32,0x30,0x9E,0x30,0x28,0xF2,0x9E,0x12,0x3E,0x30,0xFE,0x31,0x32,0x37,0x9E,0x29,0x2C,0x31,0x2C,0x36,0x2B,0x28,0x27,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD2,0x9E,0x3C,0x28,0x37,0x6F,0xFE,0x25,0x38,0x37,0x9E,0x12,0x3E,0x2F,0x2F,0x9E,0x2F,0x28,0x37,0x9E,0xD2,0x9E,0x2A,0x32,0x9E,0x29,0x32,0x35,0xFE,0x31,0x32,0x3A,0x3F,0x9E,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x33,0x24,0x3C,0x9E,0x29,0x32,0x35,0x9E,0x37,0x2B,0x2C,0x36,0x3F,0x3F,0x3F,0xFE,0x2F,0x24,0x37,0x28,0x35,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_120[] = { 0x18,0x32,0x32,0x3A,0x24,0x24,0x2B,0xF2,0x9E,0x0C,0x24,0x31,0x9E,0x2C,0x37,0x9E,0x25,0x28,0x9E,0x37,0x2B,0x24,0x37,0xFE,0x12,0x3E,0x39,0x28,0x9E,0x2F,0x32,0x36,0x37,0xF4,0xF4,0xF4,0x9E,0x1D,0x2B,0x28,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x2B,0x24,0x36,0x9E,0x29,0x24,0x2C,0x2F,0x28,0x27,0x9E,0x30,0x28,0x3F,0x3F,0x3F,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x37,0x2C,0x30,0x28,0x3F,0xFE,0x0C,0x32,0x31,0x36,0x2C,0x27,0x28,0x35,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x24,0x9E,0x27,0x35,0x24,0x3A,0x3F,0xFE,0x17,0x28,0x3B,0x37,0x9E,0x37,0x2C,0x30,0x28,0x6F,0x9E,0x12,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x2C,0x31,0xFE,0x33,0x28,0x35,0x29,0x28,0x26,0x37,0x9E,0x26,0x32,0x31,0x27,0x2C,0x37,0x2C,0x32,0x31,0x3F,0xFE,0xFE,0x17,0x32,0x3A,0x6F,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0xFE,0xD2,0x35,0x9E,0x33,0x35,0x28,0x26,0x2C,0x32,0x38,0x36,0x9E,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x6F,0xFE,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x37,0x32,0x33,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x37,0x32,0x3A,0x28,0x35,0x3F,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x3A,0x24,0x2C,0x37,0x2C,0x31,0x2A,0xF2,0xFE,0x10,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_121[] = { 0x17,0x32,0x32,0x32,0xF2,0x9E,0x12,0x37,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x25,0x28,0xF2,0xFE,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x25,0x28,0x24,0x37,0x28,0x31,0x9E,0x30,0x28,0x6F,0xFE,0x16,0x24,0x35,0x2C,0x32,0xF4,0xF2,0xF2,0x9E,0x12,0x9E,0x2A,0x24,0x39,0x28,0x9E,0x37,0x2B,0x32,0x36,0x28,0xFE,0x37,0x35,0x32,0x32,0x33,0x36,0x9E,0x33,0x32,0x3A,0x28,0x35,0x6F,0x9E,0x25,0x38,0x37,0x9E,0x31,0x32,0x3A,0xFE,0x2C,0x37,0x3E,0x36,0x9E,0x29,0x24,0x27,0x2C,0x31,0x2A,0x9E,0x24,0x3A,0x24,0x3C,0xF2,0xFE,0x0A,0x35,0x35,0x2A,0x2A,0x2B,0x2B,0xF2,0x9E,0x12,0x9E,0x26,0x24,0x31,0x9E,0x36,0x28,0x28,0x9E,0x33,0x28,0x24,0x26,0x28,0xFE,0x35,0x28,0x37,0x38,0x35,0x31,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x3A,0x32,0x35,0x2F,0x27,0xF2,0x9E,0x12,0xFE,0x26,0x24,0x31,0x3E,0x37,0x9E,0x36,0x37,0x24,0x31,0x27,0x9E,0x2C,0x37,0xF2,0x9E,0x11,0x30,0x30,0x30,0x3F,0x3F,0x3F,0xFE,0x12,0x37,0x3E,0x36,0x9E,0x31,0x32,0x37,0x9E,0x32,0x39,0x28,0x35,0x9E,0x3C,0x28,0x37,0x3F,0x3F,0x3F,0xFE,0xFE,0x0C,0x3E,0x30,0x32,0x31,0x9E,0x37,0x35,0x32,0x32,0x33,0x36,0xF2,0x9E,0x15,0x28,0x37,0x3E,0x36,0x9E,0x3A,0x24,0x37,0x26,0x2B,0xFE,0xD1,0x9E,0x28,0x31,0x27,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x2A,0x28,0xD1,0x35,0xF2,0xFE,0x0B,0x3A,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_122[] = { 0x1D,0x2B,0x28,0x9E,0x0B,0x2F,0x24,0x26,0x2E,0x9E,0x11,0x32,0x2F,0x28,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x20,0x32,0x35,0x2E,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0xFE,0xD0,0xD0,0xD0,0x9E,0x0C,0x2F,0x32,0x38,0x27,0x3C,0x9E,0x16,0x24,0x3D,0x28,0xFE,0x15,0x28,0x29,0x37,0xE6,0x9E,0x1E,0x31,0x27,0x28,0x35,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x15,0x24,0x2E,0x28,0xFF };
+static const u8 dialog_text_DIALOG_123[] = { 0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x39,0x28,0x35,0x31,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x1D,0x32,0x9E,0x20,0x24,0x37,0x28,0x35,0x29,0x24,0x2F,0x2F,0xFE,0x15,0x28,0x29,0x37,0xE6,0x9E,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0xFF };
+static const u8 dialog_text_DIALOG_124[] = { 0x20,0x32,0x35,0x2E,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0xFE,0x0D,0x24,0x31,0x2A,0x28,0x35,0xF2,0xF2,0xFE,0x1B,0x28,0x24,0x27,0x9E,0x2C,0x31,0x36,0x37,0x35,0x38,0x26,0x37,0x2C,0x32,0x31,0x36,0xFE,0x37,0x2B,0x32,0x35,0x32,0x38,0x2A,0x2B,0x2F,0x3C,0xF2,0xFE,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0x9E,0x26,0x32,0x31,0x37,0x2C,0x31,0x38,0x28,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x27,0x2C,0x35,0x28,0x26,0x37,0x2C,0x32,0x31,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x24,0x35,0x35,0x32,0x3A,0xFE,0x24,0x26,0x37,0x2C,0x39,0x24,0x37,0x28,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_125[] = { 0x11,0x24,0x3D,0x3C,0x9E,0x16,0x24,0x3D,0x28,0x9F,0x0E,0x3B,0x2C,0x37,0xFE,0x0D,0x24,0x31,0x2A,0x28,0x35,0xF2,0x9E,0x0C,0x2F,0x32,0x36,0x28,0x27,0x3F,0xFE,0x1D,0x38,0x35,0x31,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x31,0x32,0x3A,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_126[] = { 0x1E,0x33,0xE6,0x9E,0x0B,0x2F,0x24,0x26,0x2E,0x9E,0x11,0x32,0x2F,0x28,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x20,0x32,0x35,0x2E,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0xFE,0xD0,0xD0,0xD0,0x9E,0x11,0x24,0x3D,0x3C,0x9E,0x16,0x24,0x3D,0x28,0xFF };
+static const u8 dialog_text_DIALOG_127[] = { 0x1E,0x31,0x27,0x28,0x35,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x15,0x24,0x2E,0x28,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x39,0x28,0xFE,0x15,0x28,0x29,0x37,0xE6,0x9E,0x0A,0x25,0x24,0x31,0x27,0x32,0x31,0x28,0x27,0x9E,0x16,0x2C,0x31,0x28,0xFE,0xD0,0xD0,0xD0,0xE1,0x0C,0x2F,0x32,0x36,0x28,0x27,0xE3,0xFE,0x0A,0x9E,0x2A,0x28,0x31,0x37,0x2F,0x28,0x9E,0x36,0x28,0x24,0x9E,0x27,0x35,0x24,0x2A,0x32,0x31,0x9E,0x2F,0x2C,0x39,0x28,0x36,0xFE,0x2B,0x28,0x35,0x28,0x3F,0x9E,0x19,0x32,0x38,0x31,0x27,0x9E,0x32,0x31,0x9E,0x2B,0x2C,0x36,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x37,0x32,0xFE,0x30,0x24,0x2E,0x28,0x9E,0x2B,0x2C,0x30,0x9E,0x2F,0x32,0x3A,0x28,0x35,0x9E,0x2B,0x2C,0x36,0x9E,0x2B,0x28,0x24,0x27,0x3F,0xFE,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x25,0x28,0x26,0x32,0x30,0x28,0x9E,0x2B,0x2C,0x36,0x9E,0x2F,0x38,0x31,0x26,0x2B,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_128[] = { 0x22,0x32,0x38,0x9E,0x30,0x38,0x36,0x37,0x9E,0x29,0x2C,0x2A,0x2B,0x37,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0x2B,0x32,0x31,0x32,0x35,0xF2,0x9E,0x12,0x37,0x9E,0x2C,0x36,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x36,0x37,0x9E,0xD1,0xFE,0x35,0x32,0x3C,0x24,0x2F,0x9E,0x35,0x38,0x2F,0x28,0x36,0x9E,0x37,0x32,0x9E,0x37,0x2B,0x35,0x32,0x3A,0x9E,0xD1,0xFE,0x2E,0x2C,0x31,0x2A,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x35,0x2C,0x31,0x2A,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_129[] = { 0x20,0x28,0x2F,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0xFE,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x9E,0x0C,0x32,0x38,0x35,0x36,0x28,0xF2,0x9E,0x0A,0x2F,0x2F,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x25,0x2F,0x38,0x28,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x36,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x27,0xFE,0x3A,0x2C,0x2F,0x2F,0x9E,0x25,0x28,0x26,0x32,0x30,0x28,0x9E,0x36,0x32,0x2F,0x2C,0x27,0x9E,0x32,0x31,0x26,0x28,0x9E,0xD2,0xFE,0x36,0x37,0x28,0x33,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x3F,0xFE,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x27,0x2C,0x36,0x24,0x33,0x33,0x28,0x24,0x35,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0xFE,0x33,0x38,0x37,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0x9E,0x0C,0x24,0x33,0x6F,0x9E,0x36,0x32,0xFE,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x24,0x25,0x2F,0x28,0x9E,0x37,0x32,0x9E,0x28,0x2F,0x38,0x27,0x28,0xFE,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0x9E,0x24,0x31,0x27,0x9E,0x3A,0x24,0x2F,0x2E,0x9E,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0xFE,0x30,0x24,0x31,0x3C,0x9E,0x37,0x2B,0x2C,0x31,0x2A,0x36,0x3F,0x9E,0x1D,0x35,0x3C,0x9E,0x2C,0x37,0x9E,0x32,0x38,0x37,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_130[] = { 0x20,0x28,0x2F,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x16,0x28,0x37,0x24,0x2F,0x9E,0x0C,0x24,0x33,0xFE,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x9E,0x0C,0x32,0x38,0x35,0x36,0x28,0xF2,0x9E,0x18,0x31,0x26,0x28,0x9E,0xD2,0xFE,0x36,0x37,0x28,0x33,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x6F,0xFE,0xD1,0x9E,0x2A,0x35,0x28,0x28,0x31,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x36,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x25,0x28,0x26,0x32,0x30,0x28,0x9E,0x36,0x32,0x2F,0x2C,0x27,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x37,0x38,0x35,0x31,0x9E,0xD2,0x35,0x9E,0x25,0x32,0x27,0x3C,0xFE,0x2C,0x31,0x37,0x32,0x9E,0x30,0x28,0x37,0x24,0x2F,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0x9E,0x16,0x28,0x37,0x24,0x2F,0xFE,0x0C,0x24,0x33,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x3A,0x24,0x2F,0x2E,0xFE,0x38,0x31,0x27,0x28,0x35,0x3A,0x24,0x37,0x28,0x35,0xF2,0x9E,0x1D,0x35,0x3C,0x9E,0x2C,0x37,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_131[] = { 0x20,0x28,0x2F,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0xFE,0x0C,0x32,0x38,0x35,0x36,0x28,0xF2,0x9E,0x1C,0x37,0x28,0x33,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x35,0x28,0x27,0xFE,0x36,0x3A,0x2C,0x37,0x26,0x2B,0x9E,0x24,0x37,0x9E,0xD1,0x9E,0x37,0x32,0x33,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x37,0x32,0x3A,0x28,0x35,0x6F,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x28,0x31,0x37,0x28,0x35,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x35,0x24,0x2C,0x31,0x25,0x32,0x3A,0x9E,0x35,0x2C,0x31,0x2A,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x37,0x35,0x2C,0x2A,0x2A,0x28,0x35,0x9E,0xD1,0xFE,0x36,0x3A,0x2C,0x37,0x26,0x2B,0x6F,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x35,0x28,0x27,0xFE,0x25,0x2F,0x32,0x26,0x2E,0x36,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x27,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x25,0x28,0x26,0x32,0x30,0x28,0x9E,0x36,0x32,0x2F,0x2C,0x27,0x3F,0xFE,0xFE,0x1D,0x35,0x3C,0x9E,0x32,0x38,0x37,0x9E,0xD1,0x9E,0x20,0x2C,0x31,0x2A,0x9E,0x0C,0x24,0x33,0xF2,0x9E,0x0D,0x32,0xFE,0xD1,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0x9E,0x13,0x38,0x30,0x33,0x9E,0x37,0x32,0x9E,0x37,0x24,0x2E,0x28,0xFE,0x32,0x29,0x29,0x9E,0x24,0x31,0x27,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x9E,0x37,0x32,0x9E,0x2F,0x24,0x31,0x27,0x3F,0xFE,0xFE,0xFE,0x19,0x38,0x2F,0x2F,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0xFE,0x1C,0x37,0x2C,0x26,0x2E,0x9E,0x37,0x32,0x9E,0x2A,0x32,0x9E,0x38,0x33,0x9E,0x24,0x31,0x27,0x9E,0x33,0x38,0x36,0x2B,0xFE,0x29,0x32,0x35,0x3A,0x24,0x35,0x27,0x9E,0x37,0x32,0x9E,0x31,0x32,0x36,0x28,0x9E,0x27,0x32,0x3A,0x31,0x6F,0xFE,0x2D,0x38,0x36,0x37,0x9E,0x24,0x36,0x9E,0xD2,0x9E,0x3A,0x32,0x38,0x2F,0x27,0x9E,0x3A,0x2B,0x28,0x31,0xFE,0x29,0x2F,0x3C,0x2C,0x31,0x2A,0x9E,0x24,0x31,0x9E,0x24,0x2C,0x35,0x33,0x2F,0x24,0x31,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_132[] = { 0x20,0x2B,0x32,0x24,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0x33,0x24,0x2F,0x6F,0x9E,0xD2,0xFE,0x24,0x35,0x28,0x31,0x3E,0x37,0x9E,0x37,0x35,0x3C,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0x26,0x2B,0x28,0x24,0x37,0x6F,0xFE,0x24,0x35,0x28,0x9E,0xD2,0xF4,0x9E,0x1C,0x2B,0x32,0x35,0x37,0x26,0x38,0x37,0x36,0x9E,0x24,0x35,0x28,0x31,0x3E,0x37,0xFE,0x24,0x2F,0x2F,0x32,0x3A,0x28,0x27,0x3F,0xFE,0x17,0x32,0x3A,0x6F,0x9E,0x12,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x37,0x2B,0x24,0x37,0x9E,0xD2,0xFE,0x2E,0x31,0x32,0x3A,0x9E,0x25,0x28,0x37,0x37,0x28,0x35,0x3F,0x9E,0x22,0x32,0x38,0x3E,0x35,0x28,0xFE,0x27,0x2C,0x36,0x34,0x38,0x24,0x2F,0x2C,0x29,0x2C,0x28,0x27,0xF2,0x9E,0x17,0x28,0x3B,0x37,0x9E,0x37,0x2C,0x30,0x28,0x6F,0xFE,0x33,0x2F,0x24,0x3C,0x9E,0x29,0x24,0x2C,0x35,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_133[] = { 0x0A,0x30,0x9E,0x12,0x9E,0x2A,0x2F,0x24,0x27,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0x9E,0xD2,0xF2,0x9E,0x1D,0x2B,0x28,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x3F,0x3F,0x3F,0x24,0x31,0x27,0x9E,0x12,0x3F,0x3F,0x3F,0x24,0x31,0x27,0x6F,0xFE,0x3A,0x28,0x2F,0x2F,0x6F,0x9E,0x28,0x39,0x28,0x35,0x3C,0x25,0x32,0x27,0x3C,0x3F,0x3F,0x3F,0x3A,0x28,0x3E,0x35,0x28,0x9E,0x24,0x2F,0x2F,0xFE,0x37,0x35,0x24,0x33,0x33,0x28,0x27,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0xFE,0x3A,0x24,0x2F,0x2F,0x36,0x3F,0xFE,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2B,0x24,0x36,0x9E,0x36,0x37,0x32,0x2F,0x28,0x31,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3E,0x36,0x9E,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x28,0x3E,0x36,0xFE,0x38,0x36,0x2C,0x31,0x2A,0x9E,0xD1,0x2C,0x35,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x37,0x32,0xFE,0x26,0x35,0x28,0x24,0x37,0x28,0x9E,0x2B,0x2C,0x36,0x9E,0x32,0x3A,0x31,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x9E,0x2C,0x31,0xFE,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0x36,0x9E,0x24,0x31,0x27,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0x3F,0xFE,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0xFE,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x0A,0x36,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x27,0x9E,0xD1,0x30,0x6F,0xFE,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x38,0x36,0x28,0x9E,0xD1,0x2C,0x35,0x9E,0x33,0x32,0x3A,0x28,0x35,0xFE,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x27,0x32,0x32,0x35,0x36,0x9E,0x37,0x2B,0x24,0x37,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2B,0x24,0x36,0x9E,0x36,0x28,0x24,0x2F,0x28,0x27,0x3F,0xFE,0xFE,0x1D,0x2B,0x28,0x35,0x28,0x9E,0x24,0x35,0x28,0x9E,0x29,0x32,0x38,0x35,0x9E,0x35,0x32,0x32,0x30,0x36,0x9E,0x32,0x31,0xFE,0xD1,0x9E,0x29,0x2C,0x35,0x36,0x37,0x9E,0x29,0x2F,0x32,0x32,0x35,0x3F,0x9E,0x1C,0x37,0x24,0x35,0x37,0x9E,0x2C,0x31,0xFE,0xD1,0x9E,0x32,0x31,0x28,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0xFE,0x32,0x29,0x9E,0x0B,0x32,0x25,0x9F,0x32,0x30,0x25,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x3F,0x9E,0x12,0x37,0x3E,0x36,0xFE,0xD1,0x9E,0x32,0x31,0x2F,0x3C,0x9E,0x35,0x32,0x32,0x30,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0xFE,0x2B,0x24,0x36,0x31,0x3E,0x37,0x9E,0x36,0x28,0x24,0x2F,0x28,0x27,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0x28,0x2C,0x2A,0x2B,0x37,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0xFE,0x24,0x25,0x2F,0x28,0x9E,0x37,0x32,0x9E,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x27,0x32,0x32,0x35,0xFE,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0x9E,0x25,0x2C,0x2A,0x9E,0x36,0x37,0x24,0x35,0x3F,0x9E,0x1D,0x2B,0x28,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x30,0x38,0x36,0x37,0x9E,0x25,0x28,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_134[] = { 0x1D,0x2B,0x28,0x9E,0x31,0x24,0x30,0x28,0x36,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0xFE,0x24,0x35,0x28,0x9E,0x24,0x2F,0x36,0x32,0x9E,0x2B,0x2C,0x31,0x37,0x36,0x9E,0x29,0x32,0x35,0xFE,0x29,0x2C,0x31,0x27,0x2C,0x31,0x2A,0x9E,0xD1,0x30,0x3F,0x9E,0x1D,0x2B,0x28,0x3C,0x9E,0x24,0x35,0x28,0xFE,0x27,0x2C,0x36,0x33,0x2F,0x24,0x3C,0x28,0x27,0x9E,0x24,0x37,0x9E,0xD1,0x9E,0x25,0x28,0x2A,0x2C,0x31,0x31,0x2C,0x31,0x2A,0xFE,0x32,0x29,0x9E,0x28,0x24,0x26,0x2B,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3F,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0xFE,0x2C,0x31,0x9E,0x24,0x31,0x3C,0x9E,0x32,0x35,0x27,0x28,0x35,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x3A,0x32,0x31,0x3E,0x37,0xFE,0x29,0x2C,0x31,0x27,0x9E,0x36,0x32,0x30,0x28,0x9E,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0xFE,0x32,0x35,0x9E,0x2C,0x37,0x28,0x30,0x36,0x9E,0x38,0x31,0x2F,0x28,0x36,0x36,0x9E,0xD2,0x9E,0x36,0x28,0x2F,0x28,0x26,0x37,0xFE,0x24,0x9E,0x36,0x33,0x28,0x26,0x2C,0x29,0x2C,0x26,0x9E,0x1C,0x37,0x24,0x35,0x3F,0xFE,0x0A,0x29,0x37,0x28,0x35,0x9E,0xD2,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0x36,0x32,0x30,0x28,0xFE,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x37,0x35,0x3C,0xFE,0x24,0x31,0x32,0xD1,0x35,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3F,0xFE,0x20,0x28,0x3E,0x35,0x28,0x9E,0x24,0x2F,0x2F,0x9E,0x3A,0x24,0x2C,0x37,0x2C,0x31,0x2A,0x9E,0x29,0x32,0x35,0xFE,0xD2,0x35,0x9E,0x2B,0x28,0x2F,0x33,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_135[] = { 0x12,0x37,0x9E,0x3A,0x24,0x36,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x3A,0x2B,0x32,0x9E,0x36,0x37,0x32,0x2F,0x28,0xFE,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0x3F,0x9E,0x12,0x9E,0x36,0x24,0x3A,0x9E,0x2B,0x2C,0x30,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0x30,0x3C,0x9E,0x32,0x3A,0x31,0x9E,0x28,0x3C,0x28,0x36,0xF2,0xFE,0xFE,0xFE,0x11,0x28,0x3E,0x36,0x9E,0x2B,0x2C,0x27,0x27,0x28,0x31,0x9E,0x36,0x2C,0x3B,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x2C,0x31,0xFE,0x28,0x24,0x26,0x2B,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x6F,0x9E,0x25,0x38,0x37,0x9E,0xD2,0xFE,0x3A,0x32,0x31,0x3E,0x37,0x9E,0x29,0x2C,0x31,0x27,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0x9E,0xD1,0x30,0x9E,0x2C,0x31,0xFE,0x36,0x32,0x30,0x28,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x36,0x9E,0x38,0x31,0x37,0x2C,0x2F,0x9E,0xD2,0xFE,0x33,0x35,0x28,0x36,0x36,0x9E,0xD1,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x28,0x36,0x3F,0xFE,0x1D,0x2B,0x28,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0xD2,0x3E,0x39,0x28,0x9E,0x29,0x32,0x38,0x31,0x27,0xFE,0x3A,0x2C,0x2F,0x2F,0x9E,0x36,0x2B,0x32,0x3A,0x9E,0x32,0x31,0x9E,0x28,0x24,0x26,0x2B,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3E,0x36,0xFE,0x36,0x37,0x24,0x35,0x37,0x2C,0x31,0x2A,0x9E,0x36,0x26,0x35,0x28,0x28,0x31,0x3F,0xFE,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x3A,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x36,0x28,0x28,0x9E,0x36,0x32,0x30,0x28,0xFE,0x32,0x29,0x9E,0xD1,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0x9E,0xD2,0x3E,0x39,0x28,0xFE,0x24,0x2F,0x35,0x28,0x24,0x27,0x3C,0x9E,0x27,0x28,0x29,0x28,0x24,0x37,0x28,0x27,0x6F,0x9E,0x36,0x28,0x2F,0x28,0x26,0x37,0xFE,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0xD2,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0xFE,0x29,0x35,0x32,0x30,0x9E,0xD1,0x30,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_136[] = { 0x20,0x32,0x3A,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x24,0x2F,0x35,0x28,0x24,0x27,0x3C,0xFE,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x30,0x24,0x31,0x3C,0xFE,0x1C,0x37,0x24,0x35,0x36,0xF4,0x9E,0x20,0x24,0x3C,0x9E,0x37,0x32,0x9E,0x2A,0x32,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0xFE,0x12,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x37,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x38,0x36,0x9E,0x32,0x38,0x37,0xFE,0x32,0x29,0x9E,0x2B,0x28,0x35,0x28,0x9E,0x2C,0x31,0x9E,0x31,0x32,0x9E,0x37,0x2C,0x30,0x28,0xF2,0xFE,0xFE,0x0B,0x28,0x9E,0x26,0x24,0x35,0x28,0x29,0x38,0x2F,0x6F,0x9E,0x37,0x2B,0x32,0x38,0x2A,0x2B,0x3F,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x2C,0x36,0x9E,0x25,0x24,0x31,0x27,0xFE,0x3A,0x35,0x32,0x37,0x28,0x9E,0xD1,0x9E,0x25,0x32,0x32,0x2E,0x9E,0x32,0x31,0x9E,0xF5,0x25,0x24,0x27,0x3F,0xF6,0xFE,0x1D,0x24,0x2E,0x28,0x9E,0x30,0x3C,0x9E,0x24,0x27,0x39,0x2C,0x26,0x28,0xE6,0x9E,0x20,0x2B,0x28,0x31,0x9E,0xD2,0xFE,0x31,0x28,0x28,0x27,0x9E,0x37,0x32,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x9E,0x29,0x35,0x32,0x30,0xFE,0x2C,0x31,0x2D,0x38,0x35,0x2C,0x28,0x36,0x6F,0x9E,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0x26,0x32,0x2C,0x31,0x36,0x3F,0xFE,0x22,0x28,0x2F,0x2F,0x32,0x3A,0x9E,0x0C,0x32,0x2C,0x31,0x36,0x9E,0x35,0x28,0x29,0x2C,0x2F,0x2F,0x9E,0x32,0x31,0x28,0xFE,0x33,0x2C,0x28,0x26,0x28,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x16,0x28,0x37,0x28,0x35,0x6F,0xFE,0x1B,0x28,0x27,0x9E,0x0C,0x32,0x2C,0x31,0x36,0x9E,0x35,0x28,0x29,0x2C,0x2F,0x2F,0x9E,0x37,0x3A,0x32,0xFE,0x33,0x2C,0x28,0x26,0x28,0x36,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x0B,0x2F,0x38,0x28,0x9E,0x0C,0x32,0x2C,0x31,0x36,0xFE,0x35,0x28,0x29,0x2C,0x2F,0x2F,0x9E,0x29,0x2C,0x39,0x28,0x3F,0xFE,0xFE,0x1D,0x32,0x9E,0x30,0x24,0x2E,0x28,0x9E,0x0B,0x2F,0x38,0x28,0x9E,0x0C,0x32,0x2C,0x31,0x36,0xFE,0x24,0x33,0x33,0x28,0x24,0x35,0x6F,0x9E,0x33,0x32,0x38,0x31,0x27,0x9E,0x32,0x31,0x9E,0x0B,0x2F,0x38,0x28,0xFE,0x0C,0x32,0x2C,0x31,0x9E,0x0B,0x2F,0x32,0x26,0x2E,0x36,0x3F,0xFE,0xFE,0xFE,0xFE,0x0A,0x2F,0x36,0x32,0x6F,0x9E,0x2C,0x29,0x9E,0xD2,0x9E,0x29,0x24,0x2F,0x2F,0x9E,0x29,0x35,0x32,0x30,0xFE,0x2B,0x2C,0x2A,0x2B,0x9E,0x33,0x2F,0x24,0x26,0x28,0x36,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0xFE,0x30,0x2C,0x31,0x2C,0x30,0x2C,0x3D,0x28,0x9E,0x27,0x24,0x30,0x24,0x2A,0x28,0x9E,0x2C,0x29,0x9E,0xD2,0xFE,0x19,0x32,0x38,0x31,0x27,0x9E,0xD1,0x9E,0x10,0x35,0x32,0x38,0x31,0x27,0x9E,0x24,0x36,0x9E,0xD2,0xFE,0x2F,0x24,0x31,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_137[] = { 0x1D,0x2B,0x24,0x31,0x2E,0x36,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x1D,0x2B,0x28,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0xFE,0x2C,0x36,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x2C,0x31,0x2A,0x9E,0x2C,0x37,0x36,0x9E,0x28,0x31,0x28,0x35,0x2A,0x3C,0xFE,0x24,0x36,0x9E,0xD2,0x9E,0x35,0x28,0x37,0x35,0x2C,0x28,0x39,0x28,0x9E,0x19,0x32,0x3A,0x28,0x35,0xFE,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x24,0x31,0x27,0x9E,0xD2,0x3E,0x39,0x28,0x9E,0x26,0x2B,0x24,0x36,0x28,0x27,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0x2B,0x28,0x35,0x28,0x6F,0xFE,0x32,0x31,0x9E,0x37,0x32,0x9E,0x36,0x32,0x30,0x28,0x9E,0x24,0x35,0x28,0x24,0x9E,0x24,0x2B,0x28,0x24,0x27,0x3F,0xFE,0x18,0x2B,0x6F,0x9E,0x25,0x3C,0x9E,0xD1,0x9E,0x25,0x3C,0x6F,0x9E,0x24,0x35,0x28,0x9E,0xD2,0xFE,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x2C,0x31,0x2A,0x9E,0x26,0x32,0x2C,0x31,0x36,0xF4,0x9E,0x1C,0x33,0x28,0x26,0x2C,0x24,0x2F,0xFE,0x1C,0x37,0x24,0x35,0x36,0x9E,0x24,0x33,0x33,0x28,0x24,0x35,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0xFE,0x26,0x32,0x2F,0x2F,0x28,0x26,0x37,0x9E,0x01,0x00,0x00,0x9E,0x26,0x32,0x2C,0x31,0x36,0x9E,0x2C,0x31,0x9E,0x28,0x24,0x26,0x2B,0xFE,0x32,0x29,0x9E,0xD1,0x9E,0x01,0x05,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x36,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_138[] = { 0x0D,0x32,0x3A,0x31,0xE6,0x9E,0x1E,0x31,0x27,0x28,0x35,0x2A,0x35,0x32,0x38,0x31,0x27,0x9E,0x15,0x24,0x2E,0x28,0xFE,0x15,0x28,0x29,0x37,0xE6,0x9E,0x0B,0x2F,0x24,0x26,0x2E,0x9E,0x11,0x32,0x2F,0x28,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x11,0x24,0x3D,0x3C,0x9E,0x16,0x24,0x3D,0x28,0x9E,0xE1,0x0C,0x2F,0x32,0x36,0x28,0x27,0xE3,0xFF };
+static const u8 dialog_text_DIALOG_139[] = { 0x0A,0x25,0x32,0x39,0x28,0xE6,0x9E,0x0A,0x38,0x37,0x32,0x30,0x24,0x37,0x2C,0x26,0x9E,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0xFE,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0x9E,0x25,0x28,0x2A,0x2C,0x31,0x36,0xFE,0x24,0x38,0x37,0x32,0x30,0x24,0x37,0x2C,0x26,0x24,0x2F,0x2F,0x3C,0x9E,0x24,0x31,0x27,0x9E,0x29,0x32,0x2F,0x2F,0x32,0x3A,0x36,0xFE,0x33,0x35,0x28,0x9F,0x36,0x28,0x37,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x3F,0xFE,0x12,0x37,0x9E,0x27,0x2C,0x36,0x24,0x33,0x33,0x28,0x24,0x35,0x36,0xFE,0x24,0x38,0x37,0x32,0x30,0x24,0x37,0x2C,0x26,0x24,0x2F,0x2F,0x3C,0x6F,0x9E,0x37,0x32,0x32,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_140[] = { 0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0x9E,0x0A,0x35,0x28,0x24,0xFE,0x1B,0x2C,0x2A,0x2B,0x37,0xE6,0x9E,0x11,0x24,0x3D,0x3C,0x9E,0x16,0x24,0x3D,0x28,0xFE,0xD0,0xD0,0xD0,0x9E,0x0E,0x31,0x37,0x35,0x24,0x31,0x26,0x28,0xFE,0x15,0x28,0x29,0x37,0xE6,0x9E,0x0B,0x2F,0x24,0x26,0x2E,0x9E,0x11,0x32,0x2F,0x28,0xFE,0xD0,0xD0,0xD0,0x0E,0x2F,0x28,0x39,0x24,0x37,0x32,0x35,0x9E,0x01,0xFE,0x0A,0x35,0x35,0x32,0x3A,0xE6,0x9E,0x22,0x32,0x38,0x9E,0x24,0x35,0x28,0x9E,0x2B,0x28,0x35,0x28,0xFF };
+static const u8 dialog_text_DIALOG_141[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0x9E,0x32,0x31,0x28,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x36,0x37,0x32,0x2F,0x28,0x31,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0xFE,0x17,0x32,0x3A,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x32,0x33,0x28,0x31,0x9E,0x36,0x32,0x30,0x28,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x36,0x28,0x24,0x2F,0x28,0x27,0x9E,0x27,0x32,0x32,0x35,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFE,0x1D,0x35,0x3C,0x9E,0xD1,0x9E,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x3E,0x36,0x9E,0x35,0x32,0x32,0x30,0xFE,0x32,0x31,0x9E,0xD1,0x9E,0x36,0x28,0x26,0x32,0x31,0x27,0x9E,0x29,0x2F,0x32,0x32,0x35,0x9E,0x24,0x31,0x27,0xFE,0xD1,0x9E,0x35,0x32,0x32,0x30,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0xFE,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0x9E,0x32,0x29,0x9E,0x20,0x2B,0x32,0x30,0x33,0x3E,0x36,0xFE,0x0F,0x32,0x35,0x37,0x35,0x28,0x36,0x36,0x9E,0x32,0x31,0x9E,0x0F,0x2F,0x32,0x32,0x35,0x9E,0x01,0x3F,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x3E,0x36,0x9E,0x37,0x35,0x32,0x32,0x33,0x36,0x9E,0x24,0x35,0x28,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0xFE,0x2A,0x24,0x2C,0x31,0x2C,0x31,0x2A,0x9E,0x33,0x32,0x3A,0x28,0x35,0x6F,0x9E,0x36,0x32,0x9E,0xD2,0xFE,0x26,0x24,0x31,0x3E,0x37,0x9E,0x2A,0x2C,0x39,0x28,0x9E,0x38,0x33,0x3F,0x9E,0x1C,0x24,0x39,0x28,0x9E,0x38,0x36,0x6F,0xFE,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x14,0x28,0x28,0x33,0x9E,0x36,0x28,0x24,0x35,0x26,0x2B,0x2C,0x31,0x2A,0x9E,0x29,0x32,0x35,0xFE,0x1C,0x37,0x24,0x35,0x36,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_142[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0x9E,0x37,0x2B,0x35,0x28,0x28,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x17,0x32,0x3A,0x9E,0xD2,0x9E,0x26,0x24,0x31,0xFE,0x32,0x33,0x28,0x31,0x9E,0x24,0x31,0x3C,0x9E,0x27,0x32,0x32,0x35,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x24,0x9E,0x03,0xFE,0x32,0x31,0x9E,0x2C,0x37,0x36,0x9E,0x36,0x37,0x24,0x35,0x3F,0xFE,0xFE,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0x9E,0x26,0x32,0x30,0x28,0x9E,0x24,0x31,0x27,0x9E,0x2A,0x32,0x9E,0x29,0x35,0x32,0x30,0xFE,0xD1,0x9E,0x32,0x33,0x28,0x31,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x36,0x9E,0x24,0x36,0x9E,0xD2,0xFE,0x33,0x2F,0x28,0x24,0x36,0x28,0x3F,0x9E,0x1D,0x2B,0x28,0x9E,0x28,0x31,0x28,0x30,0x2C,0x28,0x36,0x9E,0x24,0x2B,0x28,0x24,0x27,0xFE,0x24,0x35,0x28,0x9E,0x28,0x39,0x28,0x31,0x9E,0x30,0x28,0x24,0x31,0x28,0x35,0x6F,0x9E,0x36,0x32,0x9E,0x25,0x28,0xFE,0x26,0x24,0x35,0x28,0x29,0x38,0x2F,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_143[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0x9E,0x28,0x2C,0x2A,0x2B,0x37,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x17,0x32,0x3A,0x9E,0xD2,0xFE,0x26,0x24,0x31,0x9E,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x27,0x32,0x32,0x35,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0xD1,0x9E,0x25,0x2C,0x2A,0x9E,0x1C,0x37,0x24,0x35,0xF2,0x9E,0x0B,0x38,0x37,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0xFE,0x2C,0x36,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x2B,0x28,0x24,0x27,0x3F,0x3F,0x3F,0x26,0x24,0x31,0x9E,0xD2,0xFE,0x2B,0x28,0x24,0x35,0x9E,0xD1,0x9E,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x26,0x24,0x2F,0x2F,0x2C,0x31,0x2A,0xF4,0xFF };
+static const u8 dialog_text_DIALOG_144[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0x9E,0x03,0x00,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x17,0x32,0x3A,0x9E,0xD2,0x9E,0x26,0x24,0x31,0xFE,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x27,0x32,0x32,0x35,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0xD1,0xFE,0x25,0x2C,0x2A,0x9E,0x1C,0x37,0x24,0x35,0xF2,0x9E,0x0B,0x38,0x37,0x9E,0x25,0x28,0x29,0x32,0x35,0x28,0x9E,0xD2,0xFE,0x30,0x32,0x39,0x28,0x9E,0x32,0x31,0x6F,0x9E,0x2B,0x32,0x3A,0x3E,0x36,0x9E,0x2C,0x37,0x9E,0x2A,0x32,0x2C,0x31,0x2A,0xFE,0x32,0xD1,0x35,0x3A,0x2C,0x36,0x28,0xF4,0xFE,0x0D,0x2C,0x27,0x9E,0xD2,0x9E,0x33,0x32,0x38,0x31,0x27,0x9E,0xD1,0x9E,0x37,0x3A,0x32,0xFE,0x26,0x32,0x2F,0x38,0x30,0x31,0x36,0x9E,0x27,0x32,0x3A,0x31,0xF4,0x9E,0x22,0x32,0x38,0x9E,0x27,0x2C,0x27,0x31,0x3E,0x37,0xFE,0x2F,0x32,0x36,0x28,0x9E,0xD2,0x35,0x9E,0x2B,0x24,0x37,0x6F,0x9E,0x27,0x2C,0x27,0x9E,0xD2,0xF4,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x27,0x2C,0x27,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x37,0x32,0xFE,0x36,0x37,0x32,0x30,0x33,0x9E,0x32,0x31,0x9E,0xD1,0x9E,0x26,0x32,0x31,0x27,0x32,0x35,0x9E,0x37,0x32,0xFE,0x2A,0x28,0x37,0x9E,0x2C,0x37,0x9E,0x25,0x24,0x26,0x2E,0xF2,0xFE,0x1D,0x2B,0x28,0x3C,0x9E,0x36,0x24,0x3C,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x2B,0x24,0x36,0xFE,0x36,0x31,0x28,0x24,0x2E,0x28,0x27,0x9E,0x32,0x38,0x37,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x36,0x28,0x24,0xFE,0x24,0x31,0x27,0x9E,0x2C,0x31,0x37,0x32,0x9E,0xD1,0x9E,0x38,0x31,0x27,0x28,0x35,0x2A,0x35,0x32,0x38,0x31,0x27,0x3F,0xFE,0x11,0x24,0x39,0x28,0x9E,0xD2,0x9E,0x29,0x2C,0x31,0x24,0x2F,0x2F,0x3C,0xFE,0x26,0x32,0x35,0x31,0x28,0x35,0x28,0x27,0x9E,0x2B,0x2C,0x30,0xF4,0xFF };
+static const u8 dialog_text_DIALOG_145[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0x28,0x27,0x9E,0x05,0x00,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x17,0x32,0x3A,0x9E,0xD2,0x9E,0x26,0x24,0x31,0xFE,0x32,0x33,0x28,0x31,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x0D,0x32,0x32,0x35,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x37,0x2B,0x2C,0x35,0x27,0x9E,0x29,0x2F,0x32,0x32,0x35,0x3F,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x3E,0x36,0xFE,0xD1,0x35,0x28,0x6F,0x9E,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0x3F,0xFE,0xFE,0x18,0x2B,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x29,0x32,0x38,0x31,0x27,0x9E,0x24,0x2F,0x2F,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x0C,0x24,0x33,0x9E,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x28,0x36,0x6F,0x9E,0x2B,0x24,0x39,0x28,0x31,0x3E,0x37,0xFE,0xD2,0xF4,0x9E,0x1B,0x28,0x27,0x6F,0x9E,0x2A,0x35,0x28,0x28,0x31,0x9E,0x24,0x31,0x27,0x9E,0x25,0x2F,0x38,0x28,0xF4,0xFE,0x1D,0x2B,0x28,0x9E,0x0C,0x24,0x33,0x36,0x9E,0xD2,0x9E,0x2A,0x28,0x37,0x9E,0x29,0x35,0x32,0x30,0x9E,0xD1,0xFE,0x26,0x32,0x2F,0x32,0x35,0x28,0x27,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x36,0x9E,0x24,0x35,0x28,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0xFE,0x2B,0x28,0x2F,0x33,0x29,0x38,0x2F,0x3F,0xFE,0x11,0x38,0x35,0x35,0x3C,0x9E,0x24,0x2F,0x32,0x31,0x2A,0x6F,0x9E,0x31,0x32,0x3A,0x3F,0x9E,0x1D,0x2B,0x28,0xFE,0x37,0x2B,0x2C,0x35,0x27,0x9E,0x29,0x2F,0x32,0x32,0x35,0x9E,0x2C,0x36,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x2B,0x28,0x24,0x27,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_146[] = { 0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x29,0x32,0x38,0x31,0x27,0x9E,0x07,0x00,0x9E,0x19,0x32,0x3A,0x28,0x35,0xFE,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x1D,0x2B,0x28,0x9E,0x30,0x3C,0x36,0x37,0x28,0x35,0x3C,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x28,0x31,0x27,0x2F,0x28,0x36,0x36,0x9E,0x36,0x37,0x24,0x2C,0x35,0x36,0x9E,0x2C,0x36,0x9E,0x36,0x32,0x2F,0x39,0x28,0x27,0x6F,0xFE,0x37,0x2B,0x24,0x31,0x2E,0x36,0x9E,0x37,0x32,0x9E,0xD2,0x9F,0x9F,0x24,0x31,0x27,0x9E,0x2C,0x36,0xFE,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x28,0x39,0x28,0x35,0x9E,0x38,0x33,0x36,0x28,0x37,0xF2,0x9E,0x17,0x32,0x3A,0x6F,0xFE,0x32,0x31,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x29,0x2C,0x31,0x24,0x2F,0x9E,0x25,0x32,0x38,0x37,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_147[] = { 0x0A,0x35,0x28,0x9E,0xD2,0x9E,0x38,0x36,0x2C,0x31,0x2A,0x9E,0xD1,0x9E,0x0C,0x24,0x33,0xFE,0x0B,0x2F,0x32,0x26,0x2E,0x36,0xF4,0x9E,0x22,0x32,0x38,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x36,0x2B,0x32,0x38,0x2F,0x27,0x6F,0xFE,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0x3F,0xFE,0xFE,0xFE,0x1D,0x32,0x9E,0x30,0x24,0x2E,0x28,0x9E,0xD1,0x30,0x9E,0x36,0x32,0x2F,0x2C,0x27,0x9E,0x36,0x32,0x9E,0xD2,0xFE,0x26,0x24,0x31,0x9E,0x25,0x35,0x28,0x24,0x2E,0x9E,0xD1,0x30,0x6F,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0xFE,0x37,0x32,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0xD1,0x9E,0x26,0x32,0x2F,0x32,0x35,0x28,0x27,0x9E,0x0C,0x24,0x33,0xFE,0x1C,0x3A,0x2C,0x37,0x26,0x2B,0x28,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3E,0x36,0xFE,0x2B,0x2C,0x27,0x27,0x28,0x31,0x9E,0x26,0x32,0x38,0x35,0x36,0x28,0x36,0x3F,0xFE,0x22,0x32,0x38,0x3E,0x2F,0x2F,0x9E,0x29,0x2C,0x31,0x27,0x9E,0xD1,0x9E,0x2B,0x2C,0x27,0x27,0x28,0x31,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x36,0x9E,0x32,0x31,0x2F,0x3C,0x9E,0x24,0x29,0x37,0x28,0x35,0xFE,0x35,0x28,0x2A,0x24,0x2C,0x31,0x2C,0x31,0x2A,0x9E,0x36,0x32,0x30,0x28,0x9E,0x32,0x29,0x9E,0xD1,0xFE,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x3F,0xFE,0xFE,0x1D,0x2B,0x28,0x9E,0x0C,0x24,0x33,0x9E,0x0B,0x2F,0x32,0x26,0x2E,0x36,0x9E,0x24,0x35,0x28,0x9E,0x24,0x9E,0x25,0x2C,0x2A,0xFE,0x2B,0x28,0x2F,0x33,0xF2,0x9E,0x1B,0x28,0x27,0x9E,0x29,0x32,0x35,0x9E,0xD1,0x9E,0x20,0x2C,0x31,0x2A,0xFE,0x0C,0x24,0x33,0x6F,0x9E,0x2A,0x35,0x28,0x28,0x31,0x9E,0x29,0x32,0x35,0x9E,0xD1,0x9E,0x16,0x28,0x37,0x24,0x2F,0xFE,0x0C,0x24,0x33,0x6F,0x9E,0x25,0x2F,0x38,0x28,0x9E,0x29,0x32,0x35,0x9E,0xD1,0x9E,0x1F,0x24,0x31,0x2C,0x36,0x2B,0xFE,0x0C,0x24,0x33,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_148[] = { 0x1C,0x31,0x32,0x3A,0x30,0x24,0x31,0x9E,0x16,0x32,0x38,0x31,0x37,0x24,0x2C,0x31,0x9E,0x24,0x2B,0x28,0x24,0x27,0x3F,0xFE,0x14,0x28,0x28,0x33,0x9E,0x32,0x38,0x37,0xF2,0x9E,0x0A,0x31,0x27,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x37,0x35,0x3C,0xFE,0xD1,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0x9E,0x13,0x38,0x30,0x33,0x9E,0x32,0x39,0x28,0x35,0x9E,0xD1,0xFE,0x2C,0x26,0x28,0x9E,0x25,0x2F,0x32,0x26,0x2E,0x9E,0x36,0x2B,0x32,0x32,0x37,0x28,0x35,0x3F,0xFE,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x29,0x24,0x2F,0x2F,0x9E,0x2C,0x31,0x37,0x32,0x9E,0xD1,0xFE,0x29,0x35,0x28,0x28,0x3D,0x2C,0x31,0x2A,0x9E,0x33,0x32,0x31,0x27,0x6F,0x9E,0xD2,0x35,0x9E,0x33,0x32,0x3A,0x28,0x35,0xFE,0x27,0x28,0x26,0x35,0x28,0x24,0x36,0x28,0x36,0x9E,0x34,0x38,0x2C,0x26,0x2E,0x2F,0x3C,0x6F,0x9E,0x24,0x31,0x27,0xFE,0xD2,0x9E,0x3A,0x32,0x31,0x3E,0x37,0x9E,0x35,0x28,0x26,0x32,0x39,0x28,0x35,0xFE,0x24,0x38,0x37,0x32,0x30,0x24,0x37,0x2C,0x26,0x24,0x2F,0x2F,0x3C,0x3F,0xFE,0xD0,0xD0,0x9F,0x9F,0x1D,0x2B,0x28,0x9E,0x1C,0x31,0x32,0x3A,0x30,0x24,0x31,0xFF };
+static const u8 dialog_text_DIALOG_149[] = { 0x20,0x28,0x2F,0x26,0x32,0x30,0x28,0x9E,0x37,0x32,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x1D,0x32,0x24,0x27,0x36,0x37,0x32,0x32,0x2F,0x3E,0x36,0xFE,0x36,0x28,0x26,0x35,0x28,0x37,0x9E,0x36,0x2F,0x2C,0x27,0x28,0xF2,0xFE,0x1D,0x2B,0x28,0x35,0x28,0x3E,0x36,0x9E,0x24,0x9E,0x1C,0x37,0x24,0x35,0x9E,0x2B,0x2C,0x27,0x27,0x28,0x31,0xFE,0x2B,0x28,0x35,0x28,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0x26,0x32,0x38,0x2F,0x27,0x31,0x3E,0x37,0xFE,0x29,0x2C,0x31,0x27,0x3F,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x36,0x2F,0x2C,0x27,0x28,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0xFE,0x29,0x32,0x35,0x3A,0x24,0x35,0x27,0x9E,0x37,0x32,0x9E,0x36,0x33,0x28,0x28,0x27,0x9E,0x38,0x33,0x6F,0xFE,0x33,0x38,0x2F,0x2F,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x37,0x32,0x9E,0x36,0x2F,0x32,0x3A,0x9E,0x27,0x32,0x3A,0x31,0x3F,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x36,0x2F,0x2C,0x27,0x28,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0xFE,0x29,0x24,0x36,0x37,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x3A,0x2C,0x31,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_150[] = { 0x20,0x24,0x24,0x24,0x24,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x29,0x2F,0x32,0x32,0x27,0x28,0x27,0x9E,0x30,0x3C,0xFE,0x2B,0x32,0x38,0x36,0x28,0xF2,0x9E,0x20,0x2B,0x9F,0x3A,0x2B,0x3C,0xF4,0xF4,0x9E,0x15,0x32,0x32,0x2E,0x9E,0x24,0x37,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x30,0x28,0x36,0x36,0xF2,0x9E,0x20,0x2B,0x24,0x37,0x9E,0x24,0x30,0x9E,0x12,0xFE,0x2A,0x32,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0x27,0x32,0x9E,0x31,0x32,0x3A,0xF4,0xFE,0xFE,0x1D,0x2B,0x28,0x9E,0x26,0x28,0x2C,0x2F,0x2C,0x31,0x2A,0x3E,0x36,0x9E,0x35,0x38,0x2C,0x31,0x28,0x27,0x6F,0x9E,0xD1,0xFE,0x29,0x2F,0x32,0x32,0x35,0x9E,0x2C,0x36,0x9E,0x36,0x32,0x24,0x2E,0x28,0x27,0x3F,0x3F,0x3F,0x3A,0x2B,0x24,0x37,0x9E,0x37,0x32,0xFE,0x27,0x32,0x6F,0x9E,0x3A,0x2B,0x24,0x37,0x9E,0x37,0x32,0x9E,0x27,0x32,0xF4,0x9E,0x11,0x38,0x29,0x29,0x3F,0x3F,0x3F,0xFE,0x2B,0x38,0x29,0x29,0x3F,0x3F,0x3F,0x2C,0x37,0x9E,0x30,0x24,0x2E,0x28,0x36,0x9E,0x30,0x28,0x9E,0x36,0x32,0x3F,0x3F,0x3F,0xFE,0x16,0x0A,0x0D,0xF2,0xF2,0xF2,0xFE,0x0E,0x39,0x28,0x35,0x3C,0x37,0x2B,0x2C,0x31,0x2A,0x3E,0x36,0x9E,0x25,0x28,0x28,0x31,0x9E,0x2A,0x32,0x2C,0x31,0x2A,0xFE,0x3A,0x35,0x32,0x31,0x2A,0x9E,0x28,0x39,0x28,0x35,0x9E,0x36,0x2C,0x31,0x26,0x28,0x9E,0x12,0x9E,0x2A,0x32,0x37,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x1C,0x37,0x24,0x35,0x3F,0x3F,0x3F,0x12,0x37,0x3E,0x36,0x9E,0x36,0x32,0x9E,0x36,0x2B,0x2C,0x31,0x3C,0x6F,0xFE,0x25,0x38,0x37,0x9E,0x2C,0x37,0x9E,0x30,0x24,0x2E,0x28,0x36,0x9E,0x30,0x28,0x9E,0x29,0x28,0x28,0x2F,0x3F,0x3F,0x3F,0xFE,0x36,0x37,0x35,0x24,0x31,0x2A,0x28,0x3F,0x3F,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_151[] = { 0x12,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x24,0x31,0x3C,0x30,0x32,0x35,0x28,0xF2,0x9E,0x0F,0x2C,0x35,0x36,0x37,0x9E,0xD2,0x9E,0x2A,0x28,0x37,0xFE,0x30,0x28,0x9E,0x24,0x2F,0x2F,0x9E,0x3A,0x28,0x37,0x6F,0x9E,0xD1,0x31,0x9E,0xD2,0xFE,0x36,0x37,0x32,0x30,0x33,0x9E,0x32,0x31,0x9E,0x30,0x28,0xF2,0xFE,0x17,0x32,0x3A,0x9E,0x12,0x3E,0x30,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x6F,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x6F,0xFE,0x1B,0x0E,0x0A,0x15,0x15,0x22,0x9E,0x30,0x24,0x27,0xF2,0xFE,0x20,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0xF2,0xF2,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_152[] = { 0x18,0x3A,0x3A,0x26,0x2B,0xF2,0x9E,0x1E,0x31,0x26,0x2F,0x28,0xF2,0x9E,0x1E,0x31,0x26,0x2F,0x28,0xF2,0xFE,0x18,0x2E,0x24,0x3C,0x6F,0x9E,0x12,0x9E,0x2A,0x2C,0x39,0x28,0x3F,0x9E,0x1D,0x24,0x2E,0x28,0x9E,0x37,0x2B,0x2C,0x36,0xFE,0x1C,0x37,0x24,0x35,0xF2,0xFE,0x20,0x2B,0x28,0x3A,0xF2,0x9E,0x12,0x9E,0x29,0x28,0x28,0x2F,0x9E,0x25,0x28,0x37,0x37,0x28,0x35,0x9E,0x31,0x32,0x3A,0x3F,0xFE,0x12,0x9E,0x27,0x32,0x31,0x3E,0x37,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x31,0x28,0x28,0x27,0x9E,0x2C,0x37,0xFE,0x24,0x31,0x3C,0x30,0x32,0x35,0x28,0x6F,0x9E,0x24,0x31,0x3C,0x3A,0x24,0x3C,0x9F,0x9F,0xFE,0x12,0x9E,0x26,0x24,0x31,0x9E,0x36,0x28,0x28,0x9E,0xD1,0x9E,0x36,0x37,0x24,0x35,0x36,0xFE,0x37,0x2B,0x35,0x32,0x38,0x2A,0x2B,0x9E,0x30,0x3C,0x9E,0x26,0x28,0x2C,0x2F,0x2C,0x31,0x2A,0x9E,0x24,0x37,0xFE,0x31,0x2C,0x2A,0x2B,0x37,0x3F,0xFE,0x1D,0x2B,0x28,0x3C,0x9E,0x30,0x24,0x2E,0x28,0x9E,0x30,0x28,0x9E,0x29,0x28,0x28,0x2F,0x3F,0x3F,0x3F,0xFE,0x3F,0x3F,0x3F,0x33,0x28,0x24,0x26,0x28,0x29,0x38,0x2F,0x3F,0x9E,0x19,0x2F,0x28,0x24,0x36,0x28,0x6F,0x9E,0x26,0x32,0x30,0x28,0xFE,0x25,0x24,0x26,0x2E,0x9E,0x24,0x31,0x27,0x9E,0x39,0x2C,0x36,0x2C,0x37,0x9E,0x24,0x31,0x3C,0x37,0x2C,0x30,0x28,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_153[] = { 0x11,0x28,0x3C,0xF2,0x9E,0x20,0x2B,0x32,0x3E,0x36,0x9E,0xD1,0x35,0x28,0xF4,0xFE,0x20,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x26,0x2F,0x2C,0x30,0x25,0x2C,0x31,0x2A,0x9E,0x32,0x31,0x9E,0x30,0x28,0xF4,0xFE,0x12,0x36,0x9E,0x2C,0x37,0x9E,0x24,0x31,0x9E,0x2C,0x26,0x28,0x9E,0x24,0x31,0x37,0xF4,0xFE,0x0A,0x9E,0x36,0x31,0x32,0x3A,0x9E,0x29,0x2F,0x28,0x24,0xF4,0xFE,0x20,0x2B,0x24,0x37,0x28,0x39,0x28,0x35,0x9E,0x2C,0x37,0x9E,0x2C,0x36,0x6F,0x9E,0x2C,0x37,0x3E,0x36,0xFE,0x25,0x38,0x2A,0x2A,0x2C,0x31,0x2A,0x9E,0x30,0x28,0xF2,0x9E,0x12,0x9E,0x37,0x2B,0x2C,0x31,0x2E,0x9E,0x12,0x3E,0x2F,0x2F,0xFE,0x25,0x2F,0x32,0x3A,0x9E,0x2C,0x37,0x9E,0x24,0x3A,0x24,0x3C,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_154[] = { 0x11,0x32,0x2F,0x27,0x9E,0x32,0x31,0x9E,0x37,0x32,0x9E,0xD2,0x35,0x9E,0x2B,0x24,0x37,0xF2,0x9E,0x12,0x29,0xFE,0xD2,0x9E,0x2F,0x32,0x36,0x28,0x9E,0x2C,0x37,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0xFE,0x28,0x24,0x36,0x2C,0x2F,0x3C,0x9E,0x2C,0x31,0x2D,0x38,0x35,0x28,0x27,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0xFE,0x2F,0x32,0x36,0x28,0x9E,0x2C,0x37,0x6F,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x29,0x32,0x35,0x9E,0x2C,0x37,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x26,0x32,0x38,0x35,0x36,0x28,0x9E,0x3A,0x2B,0x28,0x35,0x28,0x9E,0xD2,0x9E,0x2F,0x32,0x36,0x37,0x9E,0x2C,0x37,0x3F,0xFE,0x1C,0x33,0x28,0x24,0x2E,0x2C,0x31,0x2A,0x9E,0x32,0x29,0x9E,0x2F,0x32,0x36,0x37,0x6F,0x9E,0xD1,0xFE,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x2C,0x36,0x9E,0x36,0x37,0x2C,0x2F,0x2F,0x9E,0x36,0x37,0x38,0x26,0x2E,0x9E,0x2C,0x31,0xFE,0xD1,0x9E,0x3A,0x24,0x2F,0x2F,0x36,0x9E,0x36,0x32,0x30,0x28,0x3A,0x2B,0x28,0x35,0x28,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x9E,0x2B,0x28,0x2F,0x33,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0xF2,0xFE,0xFE,0x18,0x2B,0x6F,0x9E,0xD2,0x9E,0x2E,0x31,0x32,0x3A,0x9E,0x37,0x2B,0x24,0x37,0x9E,0xD1,0x35,0x28,0xFE,0x24,0x35,0x28,0x9E,0x36,0x28,0x26,0x35,0x28,0x37,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x3A,0x24,0x2F,0x2F,0x36,0x9E,0x24,0x36,0x9E,0x3A,0x28,0x2F,0x2F,0x9E,0x24,0x36,0x9E,0x2C,0x31,0x9E,0xD1,0xFE,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0x36,0x6F,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0xF4,0xFF };
+static const u8 dialog_text_DIALOG_155[] = { 0x1D,0x2B,0x24,0x31,0x2E,0x36,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x33,0x32,0x3A,0x28,0x35,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0x6F,0x9E,0x2F,0x2C,0x29,0x28,0x9E,0x2C,0x36,0xFE,0x35,0x28,0x37,0x38,0x35,0x31,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0xFE,0x19,0x2F,0x28,0x24,0x36,0x28,0x6F,0x9E,0x16,0x24,0x35,0x2C,0x32,0x6F,0x9E,0xD2,0x9E,0x2B,0x24,0x39,0x28,0xFE,0x37,0x32,0x9E,0x2A,0x2C,0x39,0x28,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0x9E,0xD1,0x9E,0x25,0x32,0x32,0x37,0xF2,0xFE,0xFE,0x11,0x28,0x35,0x28,0x6F,0x9E,0x2F,0x28,0x37,0x9E,0x30,0x28,0x9E,0x37,0x28,0x2F,0x2F,0x9E,0xD2,0x9E,0x24,0xFE,0x2F,0x2C,0x37,0x37,0x2F,0x28,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x3F,0x9E,0x12,0x31,0x9E,0xD1,0x9E,0x35,0x32,0x32,0x30,0x9E,0x3A,0x2C,0x37,0x2B,0xFE,0xD1,0x9E,0x30,0x2C,0x35,0x35,0x32,0x35,0x36,0x6F,0x9E,0x2F,0x32,0x32,0x2E,0x9E,0x26,0x24,0x35,0x28,0x29,0x38,0x2F,0x2F,0x3C,0xFE,0x29,0x32,0x35,0x9E,0x24,0x31,0x3C,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x37,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x31,0x32,0x37,0xFE,0x35,0x28,0x29,0x2F,0x28,0x26,0x37,0x28,0x27,0x9E,0x2C,0x31,0x9E,0xD1,0x9E,0x30,0x2C,0x35,0x35,0x32,0x35,0x3F,0xFE,0x0A,0x31,0x27,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x2A,0x32,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x3A,0x24,0x37,0x28,0x35,0x9E,0x37,0x32,0x3A,0x31,0x6F,0x9E,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x29,0x2F,0x32,0x32,0x27,0xFE,0x2C,0x37,0x9E,0x3A,0x2C,0x37,0x2B,0x9E,0x24,0x9E,0x2B,0x2C,0x2A,0x2B,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x2C,0x31,0x37,0x32,0xFE,0xD1,0x9E,0x33,0x24,0x2C,0x31,0x37,0x2C,0x31,0x2A,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_156[] = { 0x1D,0x2B,0x28,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x9E,0xD1,0xFE,0x26,0x2F,0x32,0x26,0x2E,0x9E,0x2C,0x36,0x9E,0x36,0x32,0x9E,0x36,0x37,0x35,0x24,0x31,0x2A,0x28,0xF2,0xFE,0x20,0x2B,0x28,0x31,0x9E,0xD2,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x2C,0x31,0x36,0x2C,0x27,0x28,0x6F,0xFE,0x3A,0x24,0x37,0x26,0x2B,0x9E,0xD1,0x9E,0x33,0x32,0x36,0x2C,0x37,0x2C,0x32,0x31,0x9E,0x32,0x29,0xFE,0xD1,0x9E,0x25,0x2C,0x2A,0x9E,0x2B,0x24,0x31,0x27,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_157[] = { 0x20,0x24,0x37,0x26,0x2B,0x9E,0x32,0x38,0x37,0xF2,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x2F,0x28,0x37,0xFE,0xD2,0x35,0x36,0x28,0x2F,0x29,0x9E,0x25,0x28,0x9E,0x36,0x3A,0x24,0x2F,0x2F,0x32,0x3A,0x28,0x27,0x9E,0x25,0x3C,0xFE,0x34,0x38,0x2C,0x26,0x2E,0x36,0x24,0x31,0x27,0x3F,0xFE,0xFE,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x36,0x2C,0x31,0x2E,0x9E,0x2C,0x31,0x37,0x32,0x9E,0xD1,0x9E,0x36,0x24,0x31,0x27,0x6F,0xFE,0xD2,0x9E,0x3A,0x32,0x31,0x3E,0x37,0x9E,0x25,0x28,0x9E,0x24,0x25,0x2F,0x28,0x9E,0x37,0x32,0xFE,0x2D,0x38,0x30,0x33,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x2C,0x29,0x9E,0xD2,0x35,0x9E,0x2B,0x28,0x24,0x27,0xFE,0x2A,0x32,0x28,0x36,0x9E,0x38,0x31,0x27,0x28,0x35,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0xFE,0x36,0x30,0x32,0xD1,0x35,0x28,0x27,0x3F,0xFE,0x1D,0x2B,0x28,0x9E,0x27,0x24,0x35,0x2E,0x9E,0x24,0x35,0x28,0x24,0x36,0x9E,0x24,0x35,0x28,0xFE,0x25,0x32,0x37,0x37,0x32,0x30,0x2F,0x28,0x36,0x36,0x9E,0x33,0x2C,0x37,0x36,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_158[] = { 0x01,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x35,0x28,0x33,0x28,0x24,0x37,0x28,0x27,0x2F,0x3C,0xFE,0x24,0x31,0x27,0x9E,0x37,0x2C,0x30,0x28,0x9E,0x2C,0x37,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x6F,0x9E,0xD2,0x3E,0x2F,0x2F,0xFE,0x2D,0x38,0x30,0x33,0x9E,0x2B,0x2C,0x2A,0x2B,0x28,0x35,0x9E,0x24,0x31,0x27,0x9E,0x2B,0x2C,0x2A,0x2B,0x28,0x35,0x3F,0xFE,0x12,0x29,0x9E,0xD2,0x9E,0x35,0x38,0x31,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x29,0x24,0x36,0x37,0x9E,0x24,0x31,0x27,0xFE,0x37,0x2C,0x30,0x28,0x9E,0x37,0x2B,0x35,0x28,0x28,0x9E,0x2D,0x38,0x30,0x33,0x36,0x9E,0x35,0x2C,0x2A,0x2B,0x37,0x6F,0xFE,0xD2,0x9E,0x26,0x24,0x31,0x9E,0x27,0x32,0x9E,0x24,0x9E,0x1D,0x35,0x2C,0x33,0x2F,0x28,0x9E,0x13,0x38,0x30,0x33,0x3F,0xFE,0x02,0x3F,0x9E,0x13,0x38,0x30,0x33,0x9E,0x2C,0x31,0x37,0x32,0x9E,0x24,0x9E,0x36,0x32,0x2F,0x2C,0x27,0x9E,0x3A,0x24,0x2F,0x2F,0x6F,0xFE,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x9E,0x3A,0x2B,0x28,0x31,0x9E,0xD2,0xFE,0x2B,0x2C,0x37,0x9E,0xD1,0x9E,0x3A,0x24,0x2F,0x2F,0x3F,0x9E,0x22,0x32,0x38,0x9E,0x26,0x24,0x31,0xFE,0x25,0x32,0x38,0x31,0x26,0x28,0x9E,0x37,0x32,0x9E,0x24,0x9E,0x2B,0x2C,0x2A,0x2B,0x28,0x35,0x9E,0x2F,0x28,0x39,0x28,0x2F,0xFE,0x38,0x36,0x2C,0x31,0x2A,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x20,0x24,0x2F,0x2F,0x9E,0x14,0x2C,0x26,0x2E,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_159[] = { 0x03,0x3F,0x9E,0x12,0x29,0x9E,0xD2,0x9E,0x36,0x37,0x32,0x33,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0xFE,0x37,0x32,0x9E,0x26,0x35,0x32,0x38,0x26,0x2B,0x6F,0x9E,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0x6F,0x9E,0xD2,0xFE,0x26,0x24,0x31,0x9E,0x33,0x28,0x35,0x29,0x32,0x35,0x30,0x9E,0x24,0x9E,0x0B,0x24,0x26,0x2E,0x3A,0x24,0x35,0x27,0xFE,0x1C,0x32,0x30,0x28,0x35,0x36,0x24,0x38,0x2F,0x37,0x3F,0x9E,0x1D,0x32,0x9E,0x27,0x32,0x9E,0x24,0x9E,0x15,0x32,0x31,0x2A,0xFE,0x13,0x38,0x30,0x33,0x6F,0x9E,0x35,0x38,0x31,0x9E,0x29,0x24,0x36,0x37,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x57,0x6F,0xFE,0xD1,0x31,0x9E,0x2D,0x38,0x30,0x33,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_160[] = { 0x19,0x35,0x28,0x36,0x36,0x9E,0x55,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0x9E,0x35,0x38,0x31,0x31,0x2C,0x31,0x2A,0xFE,0x29,0x24,0x36,0x37,0x9E,0x37,0x32,0x9E,0x27,0x32,0x9E,0x24,0x9E,0x0B,0x32,0x27,0x3C,0x9E,0x1C,0x2F,0x2C,0x27,0x28,0xFE,0x24,0x37,0x37,0x24,0x26,0x2E,0x3F,0x9E,0x1D,0x32,0x9E,0x36,0x37,0x24,0x31,0x27,0x9E,0x3A,0x2B,0x2C,0x2F,0x28,0xFE,0x36,0x2F,0x2C,0x27,0x2C,0x31,0x2A,0x6F,0x9E,0x33,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x32,0x35,0x9E,0x55,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_161[] = { 0x16,0x24,0x35,0x2C,0x32,0xF2,0xF2,0xF2,0xFE,0x12,0x37,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0xD2,0xF4,0xF4,0xF4,0xFE,0x12,0x37,0x9E,0x2B,0x24,0x36,0x9E,0x25,0x28,0x28,0x31,0x9E,0x36,0x32,0x9E,0x2F,0x32,0x31,0x2A,0x9E,0x36,0x2C,0x31,0x26,0x28,0xFE,0x32,0x38,0x35,0x9E,0x2F,0x24,0x36,0x37,0x9E,0x24,0x27,0x39,0x28,0x31,0x37,0x38,0x35,0x28,0xF2,0xFE,0x1D,0x2B,0x28,0x3C,0x9E,0x37,0x32,0x2F,0x27,0x9E,0x30,0x28,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x12,0x9E,0x30,0x2C,0x2A,0x2B,0x37,0xFE,0x36,0x28,0x28,0x9E,0xD2,0x9E,0x2C,0x29,0x9E,0x12,0x9E,0x3A,0x24,0x2C,0x37,0x28,0x27,0x9E,0x2B,0x28,0x35,0x28,0x6F,0xFE,0x25,0x38,0x37,0x9E,0x12,0x3E,0x27,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x25,0x32,0x38,0x37,0x9E,0x2A,0x2C,0x39,0x28,0x31,0xFE,0x38,0x33,0x9E,0x2B,0x32,0x33,0x28,0xF2,0xFE,0x12,0x36,0x9E,0x2C,0x37,0x9E,0x37,0x35,0x38,0x28,0xF4,0x9E,0x11,0x24,0x39,0x28,0x9E,0xD2,0xFE,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x25,0x28,0x24,0x37,0x28,0x31,0x9E,0x0B,0x32,0x3A,0x36,0x28,0x35,0xF4,0x9E,0x0A,0x31,0x27,0xFE,0x35,0x28,0x36,0x37,0x32,0x35,0x28,0x27,0x9E,0xD1,0x9E,0x1C,0x37,0x24,0x35,0x36,0x9E,0x37,0x32,0x9E,0xD1,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0xF4,0xFE,0x0A,0x31,0x27,0x9E,0x36,0x24,0x39,0x28,0x27,0x9E,0xD1,0x9E,0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0xF4,0xFE,0x12,0x9E,0x2E,0x31,0x28,0x3A,0x9E,0xD2,0x9E,0x26,0x32,0x38,0x2F,0x27,0x9E,0x27,0x32,0x9E,0x2C,0x37,0xF2,0xFE,0x17,0x32,0x3A,0x9E,0x12,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x24,0x9E,0x39,0x28,0x35,0x3C,0x9E,0x36,0x33,0x28,0x26,0x2C,0x24,0x2F,0xFE,0x30,0x28,0x36,0x36,0x24,0x2A,0x28,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0xFE,0xF5,0x1D,0x2B,0x24,0x31,0x2E,0x36,0x9E,0x29,0x32,0x35,0x9E,0x33,0x2F,0x24,0x3C,0x2C,0x31,0x2A,0x9E,0x1C,0x38,0x33,0x28,0x35,0xFE,0x16,0x24,0x35,0x2C,0x32,0x9E,0x06,0x04,0xF2,0x9E,0x1D,0x2B,0x2C,0x36,0x9E,0x2C,0x36,0x9E,0xD1,0xFE,0x28,0x31,0x27,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x2A,0x24,0x30,0x28,0x6F,0x9E,0x25,0x38,0x37,0x9E,0x31,0x32,0x37,0xFE,0xD1,0x9E,0x28,0x31,0x27,0x9E,0x32,0x29,0x9E,0xD1,0x9E,0x29,0x38,0x31,0x3F,0xFE,0x20,0x28,0x9E,0x3A,0x24,0x31,0x37,0x9E,0xD2,0x9E,0x37,0x32,0x9E,0x2E,0x28,0x28,0x33,0x9E,0x32,0x31,0xFE,0x33,0x2F,0x24,0x3C,0x2C,0x31,0x2A,0x6F,0x9E,0x36,0x32,0x9E,0x3A,0x28,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x24,0xFE,0x2F,0x2C,0x37,0x37,0x2F,0x28,0x9E,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0x29,0x32,0x35,0x9E,0xD2,0x3F,0xFE,0x20,0x28,0x9E,0x2B,0x32,0x33,0x28,0x9E,0x37,0x2B,0x24,0x37,0x9E,0xD2,0x9E,0x2F,0x2C,0x2E,0x28,0x9E,0x2C,0x37,0xF2,0xFE,0x0E,0x31,0x2D,0x32,0x3C,0xF2,0xF2,0xF2,0xF6,0xFE,0xFE,0x1D,0x2B,0x28,0x9E,0x1C,0x38,0x33,0x28,0x35,0x9E,0x16,0x24,0x35,0x2C,0x32,0x9E,0x06,0x04,0x9E,0x1D,0x28,0x24,0x30,0xFF };
+static const u8 dialog_text_DIALOG_162[] = { 0x17,0x32,0x6F,0x9E,0x31,0x32,0x6F,0x9E,0x31,0x32,0xF2,0x9E,0x17,0x32,0x37,0x9E,0xD2,0xFE,0x24,0x2A,0x24,0x2C,0x31,0xF2,0x9E,0x12,0x3E,0x30,0x9E,0x2C,0x31,0x9E,0x24,0x9E,0x2A,0x35,0x28,0x24,0x37,0xFE,0x2B,0x38,0x35,0x35,0x3C,0x6F,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0xD2,0x9E,0x36,0x28,0x28,0xF4,0xFE,0xFE,0x12,0x3E,0x39,0x28,0x9E,0x31,0x32,0x9E,0x37,0x2C,0x30,0x28,0x9E,0x37,0x32,0x9E,0x36,0x34,0x38,0x24,0x25,0x25,0x2F,0x28,0xFE,0x32,0x39,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0x3F,0x9E,0x11,0x28,0x35,0x28,0x6F,0x9E,0x2B,0x24,0x39,0x28,0x9E,0x2C,0x37,0x3F,0xFE,0x12,0x9E,0x31,0x28,0x39,0x28,0x35,0x9E,0x30,0x28,0x24,0x31,0x37,0x9E,0x37,0x32,0x9E,0x2B,0x2C,0x27,0x28,0x9E,0x2C,0x37,0xFE,0x29,0x35,0x32,0x30,0x9E,0xD2,0x3F,0x3F,0x3F,0xFE,0x12,0x37,0x3E,0x36,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x12,0x3E,0x30,0x9E,0x2C,0x31,0x9E,0x36,0x38,0x26,0x2B,0xFE,0x24,0x9E,0x35,0x38,0x36,0x2B,0x3F,0x9E,0x1D,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x2C,0x37,0x6F,0x9E,0x37,0x2B,0x24,0x37,0x3E,0x36,0xFE,0x24,0x2F,0x2F,0x3F,0x9E,0x17,0x32,0x3A,0x6F,0x9E,0x12,0x9E,0x30,0x38,0x36,0x37,0x9E,0x25,0x28,0x9E,0x32,0x29,0x29,0x3F,0xFE,0x18,0x3A,0x3A,0x3A,0xF2,0x9E,0x15,0x28,0x37,0x9E,0x30,0x28,0x9E,0x2A,0x32,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_163[] = { 0x17,0x32,0x32,0x32,0x32,0xF2,0x9E,0x22,0x32,0x38,0x3E,0x39,0x28,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0xFE,0x25,0x28,0x24,0x37,0x28,0x31,0x9E,0x30,0x28,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x37,0x2C,0x30,0x28,0x6F,0xFE,0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x12,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x36,0x37,0x24,0x31,0x27,0xFE,0x2F,0x32,0x36,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0xD2,0xF2,0xFE,0xFE,0x16,0x3C,0x9E,0x37,0x35,0x32,0x32,0x33,0x36,0x3F,0x3F,0x3F,0x3A,0x32,0x35,0x37,0x2B,0x2F,0x28,0x36,0x36,0xF2,0xFE,0x1D,0x2B,0x28,0x3C,0x3E,0x39,0x28,0x9E,0x37,0x38,0x35,0x31,0x28,0x27,0x9E,0x32,0x39,0x28,0x35,0x9E,0x24,0x2F,0x2F,0xFE,0xD1,0x9E,0x19,0x32,0x3A,0x28,0x35,0x9E,0x1C,0x37,0x24,0x35,0x36,0xF2,0x9E,0x20,0x2B,0x24,0x37,0xF4,0xF2,0xFE,0x1D,0x2B,0x28,0x35,0x28,0x9E,0x24,0x35,0x28,0x9E,0x01,0x02,0x00,0x9E,0x2C,0x31,0x9E,0x24,0x2F,0x2F,0xF4,0xF4,0xF4,0xFE,0xFE,0x0A,0x30,0x24,0x3D,0x2C,0x31,0x2A,0xF2,0x9E,0x1D,0x2B,0x28,0x35,0x28,0x9E,0x3A,0x28,0x35,0x28,0x9E,0x36,0x32,0x30,0x28,0xFE,0x2C,0x31,0x9E,0xD1,0x9E,0x26,0x24,0x36,0x37,0x2F,0x28,0x9E,0x37,0x2B,0x24,0x37,0x9E,0x12,0xFE,0x30,0x2C,0x36,0x36,0x28,0x27,0xF4,0xF4,0xF2,0xF2,0xFE,0xFE,0xFE,0x17,0x32,0x3A,0x9E,0x12,0x9E,0x36,0x28,0x28,0x9E,0x33,0x28,0x24,0x26,0x28,0xFE,0x35,0x28,0x37,0x38,0x35,0x31,0x2C,0x31,0x2A,0x9E,0x37,0x32,0x9E,0xD1,0x9E,0x3A,0x32,0x35,0x2F,0x27,0x3F,0x3F,0x3F,0xFE,0x18,0x32,0x32,0x32,0xF2,0x9E,0x12,0x9E,0x35,0x28,0x24,0x2F,0x2F,0x3C,0x9E,0x2B,0x24,0x37,0x28,0x9E,0x37,0x2B,0x24,0x37,0xF2,0xFE,0x12,0x9E,0x26,0x24,0x31,0x3E,0x37,0x9E,0x3A,0x24,0x37,0x26,0x2B,0x9F,0x9F,0xFE,0x12,0x3E,0x30,0x9E,0x32,0x38,0x37,0x37,0x24,0x9E,0x2B,0x28,0x35,0x28,0xF2,0xFE,0x13,0x38,0x36,0x37,0x9E,0xD2,0x9E,0x3A,0x24,0x2C,0x37,0x9E,0x38,0x31,0x37,0x2C,0x2F,0x9E,0x31,0x28,0x3B,0x37,0xFE,0x37,0x2C,0x30,0x28,0x3F,0x9E,0x1E,0x31,0x37,0x2C,0x2F,0x9E,0xD1,0x31,0x6F,0x9E,0x2E,0x28,0x28,0x33,0xFE,0x37,0x2B,0x24,0x37,0x9E,0x0C,0x32,0x31,0x37,0x35,0x32,0x2F,0x9E,0x1C,0x37,0x2C,0x26,0x2E,0xFE,0x36,0x30,0x32,0x2E,0x2C,0x31,0x3E,0xF2,0xFE,0x0B,0x38,0x3A,0x24,0x24,0x9E,0x2B,0x24,0x9E,0x2B,0x24,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_164[] = { 0x16,0x24,0x35,0x2C,0x32,0xF2,0x9E,0x20,0x2B,0x24,0x37,0x3E,0x36,0x9E,0x38,0x33,0x6F,0x9E,0x33,0x24,0x2F,0xF4,0xFE,0x12,0x9E,0x2B,0x24,0x39,0x28,0x31,0x3E,0x37,0x9E,0x25,0x28,0x28,0x31,0x9E,0x32,0x31,0x9E,0xD1,0xFE,0x36,0x2F,0x2C,0x27,0x28,0x9E,0x2F,0x24,0x37,0x28,0x2F,0x3C,0x6F,0x9E,0x36,0x32,0x9E,0x12,0x3E,0x30,0x9E,0x32,0x38,0x37,0xFE,0x32,0x29,0x9E,0x36,0x2B,0x24,0x33,0x28,0x3F,0xFE,0x1C,0x37,0x2C,0x2F,0x2F,0x6F,0x9E,0x12,0x3E,0x30,0x9E,0x24,0x2F,0x3A,0x24,0x3C,0x36,0x9E,0x38,0x33,0x9E,0x29,0x32,0x35,0x9E,0x24,0xFE,0x2A,0x32,0x32,0x27,0x9E,0x35,0x24,0x26,0x28,0x6F,0x9E,0x28,0x36,0x33,0x28,0x26,0x2C,0x24,0x2F,0x2F,0x3C,0xFE,0x24,0x2A,0x24,0x2C,0x31,0x36,0x37,0x9E,0x24,0x31,0x9E,0x32,0x2F,0x27,0x9E,0x36,0x2F,0x28,0x27,0x27,0x2C,0x31,0x3E,0xFE,0x25,0x38,0x27,0x27,0x3C,0x3F,0xFE,0x20,0x2B,0x24,0x27,0x27,0x3C,0x24,0x9E,0x36,0x24,0x3C,0xF4,0xFE,0x1B,0x28,0x24,0x27,0x3C,0x3F,0x3F,0x3F,0x36,0x28,0x37,0x3F,0x3F,0x3F,0xFE,0xFE,0xD0,0xD0,0x10,0x32,0xD0,0xD0,0xD0,0xD0,0x9E,0x0D,0x32,0x31,0x3E,0x37,0x9E,0x10,0x32,0xFF };
+static const u8 dialog_text_DIALOG_165[] = { 0x12,0x9E,0x37,0x24,0x2E,0x28,0x9E,0x31,0x32,0x9E,0x35,0x28,0x36,0x33,0x32,0x31,0x36,0x2C,0x25,0x2C,0x2F,0x2C,0x37,0x3C,0xFE,0x3A,0x2B,0x24,0x37,0x36,0x32,0x28,0x39,0x28,0x35,0x9E,0x29,0x32,0x35,0x9E,0x37,0x2B,0x32,0x36,0x28,0x9E,0x3A,0x2B,0x32,0xFE,0x2A,0x28,0x37,0x9E,0x27,0x2C,0x3D,0x3D,0x3C,0x9E,0x24,0x31,0x27,0x9E,0x33,0x24,0x36,0x36,0x9E,0x32,0x38,0x37,0xFE,0x29,0x35,0x32,0x30,0x9E,0x35,0x38,0x31,0x31,0x2C,0x31,0x2A,0x9E,0x24,0x35,0x32,0x38,0x31,0x27,0xFE,0x37,0x2B,0x2C,0x36,0x9E,0x33,0x32,0x36,0x37,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_166[] = { 0x12,0x3E,0x2F,0x2F,0x9E,0x25,0x28,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x36,0x32,0x32,0x31,0x3F,0xFE,0x12,0x3E,0x30,0x9E,0x32,0x38,0x37,0x9E,0x37,0x35,0x24,0x2C,0x31,0x2C,0x31,0x2A,0x9E,0x31,0x32,0x3A,0x6F,0xFE,0x36,0x32,0x9E,0x26,0x32,0x30,0x28,0x9E,0x25,0x24,0x26,0x2E,0x9E,0x2F,0x24,0x37,0x28,0x35,0x3F,0xFE,0xD0,0xD0,0x9F,0x9F,0x14,0x32,0x32,0x33,0x24,0x9E,0xD1,0x9E,0x1A,0x38,0x2C,0x26,0x2E,0xFF };
+static const u8 dialog_text_DIALOG_167[] = { 0x19,0x35,0x2C,0x31,0x26,0x28,0x36,0x36,0x9E,0x1D,0x32,0x24,0x27,0x36,0x37,0x32,0x32,0x2F,0x3E,0x36,0xFE,0x26,0x24,0x36,0x37,0x2F,0x28,0x9E,0x2C,0x36,0x9E,0x2D,0x38,0x36,0x37,0x9E,0x24,0x2B,0x28,0x24,0x27,0x3F,0xFE,0xFE,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x54,0x9E,0x37,0x32,0x9E,0x2D,0x38,0x30,0x33,0x6F,0x9E,0x57,0x9E,0x37,0x32,0xFE,0x26,0x35,0x32,0x38,0x26,0x2B,0x6F,0x9E,0x24,0x31,0x27,0x9E,0x55,0x9E,0x37,0x32,0x9E,0x33,0x38,0x31,0x26,0x2B,0x6F,0xFE,0x35,0x28,0x24,0x27,0x9E,0x24,0x9E,0x36,0x2C,0x2A,0x31,0x6F,0x9E,0x32,0x35,0x9E,0x2A,0x35,0x24,0x25,0xFE,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x3F,0xFE,0x19,0x35,0x28,0x36,0x36,0x9E,0x55,0x9E,0x24,0x2A,0x24,0x2C,0x31,0x9E,0x37,0x32,0x9E,0x37,0x2B,0x35,0x32,0x3A,0xFE,0x36,0x32,0x30,0x28,0x37,0x2B,0x2C,0x31,0x2A,0x9E,0xD2,0x3E,0x35,0x28,0x9E,0x2B,0x32,0x2F,0x27,0x2C,0x31,0x2A,0x3F,0xFF };
+static const u8 dialog_text_DIALOG_168[] = { 0x11,0x28,0x3C,0xF2,0x9E,0x14,0x31,0x32,0x26,0x2E,0x9E,0x2C,0x37,0x9E,0x32,0x29,0x29,0xF2,0x9E,0x1D,0x2B,0x24,0x37,0x3E,0x36,0xFE,0xD1,0x9E,0x36,0x28,0x26,0x32,0x31,0x27,0x9E,0x37,0x2C,0x30,0x28,0x9E,0xD2,0x3E,0x39,0x28,0xFE,0x31,0x24,0x2C,0x2F,0x28,0x27,0x9E,0x30,0x28,0x3F,0x9E,0x17,0x32,0x3A,0x9E,0xD2,0x3E,0x35,0x28,0xFE,0x24,0x36,0x2E,0x2C,0x31,0x2A,0x9E,0x29,0x32,0x35,0x9E,0x2C,0x37,0x6F,0x9E,0x2F,0x2C,0x31,0x2A,0x38,0x2C,0x31,0x28,0xFE,0x25,0x35,0x28,0x24,0x37,0x2B,0xF2,0xFF };
+static const u8 dialog_text_DIALOG_169[] = { 0x14,0x28,0x28,0x33,0x9E,0x32,0x38,0x37,0xF2,0xFE,0x1D,0x2B,0x24,0x37,0x9E,0x30,0x28,0x24,0x31,0x36,0x9E,0xD2,0xF2,0xFE,0x0A,0x35,0x35,0x2A,0x2A,0x2B,0x2B,0xF2,0xFE,0xFE,0x0A,0x31,0x3C,0x32,0x31,0x28,0x9E,0x28,0x31,0x37,0x28,0x35,0x2C,0x31,0x2A,0x9E,0x37,0x2B,0x2C,0x36,0x9E,0x26,0x24,0x39,0x28,0xFE,0x3A,0x2C,0x37,0x2B,0x32,0x38,0x37,0x9E,0x33,0x28,0x35,0x30,0x2C,0x36,0x36,0x2C,0x32,0x31,0x9E,0x3A,0x2C,0x2F,0x2F,0xFE,0x30,0x28,0x28,0x37,0x9E,0x26,0x28,0x35,0x37,0x24,0x2C,0x31,0x9E,0x27,0x2C,0x36,0x24,0x36,0x37,0x28,0x35,0x3F,0xFF };
+static const struct DialogEntry dialog_entry_DIALOG_000 = { 1, 6, 30, 200, dialog_text_DIALOG_000 };
+static const struct DialogEntry dialog_entry_DIALOG_001 = { 1, 4, 95, 200, dialog_text_DIALOG_001 };
+static const struct DialogEntry dialog_entry_DIALOG_002 = { 1, 4, 95, 200, dialog_text_DIALOG_002 };
+static const struct DialogEntry dialog_entry_DIALOG_003 = { 1, 5, 95, 200, dialog_text_DIALOG_003 };
+static const struct DialogEntry dialog_entry_DIALOG_004 = { 1, 3, 95, 200, dialog_text_DIALOG_004 };
+static const struct DialogEntry dialog_entry_DIALOG_005 = { 1, 3, 30, 200, dialog_text_DIALOG_005 };
+static const struct DialogEntry dialog_entry_DIALOG_006 = { 1, 3, 30, 200, dialog_text_DIALOG_006 };
+static const struct DialogEntry dialog_entry_DIALOG_007 = { 1, 5, 30, 200, dialog_text_DIALOG_007 };
+static const struct DialogEntry dialog_entry_DIALOG_008 = { 1, 4, 30, 200, dialog_text_DIALOG_008 };
+static const struct DialogEntry dialog_entry_DIALOG_009 = { 1, 5, 30, 200, dialog_text_DIALOG_009 };
+static const struct DialogEntry dialog_entry_DIALOG_010 = { 1, 4, 30, 200, dialog_text_DIALOG_010 };
+static const struct DialogEntry dialog_entry_DIALOG_011 = { 1, 4, 30, 200, dialog_text_DIALOG_011 };
+static const struct DialogEntry dialog_entry_DIALOG_012 = { 1, 4, 30, 200, dialog_text_DIALOG_012 };
+static const struct DialogEntry dialog_entry_DIALOG_013 = { 1, 5, 30, 200, dialog_text_DIALOG_013 };
+static const struct DialogEntry dialog_entry_DIALOG_014 = { 1, 4, 30, 200, dialog_text_DIALOG_014 };
+static const struct DialogEntry dialog_entry_DIALOG_015 = { 1, 4, 30, 200, dialog_text_DIALOG_015 };
+static const struct DialogEntry dialog_entry_DIALOG_016 = { 1, 3, 30, 200, dialog_text_DIALOG_016 };
+static const struct DialogEntry dialog_entry_DIALOG_017 = { 1, 4, 30, 200, dialog_text_DIALOG_017 };
+static const struct DialogEntry dialog_entry_DIALOG_018 = { 1, 4, 30, 200, dialog_text_DIALOG_018 };
+static const struct DialogEntry dialog_entry_DIALOG_019 = { 1, 2, 30, 200, dialog_text_DIALOG_019 };
+static const struct DialogEntry dialog_entry_DIALOG_020 = { 1, 6, 95, 150, dialog_text_DIALOG_020 };
+static const struct DialogEntry dialog_entry_DIALOG_021 = { 1, 5, 95, 200, dialog_text_DIALOG_021 };
+static const struct DialogEntry dialog_entry_DIALOG_022 = { 1, 2, 95, 200, dialog_text_DIALOG_022 };
+static const struct DialogEntry dialog_entry_DIALOG_023 = { 1, 3, 95, 200, dialog_text_DIALOG_023 };
+static const struct DialogEntry dialog_entry_DIALOG_024 = { 1, 5, 95, 200, dialog_text_DIALOG_024 };
+static const struct DialogEntry dialog_entry_DIALOG_025 = { 1, 4, 95, 200, dialog_text_DIALOG_025 };
+static const struct DialogEntry dialog_entry_DIALOG_026 = { 1, 4, 95, 200, dialog_text_DIALOG_026 };
+static const struct DialogEntry dialog_entry_DIALOG_027 = { 1, 4, 95, 200, dialog_text_DIALOG_027 };
+static const struct DialogEntry dialog_entry_DIALOG_028 = { 1, 4, 95, 200, dialog_text_DIALOG_028 };
+static const struct DialogEntry dialog_entry_DIALOG_029 = { 1, 5, 95, 200, dialog_text_DIALOG_029 };
+static const struct DialogEntry dialog_entry_DIALOG_030 = { 1, 6, 30, 200, dialog_text_DIALOG_030 };
+static const struct DialogEntry dialog_entry_DIALOG_031 = { 1, 5, 30, 200, dialog_text_DIALOG_031 };
+static const struct DialogEntry dialog_entry_DIALOG_032 = { 1, 5, 30, 200, dialog_text_DIALOG_032 };
+static const struct DialogEntry dialog_entry_DIALOG_033 = { 1, 6, 30, 200, dialog_text_DIALOG_033 };
+static const struct DialogEntry dialog_entry_DIALOG_034 = { 1, 6, 30, 200, dialog_text_DIALOG_034 };
+static const struct DialogEntry dialog_entry_DIALOG_035 = { 1, 5, 30, 200, dialog_text_DIALOG_035 };
+static const struct DialogEntry dialog_entry_DIALOG_036 = { 1, 5, 30, 200, dialog_text_DIALOG_036 };
+static const struct DialogEntry dialog_entry_DIALOG_037 = { 1, 2, 30, 200, dialog_text_DIALOG_037 };
+static const struct DialogEntry dialog_entry_DIALOG_038 = { 1, 3, 95, 200, dialog_text_DIALOG_038 };
+static const struct DialogEntry dialog_entry_DIALOG_039 = { 1, 4, 30, 200, dialog_text_DIALOG_039 };
+static const struct DialogEntry dialog_entry_DIALOG_040 = { 1, 3, 30, 200, dialog_text_DIALOG_040 };
+static const struct DialogEntry dialog_entry_DIALOG_041 = { 1, 3, 30, 200, dialog_text_DIALOG_041 };
+static const struct DialogEntry dialog_entry_DIALOG_042 = { 1, 4, 30, 200, dialog_text_DIALOG_042 };
+static const struct DialogEntry dialog_entry_DIALOG_043 = { 1, 5, 30, 200, dialog_text_DIALOG_043 };
+static const struct DialogEntry dialog_entry_DIALOG_044 = { 1, 5, 95, 200, dialog_text_DIALOG_044 };
+static const struct DialogEntry dialog_entry_DIALOG_045 = { 1, 6, 95, 200, dialog_text_DIALOG_045 };
+static const struct DialogEntry dialog_entry_DIALOG_046 = { 1, 5, 30, 200, dialog_text_DIALOG_046 };
+static const struct DialogEntry dialog_entry_DIALOG_047 = { 1, 2, 95, 200, dialog_text_DIALOG_047 };
+static const struct DialogEntry dialog_entry_DIALOG_048 = { 1, 4, 30, 200, dialog_text_DIALOG_048 };
+static const struct DialogEntry dialog_entry_DIALOG_049 = { 1, 5, 30, 200, dialog_text_DIALOG_049 };
+static const struct DialogEntry dialog_entry_DIALOG_050 = { 1, 4, 30, 200, dialog_text_DIALOG_050 };
+static const struct DialogEntry dialog_entry_DIALOG_051 = { 1, 6, 30, 200, dialog_text_DIALOG_051 };
+static const struct DialogEntry dialog_entry_DIALOG_052 = { 1, 5, 30, 200, dialog_text_DIALOG_052 };
+static const struct DialogEntry dialog_entry_DIALOG_053 = { 1, 5, 30, 200, dialog_text_DIALOG_053 };
+static const struct DialogEntry dialog_entry_DIALOG_054 = { 1, 5, 30, 200, dialog_text_DIALOG_054 };
+static const struct DialogEntry dialog_entry_DIALOG_055 = { 1, 4, 30, 200, dialog_text_DIALOG_055 };
+static const struct DialogEntry dialog_entry_DIALOG_056 = { 1, 6, 30, 200, dialog_text_DIALOG_056 };
+static const struct DialogEntry dialog_entry_DIALOG_057 = { 1, 4, 30, 200, dialog_text_DIALOG_057 };
+static const struct DialogEntry dialog_entry_DIALOG_058 = { 1, 4, 30, 200, dialog_text_DIALOG_058 };
+static const struct DialogEntry dialog_entry_DIALOG_059 = { 1, 4, 30, 200, dialog_text_DIALOG_059 };
+static const struct DialogEntry dialog_entry_DIALOG_060 = { 1, 4, 30, 200, dialog_text_DIALOG_060 };
+static const struct DialogEntry dialog_entry_DIALOG_061 = { 1, 4, 30, 200, dialog_text_DIALOG_061 };
+static const struct DialogEntry dialog_entry_DIALOG_062 = { 1, 3, 30, 200, dialog_text_DIALOG_062 };
+static const struct DialogEntry dialog_entry_DIALOG_063 = { 1, 5, 30, 200, dialog_text_DIALOG_063 };
+static const struct DialogEntry dialog_entry_DIALOG_064 = { 1, 5, 30, 200, dialog_text_DIALOG_064 };
+static const struct DialogEntry dialog_entry_DIALOG_065 = { 1, 6, 30, 200, dialog_text_DIALOG_065 };
+static const struct DialogEntry dialog_entry_DIALOG_066 = { 1, 5, 30, 200, dialog_text_DIALOG_066 };
+static const struct DialogEntry dialog_entry_DIALOG_067 = { 1, 5, 30, 200, dialog_text_DIALOG_067 };
+static const struct DialogEntry dialog_entry_DIALOG_068 = { 1, 5, 30, 200, dialog_text_DIALOG_068 };
+static const struct DialogEntry dialog_entry_DIALOG_069 = { 1, 6, 30, 200, dialog_text_DIALOG_069 };
+static const struct DialogEntry dialog_entry_DIALOG_070 = { 1, 5, 30, 200, dialog_text_DIALOG_070 };
+static const struct DialogEntry dialog_entry_DIALOG_071 = { 1, 3, 30, 200, dialog_text_DIALOG_071 };
+static const struct DialogEntry dialog_entry_DIALOG_072 = { 1, 5, 30, 200, dialog_text_DIALOG_072 };
+static const struct DialogEntry dialog_entry_DIALOG_073 = { 1, 4, 95, 200, dialog_text_DIALOG_073 };
+static const struct DialogEntry dialog_entry_DIALOG_074 = { 1, 5, 30, 200, dialog_text_DIALOG_074 };
+static const struct DialogEntry dialog_entry_DIALOG_075 = { 1, 5, 30, 200, dialog_text_DIALOG_075 };
+static const struct DialogEntry dialog_entry_DIALOG_076 = { 1, 6, 30, 200, dialog_text_DIALOG_076 };
+static const struct DialogEntry dialog_entry_DIALOG_077 = { 1, 2, 150, 200, dialog_text_DIALOG_077 };
+static const struct DialogEntry dialog_entry_DIALOG_078 = { 1, 5, 30, 200, dialog_text_DIALOG_078 };
+static const struct DialogEntry dialog_entry_DIALOG_079 = { 1, 4, 30, 200, dialog_text_DIALOG_079 };
+static const struct DialogEntry dialog_entry_DIALOG_080 = { 1, 1, 30, 200, dialog_text_DIALOG_080 };
+static const struct DialogEntry dialog_entry_DIALOG_081 = { 1, 4, 30, 200, dialog_text_DIALOG_081 };
+static const struct DialogEntry dialog_entry_DIALOG_082 = { 1, 4, 30, 200, dialog_text_DIALOG_082 };
+static const struct DialogEntry dialog_entry_DIALOG_083 = { 1, 6, 30, 200, dialog_text_DIALOG_083 };
+static const struct DialogEntry dialog_entry_DIALOG_084 = { 1, 3, 30, 200, dialog_text_DIALOG_084 };
+static const struct DialogEntry dialog_entry_DIALOG_085 = { 1, 5, 30, 200, dialog_text_DIALOG_085 };
+static const struct DialogEntry dialog_entry_DIALOG_086 = { 1, 3, 30, 200, dialog_text_DIALOG_086 };
+static const struct DialogEntry dialog_entry_DIALOG_087 = { 1, 4, 30, 200, dialog_text_DIALOG_087 };
+static const struct DialogEntry dialog_entry_DIALOG_088 = { 1, 5, 30, 200, dialog_text_DIALOG_088 };
+static const struct DialogEntry dialog_entry_DIALOG_089 = { 1, 5, 95, 200, dialog_text_DIALOG_089 };
+static const struct DialogEntry dialog_entry_DIALOG_090 = { 1, 6, 30, 200, dialog_text_DIALOG_090 };
+static const struct DialogEntry dialog_entry_DIALOG_091 = { 2, 2, 30, 200, dialog_text_DIALOG_091 };
+static const struct DialogEntry dialog_entry_DIALOG_092 = { 1, 5, 30, 200, dialog_text_DIALOG_092 };
+static const struct DialogEntry dialog_entry_DIALOG_093 = { 1, 5, 30, 200, dialog_text_DIALOG_093 };
+static const struct DialogEntry dialog_entry_DIALOG_094 = { 1, 4, 30, 200, dialog_text_DIALOG_094 };
+static const struct DialogEntry dialog_entry_DIALOG_095 = { 1, 4, 30, 200, dialog_text_DIALOG_095 };
+static const struct DialogEntry dialog_entry_DIALOG_096 = { 1, 4, 30, 200, dialog_text_DIALOG_096 };
+static const struct DialogEntry dialog_entry_DIALOG_097 = { 1, 5, 30, 200, dialog_text_DIALOG_097 };
+static const struct DialogEntry dialog_entry_DIALOG_098 = { 1, 2, 95, 200, dialog_text_DIALOG_098 };
+static const struct DialogEntry dialog_entry_DIALOG_099 = { 1, 5, 95, 200, dialog_text_DIALOG_099 };
+static const struct DialogEntry dialog_entry_DIALOG_100 = { 1, 3, 95, 200, dialog_text_DIALOG_100 };
+static const struct DialogEntry dialog_entry_DIALOG_101 = { 1, 3, 95, 200, dialog_text_DIALOG_101 };
+static const struct DialogEntry dialog_entry_DIALOG_102 = { 1, 5, 30, 200, dialog_text_DIALOG_102 };
+static const struct DialogEntry dialog_entry_DIALOG_103 = { 1, 4, 95, 200, dialog_text_DIALOG_103 };
+static const struct DialogEntry dialog_entry_DIALOG_104 = { 1, 5, 30, 200, dialog_text_DIALOG_104 };
+static const struct DialogEntry dialog_entry_DIALOG_105 = { 1, 3, 95, 200, dialog_text_DIALOG_105 };
+static const struct DialogEntry dialog_entry_DIALOG_106 = { 1, 2, 95, 200, dialog_text_DIALOG_106 };
+static const struct DialogEntry dialog_entry_DIALOG_107 = { 1, 3, 95, 200, dialog_text_DIALOG_107 };
+static const struct DialogEntry dialog_entry_DIALOG_108 = { 1, 2, 95, 200, dialog_text_DIALOG_108 };
+static const struct DialogEntry dialog_entry_DIALOG_109 = { 1, 4, 95, 200, dialog_text_DIALOG_109 };
+static const struct DialogEntry dialog_entry_DIALOG_110 = { 1, 5, 95, 200, dialog_text_DIALOG_110 };
+static const struct DialogEntry dialog_entry_DIALOG_111 = { 1, 4, 95, 200, dialog_text_DIALOG_111 };
+static const struct DialogEntry dialog_entry_DIALOG_112 = { 1, 4, 30, 200, dialog_text_DIALOG_112 };
+static const struct DialogEntry dialog_entry_DIALOG_113 = { 1, 6, 30, 200, dialog_text_DIALOG_113 };
+static const struct DialogEntry dialog_entry_DIALOG_114 = { 1, 5, 95, 200, dialog_text_DIALOG_114 };
+static const struct DialogEntry dialog_entry_DIALOG_115 = { 1, 5, 95, 200, dialog_text_DIALOG_115 };
+static const struct DialogEntry dialog_entry_DIALOG_116 = { 1, 5, 95, 200, dialog_text_DIALOG_116 };
+static const struct DialogEntry dialog_entry_DIALOG_117 = { 1, 1, 95, 200, dialog_text_DIALOG_117 };
+static const struct DialogEntry dialog_entry_DIALOG_118 = { 1, 6, 95, 200, dialog_text_DIALOG_118 };
+static const struct DialogEntry dialog_entry_DIALOG_119 = { 1, 6, 30, 200, dialog_text_DIALOG_119 };
+static const struct DialogEntry dialog_entry_DIALOG_120 = { 1, 4, 30, 200, dialog_text_DIALOG_120 };
+static const struct DialogEntry dialog_entry_DIALOG_121 = { 1, 5, 30, 200, dialog_text_DIALOG_121 };
+static const struct DialogEntry dialog_entry_DIALOG_122 = { 1, 4, 30, 200, dialog_text_DIALOG_122 };
+static const struct DialogEntry dialog_entry_DIALOG_123 = { 1, 4, 30, 200, dialog_text_DIALOG_123 };
+static const struct DialogEntry dialog_entry_DIALOG_124 = { 1, 4, 30, 200, dialog_text_DIALOG_124 };
+static const struct DialogEntry dialog_entry_DIALOG_125 = { 1, 3, 30, 200, dialog_text_DIALOG_125 };
+static const struct DialogEntry dialog_entry_DIALOG_126 = { 2, 3, 30, 200, dialog_text_DIALOG_126 };
+static const struct DialogEntry dialog_entry_DIALOG_127 = { 3, 4, 30, 200, dialog_text_DIALOG_127 };
+static const struct DialogEntry dialog_entry_DIALOG_128 = { 1, 4, 95, 200, dialog_text_DIALOG_128 };
+static const struct DialogEntry dialog_entry_DIALOG_129 = { 1, 5, 30, 200, dialog_text_DIALOG_129 };
+static const struct DialogEntry dialog_entry_DIALOG_130 = { 1, 5, 30, 200, dialog_text_DIALOG_130 };
+static const struct DialogEntry dialog_entry_DIALOG_131 = { 1, 5, 30, 200, dialog_text_DIALOG_131 };
+static const struct DialogEntry dialog_entry_DIALOG_132 = { 1, 4, 30, 200, dialog_text_DIALOG_132 };
+static const struct DialogEntry dialog_entry_DIALOG_133 = { 1, 6, 30, 200, dialog_text_DIALOG_133 };
+static const struct DialogEntry dialog_entry_DIALOG_134 = { 1, 5, 30, 200, dialog_text_DIALOG_134 };
+static const struct DialogEntry dialog_entry_DIALOG_135 = { 1, 5, 30, 200, dialog_text_DIALOG_135 };
+static const struct DialogEntry dialog_entry_DIALOG_136 = { 1, 6, 30, 200, dialog_text_DIALOG_136 };
+static const struct DialogEntry dialog_entry_DIALOG_137 = { 1, 6, 30, 200, dialog_text_DIALOG_137 };
+static const struct DialogEntry dialog_entry_DIALOG_138 = { 1, 3, 30, 200, dialog_text_DIALOG_138 };
+static const struct DialogEntry dialog_entry_DIALOG_139 = { 1, 6, 30, 200, dialog_text_DIALOG_139 };
+static const struct DialogEntry dialog_entry_DIALOG_140 = { 1, 6, 30, 200, dialog_text_DIALOG_140 };
+static const struct DialogEntry dialog_entry_DIALOG_141 = { 1, 5, 150, 200, dialog_text_DIALOG_141 };
+static const struct DialogEntry dialog_entry_DIALOG_142 = { 1, 5, 150, 200, dialog_text_DIALOG_142 };
+static const struct DialogEntry dialog_entry_DIALOG_143 = { 1, 6, 150, 200, dialog_text_DIALOG_143 };
+static const struct DialogEntry dialog_entry_DIALOG_144 = { 1, 6, 150, 200, dialog_text_DIALOG_144 };
+static const struct DialogEntry dialog_entry_DIALOG_145 = { 1, 6, 150, 200, dialog_text_DIALOG_145 };
+static const struct DialogEntry dialog_entry_DIALOG_146 = { 1, 6, 150, 200, dialog_text_DIALOG_146 };
+static const struct DialogEntry dialog_entry_DIALOG_147 = { 1, 5, 30, 200, dialog_text_DIALOG_147 };
+static const struct DialogEntry dialog_entry_DIALOG_148 = { 1, 6, 30, 200, dialog_text_DIALOG_148 };
+static const struct DialogEntry dialog_entry_DIALOG_149 = { 1, 3, 30, 200, dialog_text_DIALOG_149 };
+static const struct DialogEntry dialog_entry_DIALOG_150 = { 1, 5, 30, 200, dialog_text_DIALOG_150 };
+static const struct DialogEntry dialog_entry_DIALOG_151 = { 1, 4, 30, 200, dialog_text_DIALOG_151 };
+static const struct DialogEntry dialog_entry_DIALOG_152 = { 1, 3, 30, 200, dialog_text_DIALOG_152 };
+static const struct DialogEntry dialog_entry_DIALOG_153 = { 1, 4, 30, 200, dialog_text_DIALOG_153 };
+static const struct DialogEntry dialog_entry_DIALOG_154 = { 1, 5, 30, 200, dialog_text_DIALOG_154 };
+static const struct DialogEntry dialog_entry_DIALOG_155 = { 1, 6, 30, 200, dialog_text_DIALOG_155 };
+static const struct DialogEntry dialog_entry_DIALOG_156 = { 1, 5, 30, 200, dialog_text_DIALOG_156 };
+static const struct DialogEntry dialog_entry_DIALOG_157 = { 1, 5, 30, 200, dialog_text_DIALOG_157 };
+static const struct DialogEntry dialog_entry_DIALOG_158 = { 1, 6, 30, 200, dialog_text_DIALOG_158 };
+static const struct DialogEntry dialog_entry_DIALOG_159 = { 1, 6, 30, 200, dialog_text_DIALOG_159 };
+static const struct DialogEntry dialog_entry_DIALOG_160 = { 1, 4, 30, 200, dialog_text_DIALOG_160 };
+static const struct DialogEntry dialog_entry_DIALOG_161 = { 1, 4, 30, 200, dialog_text_DIALOG_161 };
+static const struct DialogEntry dialog_entry_DIALOG_162 = { 1, 4, 30, 200, dialog_text_DIALOG_162 };
+static const struct DialogEntry dialog_entry_DIALOG_163 = { 1, 5, 30, 200, dialog_text_DIALOG_163 };
+static const struct DialogEntry dialog_entry_DIALOG_164 = { 1, 4, 30, 200, dialog_text_DIALOG_164 };
+static const struct DialogEntry dialog_entry_DIALOG_165 = { 1, 5, 30, 200, dialog_text_DIALOG_165 };
+static const struct DialogEntry dialog_entry_DIALOG_166 = { 1, 4, 30, 200, dialog_text_DIALOG_166 };
+static const struct DialogEntry dialog_entry_DIALOG_167 = { 1, 4, 30, 200, dialog_text_DIALOG_167 };
+static const struct DialogEntry dialog_entry_DIALOG_168 = { 1, 5, 30, 200, dialog_text_DIALOG_168 };
+static const struct DialogEntry dialog_entry_DIALOG_169 = { 1, 4, 30, 200, dialog_text_DIALOG_169 };
+const struct DialogEntry *const seg2_dialog_table[] = {
+&dialog_entry_DIALOG_000,
+&dialog_entry_DIALOG_001,
+&dialog_entry_DIALOG_002,
+&dialog_entry_DIALOG_003,
+&dialog_entry_DIALOG_004,
+&dialog_entry_DIALOG_005,
+&dialog_entry_DIALOG_006,
+&dialog_entry_DIALOG_007,
+&dialog_entry_DIALOG_008,
+&dialog_entry_DIALOG_009,
+&dialog_entry_DIALOG_010,
+&dialog_entry_DIALOG_011,
+&dialog_entry_DIALOG_012,
+&dialog_entry_DIALOG_013,
+&dialog_entry_DIALOG_014,
+&dialog_entry_DIALOG_015,
+&dialog_entry_DIALOG_016,
+&dialog_entry_DIALOG_017,
+&dialog_entry_DIALOG_018,
+&dialog_entry_DIALOG_019,
+&dialog_entry_DIALOG_020,
+&dialog_entry_DIALOG_021,
+&dialog_entry_DIALOG_022,
+&dialog_entry_DIALOG_023,
+&dialog_entry_DIALOG_024,
+&dialog_entry_DIALOG_025,
+&dialog_entry_DIALOG_026,
+&dialog_entry_DIALOG_027,
+&dialog_entry_DIALOG_028,
+&dialog_entry_DIALOG_029,
+&dialog_entry_DIALOG_030,
+&dialog_entry_DIALOG_031,
+&dialog_entry_DIALOG_032,
+&dialog_entry_DIALOG_033,
+&dialog_entry_DIALOG_034,
+&dialog_entry_DIALOG_035,
+&dialog_entry_DIALOG_036,
+&dialog_entry_DIALOG_037,
+&dialog_entry_DIALOG_038,
+&dialog_entry_DIALOG_039,
+&dialog_entry_DIALOG_040,
+&dialog_entry_DIALOG_041,
+&dialog_entry_DIALOG_042,
+&dialog_entry_DIALOG_043,
+&dialog_entry_DIALOG_044,
+&dialog_entry_DIALOG_045,
+&dialog_entry_DIALOG_046,
+&dialog_entry_DIALOG_047,
+&dialog_entry_DIALOG_048,
+&dialog_entry_DIALOG_049,
+&dialog_entry_DIALOG_050,
+&dialog_entry_DIALOG_051,
+&dialog_entry_DIALOG_052,
+&dialog_entry_DIALOG_053,
+&dialog_entry_DIALOG_054,
+&dialog_entry_DIALOG_055,
+&dialog_entry_DIALOG_056,
+&dialog_entry_DIALOG_057,
+&dialog_entry_DIALOG_058,
+&dialog_entry_DIALOG_059,
+&dialog_entry_DIALOG_060,
+&dialog_entry_DIALOG_061,
+&dialog_entry_DIALOG_062,
+&dialog_entry_DIALOG_063,
+&dialog_entry_DIALOG_064,
+&dialog_entry_DIALOG_065,
+&dialog_entry_DIALOG_066,
+&dialog_entry_DIALOG_067,
+&dialog_entry_DIALOG_068,
+&dialog_entry_DIALOG_069,
+&dialog_entry_DIALOG_070,
+&dialog_entry_DIALOG_071,
+&dialog_entry_DIALOG_072,
+&dialog_entry_DIALOG_073,
+&dialog_entry_DIALOG_074,
+&dialog_entry_DIALOG_075,
+&dialog_entry_DIALOG_076,
+&dialog_entry_DIALOG_077,
+&dialog_entry_DIALOG_078,
+&dialog_entry_DIALOG_079,
+&dialog_entry_DIALOG_080,
+&dialog_entry_DIALOG_081,
+&dialog_entry_DIALOG_082,
+&dialog_entry_DIALOG_083,
+&dialog_entry_DIALOG_084,
+&dialog_entry_DIALOG_085,
+&dialog_entry_DIALOG_086,
+&dialog_entry_DIALOG_087,
+&dialog_entry_DIALOG_088,
+&dialog_entry_DIALOG_089,
+&dialog_entry_DIALOG_090,
+&dialog_entry_DIALOG_091,
+&dialog_entry_DIALOG_092,
+&dialog_entry_DIALOG_093,
+&dialog_entry_DIALOG_094,
+&dialog_entry_DIALOG_095,
+&dialog_entry_DIALOG_096,
+&dialog_entry_DIALOG_097,
+&dialog_entry_DIALOG_098,
+&dialog_entry_DIALOG_099,
+&dialog_entry_DIALOG_100,
+&dialog_entry_DIALOG_101,
+&dialog_entry_DIALOG_102,
+&dialog_entry_DIALOG_103,
+&dialog_entry_DIALOG_104,
+&dialog_entry_DIALOG_105,
+&dialog_entry_DIALOG_106,
+&dialog_entry_DIALOG_107,
+&dialog_entry_DIALOG_108,
+&dialog_entry_DIALOG_109,
+&dialog_entry_DIALOG_110,
+&dialog_entry_DIALOG_111,
+&dialog_entry_DIALOG_112,
+&dialog_entry_DIALOG_113,
+&dialog_entry_DIALOG_114,
+&dialog_entry_DIALOG_115,
+&dialog_entry_DIALOG_116,
+&dialog_entry_DIALOG_117,
+&dialog_entry_DIALOG_118,
+&dialog_entry_DIALOG_119,
+&dialog_entry_DIALOG_120,
+&dialog_entry_DIALOG_121,
+&dialog_entry_DIALOG_122,
+&dialog_entry_DIALOG_123,
+&dialog_entry_DIALOG_124,
+&dialog_entry_DIALOG_125,
+&dialog_entry_DIALOG_126,
+&dialog_entry_DIALOG_127,
+&dialog_entry_DIALOG_128,
+&dialog_entry_DIALOG_129,
+&dialog_entry_DIALOG_130,
+&dialog_entry_DIALOG_131,
+&dialog_entry_DIALOG_132,
+&dialog_entry_DIALOG_133,
+&dialog_entry_DIALOG_134,
+&dialog_entry_DIALOG_135,
+&dialog_entry_DIALOG_136,
+&dialog_entry_DIALOG_137,
+&dialog_entry_DIALOG_138,
+&dialog_entry_DIALOG_139,
+&dialog_entry_DIALOG_140,
+&dialog_entry_DIALOG_141,
+&dialog_entry_DIALOG_142,
+&dialog_entry_DIALOG_143,
+&dialog_entry_DIALOG_144,
+&dialog_entry_DIALOG_145,
+&dialog_entry_DIALOG_146,
+&dialog_entry_DIALOG_147,
+&dialog_entry_DIALOG_148,
+&dialog_entry_DIALOG_149,
+&dialog_entry_DIALOG_150,
+&dialog_entry_DIALOG_151,
+&dialog_entry_DIALOG_152,
+&dialog_entry_DIALOG_153,
+&dialog_entry_DIALOG_154,
+&dialog_entry_DIALOG_155,
+&dialog_entry_DIALOG_156,
+&dialog_entry_DIALOG_157,
+&dialog_entry_DIALOG_158,
+&dialog_entry_DIALOG_159,
+&dialog_entry_DIALOG_160,
+&dialog_entry_DIALOG_161,
+&dialog_entry_DIALOG_162,
+&dialog_entry_DIALOG_163,
+&dialog_entry_DIALOG_164,
+&dialog_entry_DIALOG_165,
+&dialog_entry_DIALOG_166,
+&dialog_entry_DIALOG_167,
+&dialog_entry_DIALOG_168,
+&dialog_entry_DIALOG_169,
+    NULL
+};
+static const u8 GLUE2(seg2_course_name_table, _COURSE_BOB)[] = { 0x9E,0x01,0x9E,0x0B,0x18,0x0B,0x9F,0x18,0x16,0x0B,0x9E,0x0B,0x0A,0x1D,0x1D,0x15,0x0E,0x0F,0x12,0x0E,0x15,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_WF)[] = { 0x9E,0x02,0x9E,0x20,0x11,0x18,0x16,0x19,0x3E,0x1C,0x9E,0x0F,0x18,0x1B,0x1D,0x1B,0x0E,0x1C,0x1C,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_JRB)[] = { 0x9E,0x03,0x9E,0x13,0x18,0x15,0x15,0x22,0x9E,0x1B,0x18,0x10,0x0E,0x1B,0x9E,0x0B,0x0A,0x22,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_CCM)[] = { 0x9E,0x04,0x9E,0x0C,0x18,0x18,0x15,0x6F,0x9E,0x0C,0x18,0x18,0x15,0x9E,0x16,0x18,0x1E,0x17,0x1D,0x0A,0x12,0x17,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_BBH)[] = { 0x9E,0x05,0x9E,0x0B,0x12,0x10,0x9E,0x0B,0x18,0x18,0x3E,0x1C,0x9E,0x11,0x0A,0x1E,0x17,0x1D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_HMC)[] = { 0x9E,0x06,0x9E,0x11,0x0A,0x23,0x22,0x9E,0x16,0x0A,0x23,0x0E,0x9E,0x0C,0x0A,0x1F,0x0E,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_LLL)[] = { 0x9E,0x07,0x9E,0x15,0x0E,0x1D,0x11,0x0A,0x15,0x9E,0x15,0x0A,0x1F,0x0A,0x9E,0x15,0x0A,0x17,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_SSL)[] = { 0x9E,0x08,0x9E,0x1C,0x11,0x12,0x0F,0x1D,0x12,0x17,0x10,0x9E,0x1C,0x0A,0x17,0x0D,0x9E,0x15,0x0A,0x17,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_DDD)[] = { 0x9E,0x09,0x9E,0x0D,0x12,0x1B,0x0E,0x6F,0x9E,0x0D,0x12,0x1B,0x0E,0x9E,0x0D,0x18,0x0C,0x14,0x1C,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_SL)[] = { 0x01,0x00,0x9E,0x1C,0x17,0x18,0x20,0x16,0x0A,0x17,0x3E,0x1C,0x9E,0x15,0x0A,0x17,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_WDW)[] = { 0x01,0x01,0x9E,0x20,0x0E,0x1D,0x9F,0x0D,0x1B,0x22,0x9E,0x20,0x18,0x1B,0x15,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_TTM)[] = { 0x01,0x02,0x9E,0x1D,0x0A,0x15,0x15,0x6F,0x9E,0x1D,0x0A,0x15,0x15,0x9E,0x16,0x18,0x1E,0x17,0x1D,0x0A,0x12,0x17,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_THI)[] = { 0x01,0x03,0x9E,0x1D,0x12,0x17,0x22,0x9F,0x11,0x1E,0x10,0x0E,0x9E,0x12,0x1C,0x15,0x0A,0x17,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_TTC)[] = { 0x01,0x04,0x9E,0x1D,0x12,0x0C,0x14,0x9E,0x1D,0x18,0x0C,0x14,0x9E,0x0C,0x15,0x18,0x0C,0x14,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_RR)[] = { 0x01,0x05,0x9E,0x1B,0x0A,0x12,0x17,0x0B,0x18,0x20,0x9E,0x1B,0x12,0x0D,0x0E,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_BITDW)[] = { 0x9E,0x9E,0x9E,0x0B,0x18,0x20,0x1C,0x0E,0x1B,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0D,0x0A,0x1B,0x14,0x9E,0x20,0x18,0x1B,0x15,0x0D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_BITFS)[] = { 0x9E,0x9E,0x9E,0x0B,0x18,0x20,0x1C,0x0E,0x1B,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0F,0x12,0x1B,0x0E,0x9E,0x1C,0x0E,0x0A,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_BITS)[] = { 0x9E,0x9E,0x9E,0x0B,0x18,0x20,0x1C,0x0E,0x1B,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x14,0x22,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_PSS)[] = { 0x9E,0x9E,0x9E,0x1D,0x11,0x0E,0x9E,0x19,0x1B,0x12,0x17,0x0C,0x0E,0x1C,0x1C,0x3E,0x1C,0x9E,0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x9E,0x1C,0x15,0x12,0x0D,0x0E,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_COTMC)[] = { 0x9E,0x9E,0x9E,0x0C,0x0A,0x1F,0x0E,0x1B,0x17,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x16,0x0E,0x1D,0x0A,0x15,0x9E,0x0C,0x0A,0x19,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_TOTWC)[] = { 0x9E,0x9E,0x9E,0x1D,0x18,0x20,0x0E,0x1B,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x20,0x12,0x17,0x10,0x9E,0x0C,0x0A,0x19,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_VCUTM)[] = { 0x9E,0x9E,0x9E,0x1F,0x0A,0x17,0x12,0x1C,0x11,0x9E,0x0C,0x0A,0x19,0x9E,0x1E,0x17,0x0D,0x0E,0x1B,0x9E,0x1D,0x11,0x0E,0x9E,0x16,0x18,0x0A,0x1D,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_WMOTR)[] = { 0x9E,0x9E,0x9E,0x20,0x12,0x17,0x10,0x9E,0x16,0x0A,0x1B,0x12,0x18,0x9E,0x18,0x1F,0x0E,0x1B,0x9E,0x1D,0x11,0x0E,0x9E,0x1B,0x0A,0x12,0x17,0x0B,0x18,0x20,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_SA)[] = { 0x9E,0x9E,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x9E,0x0A,0x1A,0x1E,0x0A,0x1B,0x12,0x1E,0x16,0xFF };
+static const u8 GLUE2(seg2_course_name_table, _COURSE_CAKE_END)[] = { 0xFF };
+static const u8 GLUE2(seg2_course_name_table, _castle_secret_stars)[] = { 0x9E,0x9E,0x9E,0x0C,0x0A,0x1C,0x1D,0x15,0x0E,0x9E,0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x9E,0x1C,0x1D,0x0A,0x1B,0x1C,0xFF };
+
+
+
+
+
+
+
+const u8 *const seg2_course_name_table[] = {
+GLUE2(seg2_course_name_table, _COURSE_BOB),
+GLUE2(seg2_course_name_table, _COURSE_WF),
+GLUE2(seg2_course_name_table, _COURSE_JRB),
+GLUE2(seg2_course_name_table, _COURSE_CCM),
+GLUE2(seg2_course_name_table, _COURSE_BBH),
+GLUE2(seg2_course_name_table, _COURSE_HMC),
+GLUE2(seg2_course_name_table, _COURSE_LLL),
+GLUE2(seg2_course_name_table, _COURSE_SSL),
+GLUE2(seg2_course_name_table, _COURSE_DDD),
+GLUE2(seg2_course_name_table, _COURSE_SL),
+GLUE2(seg2_course_name_table, _COURSE_WDW),
+GLUE2(seg2_course_name_table, _COURSE_TTM),
+GLUE2(seg2_course_name_table, _COURSE_THI),
+GLUE2(seg2_course_name_table, _COURSE_TTC),
+GLUE2(seg2_course_name_table, _COURSE_RR),
+GLUE2(seg2_course_name_table, _COURSE_BITDW),
+GLUE2(seg2_course_name_table, _COURSE_BITFS),
+GLUE2(seg2_course_name_table, _COURSE_BITS),
+GLUE2(seg2_course_name_table, _COURSE_PSS),
+GLUE2(seg2_course_name_table, _COURSE_COTMC),
+GLUE2(seg2_course_name_table, _COURSE_TOTWC),
+GLUE2(seg2_course_name_table, _COURSE_VCUTM),
+GLUE2(seg2_course_name_table, _COURSE_WMOTR),
+GLUE2(seg2_course_name_table, _COURSE_SA),
+GLUE2(seg2_course_name_table, _COURSE_CAKE_END),
+GLUE2(seg2_course_name_table, _castle_secret_stars),
+
+
+
+
+
+
+
+    NULL
+};
+static const u8 act_name_COURSE_BOB_1[] = { 0x0B,0x12,0x10,0x9E,0x0B,0x18,0x0B,0x9F,0x18,0x16,0x0B,0x9E,0x18,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x1E,0x16,0x16,0x12,0x1D,0xFF }; static const u8 act_name_COURSE_BOB_2[] = { 0x0F,0x18,0x18,0x1D,0x1B,0x0A,0x0C,0x0E,0x9E,0x20,0x12,0x1D,0x11,0x9E,0x14,0x18,0x18,0x19,0x0A,0x9E,0x1D,0x11,0x0E,0x9E,0x1A,0x1E,0x12,0x0C,0x14,0xFF }; static const u8 act_name_COURSE_BOB_3[] = { 0x1C,0x11,0x18,0x18,0x1D,0x9E,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x12,0x1C,0x15,0x0A,0x17,0x0D,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x14,0x22,0xFF }; static const u8 act_name_COURSE_BOB_4[] = { 0x0F,0x12,0x17,0x0D,0x9E,0x1D,0x11,0x0E,0x9E,0x08,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_BOB_5[] = { 0x16,0x0A,0x1B,0x12,0x18,0x9E,0x20,0x12,0x17,0x10,0x1C,0x9E,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x14,0x22,0xFF }; static const u8 act_name_COURSE_BOB_6[] = { 0x0B,0x0E,0x11,0x12,0x17,0x0D,0x9E,0x0C,0x11,0x0A,0x12,0x17,0x9E,0x0C,0x11,0x18,0x16,0x19,0x3E,0x1C,0x9E,0x10,0x0A,0x1D,0x0E,0xFF };
+static const u8 act_name_COURSE_WF_1[] = { 0x0C,0x11,0x12,0x19,0x9E,0x18,0x0F,0x0F,0x9E,0x20,0x11,0x18,0x16,0x19,0x3E,0x1C,0x9E,0x0B,0x15,0x18,0x0C,0x14,0xFF }; static const u8 act_name_COURSE_WF_2[] = { 0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x1D,0x18,0x19,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x0F,0x18,0x1B,0x1D,0x1B,0x0E,0x1C,0x1C,0xFF }; static const u8 act_name_COURSE_WF_3[] = { 0x1C,0x11,0x18,0x18,0x1D,0x9E,0x12,0x17,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x20,0x12,0x15,0x0D,0x9E,0x0B,0x15,0x1E,0x0E,0xFF }; static const u8 act_name_COURSE_WF_4[] = { 0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0x9E,0x18,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0F,0x15,0x18,0x0A,0x1D,0x12,0x17,0x10,0x9E,0x12,0x1C,0x15,0x0E,0xFF }; static const u8 act_name_COURSE_WF_5[] = { 0x0F,0x0A,0x15,0x15,0x9E,0x18,0x17,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x0C,0x0A,0x10,0x0E,0x0D,0x9E,0x12,0x1C,0x15,0x0A,0x17,0x0D,0xFF }; static const u8 act_name_COURSE_WF_6[] = { 0x0B,0x15,0x0A,0x1C,0x1D,0x9E,0x0A,0x20,0x0A,0x22,0x9E,0x1D,0x11,0x0E,0x9E,0x20,0x0A,0x15,0x15,0xFF };
+static const u8 act_name_COURSE_JRB_1[] = { 0x19,0x15,0x1E,0x17,0x0D,0x0E,0x1B,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x1E,0x17,0x14,0x0E,0x17,0x9E,0x1C,0x11,0x12,0x19,0xFF }; static const u8 act_name_COURSE_JRB_2[] = { 0x0C,0x0A,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0E,0x0E,0x15,0x9E,0x0C,0x18,0x16,0x0E,0x9E,0x18,0x1E,0x1D,0x9E,0x1D,0x18,0x9E,0x19,0x15,0x0A,0x22,0xF4,0xFF }; static const u8 act_name_COURSE_JRB_3[] = { 0x1D,0x1B,0x0E,0x0A,0x1C,0x1E,0x1B,0x0E,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x18,0x0C,0x0E,0x0A,0x17,0x9E,0x0C,0x0A,0x1F,0x0E,0xFF }; static const u8 act_name_COURSE_JRB_4[] = { 0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0x9E,0x18,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x11,0x12,0x19,0x9E,0x0A,0x0F,0x15,0x18,0x0A,0x1D,0xFF }; static const u8 act_name_COURSE_JRB_5[] = { 0x0B,0x15,0x0A,0x1C,0x1D,0x9E,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x1D,0x18,0x17,0x0E,0x9E,0x19,0x12,0x15,0x15,0x0A,0x1B,0xFF }; static const u8 act_name_COURSE_JRB_6[] = { 0x1D,0x11,0x1B,0x18,0x1E,0x10,0x11,0x9E,0x1D,0x11,0x0E,0x9E,0x13,0x0E,0x1D,0x9E,0x1C,0x1D,0x1B,0x0E,0x0A,0x16,0xFF };
+static const u8 act_name_COURSE_CCM_1[] = { 0x1C,0x15,0x12,0x19,0x9E,0x1C,0x15,0x12,0x0D,0x12,0x17,0x3E,0x9E,0x0A,0x20,0x0A,0x22,0xFF }; static const u8 act_name_COURSE_CCM_2[] = { 0x15,0x12,0x3E,0x15,0x9E,0x19,0x0E,0x17,0x10,0x1E,0x12,0x17,0x9E,0x15,0x18,0x1C,0x1D,0xFF }; static const u8 act_name_COURSE_CCM_3[] = { 0x0B,0x12,0x10,0x9E,0x19,0x0E,0x17,0x10,0x1E,0x12,0x17,0x9E,0x1B,0x0A,0x0C,0x0E,0xFF }; static const u8 act_name_COURSE_CCM_4[] = { 0x0F,0x1B,0x18,0x1C,0x1D,0x22,0x9E,0x1C,0x15,0x12,0x0D,0x0E,0x9E,0x0F,0x18,0x1B,0x9E,0x08,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_CCM_5[] = { 0x1C,0x17,0x18,0x20,0x16,0x0A,0x17,0x3E,0x1C,0x9E,0x15,0x18,0x1C,0x1D,0x9E,0x11,0x12,0x1C,0x9E,0x11,0x0E,0x0A,0x0D,0xFF }; static const u8 act_name_COURSE_CCM_6[] = { 0x20,0x0A,0x15,0x15,0x9E,0x14,0x12,0x0C,0x14,0x1C,0x9E,0x20,0x12,0x15,0x15,0x9E,0x20,0x18,0x1B,0x14,0xFF };
+static const u8 act_name_COURSE_BBH_1[] = { 0x10,0x18,0x9E,0x18,0x17,0x9E,0x0A,0x9E,0x10,0x11,0x18,0x1C,0x1D,0x9E,0x11,0x1E,0x17,0x1D,0xFF }; static const u8 act_name_COURSE_BBH_2[] = { 0x1B,0x12,0x0D,0x0E,0x9E,0x0B,0x12,0x10,0x9E,0x0B,0x18,0x18,0x3E,0x1C,0x9E,0x16,0x0E,0x1B,0x1B,0x22,0x9F,0x10,0x18,0x9F,0x1B,0x18,0x1E,0x17,0x0D,0xFF }; static const u8 act_name_COURSE_BBH_3[] = { 0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x11,0x0A,0x1E,0x17,0x1D,0x0E,0x0D,0x9E,0x0B,0x18,0x18,0x14,0x1C,0xFF }; static const u8 act_name_COURSE_BBH_4[] = { 0x1C,0x0E,0x0E,0x14,0x9E,0x1D,0x11,0x0E,0x9E,0x08,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_BBH_5[] = { 0x0B,0x12,0x10,0x9E,0x0B,0x18,0x18,0x3E,0x1C,0x9E,0x0B,0x0A,0x15,0x0C,0x18,0x17,0x22,0xFF }; static const u8 act_name_COURSE_BBH_6[] = { 0x0E,0x22,0x0E,0x9E,0x1D,0x18,0x9E,0x0E,0x22,0x0E,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x9E,0x1B,0x18,0x18,0x16,0xFF };
+static const u8 act_name_COURSE_HMC_1[] = { 0x1C,0x20,0x12,0x16,0x16,0x12,0x17,0x10,0x9E,0x0B,0x0E,0x0A,0x1C,0x1D,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0C,0x0A,0x1F,0x0E,0x1B,0x17,0xFF }; static const u8 act_name_COURSE_HMC_2[] = { 0x0E,0x15,0x0E,0x1F,0x0A,0x1D,0x0E,0x9E,0x0F,0x18,0x1B,0x9E,0x08,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_HMC_3[] = { 0x16,0x0E,0x1D,0x0A,0x15,0x9F,0x11,0x0E,0x0A,0x0D,0x9E,0x16,0x0A,0x1B,0x12,0x18,0x9E,0x0C,0x0A,0x17,0x9E,0x16,0x18,0x1F,0x0E,0xF2,0xFF }; static const u8 act_name_COURSE_HMC_4[] = { 0x17,0x0A,0x1F,0x12,0x10,0x0A,0x1D,0x12,0x17,0x10,0x9E,0x1D,0x11,0x0E,0x9E,0x1D,0x18,0x21,0x12,0x0C,0x9E,0x16,0x0A,0x23,0x0E,0xFF }; static const u8 act_name_COURSE_HMC_5[] = { 0x0A,0x9F,0x16,0x0A,0x23,0x0E,0x9F,0x12,0x17,0x10,0x9E,0x0E,0x16,0x0E,0x1B,0x10,0x0E,0x17,0x0C,0x22,0x9E,0x0E,0x21,0x12,0x1D,0xFF }; static const u8 act_name_COURSE_HMC_6[] = { 0x20,0x0A,0x1D,0x0C,0x11,0x9E,0x0F,0x18,0x1B,0x9E,0x1B,0x18,0x15,0x15,0x12,0x17,0x10,0x9E,0x1B,0x18,0x0C,0x14,0x1C,0xFF };
+static const u8 act_name_COURSE_LLL_1[] = { 0x0B,0x18,0x12,0x15,0x9E,0x1D,0x11,0x0E,0x9E,0x0B,0x12,0x10,0x9E,0x0B,0x1E,0x15,0x15,0x22,0xFF }; static const u8 act_name_COURSE_LLL_2[] = { 0x0B,0x1E,0x15,0x15,0x22,0x9E,0x1D,0x11,0x0E,0x9E,0x0B,0x1E,0x15,0x15,0x12,0x0E,0x1C,0xFF }; static const u8 act_name_COURSE_LLL_3[] = { 0x08,0x9F,0x0C,0x18,0x12,0x17,0x9E,0x19,0x1E,0x23,0x23,0x15,0x0E,0x9E,0x20,0x12,0x1D,0x11,0x9E,0x01,0x05,0x9E,0x19,0x12,0x0E,0x0C,0x0E,0x1C,0xFF }; static const u8 act_name_COURSE_LLL_4[] = { 0x1B,0x0E,0x0D,0x9F,0x11,0x18,0x1D,0x9E,0x15,0x18,0x10,0x9E,0x1B,0x18,0x15,0x15,0x12,0x17,0x10,0xFF }; static const u8 act_name_COURSE_LLL_5[] = { 0x11,0x18,0x1D,0x9F,0x0F,0x18,0x18,0x1D,0x9F,0x12,0x1D,0x9E,0x12,0x17,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x1F,0x18,0x15,0x0C,0x0A,0x17,0x18,0xFF }; static const u8 act_name_COURSE_LLL_6[] = { 0x0E,0x15,0x0E,0x1F,0x0A,0x1D,0x18,0x1B,0x9E,0x1D,0x18,0x1E,0x1B,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1F,0x18,0x15,0x0C,0x0A,0x17,0x18,0xFF };
+static const u8 act_name_COURSE_SSL_1[] = { 0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1D,0x0A,0x15,0x18,0x17,0x1C,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x0B,0x12,0x10,0x9E,0x0B,0x12,0x1B,0x0D,0xFF }; static const u8 act_name_COURSE_SSL_2[] = { 0x1C,0x11,0x12,0x17,0x12,0x17,0x10,0x9E,0x0A,0x1D,0x18,0x19,0x9E,0x1D,0x11,0x0E,0x9E,0x19,0x22,0x1B,0x0A,0x16,0x12,0x0D,0xFF }; static const u8 act_name_COURSE_SSL_3[] = { 0x12,0x17,0x1C,0x12,0x0D,0x0E,0x9E,0x1D,0x11,0x0E,0x9E,0x0A,0x17,0x0C,0x12,0x0E,0x17,0x1D,0x9E,0x19,0x22,0x1B,0x0A,0x16,0x12,0x0D,0xFF }; static const u8 act_name_COURSE_SSL_4[] = { 0x1C,0x1D,0x0A,0x17,0x0D,0x9E,0x1D,0x0A,0x15,0x15,0x9E,0x18,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0F,0x18,0x1E,0x1B,0x9E,0x19,0x12,0x15,0x15,0x0A,0x1B,0x1C,0xFF }; static const u8 act_name_COURSE_SSL_5[] = { 0x0F,0x1B,0x0E,0x0E,0x9E,0x0F,0x15,0x22,0x12,0x17,0x10,0x9E,0x0F,0x18,0x1B,0x9E,0x08,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_SSL_6[] = { 0x19,0x22,0x1B,0x0A,0x16,0x12,0x0D,0x9E,0x19,0x1E,0x23,0x23,0x15,0x0E,0xFF };
+static const u8 act_name_COURSE_DDD_1[] = { 0x0B,0x18,0x0A,0x1B,0x0D,0x9E,0x0B,0x18,0x20,0x1C,0x0E,0x1B,0x3E,0x1C,0x9E,0x1C,0x1E,0x0B,0xFF }; static const u8 act_name_COURSE_DDD_2[] = { 0x0C,0x11,0x0E,0x1C,0x1D,0x1C,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0C,0x1E,0x1B,0x1B,0x0E,0x17,0x1D,0xFF }; static const u8 act_name_COURSE_DDD_3[] = { 0x19,0x18,0x15,0x0E,0x9F,0x13,0x1E,0x16,0x19,0x12,0x17,0x10,0x9E,0x0F,0x18,0x1B,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_DDD_4[] = { 0x1D,0x11,0x1B,0x18,0x1E,0x10,0x11,0x9E,0x1D,0x11,0x0E,0x9E,0x13,0x0E,0x1D,0x9E,0x1C,0x1D,0x1B,0x0E,0x0A,0x16,0xFF }; static const u8 act_name_COURSE_DDD_5[] = { 0x1D,0x11,0x0E,0x9E,0x16,0x0A,0x17,0x1D,0x0A,0x9E,0x1B,0x0A,0x22,0x3E,0x1C,0x9E,0x1B,0x0E,0x20,0x0A,0x1B,0x0D,0xFF }; static const u8 act_name_COURSE_DDD_6[] = { 0x0C,0x18,0x15,0x15,0x0E,0x0C,0x1D,0x9E,0x1D,0x11,0x0E,0x9E,0x0C,0x0A,0x19,0x1C,0x3F,0x3F,0x3F,0xFF };
+static const u8 act_name_COURSE_SL_1[] = { 0x1C,0x17,0x18,0x20,0x16,0x0A,0x17,0x3E,0x1C,0x9E,0x0B,0x12,0x10,0x9E,0x11,0x0E,0x0A,0x0D,0xFF }; static const u8 act_name_COURSE_SL_2[] = { 0x0C,0x11,0x12,0x15,0x15,0x9E,0x20,0x12,0x1D,0x11,0x9E,0x1D,0x11,0x0E,0x9E,0x0B,0x1E,0x15,0x15,0x22,0xFF }; static const u8 act_name_COURSE_SL_3[] = { 0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0D,0x0E,0x0E,0x19,0x9E,0x0F,0x1B,0x0E,0x0E,0x23,0x0E,0xFF }; static const u8 act_name_COURSE_SL_4[] = { 0x20,0x11,0x12,0x1B,0x15,0x9E,0x0F,0x1B,0x18,0x16,0x9E,0x1D,0x11,0x0E,0x9E,0x0F,0x1B,0x0E,0x0E,0x23,0x12,0x17,0x10,0x9E,0x19,0x18,0x17,0x0D,0xFF }; static const u8 act_name_COURSE_SL_5[] = { 0x1C,0x11,0x0E,0x15,0x15,0x9E,0x1C,0x11,0x1B,0x0E,0x0D,0x0D,0x12,0x17,0x3E,0x9E,0x0F,0x18,0x1B,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_SL_6[] = { 0x12,0x17,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x12,0x10,0x15,0x18,0x18,0xFF };
+static const u8 act_name_COURSE_WDW_1[] = { 0x1C,0x11,0x18,0x0C,0x14,0x12,0x17,0x10,0x9E,0x0A,0x1B,0x1B,0x18,0x20,0x9E,0x15,0x12,0x0F,0x1D,0x1C,0xF2,0xFF }; static const u8 act_name_COURSE_WDW_2[] = { 0x1D,0x18,0x19,0x9E,0x18,0x3E,0x9E,0x1D,0x11,0x0E,0x9E,0x1D,0x18,0x20,0x17,0xFF }; static const u8 act_name_COURSE_WDW_3[] = { 0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x1C,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x11,0x0A,0x15,0x15,0x18,0x20,0x1C,0x9E,0xE5,0x9E,0x1C,0x14,0x22,0xFF }; static const u8 act_name_COURSE_WDW_4[] = { 0x0E,0x21,0x19,0x1B,0x0E,0x1C,0x1C,0x9E,0x0E,0x15,0x0E,0x1F,0x0A,0x1D,0x18,0x1B,0x9F,0x9F,0x11,0x1E,0x1B,0x1B,0x22,0x9E,0x1E,0x19,0xF2,0xFF }; static const u8 act_name_COURSE_WDW_5[] = { 0x10,0x18,0x9E,0x1D,0x18,0x9E,0x1D,0x18,0x20,0x17,0x9E,0x0F,0x18,0x1B,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_WDW_6[] = { 0x1A,0x1E,0x12,0x0C,0x14,0x9E,0x1B,0x0A,0x0C,0x0E,0x9E,0x1D,0x11,0x1B,0x18,0x1E,0x10,0x11,0x9E,0x0D,0x18,0x20,0x17,0x1D,0x18,0x20,0x17,0xF2,0xFF };
+static const u8 act_name_COURSE_TTM_1[] = { 0x1C,0x0C,0x0A,0x15,0x0E,0x9E,0x1D,0x11,0x0E,0x9E,0x16,0x18,0x1E,0x17,0x1D,0x0A,0x12,0x17,0xFF }; static const u8 act_name_COURSE_TTM_2[] = { 0x16,0x22,0x1C,0x1D,0x0E,0x1B,0x22,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x16,0x18,0x17,0x14,0x0E,0x22,0x9E,0x0C,0x0A,0x10,0x0E,0xFF }; static const u8 act_name_COURSE_TTM_3[] = { 0x1C,0x0C,0x0A,0x1B,0x22,0x9E,0x3E,0x1C,0x11,0x1B,0x18,0x18,0x16,0x1C,0x6F,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_TTM_4[] = { 0x16,0x22,0x1C,0x1D,0x0E,0x1B,0x12,0x18,0x1E,0x1C,0x9E,0x16,0x18,0x1E,0x17,0x1D,0x0A,0x12,0x17,0x1C,0x12,0x0D,0x0E,0xFF }; static const u8 act_name_COURSE_TTM_5[] = { 0x0B,0x1B,0x0E,0x0A,0x1D,0x11,0x1D,0x0A,0x14,0x12,0x17,0x10,0x9E,0x1F,0x12,0x0E,0x20,0x9E,0x0F,0x1B,0x18,0x16,0x9E,0x0B,0x1B,0x12,0x0D,0x10,0x0E,0xFF }; static const u8 act_name_COURSE_TTM_6[] = { 0x0B,0x15,0x0A,0x1C,0x1D,0x9E,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x15,0x18,0x17,0x0E,0x15,0x22,0x9E,0x16,0x1E,0x1C,0x11,0x1B,0x18,0x18,0x16,0xFF };
+static const u8 act_name_COURSE_THI_1[] = { 0x19,0x15,0x1E,0x0C,0x14,0x9E,0x1D,0x11,0x0E,0x9E,0x19,0x12,0x1B,0x0A,0x17,0x11,0x0A,0x9E,0x0F,0x15,0x18,0x20,0x0E,0x1B,0xFF }; static const u8 act_name_COURSE_THI_2[] = { 0x1D,0x11,0x0E,0x9E,0x1D,0x12,0x19,0x9E,0x1D,0x18,0x19,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x11,0x1E,0x10,0x0E,0x9E,0x12,0x1C,0x15,0x0A,0x17,0x0D,0xFF }; static const u8 act_name_COURSE_THI_3[] = { 0x1B,0x0E,0x16,0x0A,0x1D,0x0C,0x11,0x9E,0x20,0x12,0x1D,0x11,0x9E,0x14,0x18,0x18,0x19,0x0A,0x9E,0x1D,0x11,0x0E,0x9E,0x1A,0x1E,0x12,0x0C,0x14,0xFF }; static const u8 act_name_COURSE_THI_4[] = { 0x0F,0x12,0x1F,0x0E,0x9E,0x12,0x1D,0x1D,0x22,0x9E,0x0B,0x12,0x1D,0x1D,0x22,0x9E,0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x1C,0xFF }; static const u8 act_name_COURSE_THI_5[] = { 0x20,0x12,0x10,0x10,0x15,0x0E,0x1B,0x3E,0x1C,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF }; static const u8 act_name_COURSE_THI_6[] = { 0x16,0x0A,0x14,0x0E,0x9E,0x20,0x12,0x10,0x10,0x15,0x0E,0x1B,0x9E,0x1C,0x1A,0x1E,0x12,0x1B,0x16,0xFF };
+static const u8 act_name_COURSE_TTC_1[] = { 0x1B,0x18,0x15,0x15,0x9E,0x12,0x17,0x1D,0x18,0x9E,0x1D,0x11,0x0E,0x9E,0x0C,0x0A,0x10,0x0E,0xFF }; static const u8 act_name_COURSE_TTC_2[] = { 0x1D,0x11,0x0E,0x9E,0x19,0x12,0x1D,0x9E,0x0A,0x17,0x0D,0x9E,0x1D,0x11,0x0E,0x9E,0x19,0x0E,0x17,0x0D,0x1E,0x15,0x1E,0x16,0x1C,0xFF }; static const u8 act_name_COURSE_TTC_3[] = { 0x10,0x0E,0x1D,0x9E,0x0A,0x9E,0x11,0x0A,0x17,0x0D,0xFF }; static const u8 act_name_COURSE_TTC_4[] = { 0x1C,0x1D,0x18,0x16,0x19,0x9E,0x18,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1D,0x11,0x20,0x18,0x16,0x19,0xFF }; static const u8 act_name_COURSE_TTC_5[] = { 0x1D,0x12,0x16,0x0E,0x0D,0x9E,0x13,0x1E,0x16,0x19,0x1C,0x9E,0x18,0x17,0x9E,0x16,0x18,0x1F,0x12,0x17,0x10,0x9E,0x0B,0x0A,0x1B,0x1C,0xFF }; static const u8 act_name_COURSE_TTC_6[] = { 0x1C,0x1D,0x18,0x19,0x9E,0x1D,0x12,0x16,0x0E,0x9E,0x0F,0x18,0x1B,0x9E,0x1B,0x0E,0x0D,0x9E,0x0C,0x18,0x12,0x17,0x1C,0xFF };
+static const u8 act_name_COURSE_RR_1[] = { 0x0C,0x1B,0x1E,0x12,0x1C,0x0E,0x1B,0x9E,0x0C,0x1B,0x18,0x1C,0x1C,0x12,0x17,0x10,0x9E,0x1D,0x11,0x0E,0x9E,0x1B,0x0A,0x12,0x17,0x0B,0x18,0x20,0xFF }; static const u8 act_name_COURSE_RR_2[] = { 0x1D,0x11,0x0E,0x9E,0x0B,0x12,0x10,0x9E,0x11,0x18,0x1E,0x1C,0x0E,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x1C,0x14,0x22,0xFF }; static const u8 act_name_COURSE_RR_3[] = { 0x0C,0x18,0x12,0x17,0x1C,0x9E,0x0A,0x16,0x0A,0x1C,0x1C,0x0E,0x0D,0x9E,0x12,0x17,0x9E,0x0A,0x9E,0x16,0x0A,0x23,0x0E,0xFF }; static const u8 act_name_COURSE_RR_4[] = { 0x1C,0x20,0x12,0x17,0x10,0x12,0x17,0x3E,0x9E,0x12,0x17,0x9E,0x1D,0x11,0x0E,0x9E,0x0B,0x1B,0x0E,0x0E,0x23,0x0E,0xFF }; static const u8 act_name_COURSE_RR_5[] = { 0x1D,0x1B,0x12,0x0C,0x14,0x22,0x9E,0x1D,0x1B,0x12,0x0A,0x17,0x10,0x15,0x0E,0x1C,0xF2,0xFF }; static const u8 act_name_COURSE_RR_6[] = { 0x1C,0x18,0x16,0x0E,0x20,0x11,0x0E,0x1B,0x0E,0x9E,0x18,0x1F,0x0E,0x1B,0x9E,0x1D,0x11,0x0E,0x9E,0x1B,0x0A,0x12,0x17,0x0B,0x18,0x20,0xFF };
+
+
+
+
+
+
+
+
+
+
+
+static const u8 extra_text_0[] = { 0x18,0x17,0x0E,0x9E,0x18,0x0F,0x9E,0x1D,0x11,0x0E,0x9E,0x0C,0x0A,0x1C,0x1D,0x15,0x0E,0x3E,0x1C,0x9E,0x1C,0x0E,0x0C,0x1B,0x0E,0x1D,0x9E,0x1C,0x1D,0x0A,0x1B,0x1C,0xF2,0xFF };
+static const u8 extra_text_1[] = { 0xFF };
+static const u8 extra_text_2[] = { 0xFF };
+static const u8 extra_text_3[] = { 0xFF };
+static const u8 extra_text_4[] = { 0xFF };
+static const u8 extra_text_5[] = { 0xFF };
+static const u8 extra_text_6[] = { 0xFF };
+const u8 *const seg2_act_name_table[] = {
+act_name_COURSE_BOB_1, act_name_COURSE_BOB_2, act_name_COURSE_BOB_3, act_name_COURSE_BOB_4, act_name_COURSE_BOB_5, act_name_COURSE_BOB_6,
+act_name_COURSE_WF_1, act_name_COURSE_WF_2, act_name_COURSE_WF_3, act_name_COURSE_WF_4, act_name_COURSE_WF_5, act_name_COURSE_WF_6,
+act_name_COURSE_JRB_1, act_name_COURSE_JRB_2, act_name_COURSE_JRB_3, act_name_COURSE_JRB_4, act_name_COURSE_JRB_5, act_name_COURSE_JRB_6,
+act_name_COURSE_CCM_1, act_name_COURSE_CCM_2, act_name_COURSE_CCM_3, act_name_COURSE_CCM_4, act_name_COURSE_CCM_5, act_name_COURSE_CCM_6,
+act_name_COURSE_BBH_1, act_name_COURSE_BBH_2, act_name_COURSE_BBH_3, act_name_COURSE_BBH_4, act_name_COURSE_BBH_5, act_name_COURSE_BBH_6,
+act_name_COURSE_HMC_1, act_name_COURSE_HMC_2, act_name_COURSE_HMC_3, act_name_COURSE_HMC_4, act_name_COURSE_HMC_5, act_name_COURSE_HMC_6,
+act_name_COURSE_LLL_1, act_name_COURSE_LLL_2, act_name_COURSE_LLL_3, act_name_COURSE_LLL_4, act_name_COURSE_LLL_5, act_name_COURSE_LLL_6,
+act_name_COURSE_SSL_1, act_name_COURSE_SSL_2, act_name_COURSE_SSL_3, act_name_COURSE_SSL_4, act_name_COURSE_SSL_5, act_name_COURSE_SSL_6,
+act_name_COURSE_DDD_1, act_name_COURSE_DDD_2, act_name_COURSE_DDD_3, act_name_COURSE_DDD_4, act_name_COURSE_DDD_5, act_name_COURSE_DDD_6,
+act_name_COURSE_SL_1, act_name_COURSE_SL_2, act_name_COURSE_SL_3, act_name_COURSE_SL_4, act_name_COURSE_SL_5, act_name_COURSE_SL_6,
+act_name_COURSE_WDW_1, act_name_COURSE_WDW_2, act_name_COURSE_WDW_3, act_name_COURSE_WDW_4, act_name_COURSE_WDW_5, act_name_COURSE_WDW_6,
+act_name_COURSE_TTM_1, act_name_COURSE_TTM_2, act_name_COURSE_TTM_3, act_name_COURSE_TTM_4, act_name_COURSE_TTM_5, act_name_COURSE_TTM_6,
+act_name_COURSE_THI_1, act_name_COURSE_THI_2, act_name_COURSE_THI_3, act_name_COURSE_THI_4, act_name_COURSE_THI_5, act_name_COURSE_THI_6,
+act_name_COURSE_TTC_1, act_name_COURSE_TTC_2, act_name_COURSE_TTC_3, act_name_COURSE_TTC_4, act_name_COURSE_TTC_5, act_name_COURSE_TTC_6,
+act_name_COURSE_RR_1, act_name_COURSE_RR_2, act_name_COURSE_RR_3, act_name_COURSE_RR_4, act_name_COURSE_RR_5, act_name_COURSE_RR_6,
+
+
+
+
+
+
+
+
+
+
+
+extra_text_0,
+extra_text_1,
+extra_text_2,
+extra_text_3,
+extra_text_4,
+extra_text_5,
+extra_text_6,
+    NULL
+};
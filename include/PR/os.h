@@ -37,6 +37,7 @@ extern "C" {
 
 #include <PR/ultratypes.h>
 #include "PR/os_message.h"
+#include "PR/os_time.h"
 
 #if defined(_LANGUAGE_C) || defined(_LANGUAGE_C_PLUS_PLUS)
 
@@ -502,12 +503,7 @@ typedef struct {
  */
 extern u64 osClockRate;
 
-#define    OS_CLOCK_RATE        62500000LL
-#define    OS_CPU_COUNTER        (OS_CLOCK_RATE*3/4)
-#define OS_NSEC_TO_CYCLES(n)    (((u64)(n)*(OS_CPU_COUNTER/15625000LL))/(1000000000LL/15625000LL))
-#define OS_USEC_TO_CYCLES(n)    (((u64)(n)*(OS_CPU_COUNTER/15625LL))/(1000000LL/15625LL))
-#define OS_CYCLES_TO_NSEC(c)    (((u64)(c)*(1000000000LL/15625000LL))/(OS_CPU_COUNTER/15625000LL))
-#define OS_CYCLES_TO_USEC(c)    (((u64)(c)*(1000000LL/15625LL))/(OS_CPU_COUNTER/15625LL))
+/* The counter conversion macros are in os_time.h */
 
 /**************************************************************************
  *
@@ -205,6 +205,9 @@ struct Object
     /*0x218*/ void *collisionData;
     /*0x21C*/ Mat4 transform;
     /*0x25C*/ void *respawnInfo;
+#ifndef TARGET_N64
+    u16 lodPhase; // see object_lod.c
+#endif
 };
 
 struct ObjectHitbox
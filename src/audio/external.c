@@ -12,6 +12,9 @@
 #include "game/camera.h"
 #include "seq_ids.h"
 #include "dialog_ids.h"
+#ifndef TARGET_N64
+#include "pc/audio_event_log.h"
+#endif
 
 #if defined(VERSION_EU) || defined(VERSION_SH)
 #define EU_FLOAT(x) x##f
@@ -831,6 +834,9 @@ void create_next_audio_buffer(s16 *samples, u32 num_samples) {
  * Called from threads: thread5_game_loop
  */
 void play_sound(s32 soundBits, f32 *pos) {
+#ifndef TARGET_N64
+    audio_event_log_sound(soundBits);
+#endif
     sSoundRequests[sSoundRequestCount].soundBits = soundBits;
     sSoundRequests[sSoundRequestCount].position = pos;
     sSoundRequestCount++;
@@ -1345,6 +1351,9 @@ static void noop_8031EEC8(void) {
  * Called from threads: thread5_game_loop
  */
 void audio_signal_game_loop_tick(void) {
+#ifndef TARGET_N64
+    audio_event_log_tick();
+#endif
     sGameLoopTicked = 1;
 #if defined(VERSION_EU) || defined(VERSION_SH)
     maybe_tick_game_sound();
@@ -1791,11 +1800,18 @@ void seq_player_fade_out(u8 player, u16 fadeDuration) {
 #else
     s32 fd = fadeDuration; // will also match if we change function signature func_802ad74c to use s32 as arg1
 #endif
+
+#ifndef TARGET_N64
+    audio_event_log_fade_out(player, fadeDuration);
+#endif
     if (!player) {
         sCurrentBackgroundMusicSeqId = SEQUENCE_NONE;
     }
     func_802ad74c(0x83000000 | (player & 0xff) << 16, fd);
 #else
+#ifndef TARGET_N64
+    audio_event_log_fade_out(player, fadeDuration);
+#endif
     if (player == SEQ_PLAYER_LEVEL) {
         sCurrentBackgroundMusicSeqId = SEQUENCE_NONE;
     }
@@ -2229,6 +2245,10 @@ void stop_sound(u32 soundBits, f32 *pos) {
     u8 bank = (soundBits & SOUNDARGS_MASK_BANK) >> SOUNDARGS_SHIFT_BANK;
     u8 soundIndex = sSoundBanks[bank][0].next;
 
+#ifndef TARGET_N64
+    audio_event_log_stop_sound(soundBits);
+#endif
+
     while (soundIndex != 0xff) {
         // If sound has same id and source position pointer
         if ((u16)(soundBits >> SOUNDARGS_SHIFT_SOUNDID)
@@ -2264,6 +2284,32 @@ void stop_sounds_from_source(f32 *pos) {
     }
 }
 
+#ifndef TARGET_N64
+/**
+ * Write the positions that the sounds in the sound banks are played from to
+ * sources, up to maxSources of them, and return the number of sounds. A
+ * source that isn't among them has nothing for stop_sounds_from_source to
+ * stop.
+ */
+s32 get_sound_sources(f32 **sources, s32 maxSources) {
+    s32 count = 0;
+    u8 bank;
+    u8 soundIndex;
+
+    for (bank = 0; bank < SOUND_BANK_COUNT; bank++) {
+        soundIndex = sSoundBanks[bank][0].next;
+        while (soundIndex != 0xff) {
+            if (count < maxSources) {
+                sources[count] = sSoundBanks[bank][soundIndex].x;
+            }
+            count++;
+            soundIndex = sSoundBanks[bank][soundIndex].next;
+        }
+    }
+    return count;
+}
+#endif
+
 /**
  * Called from threads: thread3_main, thread5_game_loop
  */
@@ -2386,6 +2432,10 @@ void play_music(u8 player, u16 seqArgs, u16 fadeTimer) {
     u8 i;
     u8 foundIndex = 0;
 
+#ifndef TARGET_N64
+    audio_event_log_music(player, seqArgs, fadeTimer);
+#endif
+
     // Except for the background music player, we don't support queued
     // sequences. Just play them immediately, stopping any old sequence.
     if (player != SEQ_PLAYER_LEVEL) {
@@ -38,6 +38,9 @@ void sound_init(void);
 void get_currently_playing_sound(u8 bank, u8 *numPlayingSounds, u8 *numSoundsInBank, u8 *soundId);
 void stop_sound(u32 soundBits, f32 *pos);
 void stop_sounds_from_source(f32 *pos);
+#ifndef TARGET_N64
+s32 get_sound_sources(f32 **sources, s32 maxSources);
+#endif
 void stop_sounds_in_continuous_banks(void);
 void sound_banks_disable(u8 player, u16 bankMask);
 void sound_banks_enable(u8 player, u16 bankMask);
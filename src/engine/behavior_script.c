@@ -36,6 +36,15 @@ UNUSED static void goto_behavior_unused(const BehaviorScript *bhvAddr) {
     gCurrentObject->bhvStackIndex = 0;
 }
 
+#ifndef TARGET_N64
+/**
+ * Return the random seed without advancing it, for state checksums.
+ */
+u16 random_get_seed(void) {
+    return gRandomSeed16;
+}
+#endif
+
 // Generate a pseudorandom integer from 0 to 65535 from the random seed, and update the seed.
 u16 random_u16(void) {
     u16 temp1, temp2;
@@ -22,6 +22,9 @@
 u16 random_u16(void);
 float random_float(void);
 s32 random_sign(void);
+#ifndef TARGET_N64
+u16 random_get_seed(void);
+#endif
 
 void stub_behavior_script_2(void);
 
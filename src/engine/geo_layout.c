@@ -1,7 +1,12 @@
 #include <ultra64.h>
+#ifdef GEO_LAYOUT_CACHE_VALIDATE
+#include <stdio.h>
+#include <stdlib.h>
+#endif
 #include "sm64.h"
 
 #include "geo_layout.h"
+#include "geo_layout_cache.h"
 #include "math_util.h"
 #include "game/memory.h"
 #include "graph_node.h"
@@ -767,7 +772,11 @@ void geo_layout_cmd_node_culling_radius(void) {
     gGeoLayoutCommand += 0x04 << CMD_SIZE_SHIFT;
 }
 
+#ifndef TARGET_N64
+static struct GraphNode *interpret_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
+#else
 struct GraphNode *process_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
+#endif
     // set by register_scene_graph_node when gCurGraphNodeIndex is 0
     // and gCurRootGraphNode is NULL
     gCurRootGraphNode = NULL;
@@ -793,3 +802,194 @@ struct GraphNode *process_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
 
     return gCurRootGraphNode;
 }
+
+#ifndef TARGET_N64
+/**
+ * Build the graph node tree of a geo layout, from the geo layout cache if it
+ * was built before. Building with GEO_LAYOUT_CACHE_VALIDATE also interprets
+ * the layout and checks the cached tree against it.
+ */
+struct GraphNode *process_geo_layout(struct AllocOnlyPool *pool, void *segptr) {
+    struct GraphNode *root = geo_layout_cache_instantiate(pool, segptr);
+    s32 numNodes;
+
+#ifdef GEO_LAYOUT_CACHE_VALIDATE
+    if (root != NULL) {
+        struct GraphNode *interpreted = interpret_geo_layout(pool, segptr);
+
+        if (!geo_layout_cache_trees_equal(root, interpreted)) {
+            fprintf(stderr, "geo layout cache: cached tree of %p differs from the interpreted one\n",
+                    segptr);
+            abort();
+        }
+    }
+#endif
+    if (root != NULL) {
+        return root;
+    }
+
+    numNodes = gNumRegisteredGraphNodes;
+    root = interpret_geo_layout(pool, segptr);
+    geo_layout_cache_store(segptr, root, gNumRegisteredGraphNodes - numNodes);
+    return root;
+}
+#endif
+
+#ifndef TARGET_N64
+// Most nested branches followed by geo_layout_find_display_lists
+#define GEO_LAYOUT_FIND_MAX_DEPTH 32
+
+// How the walk of a branch stopped
+#define GEO_LAYOUT_FIND_RETURN 0
+#define GEO_LAYOUT_FIND_END 1
+
+#define geo_cmd_u8(cmd, offset) ((cmd)[CMD_PROCESS_OFFSET(offset)])
+#define geo_cmd_ptr(cmd, offset) (*(void *const *) &(cmd)[CMD_PROCESS_OFFSET(offset)])
+
+static void geo_layout_find_display_list(void *displayList, GeoLayoutDisplayListFunc func, void *arg) {
+    if (displayList != NULL) {
+        func(segmented_to_virtual(displayList), arg);
+    }
+}
+
+/**
+ * Find the optional display list at cmdPos of the commands whose size
+ * depends on their params, and return the next command.
+ */
+static const u8 *geo_layout_find_optional_display_list(const s16 *cmdPos, s16 params,
+                                                       GeoLayoutDisplayListFunc func, void *arg) {
+    if (params & 0x80) {
+        geo_layout_find_display_list(*(void *const *) &cmdPos[0], func, arg);
+        cmdPos += 2 << CMD_SIZE_SHIFT;
+    }
+    return (const u8 *) cmdPos;
+}
+
+/**
+ * Walk the commands from cmd like process_geo_layout, but without building
+ * nodes, until the layout ends or returns from a branch. The command sizes
+ * follow the geo_layout_cmd_ functions above.
+ */
+static s32 geo_layout_find_in_commands(const u8 *cmd, GeoLayoutDisplayListFunc func, void *arg, s32 depth) {
+    s16 *cmdPos;
+    Vec3s vec;
+    const u8 *target;
+    s16 params;
+
+    if (depth > GEO_LAYOUT_FIND_MAX_DEPTH) {
+        return GEO_LAYOUT_FIND_END;
+    }
+
+    while (cmd != NULL) {
+        switch (cmd[0x00]) {
+            case 0x00: // branch and link, continues after the end of the branch
+                target = segmented_to_virtual(geo_cmd_ptr(cmd, 0x04));
+                geo_layout_find_in_commands(target, func, arg, depth + 1);
+                cmd += CMD_PROCESS_OFFSET(8);
+                break;
+            case 0x01:
+                return GEO_LAYOUT_FIND_END;
+            case 0x02:
+                target = segmented_to_virtual(geo_cmd_ptr(cmd, 0x04));
+                if (geo_cmd_u8(cmd, 0x01) != 1) {
+                    cmd = target;
+                } else if (geo_layout_find_in_commands(target, func, arg, depth + 1) == GEO_LAYOUT_FIND_END) {
+                    return GEO_LAYOUT_FIND_END;
+                } else {
+                    cmd += CMD_PROCESS_OFFSET(8);
+                }
+                break;
+            case 0x03:
+                return GEO_LAYOUT_FIND_RETURN;
+            case 0x04:
+            case 0x05:
+            case 0x06:
+            case 0x07:
+            case 0x09:
+            case 0x0B:
+            case 0x0C:
+            case 0x17:
+            case 0x1B:
+            case 0x20:
+                cmd += 0x04 << CMD_SIZE_SHIFT;
+                break;
+            case 0x08:
+            case 0x1C:
+                cmd += 0x0C << CMD_SIZE_SHIFT;
+                break;
+            case 0x0A:
+                if (geo_cmd_u8(cmd, 0x01) != 0) {
+                    cmd += 4 << CMD_SIZE_SHIFT;
+                }
+                cmd += 0x08 << CMD_SIZE_SHIFT;
+                break;
+            case 0x0D:
+            case 0x0E:
+            case 0x16:
+            case 0x18:
+            case 0x19:
+            case 0x1A:
+            case 0x1E:
+                cmd += 0x08 << CMD_SIZE_SHIFT;
+                break;
+            case 0x0F:
+                cmd += 0x14 << CMD_SIZE_SHIFT;
+                break;
+            case 0x10:
+                params = geo_cmd_u8(cmd, 0x01);
+                cmdPos = (s16 *) cmd;
+                switch ((params & 0x70) >> 4) {
+                    case 0:
+                        cmdPos = read_vec3s(vec, &cmdPos[2]);
+                        cmdPos = read_vec3s(vec, cmdPos);
+                        break;
+                    case 1:
+                    case 2:
+                        cmdPos = read_vec3s(vec, &cmdPos[1]);
+                        break;
+                    case 3:
+                        cmdPos += 2 << CMD_SIZE_SHIFT;
+                        break;
+                }
+                cmd = geo_layout_find_optional_display_list(cmdPos, params, func, arg);
+                break;
+            case 0x11:
+            case 0x12:
+            case 0x14:
+                cmdPos = read_vec3s(vec, &((s16 *) cmd)[1]);
+                cmd = geo_layout_find_optional_display_list(cmdPos, geo_cmd_u8(cmd, 0x01), func, arg);
+                break;
+            case 0x13:
+                geo_layout_find_display_list(geo_cmd_ptr(cmd, 0x08), func, arg);
+                cmd += 0x0C << CMD_SIZE_SHIFT;
+                break;
+            case 0x15:
+                geo_layout_find_display_list(geo_cmd_ptr(cmd, 0x04), func, arg);
+                cmd += 0x08 << CMD_SIZE_SHIFT;
+                break;
+            case 0x1D:
+                if (geo_cmd_u8(cmd, 0x01) & 0x80) {
+                    geo_layout_find_display_list(geo_cmd_ptr(cmd, 0x08), func, arg);
+                    cmd += 4 << CMD_SIZE_SHIFT;
+                }
+                cmd += 0x08 << CMD_SIZE_SHIFT;
+                break;
+            case 0x1F:
+                cmd += 0x10 << CMD_SIZE_SHIFT;
+                break;
+            default:
+                return GEO_LAYOUT_FIND_END;
+        }
+    }
+    return GEO_LAYOUT_FIND_END;
+}
+
+/**
+ * Call func with every display list that the geo layout, and the layouts it
+ * branches to, put in its nodes. Display lists that asm nodes generate are
+ * not found. This only reads the layout, so it can run on any thread.
+ */
+void geo_layout_find_display_lists(const GeoLayout *layout, GeoLayoutDisplayListFunc func, void *arg) {
+    geo_layout_find_in_commands(segmented_to_virtual(layout), func, arg, 0);
+}
+#endif
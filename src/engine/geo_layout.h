@@ -84,4 +84,10 @@ void geo_layout_cmd_node_culling_radius(void);
 
 struct GraphNode *process_geo_layout(struct AllocOnlyPool *a0, void *segptr);
 
+#ifndef TARGET_N64
+typedef void (*GeoLayoutDisplayListFunc)(const Gfx *displayList, void *arg);
+
+void geo_layout_find_display_lists(const GeoLayout *layout, GeoLayoutDisplayListFunc func, void *arg);
+#endif
+
 #endif // GEO_LAYOUT_H
@@ -0,0 +1,359 @@
+#ifndef TARGET_N64
+#include <PR/ultratypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sm64.h"
+#include "geo_layout_cache.h"
+#include "graph_node.h"
+
+/**
+ * @file geo_layout_cache.c
+ * Keeps the graph node trees built by process_geo_layout, so that a geo
+ * layout that is loaded again (the common models are loaded by every level)
+ * doesn't need to be interpreted again.
+ *
+ * After a layout is interpreted for the first time, its nodes are serialized
+ * into one blob in creation order, with the links between nodes stored as
+ * offsets into the blob. Loading the layout again is then a single allocation
+ * from the pool, a memcpy and a relocation pass over those links. The
+ * GEO_CONTEXT_CREATE functions of the nodes are called again afterwards in
+ * creation order, since some of them have side effects outside of the tree.
+ *
+ * Only trees whose nodes are fully described by their own fields are cached.
+ * Roots, cameras and object parents reference memory or nodes outside of the
+ * node structs, and are only found in area layouts which are loaded once per
+ * level anyway.
+ */
+
+#define GEO_LAYOUT_CACHE_BUCKETS 256
+
+#define ALIGN8(val) (((val) + 0x7) & ~0x7)
+
+// Number of link fields of struct GraphNode: prev, next, parent, children
+#define GRAPH_NODE_NUM_LINKS 4
+
+struct GeoLayoutCacheEntry {
+    const void *layout;
+    struct GeoLayoutCacheEntry *next;
+    u32 size;
+    u32 numNodes;
+    u32 numRelocs;
+    u32 *nodeOffsets; // in creation order
+    u32 *relocs; // offsets of the link fields that point into the blob
+    u8 *data; // NULL if the layout can't be cached
+};
+
+struct GeoLayoutCacheStats gGeoLayoutCacheStats;
+
+static struct GeoLayoutCacheEntry *sCacheBuckets[GEO_LAYOUT_CACHE_BUCKETS];
+
+static u32 geo_layout_cache_hash(const void *layout) {
+    return (((u32) ((uintptr_t) layout >> 2)) * 2654435761U) >> 24;
+}
+
+static struct GeoLayoutCacheEntry *geo_layout_cache_find(const void *layout) {
+    struct GeoLayoutCacheEntry *entry = sCacheBuckets[geo_layout_cache_hash(layout)];
+
+    while (entry != NULL && entry->layout != layout) {
+        entry = entry->next;
+    }
+    return entry;
+}
+
+/**
+ * Return the size of a node type that can be cached, or 0 if it can't be.
+ */
+static u32 geo_layout_cache_node_size(s16 type) {
+    switch (type) {
+        case GRAPH_NODE_TYPE_ORTHO_PROJECTION:
+            return sizeof(struct GraphNodeOrthoProjection);
+        case GRAPH_NODE_TYPE_PERSPECTIVE:
+            return sizeof(struct GraphNodePerspective);
+        case GRAPH_NODE_TYPE_MASTER_LIST:
+            return sizeof(struct GraphNodeMasterList);
+        case GRAPH_NODE_TYPE_START:
+            return sizeof(struct GraphNodeStart);
+        case GRAPH_NODE_TYPE_LEVEL_OF_DETAIL:
+            return sizeof(struct GraphNodeLevelOfDetail);
+        case GRAPH_NODE_TYPE_SWITCH_CASE:
+            return sizeof(struct GraphNodeSwitchCase);
+        case GRAPH_NODE_TYPE_TRANSLATION_ROTATION:
+            return sizeof(struct GraphNodeTranslationRotation);
+        case GRAPH_NODE_TYPE_TRANSLATION:
+            return sizeof(struct GraphNodeTranslation);
+        case GRAPH_NODE_TYPE_ROTATION:
+            return sizeof(struct GraphNodeRotation);
+        case GRAPH_NODE_TYPE_ANIMATED_PART:
+            return sizeof(struct GraphNodeAnimatedPart);
+        case GRAPH_NODE_TYPE_BILLBOARD:
+            return sizeof(struct GraphNodeBillboard);
+        case GRAPH_NODE_TYPE_DISPLAY_LIST:
+            return sizeof(struct GraphNodeDisplayList);
+        case GRAPH_NODE_TYPE_SCALE:
+            return sizeof(struct GraphNodeScale);
+        case GRAPH_NODE_TYPE_SHADOW:
+            return sizeof(struct GraphNodeShadow);
+        case GRAPH_NODE_TYPE_GENERATED_LIST:
+            return sizeof(struct GraphNodeGenerated);
+        case GRAPH_NODE_TYPE_BACKGROUND:
+            return sizeof(struct GraphNodeBackground);
+        case GRAPH_NODE_TYPE_HELD_OBJ:
+            return sizeof(struct GraphNodeHeldObject);
+        case GRAPH_NODE_TYPE_CULLING_RADIUS:
+            return sizeof(struct GraphNodeCullingRadius);
+    }
+    return 0;
+}
+
+static s32 geo_layout_cache_is_last_sibling(struct GraphNode *node) {
+    return node->parent == NULL || node->next == node->parent->children;
+}
+
+/**
+ * Return the next node of a pre-order walk of the tree under root, which is
+ * the order process_geo_layout creates the nodes in.
+ */
+static struct GraphNode *geo_layout_cache_next_node(struct GraphNode *root, struct GraphNode *node) {
+    if (node->children != NULL) {
+        return node->children;
+    }
+    while (node != root) {
+        if (!geo_layout_cache_is_last_sibling(node)) {
+            return node->next;
+        }
+        node = node->parent;
+    }
+    return NULL;
+}
+
+static s32 geo_layout_cache_find_node(struct GraphNode **nodes, s32 numNodes, struct GraphNode *node) {
+    s32 i;
+
+    for (i = 0; i < numNodes; i++) {
+        if (nodes[i] == node) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static struct GeoLayoutCacheEntry *geo_layout_cache_new_entry(const void *layout) {
+    struct GeoLayoutCacheEntry *entry = calloc(1, sizeof(struct GeoLayoutCacheEntry));
+    u32 bucket = geo_layout_cache_hash(layout);
+
+    if (entry == NULL) {
+        abort();
+    }
+    entry->layout = layout;
+    entry->next = sCacheBuckets[bucket];
+    sCacheBuckets[bucket] = entry;
+    return entry;
+}
+
+/**
+ * Serialize the tree that process_geo_layout built for a layout, numNodes
+ * being the number of nodes it registered. If some of them aren't reachable
+ * from the root or can't be cached, the layout is remembered as uncacheable.
+ */
+void geo_layout_cache_store(const void *layout, struct GraphNode *root, s32 numNodes) {
+    struct GeoLayoutCacheEntry *entry;
+    struct GraphNode **nodes;
+    struct GraphNode *node;
+    s32 count = 0;
+    u32 size = 0;
+    s32 i;
+    s32 j;
+
+    if (root == NULL || geo_layout_cache_find(layout) != NULL) {
+        return;
+    }
+    entry = geo_layout_cache_new_entry(layout);
+
+    nodes = malloc(numNodes * sizeof(struct GraphNode *));
+    entry->nodeOffsets = malloc(numNodes * sizeof(u32));
+    if (nodes == NULL || entry->nodeOffsets == NULL) {
+        abort();
+    }
+
+    for (node = root; node != NULL; node = geo_layout_cache_next_node(root, node)) {
+        u32 nodeSize = geo_layout_cache_node_size(node->type);
+
+        if (nodeSize == 0 || count >= numNodes) {
+            break;
+        }
+        nodes[count] = node;
+        entry->nodeOffsets[count] = size;
+        size += ALIGN8(nodeSize);
+        count++;
+    }
+
+    if (node != NULL || count != numNodes) {
+        free(nodes);
+        free(entry->nodeOffsets);
+        entry->nodeOffsets = NULL;
+        gGeoLayoutCacheStats.numUncacheable++;
+        return;
+    }
+
+    entry->data = malloc(size);
+    entry->relocs = malloc(count * GRAPH_NODE_NUM_LINKS * sizeof(u32));
+    if (entry->data == NULL || entry->relocs == NULL) {
+        abort();
+    }
+    entry->size = size;
+    entry->numNodes = count;
+
+    for (i = 0; i < count; i++) {
+        struct GraphNode *copy = (struct GraphNode *) (entry->data + entry->nodeOffsets[i]);
+        struct GraphNode **links[GRAPH_NODE_NUM_LINKS];
+
+        memcpy(copy, nodes[i], geo_layout_cache_node_size(nodes[i]->type));
+
+        links[0] = &copy->prev;
+        links[1] = &copy->next;
+        links[2] = &copy->parent;
+        links[3] = &copy->children;
+        for (j = 0; j < GRAPH_NODE_NUM_LINKS; j++) {
+            if (*links[j] != NULL) {
+                // Every link of a node in the tree points into the tree, except the root's parent
+                s32 target = geo_layout_cache_find_node(nodes, count, *links[j]);
+
+                *links[j] = (struct GraphNode *) (uintptr_t) entry->nodeOffsets[target];
+                entry->relocs[entry->numRelocs++] = (u8 *) links[j] - entry->data;
+            }
+        }
+    }
+    free(nodes);
+
+    gGeoLayoutCacheStats.numEntries++;
+    gGeoLayoutCacheStats.dataBytes += size;
+}
+
+/**
+ * Build the tree of a layout from its cached copy, allocating it from the
+ * pool. Return NULL if the layout hasn't been cached.
+ */
+struct GraphNode *geo_layout_cache_instantiate(struct AllocOnlyPool *pool, const void *layout) {
+    struct GeoLayoutCacheEntry *entry = geo_layout_cache_find(layout);
+    u8 *base;
+    u32 i;
+
+    if (entry == NULL || entry->data == NULL) {
+        gGeoLayoutCacheStats.numMisses++;
+        return NULL;
+    }
+    gGeoLayoutCacheStats.numHits++;
+
+    base = alloc_only_pool_alloc(pool, entry->size);
+    memcpy(base, entry->data, entry->size);
+    for (i = 0; i < entry->numRelocs; i++) {
+        *(uintptr_t *) (base + entry->relocs[i]) += (uintptr_t) base;
+    }
+
+    for (i = 0; i < entry->numNodes; i++) {
+        struct GraphNode *node = (struct GraphNode *) (base + entry->nodeOffsets[i]);
+
+        if (node->type & GRAPH_NODE_TYPE_FUNCTIONAL) {
+            struct FnGraphNode *fnNode = (struct FnGraphNode *) node;
+
+            if (fnNode->func != NULL) {
+                fnNode->func(GEO_CONTEXT_CREATE, node, pool);
+            }
+        }
+    }
+
+    return (struct GraphNode *) base;
+}
+
+#define NODE_FIELD_EQUAL(type, field) (((type *) a)->field == ((type *) b)->field)
+#define NODE_VEC3_EQUAL(type, field)                                                              \
+    (NODE_FIELD_EQUAL(type, field[0]) && NODE_FIELD_EQUAL(type, field[1])                         \
+     && NODE_FIELD_EQUAL(type, field[2]))
+
+/**
+ * Compare the fields set when the nodes were created, except the links.
+ */
+static s32 geo_layout_cache_nodes_equal(struct GraphNode *a, struct GraphNode *b) {
+    if (a->type != b->type || a->flags != b->flags) {
+        return FALSE;
+    }
+
+    if (a->type & GRAPH_NODE_TYPE_FUNCTIONAL) {
+        if (!NODE_FIELD_EQUAL(struct FnGraphNode, func)) {
+            return FALSE;
+        }
+    }
+
+    switch (a->type) {
+        case GRAPH_NODE_TYPE_ORTHO_PROJECTION:
+            return NODE_FIELD_EQUAL(struct GraphNodeOrthoProjection, scale);
+        case GRAPH_NODE_TYPE_PERSPECTIVE:
+            return NODE_FIELD_EQUAL(struct GraphNodePerspective, fov)
+                   && NODE_FIELD_EQUAL(struct GraphNodePerspective, near)
+                   && NODE_FIELD_EQUAL(struct GraphNodePerspective, far);
+        case GRAPH_NODE_TYPE_LEVEL_OF_DETAIL:
+            return NODE_FIELD_EQUAL(struct GraphNodeLevelOfDetail, minDistance)
+                   && NODE_FIELD_EQUAL(struct GraphNodeLevelOfDetail, maxDistance);
+        case GRAPH_NODE_TYPE_SWITCH_CASE:
+            return NODE_FIELD_EQUAL(struct GraphNodeSwitchCase, numCases)
+                   && NODE_FIELD_EQUAL(struct GraphNodeSwitchCase, selectedCase);
+        case GRAPH_NODE_TYPE_TRANSLATION_ROTATION:
+            return NODE_FIELD_EQUAL(struct GraphNodeTranslationRotation, displayList)
+                   && NODE_VEC3_EQUAL(struct GraphNodeTranslationRotation, translation)
+                   && NODE_VEC3_EQUAL(struct GraphNodeTranslationRotation, rotation);
+        case GRAPH_NODE_TYPE_TRANSLATION:
+            return NODE_FIELD_EQUAL(struct GraphNodeTranslation, displayList)
+                   && NODE_VEC3_EQUAL(struct GraphNodeTranslation, translation);
+        case GRAPH_NODE_TYPE_ROTATION:
+            return NODE_FIELD_EQUAL(struct GraphNodeRotation, displayList)
+                   && NODE_VEC3_EQUAL(struct GraphNodeRotation, rotation);
+        case GRAPH_NODE_TYPE_ANIMATED_PART:
+            return NODE_FIELD_EQUAL(struct GraphNodeAnimatedPart, displayList)
+                   && NODE_VEC3_EQUAL(struct GraphNodeAnimatedPart, translation);
+        case GRAPH_NODE_TYPE_BILLBOARD:
+            return NODE_FIELD_EQUAL(struct GraphNodeBillboard, displayList)
+                   && NODE_VEC3_EQUAL(struct GraphNodeBillboard, translation);
+        case GRAPH_NODE_TYPE_DISPLAY_LIST:
+            return NODE_FIELD_EQUAL(struct GraphNodeDisplayList, displayList);
+        case GRAPH_NODE_TYPE_SCALE:
+            return NODE_FIELD_EQUAL(struct GraphNodeScale, displayList)
+                   && NODE_FIELD_EQUAL(struct GraphNodeScale, scale);
+        case GRAPH_NODE_TYPE_SHADOW:
+            return NODE_FIELD_EQUAL(struct GraphNodeShadow, shadowScale)
+                   && NODE_FIELD_EQUAL(struct GraphNodeShadow, shadowSolidity)
+                   && NODE_FIELD_EQUAL(struct GraphNodeShadow, shadowType);
+        case GRAPH_NODE_TYPE_GENERATED_LIST:
+            return NODE_FIELD_EQUAL(struct GraphNodeGenerated, parameter);
+        case GRAPH_NODE_TYPE_BACKGROUND:
+            return NODE_FIELD_EQUAL(struct GraphNodeBackground, background);
+        case GRAPH_NODE_TYPE_HELD_OBJ:
+            return NODE_FIELD_EQUAL(struct GraphNodeHeldObject, playerIndex)
+                   && NODE_FIELD_EQUAL(struct GraphNodeHeldObject, objNode)
+                   && NODE_VEC3_EQUAL(struct GraphNodeHeldObject, translation);
+        case GRAPH_NODE_TYPE_CULLING_RADIUS:
+            return NODE_FIELD_EQUAL(struct GraphNodeCullingRadius, cullingRadius);
+    }
+    return TRUE;
+}
+
+/**
+ * Return whether two trees have the same shape and the same nodes. Used to
+ * check the cached trees against the interpreter, see GEO_LAYOUT_CACHE_VALIDATE.
+ */
+s32 geo_layout_cache_trees_equal(struct GraphNode *a, struct GraphNode *b) {
+    struct GraphNode *rootA = a;
+    struct GraphNode *rootB = b;
+
+    while (a != NULL && b != NULL) {
+        if (!geo_layout_cache_nodes_equal(a, b)
+            || (a->children == NULL) != (b->children == NULL)
+            || geo_layout_cache_is_last_sibling(a) != geo_layout_cache_is_last_sibling(b)) {
+            return FALSE;
+        }
+        a = geo_layout_cache_next_node(rootA, a);
+        b = geo_layout_cache_next_node(rootB, b);
+    }
+    return a == NULL && b == NULL;
+}
+#endif
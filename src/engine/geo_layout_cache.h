@@ -0,0 +1,26 @@
+#ifndef GEO_LAYOUT_CACHE_H
+#define GEO_LAYOUT_CACHE_H
+
+#include <PR/ultratypes.h>
+
+#include "game/memory.h"
+#include "types.h"
+
+/**
+ * Counters of the geo layout cache, for profiling.
+ */
+struct GeoLayoutCacheStats {
+    u32 numEntries;
+    u32 numUncacheable;
+    u32 numHits;
+    u32 numMisses;
+    u32 dataBytes;
+};
+
+extern struct GeoLayoutCacheStats gGeoLayoutCacheStats;
+
+struct GraphNode *geo_layout_cache_instantiate(struct AllocOnlyPool *pool, const void *layout);
+void geo_layout_cache_store(const void *layout, struct GraphNode *root, s32 numNodes);
+s32 geo_layout_cache_trees_equal(struct GraphNode *a, struct GraphNode *b);
+
+#endif // GEO_LAYOUT_CACHE_H
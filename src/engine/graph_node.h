@@ -430,5 +430,8 @@ s16 *read_vec3s_to_vec3f(Vec3f, s16 *src);
 s16 *read_vec3s(Vec3s dst, s16 *src);
 s16 *read_vec3s_angle(Vec3s dst, s16 *src);
 void register_scene_graph_node(struct GraphNode *graphNode);
+#ifndef TARGET_N64
+extern s32 gNumRegisteredGraphNodes;
+#endif
 
 #endif // GRAPH_NODE_H
@@ -4,6 +4,11 @@
 
 #include "graph_node.h"
 
+#ifndef TARGET_N64
+// Number of nodes registered so far, see geo_layout_cache_store
+s32 gNumRegisteredGraphNodes = 0;
+#endif
+
 #if IS_64_BIT
 static s16 next_s16_in_geo_script(s16 **src) {
     s16 ret;
@@ -62,6 +67,9 @@ s16 *read_vec3s_angle(Vec3s dst, s16 *src) {
  */
 void register_scene_graph_node(struct GraphNode *graphNode) {
     if (graphNode != NULL) {
+#ifndef TARGET_N64
+        gNumRegisteredGraphNodes++;
+#endif
         gCurGraphNodeList[gCurGraphNodeIndex] = graphNode;
 
         if (gCurGraphNodeIndex == 0) {
@@ -2,6 +2,9 @@
 #ifdef NO_SEGMENTED_MEMORY
 #include <string.h>
 #endif
+#ifdef PRINT_LEVEL_LOAD_TIMES
+#include <stdio.h>
+#endif
 
 #include "sm64.h"
 #include "audio/external.h"
@@ -24,6 +27,9 @@
 #include "math_util.h"
 #include "surface_collision.h"
 #include "surface_load.h"
+#ifndef TARGET_N64
+#include "pc/level_prefetch.h"
+#endif
 
 #define CMD_GET(type, offset) (*(type *) (CMD_PROCESS_OFFSET(offset) + (u8 *) sCurrentCmd))
 
@@ -55,6 +61,11 @@ static s16 sScriptStatus;
 static s32 sRegister;
 static struct LevelCommand *sCurrentCmd;
 
+struct LevelLoadStats gLevelLoadStats;
+
+// Start of the level load being timed, or 0 if none is in progress
+static OSTime sLevelLoadStartTime = 0;
+
 #ifdef USE_SYSTEM_MALLOC
 static struct MemoryPool *sMemPoolForGoddard;
 #endif
@@ -321,7 +332,24 @@ static void level_cmd_load_mio0_texture(void) {
     sCurrentCmd = CMD_NEXT;
 }
 
+/**
+ * Return the time in CPU counter cycles, for measuring level loads.
+ */
+OSTime level_load_get_time(void) {
+#ifdef TARGET_N64
+    return osGetTime();
+#else
+    return pc_get_monotonic_time();
+#endif
+}
+
 static void level_cmd_init_level(void) {
+    sLevelLoadStartTime = level_load_get_time();
+    gLevelLoadStats.totalTime = 0;
+    gLevelLoadStats.geoLayoutTime = 0;
+    gLevelLoadStats.terrainTime = 0;
+    gLevelLoadStats.numGeoLayouts = 0;
+
     init_graph_node_start(NULL, (struct GraphNodeStart *) &gObjParentGraphNode);
     clear_objects();
     clear_areas();
@@ -375,10 +403,14 @@ static void level_cmd_begin_area(void) {
     void *geoLayoutAddr = CMD_GET(void *, 4);
 
     if (areaIndex < 8) {
+        OSTime start = level_load_get_time();
         struct GraphNodeRoot *screenArea =
             (struct GraphNodeRoot *) process_geo_layout(sLevelPool, geoLayoutAddr);
         struct GraphNodeCamera *node = (struct GraphNodeCamera *) screenArea->views[0];
 
+        gLevelLoadStats.geoLayoutTime += OS_CYCLES_TO_USEC(level_load_get_time() - start);
+        gLevelLoadStats.numGeoLayouts++;
+
         sCurrAreaIndex = areaIndex;
         screenArea->areaIndex = areaIndex;
         gAreas[areaIndex].unk04 = screenArea;
@@ -416,7 +448,11 @@ static void level_cmd_load_model_from_geo(void) {
     void *arg1 = CMD_GET(void *, 4);
 
     if (arg0 < 256) {
+        OSTime start = level_load_get_time();
+
         gLoadedGraphNodes[arg0] = process_geo_layout(sLevelPool, arg1);
+        gLevelLoadStats.geoLayoutTime += OS_CYCLES_TO_USEC(level_load_get_time() - start);
+        gLevelLoadStats.numGeoLayouts++;
     }
 
     sCurrentCmd = CMD_NEXT;
@@ -853,6 +889,26 @@ struct LevelCommand *level_script_execute(struct LevelCommand *cmd) {
         LevelScriptJumpTable[sCurrentCmd->type]();
     }
 
+    if (sLevelLoadStartTime != 0) {
+#ifndef TARGET_N64
+        level_prefetch_commit(gCurrLevelNum);
+#endif
+        gLevelLoadStats.levelNum = gCurrLevelNum;
+        gLevelLoadStats.totalTime = OS_CYCLES_TO_USEC(level_load_get_time() - sLevelLoadStartTime);
+        sLevelLoadStartTime = 0;
+#ifdef PRINT_LEVEL_LOAD_TIMES
+        printf("Loaded level %d in %.2f ms (geo layouts: %u in %.2f ms, terrain: %.2f ms)\n",
+               gLevelLoadStats.levelNum, gLevelLoadStats.totalTime / 1000.0f,
+               gLevelLoadStats.numGeoLayouts, gLevelLoadStats.geoLayoutTime / 1000.0f,
+               gLevelLoadStats.terrainTime / 1000.0f);
+#ifndef TARGET_N64
+        printf("Decoded %u textures of level %d in %.2f ms, waited %.2f ms for them\n",
+               gLevelLoadStats.numTextures, gLevelLoadStats.levelNum,
+               gLevelLoadStats.textureDecodeTime / 1000.0f, gLevelLoadStats.textureTime / 1000.0f);
+#endif
+#endif
+    }
+
     profiler_log_thread5_time(LEVEL_SCRIPT_EXECUTE);
     init_rcp();
     render_game();
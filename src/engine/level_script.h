@@ -5,7 +5,27 @@
 
 struct LevelCommand;
 
+/**
+ * Time spent loading the last level, from INIT_LEVEL until the level script
+ * first yields, in microseconds.
+ */
+struct LevelLoadStats {
+    s16 levelNum;
+    u32 totalTime;
+    u32 geoLayoutTime; // processing the geo layouts of models and areas
+    u32 terrainTime; // loading collision and building the static surface partition
+    u32 numGeoLayouts;
+#ifndef TARGET_N64
+    u32 textureTime; // waiting for the textures of the level decoded ahead of their first draw
+    u32 textureDecodeTime; // decoding them, during the warp's fade when it was started by a warp
+    u32 numTextures;
+#endif
+};
+
 extern u8 level_script_entry[];
+extern struct LevelLoadStats gLevelLoadStats;
+
+OSTime level_load_get_time(void);
 
 struct LevelCommand *level_script_execute(struct LevelCommand *cmd);
 
@@ -1,4 +1,12 @@
 #include <PR/ultratypes.h>
+#ifdef USE_SYSTEM_MALLOC
+#include <stdlib.h>
+#include <string.h>
+#ifdef STATIC_SURFACE_CACHE_VALIDATE
+#include <stddef.h>
+#include <stdio.h>
+#endif
+#endif
 
 #include "prevent_bss_reordering.h"
 
@@ -33,6 +41,24 @@ static struct AllocOnlyPool *sStaticSurfacePool;
 static struct AllocOnlyPool *sDynamicSurfaceNodePool;
 static struct AllocOnlyPool *sDynamicSurfacePool;
 static u8 sStaticSurfaceLoadComplete;
+
+/**
+ * The static surfaces and partition lists of an area, as load_area_terrain
+ * built them. The lists are stored as indices into the surface array.
+ */
+struct StaticSurfaceCacheEntry {
+    struct StaticSurfaceCacheEntry *next;
+    s16 *terrainData; // copy of the collision data this was built from
+    u32 terrainSize;
+    s8 *surfaceRooms;
+    s32 numSurfaces;
+    s32 numNodes;
+    struct Surface *surfaces;
+    u16 *nodeSurfaces; // the surface indices of all cell lists, one list after another
+    u16 listLengths[NUM_CELLS][NUM_CELLS][3];
+};
+
+static struct StaticSurfaceCacheEntry *sStaticSurfaceCache = NULL;
 #else
 struct SurfaceNode *sSurfaceNodePool;
 struct Surface *sSurfacePool;
@@ -614,6 +640,227 @@ u32 get_area_terrain_size(s16 *data) {
 #endif
 
 
+#ifdef USE_SYSTEM_MALLOC
+/**
+ * Find the static surfaces built from the same collision data before. The
+ * terrain data is copied into the level pool on every level load, so it's
+ * compared by content.
+ */
+static struct StaticSurfaceCacheEntry *static_surface_cache_find(s16 *data, s8 *surfaceRooms) {
+    struct StaticSurfaceCacheEntry *entry;
+    u32 size = get_area_terrain_size(data);
+
+    for (entry = sStaticSurfaceCache; entry != NULL; entry = entry->next) {
+        if (entry->terrainSize == size && entry->surfaceRooms == surfaceRooms
+            && memcmp(entry->terrainData, data, size * sizeof(s16)) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Return the index of a surface in the cache entry, adding it to the entry's
+ * surfaces if it's new. surfaceMap is an open addressed table of mapSize
+ * surface pointers, with their indices in the entry in surfaceIndices.
+ */
+static s32 static_surface_cache_index(struct StaticSurfaceCacheEntry *entry, struct Surface *surface,
+                                      struct Surface **surfaceMap, s32 *surfaceIndices, u32 mapSize) {
+    u32 slot = (((u32) ((uintptr_t) surface >> 3)) * 2654435761U) & (mapSize - 1);
+
+    while (surfaceMap[slot] != NULL) {
+        if (surfaceMap[slot] == surface) {
+            return surfaceIndices[slot];
+        }
+        slot = (slot + 1) & (mapSize - 1);
+    }
+
+    surfaceMap[slot] = surface;
+    surfaceIndices[slot] = entry->numSurfaces;
+    entry->surfaces[entry->numSurfaces] = *surface;
+    return entry->numSurfaces++;
+}
+
+/**
+ * Read the static surfaces and partition lists that were just loaded from
+ * the given collision data into a new cache entry. Returns NULL if there are
+ * too many surfaces to cache.
+ */
+static struct StaticSurfaceCacheEntry *static_surface_cache_build(s16 *data, s8 *surfaceRooms) {
+    struct StaticSurfaceCacheEntry *entry;
+    struct Surface **surfaceMap;
+    s32 *surfaceIndices;
+    struct SurfaceNode *node;
+    u32 mapSize = 1;
+    s32 cellX;
+    s32 cellZ;
+    s32 i;
+
+    // Node indices are stored as u16
+    if (gSurfacesAllocated > 0xFFFF) {
+        return NULL;
+    }
+
+    while (mapSize < 2 * (u32) gSurfacesAllocated) {
+        mapSize *= 2;
+    }
+
+    entry = calloc(1, sizeof(struct StaticSurfaceCacheEntry));
+    surfaceMap = calloc(mapSize, sizeof(struct Surface *));
+    surfaceIndices = malloc(mapSize * sizeof(s32));
+    if (entry == NULL || surfaceMap == NULL || surfaceIndices == NULL) {
+        abort();
+    }
+
+    entry->terrainSize = get_area_terrain_size(data);
+    entry->terrainData = malloc(entry->terrainSize * sizeof(s16));
+    entry->surfaces = malloc(gSurfacesAllocated * sizeof(struct Surface) + 1);
+    entry->nodeSurfaces = malloc(gSurfaceNodesAllocated * sizeof(u16) + 1);
+    if (entry->terrainData == NULL || entry->surfaces == NULL || entry->nodeSurfaces == NULL) {
+        abort();
+    }
+    memcpy(entry->terrainData, data, entry->terrainSize * sizeof(s16));
+    entry->surfaceRooms = surfaceRooms;
+
+    for (cellZ = 0; cellZ < NUM_CELLS; cellZ++) {
+        for (cellX = 0; cellX < NUM_CELLS; cellX++) {
+            for (i = 0; i < 3; i++) {
+                node = gStaticSurfacePartition[cellZ][cellX][i].next;
+                while (node != NULL) {
+                    entry->nodeSurfaces[entry->numNodes++] = static_surface_cache_index(
+                        entry, node->surface, surfaceMap, surfaceIndices, mapSize);
+                    entry->listLengths[cellZ][cellX][i]++;
+                    node = node->next;
+                }
+            }
+        }
+    }
+
+    free(surfaceMap);
+    free(surfaceIndices);
+    return entry;
+}
+
+/**
+ * Keep the static surfaces and partition lists that were just loaded from
+ * the given collision data.
+ */
+static void static_surface_cache_store(s16 *data, s8 *surfaceRooms) {
+    struct StaticSurfaceCacheEntry *entry = static_surface_cache_build(data, surfaceRooms);
+
+    if (entry != NULL) {
+        entry->next = sStaticSurfaceCache;
+        sStaticSurfaceCache = entry;
+    }
+}
+
+/**
+ * Rebuild the static surfaces and partition lists from a cache entry. The
+ * surfaces are copied as they are and the lists are relinked in order, so
+ * the result is the same as loading the collision data.
+ */
+static void static_surface_cache_restore(struct StaticSurfaceCacheEntry *entry) {
+    struct Surface *surfaces;
+    struct SurfaceNode *nodes;
+    struct SurfaceNode *list;
+    s32 nodeIndex = 0;
+    s32 cellX;
+    s32 cellZ;
+    s32 i;
+    s32 j;
+
+    surfaces = alloc_only_pool_alloc(sStaticSurfacePool, entry->numSurfaces * sizeof(struct Surface));
+    nodes = alloc_only_pool_alloc(sStaticSurfaceNodePool, entry->numNodes * sizeof(struct SurfaceNode));
+    memcpy(surfaces, entry->surfaces, entry->numSurfaces * sizeof(struct Surface));
+
+    for (cellZ = 0; cellZ < NUM_CELLS; cellZ++) {
+        for (cellX = 0; cellX < NUM_CELLS; cellX++) {
+            for (i = 0; i < 3; i++) {
+                list = &gStaticSurfacePartition[cellZ][cellX][i];
+                for (j = 0; j < entry->listLengths[cellZ][cellX][i]; j++) {
+                    nodes[nodeIndex].surface = &surfaces[entry->nodeSurfaces[nodeIndex]];
+                    list->next = &nodes[nodeIndex];
+                    list = list->next;
+                    nodeIndex++;
+                }
+                list->next = NULL;
+            }
+        }
+    }
+
+    // Count them like alloc_surface and alloc_surface_node do
+    gSurfacesAllocated += entry->numSurfaces;
+    gSurfaceNodesAllocated += entry->numNodes;
+}
+
+#ifdef STATIC_SURFACE_CACHE_VALIDATE
+static void static_surface_cache_free(struct StaticSurfaceCacheEntry *entry) {
+    if (entry != NULL) {
+        free(entry->terrainData);
+        free(entry->surfaces);
+        free(entry->nodeSurfaces);
+        free(entry);
+    }
+}
+
+/**
+ * Replace the static surfaces that were just loaded from the collision data
+ * with the ones restored from the cache entry, and check that the partition
+ * and the surface counters are the same as after the load. Both partitions
+ * are read back the way static_surface_cache_store reads them, so the order
+ * of every cell list and the surfaces that several cells share are compared
+ * as well.
+ */
+static s32 static_surface_cache_validate(struct StaticSurfaceCacheEntry *entry, s16 *data, s8 *surfaceRooms) {
+    s32 numLoadedSurfaces = gSurfacesAllocated;
+    s32 numLoadedNodes = gSurfaceNodesAllocated;
+    struct StaticSurfaceCacheEntry *loaded = static_surface_cache_build(data, surfaceRooms);
+    struct StaticSurfaceCacheEntry *restored;
+    s32 matches;
+    s32 i;
+
+    // Start over like load_area_terrain does before a restore
+    gSurfacesAllocated = 0;
+    gSurfaceNodesAllocated = 0;
+    alloc_only_pool_clear(sStaticSurfaceNodePool);
+    alloc_only_pool_clear(sStaticSurfacePool);
+    clear_static_surfaces();
+    static_surface_cache_restore(entry);
+
+    restored = static_surface_cache_build(data, surfaceRooms);
+    matches = loaded != NULL && restored != NULL
+              && gSurfacesAllocated == numLoadedSurfaces && gSurfaceNodesAllocated == numLoadedNodes
+              && restored->numSurfaces == loaded->numSurfaces && restored->numNodes == loaded->numNodes
+              && memcmp(restored->listLengths, loaded->listLengths, sizeof(loaded->listLengths)) == 0
+              && memcmp(restored->nodeSurfaces, loaded->nodeSurfaces, loaded->numNodes * sizeof(u16)) == 0;
+    for (i = 0; matches && i < loaded->numSurfaces; i++) {
+        // The fields up to originOffset have no padding between them, but
+        // object can be aligned past it
+        matches = restored->surfaces[i].object == NULL && loaded->surfaces[i].object == NULL
+                  && memcmp(&restored->surfaces[i], &loaded->surfaces[i],
+                            offsetof(struct Surface, originOffset) + sizeof(f32)) == 0;
+    }
+
+    static_surface_cache_free(loaded);
+    static_surface_cache_free(restored);
+    return matches;
+}
+#endif
+
+/**
+ * Advance past the surfaces of a given type without loading them, like
+ * load_static_surfaces does.
+ */
+static void skip_static_surfaces(s16 **data, s16 surfaceType, s8 **surfaceRooms) {
+    s32 numSurfaces = *(*data);
+
+    *data += 1 + numSurfaces * (3 + surface_has_force(surfaceType));
+    if (*surfaceRooms != NULL) {
+        *surfaceRooms += numSurfaces;
+    }
+}
+#endif
+
 /**
  * Process the level file, loading in vertices, surfaces, some objects, and environmental
  * boxes (water, gas, JRB fog).
@@ -622,6 +869,11 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
     s16 terrainLoadType;
     s16 *vertexData;
     UNUSED s32 unused;
+#ifdef USE_SYSTEM_MALLOC
+    struct StaticSurfaceCacheEntry *cacheEntry;
+    s16 *terrainData = data;
+    s8 *terrainRooms = surfaceRooms;
+#endif
 
     // Initialize the data for this.
     gEnvironmentRegions = NULL;
@@ -637,11 +889,24 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
 
     // Originally they forgot to clear this matrix,
     // results in segfaults if this is not done.
+    // It resets the counters to the static surfaces of the previous area,
+    // which would make them grow with every area load.
+    gNumStaticSurfaces = 0;
+    gNumStaticSurfaceNodes = 0;
     clear_dynamic_surfaces();
 #endif
 
     clear_static_surfaces();
 
+#ifdef USE_SYSTEM_MALLOC
+    cacheEntry = static_surface_cache_find(data, surfaceRooms);
+#ifndef STATIC_SURFACE_CACHE_VALIDATE
+    if (cacheEntry != NULL) {
+        static_surface_cache_restore(cacheEntry);
+    }
+#endif
+#endif
+
     // A while loop iterating through each section of the level data. Sections of data
     // are prefixed by a terrain "type." This type is reused for surfaces as the surface
     // type.
@@ -650,6 +915,12 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
         data++;
 
         if (TERRAIN_LOAD_IS_SURFACE_TYPE_LOW(terrainLoadType)) {
+#if defined(USE_SYSTEM_MALLOC) && !defined(STATIC_SURFACE_CACHE_VALIDATE)
+            if (cacheEntry != NULL) {
+                skip_static_surfaces(&data, terrainLoadType, &surfaceRooms);
+                continue;
+            }
+#endif
             load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
         } else if (terrainLoadType == TERRAIN_LOAD_VERTICES) {
             vertexData = read_vertex_data(&data);
@@ -662,11 +933,29 @@ void load_area_terrain(s16 index, s16 *data, s8 *surfaceRooms, s16 *macroObjects
         } else if (terrainLoadType == TERRAIN_LOAD_END) {
             break;
         } else if (TERRAIN_LOAD_IS_SURFACE_TYPE_HIGH(terrainLoadType)) {
+#if defined(USE_SYSTEM_MALLOC) && !defined(STATIC_SURFACE_CACHE_VALIDATE)
+            if (cacheEntry != NULL) {
+                skip_static_surfaces(&data, terrainLoadType, &surfaceRooms);
+                continue;
+            }
+#endif
             load_static_surfaces(&data, vertexData, terrainLoadType, &surfaceRooms);
             continue;
         }
     }
 
+#ifdef USE_SYSTEM_MALLOC
+    if (cacheEntry == NULL) {
+        static_surface_cache_store(terrainData, terrainRooms);
+    }
+#ifdef STATIC_SURFACE_CACHE_VALIDATE
+    else if (!static_surface_cache_validate(cacheEntry, terrainData, terrainRooms)) {
+        fprintf(stderr, "static surface cache: restored surfaces differ from the loaded ones\n");
+        abort();
+    }
+#endif
+#endif
+
     if (macroObjects != NULL && *macroObjects != -1) {
         // If the first macro object presetID is within the range [0, 29].
         // Generally an early spawning method, every object is in BBH (the first level).
@@ -0,0 +1,7 @@
+// surface_load.c built to load the collision normally on a static surface
+// cache hit, then restore the cache entry in its place and abort if the
+// result differs. Only linked into surface_cache_test, in place of
+// surface_load.c.
+
+#define STATIC_SURFACE_CACHE_VALIDATE
+#include "surface_load.c"
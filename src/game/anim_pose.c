@@ -0,0 +1,227 @@
+#include <PR/ultratypes.h>
+
+#include "sm64.h"
+#include "engine/graph_node.h"
+#include "anim_pose.h"
+#include "level_update.h"
+#include "memory.h"
+#include "rendering_graph_node.h"
+
+/**
+ * @file anim_pose.c
+ * Evaluates the animations of the animated objects in one pass before the
+ * objects of the scene graph are processed. Objects that geo_process_object
+ * will cull are skipped, using the camera matrix of the frame. The decoded
+ * values are stored in a contiguous buffer that geo_process_animated_part,
+ * geo_process_shadow and the held object code read from, instead of decoding
+ * the index/value tables one part at a time while walking the graph.
+ *
+ * The number of channels an animation has is not stored in struct Animation,
+ * so it is learned from the scene graph: after an object is rendered, the
+ * number of channels it consumed is recorded with anim_pose_record_channels.
+ * An object whose animation hasn't been seen yet is skipped by the pre-pass
+ * and decoded in-line for that frame.
+ */
+
+#define ANIM_POSE_MAX_POSES 512
+#define ANIM_POSE_BUFFER_SIZE 0x8000
+
+// Both tables are open addressed, so their sizes must be powers of two
+#define ANIM_POSE_LOOKUP_SIZE 1024
+#define ANIM_CHANNEL_TABLE_SIZE 1024
+
+struct AnimChannelCount {
+    struct Animation *anim;
+    u16 numChannels;
+};
+
+struct AnimPoseLookup {
+    struct AnimInfo *animInfo;
+    u32 generation;
+    s16 poseIndex;
+};
+
+struct AnimPoseStats gAnimPoseStats;
+
+static struct AnimChannelCount sChannelCounts[ANIM_CHANNEL_TABLE_SIZE];
+static struct AnimPoseLookup sPoseLookup[ANIM_POSE_LOOKUP_SIZE];
+static u32 sPoseGeneration = 1;
+
+static struct AnimPose sPoses[ANIM_POSE_MAX_POSES];
+static s32 sNumPoses = 0;
+
+static s16 sPoseValues[ANIM_POSE_BUFFER_SIZE];
+static s32 sPoseValuesUsed = 0;
+
+static u32 anim_pose_hash(void *ptr) {
+    return ((u32) ((uintptr_t) ptr >> 3)) * 2654435761U;
+}
+
+static struct AnimChannelCount *anim_pose_channel_entry(struct Animation *anim) {
+    u32 i = anim_pose_hash(anim) & (ANIM_CHANNEL_TABLE_SIZE - 1);
+    u32 probes;
+
+    for (probes = 0; probes < ANIM_CHANNEL_TABLE_SIZE; probes++) {
+        struct AnimChannelCount *entry = &sChannelCounts[i];
+
+        if (entry->anim == anim || entry->anim == NULL) {
+            return entry;
+        }
+        i = (i + 1) & (ANIM_CHANNEL_TABLE_SIZE - 1);
+    }
+    return NULL;
+}
+
+/**
+ * Remember how many channels the scene graph consumed while drawing an object
+ * with this animation. The count only ever grows, since a frame where some
+ * parts were skipped consumes fewer channels than the animation has.
+ */
+void anim_pose_record_channels(struct Animation *anim, s32 numChannels) {
+    struct AnimChannelCount *entry;
+
+    if (anim == NULL || numChannels <= 0) {
+        return;
+    }
+
+    entry = anim_pose_channel_entry(anim);
+    if (entry != NULL) {
+        entry->anim = anim;
+        if (entry->numChannels < numChannels) {
+            entry->numChannels = numChannels;
+        }
+    }
+}
+
+static void anim_pose_add(struct GraphNodeObject *obj) {
+    struct AnimInfo *animInfo = &obj->animInfo;
+    struct Animation *anim = animInfo->curAnim;
+    struct AnimChannelCount *entry;
+    struct AnimPose *pose;
+    u32 slot;
+
+    entry = anim_pose_channel_entry(anim);
+    if (entry == NULL || entry->anim != anim) {
+        gAnimPoseStats.numSkipped++;
+        return;
+    }
+    if (sNumPoses >= ANIM_POSE_MAX_POSES
+        || sPoseValuesUsed + entry->numChannels > ANIM_POSE_BUFFER_SIZE) {
+        gAnimPoseStats.numSkipped++;
+        return;
+    }
+
+    // Find a free lookup slot first, so the pose is never unreachable
+    slot = anim_pose_hash(animInfo) & (ANIM_POSE_LOOKUP_SIZE - 1);
+    while (sPoseLookup[slot].generation == sPoseGeneration) {
+        if (sPoseLookup[slot].animInfo == animInfo) {
+            // Already queued, e.g. a held object that is also in the object list
+            return;
+        }
+        slot = (slot + 1) & (ANIM_POSE_LOOKUP_SIZE - 1);
+    }
+
+    pose = &sPoses[sNumPoses];
+    pose->animInfo = animInfo;
+    pose->anim = anim;
+    if (obj->node.flags & GRAPH_RENDER_HAS_ANIMATION) {
+        // Does not modify animInfo, geo_set_animation_globals computes the same frame later
+        pose->frame = geo_update_animation_frame(animInfo, NULL);
+    } else {
+        pose->frame = animInfo->animFrame;
+    }
+    pose->numChannels = entry->numChannels;
+    pose->values = &sPoseValues[sPoseValuesUsed];
+
+    sPoseLookup[slot].animInfo = animInfo;
+    sPoseLookup[slot].generation = sPoseGeneration;
+    sPoseLookup[slot].poseIndex = sNumPoses;
+
+    sPoseValuesUsed += entry->numChannels;
+    sNumPoses++;
+}
+
+/**
+ * Decode the channels of poses [start, end). Every pose only reads its own
+ * animation tables and writes its own slice of the value buffer, so disjoint
+ * ranges can be evaluated concurrently.
+ */
+void anim_pose_evaluate_range(struct AnimPose *poses, s32 start, s32 end) {
+    s32 i;
+    s32 channel;
+
+    for (i = start; i < end; i++) {
+        struct AnimPose *pose = &poses[i];
+        u16 *attribute = segmented_to_virtual((void *) pose->anim->index);
+        s16 *data = segmented_to_virtual((void *) pose->anim->values);
+        s32 frame = pose->frame;
+
+        // Same as retrieve_animation_index, for every channel at once
+        for (channel = 0; channel < pose->numChannels; channel++) {
+            if (frame < attribute[0]) {
+                pose->values[channel] = data[attribute[1] + frame];
+            } else {
+                pose->values[channel] = data[attribute[1] + attribute[0] - 1];
+            }
+            attribute += 2;
+        }
+    }
+}
+
+/**
+ * Evaluate the animations of all objects under the object parent node that
+ * will be drawn in the given area with this camera matrix, as well as Mario's
+ * held object.
+ */
+void anim_pose_evaluate_objects(struct GraphNode *objParent, s16 areaIndex, Mat4 cameraMatrix) {
+    struct GraphNode *firstNode = objParent->children;
+    struct GraphNode *node = firstNode;
+
+    sPoseGeneration++;
+    sNumPoses = 0;
+    sPoseValuesUsed = 0;
+    gAnimPoseStats.numSkipped = 0;
+    gAnimPoseStats.numCulled = 0;
+
+    if (firstNode != NULL) {
+        do {
+            if (node->type == GRAPH_NODE_TYPE_OBJECT
+                && (node->flags & (GRAPH_RENDER_ACTIVE | GRAPH_RENDER_INVISIBLE)) == GRAPH_RENDER_ACTIVE) {
+                struct GraphNodeObject *obj = (struct GraphNodeObject *) node;
+
+                if (obj->areaIndex == areaIndex && obj->animInfo.curAnim != NULL) {
+                    if (geo_obj_is_in_view(obj, cameraMatrix)) {
+                        anim_pose_add(obj);
+                    } else {
+                        gAnimPoseStats.numCulled++;
+                    }
+                }
+            }
+        } while ((node = node->next) != firstNode);
+    }
+
+    // Held objects are drawn with Mario, without being culled
+    if (gMarioState->heldObj != NULL && gMarioState->heldObj->header.gfx.animInfo.curAnim != NULL) {
+        anim_pose_add(&gMarioState->heldObj->header.gfx);
+    }
+
+    anim_pose_evaluate_range(sPoses, 0, sNumPoses);
+
+    gAnimPoseStats.numPoses = sNumPoses;
+    gAnimPoseStats.numChannels = sPoseValuesUsed;
+}
+
+/**
+ * Return the pose evaluated for this frame, or NULL if the object was skipped.
+ */
+struct AnimPose *anim_pose_find(struct AnimInfo *animInfo) {
+    u32 slot = anim_pose_hash(animInfo) & (ANIM_POSE_LOOKUP_SIZE - 1);
+
+    while (sPoseLookup[slot].generation == sPoseGeneration) {
+        if (sPoseLookup[slot].animInfo == animInfo) {
+            return &sPoses[sPoseLookup[slot].poseIndex];
+        }
+        slot = (slot + 1) & (ANIM_POSE_LOOKUP_SIZE - 1);
+    }
+    return NULL;
+}
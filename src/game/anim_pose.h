@@ -0,0 +1,38 @@
+#ifndef ANIM_POSE_H
+#define ANIM_POSE_H
+
+#include <PR/ultratypes.h>
+
+#include "types.h"
+
+/**
+ * The decoded animation values of one object for the current frame. Channel
+ * 0-2 is the root translation, after which every animated part has three
+ * rotation channels, in the order the scene graph consumes them.
+ */
+struct AnimPose {
+    struct AnimInfo *animInfo;
+    struct Animation *anim;
+    s16 frame;
+    u16 numChannels;
+    s16 *values;
+};
+
+/**
+ * Counters of the last evaluation pass, for profiling.
+ */
+struct AnimPoseStats {
+    u32 numPoses;
+    u32 numChannels;
+    u32 numSkipped;
+    u32 numCulled;
+};
+
+extern struct AnimPoseStats gAnimPoseStats;
+
+void anim_pose_evaluate_objects(struct GraphNode *objParent, s16 areaIndex, Mat4 cameraMatrix);
+void anim_pose_evaluate_range(struct AnimPose *poses, s32 start, s32 end);
+struct AnimPose *anim_pose_find(struct AnimInfo *animInfo);
+void anim_pose_record_channels(struct Animation *anim, s32 numChannels);
+
+#endif // ANIM_POSE_H
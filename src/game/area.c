@@ -19,6 +19,7 @@
 #include "rendering_graph_node.h"
 #include "level_update.h"
 #include "engine/geo_layout.h"
+#include "engine/level_script.h"
 #include "save_file.h"
 #include "level_table.h"
 #include "dialog_ids.h"
@@ -232,8 +233,11 @@ void load_area(s32 index) {
         gCurrAreaIndex = gCurrentArea->index;
 
         if (gCurrentArea->terrainData != NULL) {
+            OSTime start = level_load_get_time();
+
             load_area_terrain(index, gCurrentArea->terrainData, gCurrentArea->surfaceRooms,
                               gCurrentArea->macroObjects);
+            gLevelLoadStats.terrainTime += OS_CYCLES_TO_USEC(level_load_get_time() - start);
         }
 
         if (gCurrentArea->objectSpawnInfos != NULL) {
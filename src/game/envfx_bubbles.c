@@ -11,6 +11,10 @@
 #include "audio/external.h"
 #include "textures.h"
 
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
 /**
  * This file implements environment effects that are not snow:
  * Flowers (unused), lava bubbles and jet stream/whirlpool bubbles.
@@ -308,6 +312,417 @@ void envfx_update_jetstream(void) {
     }
 }
 
+#ifndef TARGET_N64
+/**
+ * Same as random_flower_offset, drawing from the given seed.
+ */
+static s32 envfx_random_flower_offset(s32 gameRandom) {
+    s32 result = envfx_random_float(gameRandom) * 2000.0f - 1000.0f;
+    if (result < 0) {
+        result -= 1000;
+    } else {
+        result += 1000;
+    }
+
+    return result;
+}
+
+/**
+ * Same as envfx_update_flower, for 'count' flowers of the PC particle arrays
+ * starting at 'start'. Every respawn needs a floor lookup, so this one is not
+ * vectorized.
+ */
+static void envfx_update_flower_batch(s32 start, s32 count, s32 gameRandom, Vec3s centerPos) {
+    struct FloorGeometry *floorGeo; // unused
+    s32 timer = gGlobalTimer;
+    s16 centerX = centerPos[0];
+    s16 centerZ = centerPos[2];
+    s32 *xPos = gEnvFxArrays.xPos;
+    s32 *yPos = gEnvFxArrays.yPos;
+    s32 *zPos = gEnvFxArrays.zPos;
+    s32 *animFrame = gEnvFxArrays.animFrame;
+    s32 i;
+
+    for (i = start; i < start + count; i++) {
+        if (sqr(xPos[i] - centerX) + sqr(zPos[i] - centerZ) > sqr(3000)) {
+            xPos[i] = envfx_random_flower_offset(gameRandom) + centerX;
+            zPos[i] = envfx_random_flower_offset(gameRandom) + centerZ;
+            yPos[i] = find_floor_height_and_data(xPos[i], 10000.0f, zPos[i], &floorGeo);
+            animFrame[i] = (s16)(envfx_random_float(gameRandom) * 5.0f);
+        } else if ((timer & 0x03) == 0) {
+            animFrame[i] += 1;
+            if (animFrame[i] > 5) {
+                animFrame[i] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * Same as envfx_update_lava, for 'count' lava bubbles of the PC particle
+ * arrays starting at 'start'. The random numbers are drawn first, in the
+ * order of the original function, then the positions of the respawning
+ * bubbles are computed four at a time when SSE4.1 is available. The floor
+ * lookups and the animation stay one bubble at a time.
+ */
+static void envfx_update_lava_batch(s32 start, s32 count, s32 gameRandom, Vec3s centerPos) {
+    struct Surface *surface;
+    s16 floorY;
+    s16 centerX = centerPos[0];
+    s16 centerY = centerPos[1];
+    s16 centerZ = centerPos[2];
+    s32 advance = (gGlobalTimer & 0x01) == 0;
+    s32 *xPos = gEnvFxArrays.xPos + start;
+    s32 *yPos = gEnvFxArrays.yPos + start;
+    s32 *zPos = gEnvFxArrays.zPos + start;
+    s32 *isAlive = gEnvFxArrays.isAlive + start;
+    s32 *animFrame = gEnvFxArrays.animFrame + start;
+    f32 *r0 = gEnvFxArrays.scratch[0] + start;
+    f32 *r1 = gEnvFxArrays.scratch[1] + start;
+    s32 i;
+
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            r0[i] = envfx_random_float(gameRandom);
+            r1[i] = envfx_random_float(gameRandom);
+        }
+    }
+
+    i = 0;
+#ifdef __SSE4_1__
+    {
+        __m128 cx = _mm_set1_ps(centerX);
+        __m128 cz = _mm_set1_ps(centerZ);
+        __m128 scale = _mm_set1_ps(6000.0f);
+        __m128 offset = _mm_set1_ps(3000.0f);
+        __m128i max = _mm_set1_epi32(8000);
+        __m128i min = _mm_set1_epi32(-8000);
+        __m128i maxFold = _mm_set1_epi32(16000);
+        __m128i minFold = _mm_set1_epi32(-16000);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128i alive = _mm_loadu_si128((__m128i *) (isAlive + i));
+            __m128i x = _mm_cvttps_epi32(
+                _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(r0 + i), scale), offset), cx));
+            __m128i z = _mm_cvttps_epi32(
+                _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(r1 + i), scale), offset), cz));
+
+            // Fold positions beyond +-8000 back in, like envfx_set_lava_bubble_position
+            x = _mm_blendv_epi8(x, _mm_sub_epi32(maxFold, x), _mm_cmpgt_epi32(x, max));
+            x = _mm_blendv_epi8(x, _mm_sub_epi32(minFold, x), _mm_cmplt_epi32(x, min));
+            z = _mm_blendv_epi8(z, _mm_sub_epi32(maxFold, z), _mm_cmpgt_epi32(z, max));
+            z = _mm_blendv_epi8(z, _mm_sub_epi32(minFold, z), _mm_cmplt_epi32(z, min));
+
+            _mm_storeu_si128((__m128i *) (xPos + i),
+                             _mm_blendv_epi8(x, _mm_loadu_si128((__m128i *) (xPos + i)), alive));
+            _mm_storeu_si128((__m128i *) (zPos + i),
+                             _mm_blendv_epi8(z, _mm_loadu_si128((__m128i *) (zPos + i)), alive));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        if (!isAlive[i]) {
+            xPos[i] = r0[i] * 6000.0f - 3000.0f + centerX;
+            zPos[i] = r1[i] * 6000.0f - 3000.0f + centerZ;
+
+            if (xPos[i] > 8000) {
+                xPos[i] = 16000 - xPos[i];
+            }
+            if (xPos[i] < -8000) {
+                xPos[i] = -16000 - xPos[i];
+            }
+
+            if (zPos[i] > 8000) {
+                zPos[i] = 16000 - zPos[i];
+            }
+            if (zPos[i] < -8000) {
+                zPos[i] = -16000 - zPos[i];
+            }
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            floorY = find_floor(xPos[i], centerY + 500, zPos[i], &surface);
+            if (surface != NULL && surface->type == SURFACE_BURNING) {
+                yPos[i] = floorY;
+            } else {
+                yPos[i] = FLOOR_LOWER_LIMIT_MISC;
+            }
+            isAlive[i] = -1;
+        } else if (advance) {
+            animFrame[i] += 1;
+            if (animFrame[i] > 8) {
+                isAlive[i] = 0;
+                animFrame[i] = 0;
+            }
+        }
+    }
+}
+
+/**
+ * Same as envfx_update_whirlpool, for 'count' whirlpool bubbles of the PC
+ * particle arrays starting at 'start'. The alive test and the rotation around
+ * the whirlpool process four bubbles at a time when SSE4.1 is available, the
+ * random numbers and the sine table lookups are done one bubble at a time,
+ * in the order of the original function.
+ */
+static void envfx_update_whirlpool_batch(s32 start, s32 count, s32 gameRandom) {
+    s32 srcX = gEnvFxBubbleConfig[ENVFX_STATE_SRC_X];
+    s32 srcY = gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y];
+    s32 srcZ = gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z];
+    s32 destX = gEnvFxBubbleConfig[ENVFX_STATE_DEST_X];
+    s32 destY = gEnvFxBubbleConfig[ENVFX_STATE_DEST_Y];
+    s32 destZ = gEnvFxBubbleConfig[ENVFX_STATE_DEST_Z];
+    f32 cosPitch = coss(gEnvFxBubbleConfig[ENVFX_STATE_PITCH]);
+    f32 sinPitch = sins(gEnvFxBubbleConfig[ENVFX_STATE_PITCH]);
+    f32 cosMYaw = coss(-gEnvFxBubbleConfig[ENVFX_STATE_YAW]);
+    f32 sinMYaw = sins(-gEnvFxBubbleConfig[ENVFX_STATE_YAW]);
+    s32 *xPos = gEnvFxArrays.xPos + start;
+    s32 *yPos = gEnvFxArrays.yPos + start;
+    s32 *zPos = gEnvFxArrays.zPos + start;
+    s32 *isAlive = gEnvFxArrays.isAlive + start;
+    s32 *angle = gEnvFxArrays.angle + start;
+    s32 *dist = gEnvFxArrays.dist + start;
+    s32 *bubbleY = gEnvFxArrays.bubbleY + start;
+    f32 *r0 = gEnvFxArrays.scratch[0] + start;
+    f32 *r1 = gEnvFxArrays.scratch[1] + start;
+    f32 *r2 = gEnvFxArrays.scratch[2] + start;
+    s32 i = 0;
+
+#ifdef __SSE4_1__
+    {
+        __m128i minY = _mm_set1_epi32(destY - 100);
+        __m128i minDist = _mm_set1_epi32(10);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128i dead = _mm_or_si128(
+                _mm_cmplt_epi32(_mm_loadu_si128((__m128i *) (bubbleY + i)), minY),
+                _mm_cmplt_epi32(_mm_loadu_si128((__m128i *) (dist + i)), minDist));
+
+            _mm_storeu_si128((__m128i *) (isAlive + i), _mm_xor_si128(dead, _mm_set1_epi32(-1)));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        isAlive[i] = -(bubbleY[i] >= destY - 100 && dist[i] >= 10);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            r0[i] = envfx_random_float(gameRandom);
+            r1[i] = envfx_random_float(gameRandom);
+            r2[i] = envfx_random_float(gameRandom);
+        }
+    }
+
+    // Move the bubbles along the spiral, and keep the sine and cosine of
+    // their angle for the position update
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            dist[i] = r0[i] * 1000.0f;
+            angle[i] = r1[i] * 65536.0f;
+            bubbleY[i] = srcY + (r2[i] * 100.0f - 50.0f);
+            isAlive[i] = -1;
+        } else {
+            dist[i] -= 40;
+            angle[i] += (s16)(3000 - dist[i] * 2) + 0x400;
+            bubbleY[i] -= 40 - ((s16) dist[i] / 100);
+        }
+        r0[i] = sins(angle[i]);
+        r1[i] = coss(angle[i]);
+    }
+
+    i = 0;
+#ifdef __SSE4_1__
+    {
+        __m128 srcXf = _mm_set1_ps(srcX);
+        __m128 srcZf = _mm_set1_ps(srcZ);
+        __m128i destXv = _mm_set1_epi32(destX);
+        __m128i destYv = _mm_set1_epi32(destY);
+        __m128i destZv = _mm_set1_epi32(destZ);
+        __m128 cosPitchv = _mm_set1_ps(cosPitch);
+        __m128 sinPitchv = _mm_set1_ps(sinPitch);
+        __m128 cosMYawv = _mm_set1_ps(cosMYaw);
+        __m128 sinMYawv = _mm_set1_ps(sinMYaw);
+        __m128 sinMYawCosPitch = _mm_set1_ps(sinMYaw * cosPitch);
+        __m128 sinPitchSinMYaw = _mm_set1_ps(sinPitch * sinMYaw);
+        __m128 cosPitchCosMYaw = _mm_set1_ps(cosPitch * cosMYaw);
+        __m128 sinPitchCosMYaw = _mm_set1_ps(sinPitch * cosMYaw);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128 d = _mm_cvtepi32_ps(_mm_loadu_si128((__m128i *) (dist + i)));
+            __m128i x = _mm_cvttps_epi32(_mm_add_ps(srcXf, _mm_mul_ps(_mm_loadu_ps(r0 + i), d)));
+            __m128i z = _mm_cvttps_epi32(_mm_add_ps(srcZf, _mm_mul_ps(_mm_loadu_ps(r1 + i), d)));
+            __m128 vecX = _mm_cvtepi32_ps(_mm_sub_epi32(x, destXv));
+            __m128 vecY = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_loadu_si128((__m128i *) (bubbleY + i)), destYv));
+            __m128 vecZ = _mm_cvtepi32_ps(_mm_sub_epi32(z, destZv));
+            __m128 rotatedX = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(vecX, cosMYawv), _mm_mul_ps(sinMYawCosPitch, vecY)),
+                                         _mm_mul_ps(sinPitchSinMYaw, vecZ));
+            __m128 rotatedY = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(vecX, sinMYawv), _mm_mul_ps(cosPitchCosMYaw, vecY)),
+                                         _mm_mul_ps(sinPitchCosMYaw, vecZ));
+            __m128 rotatedZ = _mm_add_ps(_mm_mul_ps(vecY, sinPitchv), _mm_mul_ps(cosPitchv, vecZ));
+
+            _mm_storeu_si128((__m128i *) (xPos + i), _mm_add_epi32(destXv, _mm_cvttps_epi32(rotatedX)));
+            _mm_storeu_si128((__m128i *) (yPos + i), _mm_add_epi32(destYv, _mm_cvttps_epi32(rotatedY)));
+            _mm_storeu_si128((__m128i *) (zPos + i), _mm_add_epi32(destZv, _mm_cvttps_epi32(rotatedZ)));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        s32 vecX, vecY, vecZ;
+
+        // Same as envfx_rotate_around_whirlpool
+        xPos[i] = srcX + r0[i] * dist[i];
+        zPos[i] = srcZ + r1[i] * dist[i];
+        vecX = xPos[i] - destX;
+        vecY = bubbleY[i] - destY;
+        vecZ = zPos[i] - destZ;
+        xPos[i] = destX + (s32)(vecX * cosMYaw - sinMYaw * cosPitch * vecY - sinPitch * sinMYaw * vecZ);
+        yPos[i] = destY + (s32)(vecX * sinMYaw + cosPitch * cosMYaw * vecY - sinPitch * cosMYaw * vecZ);
+        zPos[i] = destZ + (s32)(vecY * sinPitch + cosPitch * vecZ);
+    }
+}
+
+/**
+ * Same as envfx_update_jetstream, for 'count' jet stream bubbles of the PC
+ * particle arrays starting at 'start'. The alive test and the horizontal
+ * movement process four bubbles at a time when SSE4.1 is available, the
+ * random numbers and the sine table lookups are done one bubble at a time,
+ * in the order of the original function.
+ */
+static void envfx_update_jetstream_batch(s32 start, s32 count, s32 gameRandom) {
+    s32 srcX = gEnvFxBubbleConfig[ENVFX_STATE_SRC_X];
+    s32 srcY = gEnvFxBubbleConfig[ENVFX_STATE_SRC_Y];
+    s32 srcZ = gEnvFxBubbleConfig[ENVFX_STATE_SRC_Z];
+    s32 *xPos = gEnvFxArrays.xPos + start;
+    s32 *yPos = gEnvFxArrays.yPos + start;
+    s32 *zPos = gEnvFxArrays.zPos + start;
+    s32 *isAlive = gEnvFxArrays.isAlive + start;
+    s32 *angle = gEnvFxArrays.angle + start;
+    s32 *dist = gEnvFxArrays.dist + start;
+    f32 *r0 = gEnvFxArrays.scratch[0] + start;
+    f32 *r1 = gEnvFxArrays.scratch[1] + start;
+    f32 *r2 = gEnvFxArrays.scratch[2] + start;
+    s32 i = 0;
+
+#ifdef __SSE4_1__
+    {
+        __m128i cx = _mm_set1_epi32(srcX);
+        __m128i cz = _mm_set1_epi32(srcZ);
+        __m128i maxY = _mm_set1_epi32(srcY + 1500);
+        __m128i maxDistSq = _mm_set1_epi32(sqr(1000));
+
+        for (; i + 4 <= count; i += 4) {
+            __m128i dx = _mm_sub_epi32(_mm_loadu_si128((__m128i *) (xPos + i)), cx);
+            __m128i dz = _mm_sub_epi32(_mm_loadu_si128((__m128i *) (zPos + i)), cz);
+            __m128i distSq = _mm_add_epi32(_mm_mullo_epi32(dx, dx), _mm_mullo_epi32(dz, dz));
+            __m128i dead = _mm_or_si128(_mm_cmpgt_epi32(distSq, maxDistSq),
+                                        _mm_cmpgt_epi32(_mm_loadu_si128((__m128i *) (yPos + i)), maxY));
+
+            _mm_storeu_si128((__m128i *) (isAlive + i), _mm_xor_si128(dead, _mm_set1_epi32(-1)));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        isAlive[i] = -(sqr(xPos[i] - srcX) + sqr(zPos[i] - srcZ) <= sqr(1000) && yPos[i] <= srcY + 1500);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            r0[i] = envfx_random_float(gameRandom);
+            r1[i] = envfx_random_u16(gameRandom);
+            r2[i] = envfx_random_float(gameRandom);
+        }
+    }
+
+    // Update the distance, angle and height, and keep the sine and cosine of
+    // the angle for the horizontal movement
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            dist[i] = r0[i] * 300.0f;
+            angle[i] = r1[i];
+            yPos[i] = srcY + (r2[i] * 400.0f - 200.0f);
+        } else {
+            dist[i] += 10;
+            yPos[i] -= (dist[i] / 30) - 50;
+        }
+        r0[i] = sins(angle[i]);
+        r1[i] = coss(angle[i]);
+    }
+
+    i = 0;
+#ifdef __SSE4_1__
+    {
+        __m128 srcXf = _mm_set1_ps(srcX);
+        __m128 srcZf = _mm_set1_ps(srcZ);
+        __m128 speed = _mm_set1_ps(10.0f);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128i alive = _mm_loadu_si128((__m128i *) (isAlive + i));
+            __m128 s = _mm_loadu_ps(r0 + i);
+            __m128 c = _mm_loadu_ps(r1 + i);
+            __m128 d = _mm_cvtepi32_ps(_mm_loadu_si128((__m128i *) (dist + i)));
+            __m128 x = _mm_cvtepi32_ps(_mm_loadu_si128((__m128i *) (xPos + i)));
+            __m128 z = _mm_cvtepi32_ps(_mm_loadu_si128((__m128i *) (zPos + i)));
+            __m128i newX = _mm_cvttps_epi32(_mm_add_ps(srcXf, _mm_mul_ps(s, d)));
+            __m128i newZ = _mm_cvttps_epi32(_mm_add_ps(srcZf, _mm_mul_ps(c, d)));
+            __m128i movedX = _mm_cvttps_epi32(_mm_add_ps(x, _mm_mul_ps(s, speed)));
+            __m128i movedZ = _mm_cvttps_epi32(_mm_add_ps(z, _mm_mul_ps(c, speed)));
+
+            _mm_storeu_si128((__m128i *) (xPos + i), _mm_blendv_epi8(newX, movedX, alive));
+            _mm_storeu_si128((__m128i *) (zPos + i), _mm_blendv_epi8(newZ, movedZ, alive));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        if (!isAlive[i]) {
+            xPos[i] = srcX + r0[i] * dist[i];
+            zPos[i] = srcZ + r1[i] * dist[i];
+        } else {
+            xPos[i] += r0[i] * 10.0f;
+            zPos[i] += r1[i] * 10.0f;
+        }
+    }
+}
+
+/**
+ * Update the bubbles of the original game with the game's random numbers,
+ * then the extra ones that gEnvFxDensity adds, which are stored after the
+ * sBubbleParticleCount bubbles of the original game.
+ */
+static void envfx_update_bubble_arrays(s32 mode, Vec3s centerPos) {
+    s32 extraStart = sBubbleParticleCount;
+    s32 extraCount = sBubbleParticleMaxCount * (gEnvFxDensity - 1);
+
+    switch (mode) {
+        case ENVFX_FLOWERS:
+            envfx_update_flower_batch(0, sBubbleParticleMaxCount, TRUE, centerPos);
+            envfx_update_flower_batch(extraStart, extraCount, FALSE, centerPos);
+            break;
+
+        case ENVFX_LAVA_BUBBLES:
+            envfx_update_lava_batch(0, sBubbleParticleMaxCount, TRUE, centerPos);
+            envfx_update_lava_batch(extraStart, extraCount, FALSE, centerPos);
+
+            if ((s32)(random_float() * 16.0f) == 8) {
+                play_sound(SOUND_GENERAL_QUIET_BUBBLE2, gGlobalSoundSource);
+            }
+            break;
+
+        case ENVFX_WHIRLPOOL_BUBBLES:
+            envfx_update_whirlpool_batch(0, sBubbleParticleMaxCount, TRUE);
+            envfx_update_whirlpool_batch(extraStart, extraCount, FALSE);
+            break;
+
+        case ENVFX_JETSTREAM_BUBBLES:
+            envfx_update_jetstream_batch(0, sBubbleParticleMaxCount, TRUE);
+            envfx_update_jetstream_batch(extraStart, extraCount, FALSE);
+            break;
+    }
+}
+#endif
+
 /**
  * Initialize bubble (or flower) effect by allocating a buffer to store
  * the state of each particle and setting the initial and max count.
@@ -339,19 +754,35 @@ s32 envfx_init_bubble(s32 mode) {
             break;
     }
 
+#ifdef TARGET_N64
     gEnvFxBuffer = mem_pool_alloc(gEffectsMemoryPool, sBubbleParticleCount * sizeof(struct EnvFxParticle));
     if (!gEnvFxBuffer) {
         return 0;
     }
 
     bzero(gEnvFxBuffer, sBubbleParticleCount * sizeof(struct EnvFxParticle));
+#else
+    gEnvFxBuffer = envfx_alloc_particle_arrays(sBubbleParticleCount * gEnvFxDensity);
+    if (!gEnvFxBuffer) {
+        return 0;
+    }
+#endif
     bzero(gEnvFxBubbleConfig, sizeof(gEnvFxBubbleConfig));
 
     switch (mode) {
         case ENVFX_LAVA_BUBBLES:
             for (i = 0; i < sBubbleParticleCount; i++) {
+#ifdef TARGET_N64
                 (gEnvFxBuffer + i)->animFrame = random_float() * 7.0f;
+#else
+                gEnvFxArrays.animFrame[i] = (s16)(random_float() * 7.0f);
+#endif
             }
+#ifndef TARGET_N64
+            for (; i < sBubbleParticleCount * gEnvFxDensity; i++) {
+                gEnvFxArrays.animFrame[i] = (s16)(envfx_random_float(FALSE) * 7.0f);
+            }
+#endif
             break;
     }
 
@@ -367,28 +798,44 @@ s32 envfx_init_bubble(s32 mode) {
 void envfx_bubbles_update_switch(s32 mode, Vec3s camTo, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
     switch (mode) {
         case ENVFX_FLOWERS:
+#ifdef TARGET_N64
             envfx_update_flower(camTo);
+#else
+            envfx_update_bubble_arrays(ENVFX_FLOWERS, camTo);
+#endif
             vertex1[0] = 50;  vertex1[1] = 0;  vertex1[2] = 0;
             vertex2[0] = 0;   vertex2[1] = 75; vertex2[2] = 0;
             vertex3[0] = -50; vertex3[1] = 0;  vertex3[2] = 0;
             break;
 
         case ENVFX_LAVA_BUBBLES:
+#ifdef TARGET_N64
             envfx_update_lava(camTo);
+#else
+            envfx_update_bubble_arrays(ENVFX_LAVA_BUBBLES, camTo);
+#endif
             vertex1[0] = 100;  vertex1[1] = 0;   vertex1[2] = 0;
             vertex2[0] = 0;    vertex2[1] = 150; vertex2[2] = 0;
             vertex3[0] = -100; vertex3[1] = 0;   vertex3[2] = 0;
             break;
 
         case ENVFX_WHIRLPOOL_BUBBLES:
+#ifdef TARGET_N64
             envfx_update_whirlpool();
+#else
+            envfx_update_bubble_arrays(ENVFX_WHIRLPOOL_BUBBLES, camTo);
+#endif
             vertex1[0] = 40;  vertex1[1] = 0;  vertex1[2] = 0;
             vertex2[0] = 0;   vertex2[1] = 60; vertex2[2] = 0;
             vertex3[0] = -40; vertex3[1] = 0;  vertex3[2] = 0;
             break;
 
         case ENVFX_JETSTREAM_BUBBLES:
+#ifdef TARGET_N64
             envfx_update_jetstream();
+#else
+            envfx_update_bubble_arrays(ENVFX_JETSTREAM_BUBBLES, camTo);
+#endif
             vertex1[0] = 40;  vertex1[1] = 0;  vertex1[2] = 0;
             vertex2[0] = 0;   vertex2[1] = 60; vertex2[2] = 0;
             vertex3[0] = -40; vertex3[1] = 0;  vertex3[2] = 0;
@@ -404,7 +851,7 @@ void envfx_bubbles_update_switch(s32 mode, Vec3s camTo, Vec3s vertex1, Vec3s ver
 void append_bubble_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3,
                                  Vtx *template) {
     s32 i = 0;
-    Vtx *vertBuf = alloc_display_list(15 * sizeof(Vtx));
+    Vtx *vertBuf = alloc_display_list_category(15 * sizeof(Vtx), GFX_ALLOC_VERTICES);
 
     if (vertBuf == NULL) {
         return;
@@ -461,12 +908,101 @@ void envfx_set_bubble_texture(s32 mode, s16 index) {
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006D68);
 }
 
+#ifndef TARGET_N64
+/**
+ * Write the vertices of 'count' bubbles starting at 'start' to 'vtx', and
+ * return the end of the written vertices.
+ */
+static Vtx *envfx_write_bubble_vertices(Vtx *vtx, s32 start, s32 count, s16 *vertices[3]) {
+    s32 i;
+    s32 j;
+
+    for (i = start; i < start + count; i++) {
+        for (j = 0; j < 3; j++, vtx++) {
+            vtx->v = gBubbleTempVtx[j];
+            vtx->v.ob[0] = gEnvFxArrays.xPos[i] + vertices[j][0];
+            vtx->v.ob[1] = gEnvFxArrays.yPos[i] + vertices[j][1];
+            vtx->v.ob[2] = gEnvFxArrays.zPos[i] + vertices[j][2];
+        }
+    }
+    return vtx;
+}
+
+/**
+ * Write the vertices of all bubbles to one buffer and draw them, loading 15
+ * vertices at a time like append_bubble_vertex_buffer. Every group of 5
+ * bubbles uses the texture of its first bubble, as with
+ * envfx_set_bubble_texture, but the texture is only set again when it changes.
+ */
+static Gfx *envfx_append_bubbles(Gfx *gfx, s32 mode, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
+    s16 *vertices[3];
+    void **imageArr;
+    Vtx *vertBuf;
+    s32 count = sBubbleParticleMaxCount * gEnvFxDensity;
+    s32 lastFrame = -1;
+    s32 frame;
+    s32 i;
+    s32 j;
+
+    vertBuf = alloc_display_list_category(count * 3 * sizeof(Vtx), GFX_ALLOC_VERTICES);
+    if (vertBuf == NULL) {
+        return gfx;
+    }
+
+    vertices[0] = vertex1;
+    vertices[1] = vertex2;
+    vertices[2] = vertex3;
+    envfx_write_bubble_vertices(envfx_write_bubble_vertices(vertBuf, 0, sBubbleParticleMaxCount, vertices),
+                                sBubbleParticleCount, count - sBubbleParticleMaxCount, vertices);
+
+    switch (mode) {
+        case ENVFX_FLOWERS:
+            imageArr = segmented_to_virtual(&flower_bubbles_textures_ptr_0B002008);
+            break;
+
+        case ENVFX_LAVA_BUBBLES:
+            imageArr = segmented_to_virtual(&lava_bubble_ptr_0B006020);
+            break;
+
+        default:
+            imageArr = segmented_to_virtual(&bubble_ptr_0B006848);
+            break;
+    }
+
+    for (i = 0; i < count; i += 5) {
+        s32 groupSize = count - i < 5 ? count - i : 5;
+
+        if (mode == ENVFX_FLOWERS || mode == ENVFX_LAVA_BUBBLES) {
+            frame = gEnvFxArrays.animFrame[i < sBubbleParticleMaxCount
+                                               ? i
+                                               : sBubbleParticleCount + i - sBubbleParticleMaxCount];
+        } else {
+            frame = 0;
+        }
+        if (frame != lastFrame) {
+            gDPPipeSync(gfx++);
+            gDPSetTextureImage(gfx++, G_IM_FMT_RGBA, G_IM_SIZ_16b, 1, *(imageArr + frame));
+            gSPDisplayList(gfx++, &tiny_bubble_dl_0B006D68);
+            lastFrame = frame;
+        }
+
+        gSPVertex(gfx++, VIRTUAL_TO_PHYSICAL(vertBuf + i * 3), groupSize * 3, 0);
+        for (j = 0; j < groupSize; j++) {
+            gSP1Triangle(gfx++, j * 3, j * 3 + 1, j * 3 + 2, 0);
+        }
+    }
+    return gfx;
+}
+#endif
+
 /**
  * Updates the bubble particle positions, then generates and returns a display
  * list drawing them.
  */
 Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFrom, Vec3s camTo) {
+#ifdef TARGET_N64
     s32 i;
+#endif
     s16 radius, pitch, yaw;
 
     Vec3s vertex1;
@@ -475,8 +1011,14 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
 
     Gfx *gfxStart;
 
+#ifdef TARGET_N64
     gfxStart = alloc_display_list(((sBubbleParticleMaxCount / 5) * 10 + sBubbleParticleMaxCount + 3)
                                   * sizeof(Gfx));
+#else
+    // At most a texture change, a vertex load and 5 triangles per 5 bubbles
+    gfxStart = alloc_display_list((((sBubbleParticleMaxCount * gEnvFxDensity + 4) / 5) * 9 + 3)
+                                  * sizeof(Gfx));
+#endif
     if (gfxStart == NULL) {
         return NULL;
     }
@@ -489,6 +1031,7 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
 
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006D38);
 
+#ifdef TARGET_N64
     for (i = 0; i < sBubbleParticleMaxCount; i += 5) {
         gDPPipeSync(sGfxCursor++);
         envfx_set_bubble_texture(mode, i);
@@ -499,6 +1042,9 @@ Gfx *envfx_update_bubble_particles(s32 mode, UNUSED Vec3s marioPos, Vec3s camFro
         gSP1Triangle(sGfxCursor++, 9, 10, 11, 0);
         gSP1Triangle(sGfxCursor++, 12, 13, 14, 0);
     }
+#else
+    sGfxCursor = envfx_append_bubbles(sGfxCursor, mode, vertex1, vertex2, vertex3);
+#endif
 
     gSPDisplayList(sGfxCursor++, &tiny_bubble_dl_0B006AB0);
     gSPEndDisplayList(sGfxCursor++);
@@ -519,6 +1065,12 @@ void envfx_set_max_bubble_particles(s32 mode) {
             sBubbleParticleMaxCount = gEnvFxBubbleConfig[ENVFX_STATE_PARTICLECOUNT];
             break;
     }
+#ifndef TARGET_N64
+    // The extra bubbles are stored right after the allocated ones
+    if (sBubbleParticleMaxCount > sBubbleParticleCount) {
+        sBubbleParticleMaxCount = sBubbleParticleCount;
+    }
+#endif
 }
 
 /**
@@ -13,6 +13,10 @@
 #include "audio/external.h"
 #include "obj_behaviors.h"
 
+#ifdef __SSE4_1__
+#include <smmintrin.h>
+#endif
+
 /**
  * This file contains the function that handles 'environment effects',
  * which are particle effects related to the level type that, unlike
@@ -55,6 +59,62 @@ extern void *tiny_bubble_dl_0B006AB0;
 extern void *tiny_bubble_dl_0B006A50;
 extern void *tiny_bubble_dl_0B006CD8;
 
+#ifndef TARGET_N64
+struct EnvFxParticleArrays gEnvFxArrays;
+s32 gEnvFxDensity = 1;
+static u32 sEnvFxRandomSeed = 1;
+
+#define ENVFX_NUM_ARRAYS 11
+
+/**
+ * Allocate the particle arrays for 'count' particles. They share one block
+ * from gEffectsMemoryPool, which is returned and which gEnvFxBuffer points to.
+ */
+void *envfx_alloc_particle_arrays(s32 count) {
+    s32 *block = mem_pool_alloc(gEffectsMemoryPool, ENVFX_NUM_ARRAYS * count * sizeof(s32));
+
+    if (block == NULL) {
+        return NULL;
+    }
+    bzero(block, ENVFX_NUM_ARRAYS * count * sizeof(s32));
+
+    gEnvFxArrays.xPos = block;
+    gEnvFxArrays.yPos = block + count;
+    gEnvFxArrays.zPos = block + 2 * count;
+    gEnvFxArrays.isAlive = block + 3 * count;
+    gEnvFxArrays.animFrame = block + 4 * count;
+    gEnvFxArrays.angle = block + 5 * count;
+    gEnvFxArrays.dist = block + 6 * count;
+    gEnvFxArrays.bubbleY = block + 7 * count;
+    gEnvFxArrays.scratch[0] = (f32 *) (block + 8 * count);
+    gEnvFxArrays.scratch[1] = (f32 *) (block + 9 * count);
+    gEnvFxArrays.scratch[2] = (f32 *) (block + 10 * count);
+    return block;
+}
+
+/**
+ * Draw a random number for a particle, from the game's seed for the particles
+ * of the original game and from the envfx seed for the extra ones.
+ */
+u16 envfx_random_u16(s32 gameRandom) {
+    if (gameRandom) {
+        return random_u16();
+    }
+    sEnvFxRandomSeed = sEnvFxRandomSeed * 1664525 + 1013904223;
+    return sEnvFxRandomSeed >> 16;
+}
+
+f32 envfx_random_float(s32 gameRandom) {
+    f32 rnd;
+
+    if (gameRandom) {
+        return random_float();
+    }
+    rnd = envfx_random_u16(FALSE);
+    return rnd / (double) 0x10000;
+}
+#endif
+
 /**
  * Initialize snow particles by allocating a buffer for storing their state
  * and setting a start amount.
@@ -80,12 +140,19 @@ s32 envfx_init_snow(s32 mode) {
             break;
     }
 
+#ifdef TARGET_N64
     gEnvFxBuffer = mem_pool_alloc(gEffectsMemoryPool, gSnowParticleMaxCount * sizeof(struct EnvFxParticle));
     if (!gEnvFxBuffer) {
         return 0;
     }
 
     bzero(gEnvFxBuffer, gSnowParticleMaxCount * sizeof(struct EnvFxParticle));
+#else
+    gEnvFxBuffer = envfx_alloc_particle_arrays(gSnowParticleMaxCount * gEnvFxDensity);
+    if (!gEnvFxBuffer) {
+        return 0;
+    }
+#endif
 
     gEnvFxMode = mode;
     return 1;
@@ -299,6 +366,224 @@ void envfx_update_snow_water(s32 snowCylinderX, s32 snowCylinderY, s32 snowCylin
     }
 }
 
+#ifndef TARGET_N64
+/**
+ * Parameters of envfx_update_snow_batch that differ between the snow modes.
+ */
+struct SnowUpdateParams {
+    u8 moves;       // whether alive flakes drift and fall
+    u8 spawnAhead;  // whether respawned flakes are moved ahead of the camera
+    f32 spawnYScale;
+    f32 spawnYOffset;
+    f32 driftX;     // constant added to the x drift of alive flakes
+    s32 fallSpeed;
+};
+
+static const struct SnowUpdateParams sSnowNormalParams = { TRUE, TRUE, 200.0f, 0.0f, 0.0f, 2 };
+static const struct SnowUpdateParams sSnowBlizzardParams = { TRUE, TRUE, 400.0f, 200.0f, 20.0f, 5 };
+static const struct SnowUpdateParams sSnowWaterParams = { FALSE, FALSE, 400.0f, 200.0f, 0.0f, 0 };
+
+/**
+ * Same as envfx_update_snow_normal, envfx_update_snow_blizzard and
+ * envfx_update_snow_water, for 'count' snowflakes of the PC particle arrays
+ * starting at 'start'. The update is split into three passes: the alive test,
+ * drawing the random numbers, and the position update. The random numbers are
+ * drawn in the same order as the original functions draw them, so with the
+ * game's seed the seed and the positions end up exactly the same, while the
+ * first and last pass process four snowflakes at a time when SSE4.1 is
+ * available.
+ */
+static void envfx_update_snow_batch(const struct SnowUpdateParams *params, s32 start, s32 count,
+                                    s32 gameRandom, s32 snowCylinderX, s32 snowCylinderY,
+                                    s32 snowCylinderZ) {
+    s32 deltaX = snowCylinderX - gSnowCylinderLastPos[0];
+    s32 deltaY = snowCylinderY - gSnowCylinderLastPos[1];
+    s32 deltaZ = snowCylinderZ - gSnowCylinderLastPos[2];
+    s16 spawnX = params->spawnAhead ? (s16)(deltaX * 2) : 0;
+    s16 spawnZ = params->spawnAhead ? (s16)(deltaZ * 2) : 0;
+    s16 moveX = (s16)(deltaX / 1.2);
+    s16 moveZ = (s16)(deltaZ / 1.2);
+    s32 fall = params->moves ? params->fallSpeed - (s16)(deltaY * 0.8) : 0;
+    s32 *xPos = gEnvFxArrays.xPos + start;
+    s32 *yPos = gEnvFxArrays.yPos + start;
+    s32 *zPos = gEnvFxArrays.zPos + start;
+    s32 *isAlive = gEnvFxArrays.isAlive + start;
+    f32 *r0 = gEnvFxArrays.scratch[0] + start;
+    f32 *r1 = gEnvFxArrays.scratch[1] + start;
+    f32 *r2 = gEnvFxArrays.scratch[2] + start;
+    s32 i = 0;
+
+#ifdef __SSE4_1__
+    {
+        __m128i cx = _mm_set1_epi32(snowCylinderX);
+        __m128i cz = _mm_set1_epi32(snowCylinderZ);
+        __m128i minY = _mm_set1_epi32(snowCylinderY - 201);
+        __m128i maxY = _mm_set1_epi32(snowCylinderY + 201);
+        __m128i maxDistSq = _mm_set1_epi32(sqr(300));
+
+        for (; i + 4 <= count; i += 4) {
+            __m128i dx = _mm_sub_epi32(_mm_loadu_si128((__m128i *) (xPos + i)), cx);
+            __m128i dz = _mm_sub_epi32(_mm_loadu_si128((__m128i *) (zPos + i)), cz);
+            __m128i y = _mm_loadu_si128((__m128i *) (yPos + i));
+            __m128i distSq = _mm_add_epi32(_mm_mullo_epi32(dx, dx), _mm_mullo_epi32(dz, dz));
+            __m128i dead = _mm_or_si128(_mm_cmpgt_epi32(distSq, maxDistSq),
+                                        _mm_or_si128(_mm_cmplt_epi32(y, minY), _mm_cmpgt_epi32(y, maxY)));
+
+            _mm_storeu_si128((__m128i *) (isAlive + i), _mm_xor_si128(dead, _mm_set1_epi32(-1)));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        isAlive[i] = -(sqr(xPos[i] - snowCylinderX) + sqr(zPos[i] - snowCylinderZ) <= sqr(300)
+                       && yPos[i] >= snowCylinderY - 201 && yPos[i] <= snowCylinderY + 201);
+    }
+
+    for (i = 0; i < count; i++) {
+        if (!isAlive[i]) {
+            r0[i] = envfx_random_float(gameRandom);
+            r1[i] = envfx_random_float(gameRandom);
+            r2[i] = envfx_random_float(gameRandom);
+        } else if (params->moves) {
+            r0[i] = envfx_random_float(gameRandom);
+            r1[i] = envfx_random_float(gameRandom);
+        }
+    }
+
+    i = 0;
+#ifdef __SSE4_1__
+    {
+        __m128 cx = _mm_set1_ps(snowCylinderX);
+        __m128 cy = _mm_set1_ps(snowCylinderY);
+        __m128 cz = _mm_set1_ps(snowCylinderZ);
+        __m128 spawnXf = _mm_set1_ps(spawnX);
+        __m128 spawnZf = _mm_set1_ps(spawnZ);
+        __m128 moveXf = _mm_set1_ps(moveX);
+        __m128 moveZf = _mm_set1_ps(moveZ);
+        __m128 driftX = _mm_set1_ps(params->driftX);
+        __m128 yScale = _mm_set1_ps(params->spawnYScale);
+        __m128 yOffset = _mm_set1_ps(params->spawnYOffset);
+        __m128 spawnScale = _mm_set1_ps(400.0f);
+        __m128 spawnOffset = _mm_set1_ps(200.0f);
+        __m128 two = _mm_set1_ps(2.0f);
+        __m128 one = _mm_set1_ps(1.0f);
+        __m128i fallv = _mm_set1_epi32(fall);
+
+        for (; i + 4 <= count; i += 4) {
+            __m128i alive = _mm_loadu_si128((__m128i *) (isAlive + i));
+            __m128i x = _mm_loadu_si128((__m128i *) (xPos + i));
+            __m128i y = _mm_loadu_si128((__m128i *) (yPos + i));
+            __m128i z = _mm_loadu_si128((__m128i *) (zPos + i));
+            __m128 a = _mm_loadu_ps(r0 + i);
+            __m128 b = _mm_loadu_ps(r1 + i);
+            __m128 c = _mm_loadu_ps(r2 + i);
+            __m128i newX = _mm_cvttps_epi32(_mm_add_ps(
+                _mm_add_ps(_mm_sub_ps(_mm_mul_ps(spawnScale, a), spawnOffset), cx), spawnXf));
+            __m128i newZ = _mm_cvttps_epi32(_mm_add_ps(
+                _mm_add_ps(_mm_sub_ps(_mm_mul_ps(spawnScale, b), spawnOffset), cz), spawnZf));
+            __m128i newY = _mm_cvttps_epi32(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(yScale, c), yOffset), cy));
+
+            if (params->moves) {
+                __m128 driftedX = _mm_add_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(a, two), one), moveXf), driftX);
+                __m128 driftedZ = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(b, two), one), moveZf);
+
+                x = _mm_cvttps_epi32(_mm_add_ps(_mm_cvtepi32_ps(x), driftedX));
+                z = _mm_cvttps_epi32(_mm_add_ps(_mm_cvtepi32_ps(z), driftedZ));
+                y = _mm_sub_epi32(y, fallv);
+            }
+
+            _mm_storeu_si128((__m128i *) (xPos + i), _mm_blendv_epi8(newX, x, alive));
+            _mm_storeu_si128((__m128i *) (yPos + i), _mm_blendv_epi8(newY, y, alive));
+            _mm_storeu_si128((__m128i *) (zPos + i), _mm_blendv_epi8(newZ, z, alive));
+        }
+    }
+#endif
+    for (; i < count; i++) {
+        if (!isAlive[i]) {
+            xPos[i] = 400.0f * r0[i] - 200.0f + snowCylinderX + spawnX;
+            zPos[i] = 400.0f * r1[i] - 200.0f + snowCylinderZ + spawnZ;
+            yPos[i] = params->spawnYScale * r2[i] - params->spawnYOffset + snowCylinderY;
+        } else if (params->moves) {
+            xPos[i] += r0[i] * 2 - 1.0f + moveX + params->driftX;
+            yPos[i] -= fall;
+            zPos[i] += r1[i] * 2 - 1.0f + moveZ;
+        }
+    }
+}
+
+/**
+ * Update the snowflakes of the original game with the game's random numbers,
+ * then the extra ones that gEnvFxDensity adds. Those are stored after the
+ * gSnowParticleMaxCount flakes of the original game, so that a change of the
+ * flake count never hands an extra flake over to the game's random numbers.
+ */
+static void envfx_update_snow_arrays(const struct SnowUpdateParams *params, s32 snowCylinderX,
+                                     s32 snowCylinderY, s32 snowCylinderZ) {
+    envfx_update_snow_batch(params, 0, gSnowParticleCount, TRUE, snowCylinderX, snowCylinderY,
+                            snowCylinderZ);
+    envfx_update_snow_batch(params, gSnowParticleMaxCount, gSnowParticleCount * (gEnvFxDensity - 1),
+                            FALSE, snowCylinderX, snowCylinderY, snowCylinderZ);
+
+    if (params->moves) {
+        gSnowCylinderLastPos[0] = snowCylinderX;
+        gSnowCylinderLastPos[1] = snowCylinderY;
+        gSnowCylinderLastPos[2] = snowCylinderZ;
+    }
+}
+
+/**
+ * Write the vertices of 'count' snowflakes starting at 'start' to 'vtx', and
+ * return the end of the written vertices.
+ */
+static Vtx *envfx_write_snowflake_vertices(Vtx *vtx, s32 start, s32 count, s16 *vertices[3]) {
+    s32 i;
+    s32 j;
+
+    for (i = start; i < start + count; i++) {
+        for (j = 0; j < 3; j++, vtx++) {
+            *vtx = gSnowTempVtx[j];
+            vtx->v.ob[0] = gEnvFxArrays.xPos[i] + vertices[j][0];
+            vtx->v.ob[1] = gEnvFxArrays.yPos[i] + vertices[j][1];
+            vtx->v.ob[2] = gEnvFxArrays.zPos[i] + vertices[j][2];
+        }
+    }
+    return vtx;
+}
+
+/**
+ * Write the vertices of all snowflakes to one buffer and draw them, loading
+ * 15 vertices at a time like append_snowflake_vertex_buffer.
+ */
+static Gfx *envfx_append_snowflakes(Gfx *gfx, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
+    s16 *vertices[3];
+    Vtx *vertBuf;
+    Vtx *vtx;
+    s32 count = gSnowParticleCount * gEnvFxDensity;
+    s32 i;
+    s32 j;
+
+    vertBuf = alloc_display_list_category(count * 3 * sizeof(Vtx), GFX_ALLOC_VERTICES);
+    if (vertBuf == NULL) {
+        return gfx;
+    }
+
+    vertices[0] = vertex1;
+    vertices[1] = vertex2;
+    vertices[2] = vertex3;
+    vtx = envfx_write_snowflake_vertices(vertBuf, 0, gSnowParticleCount, vertices);
+    envfx_write_snowflake_vertices(vtx, gSnowParticleMaxCount, count - gSnowParticleCount, vertices);
+
+    for (i = 0; i < count; i += 5) {
+        s32 groupSize = count - i < 5 ? count - i : 5;
+
+        gSPVertex(gfx++, VIRTUAL_TO_PHYSICAL(vertBuf + i * 3), groupSize * 3, 0);
+        for (j = 0; j < groupSize; j++) {
+            gSP1Triangle(gfx++, j * 3, j * 3 + 1, j * 3 + 2, 0);
+        }
+    }
+    return gfx;
+}
+#endif
+
 /**
  * Rotates the input vertices according to the give pitch and yaw. This
  * is needed for billboarding of particles.
@@ -344,7 +629,7 @@ void rotate_triangle_vertices(Vec3s vertex1, Vec3s vertex2, Vec3s vertex3, s16 p
  */
 void append_snowflake_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s vertex2, Vec3s vertex3) {
     s32 i = 0;
-    Vtx *vertBuf = (Vtx *) alloc_display_list(15 * sizeof(Vtx));
+    Vtx *vertBuf = (Vtx *) alloc_display_list_category(15 * sizeof(Vtx), GFX_ALLOC_VERTICES);
 
     if (vertBuf == NULL) {
         return;
@@ -375,7 +660,9 @@ void append_snowflake_vertex_buffer(Gfx *gfx, s32 index, Vec3s vertex1, Vec3s ve
  * drawing all snowflakes.
  */
 Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo) {
+#ifdef TARGET_N64
     s32 i;
+#endif
     s16 radius, pitch, yaw;
     Vec3s snowCylinderPos;
     struct SnowFlakeVertex vertex1, vertex2, vertex3;
@@ -386,7 +673,12 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
     vertex2 = gSnowFlakeVertex2;
     vertex3 = gSnowFlakeVertex3;
 
+#ifdef TARGET_N64
     gfxStart = (Gfx *) alloc_display_list((gSnowParticleCount * 6 + 3) * sizeof(Gfx));
+#else
+    // The flake count is only updated below, so leave room for the maximum
+    gfxStart = (Gfx *) alloc_display_list((gSnowParticleMaxCount * gEnvFxDensity * 6 + 3) * sizeof(Gfx));
+#endif
     gfx = gfxStart;
 
     if (gfxStart == NULL) {
@@ -409,7 +701,11 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
             }
 
             pos_from_orbit(camTo, snowCylinderPos, radius, pitch, yaw);
+#ifdef TARGET_N64
             envfx_update_snow_normal(snowCylinderPos[0], snowCylinderPos[1], snowCylinderPos[2]);
+#else
+            envfx_update_snow_arrays(&sSnowNormalParams, snowCylinderPos[0], snowCylinderPos[1], snowCylinderPos[2]);
+#endif
             break;
 
         case ENVFX_SNOW_WATER:
@@ -420,7 +716,11 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
             }
 
             pos_from_orbit(camTo, snowCylinderPos, radius, pitch, yaw);
+#ifdef TARGET_N64
             envfx_update_snow_water(snowCylinderPos[0], snowCylinderPos[1], snowCylinderPos[2]);
+#else
+            envfx_update_snow_arrays(&sSnowWaterParams, snowCylinderPos[0], snowCylinderPos[1], snowCylinderPos[2]);
+#endif
             break;
         case ENVFX_SNOW_BLIZZARD:
             if (radius > 250) {
@@ -430,7 +730,11 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
             }
 
             pos_from_orbit(camTo, snowCylinderPos, radius, pitch, yaw);
+#ifdef TARGET_N64
             envfx_update_snow_blizzard(snowCylinderPos[0], snowCylinderPos[1], snowCylinderPos[2]);
+#else
+            envfx_update_snow_arrays(&sSnowBlizzardParams, snowCylinderPos[0], snowCylinderPos[1], snowCylinderPos[2]);
+#endif
             break;
     }
 
@@ -442,6 +746,7 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
         gSPDisplayList(gfx++, &tiny_bubble_dl_0B006CD8); // snowflake with blue edge
     }
 
+#ifdef TARGET_N64
     for (i = 0; i < gSnowParticleCount; i += 5) {
         append_snowflake_vertex_buffer(gfx++, i, (s16 *) &vertex1, (s16 *) &vertex2, (s16 *) &vertex3);
 
@@ -451,6 +756,9 @@ Gfx *envfx_update_snow(s32 snowMode, Vec3s marioPos, Vec3s camFrom, Vec3s camTo)
         gSP1Triangle(gfx++, 9, 10, 11, 0);
         gSP1Triangle(gfx++, 12, 13, 14, 0);
     }
+#else
+    gfx = envfx_append_snowflakes(gfx, (s16 *) &vertex1, (s16 *) &vertex2, (s16 *) &vertex3);
+#endif
 
     gSPDisplayList(gfx++, &tiny_bubble_dl_0B006AB0) gSPEndDisplayList(gfx++);
 
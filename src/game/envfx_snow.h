@@ -31,12 +31,47 @@ struct EnvFxParticle {
 extern s8 gEnvFxMode;
 extern UNUSED s32 D_80330644;
 
+#ifndef TARGET_N64
+/**
+ * On PC, particles are stored with one array per field instead of in
+ * EnvFxParticle structs, so that they can be updated several at a time.
+ */
+struct EnvFxParticleArrays {
+    s32 *xPos;
+    s32 *yPos;
+    s32 *zPos;
+    s32 *isAlive; // -1 if the particle is alive, 0 if it needs to respawn
+    s32 *animFrame;
+    s32 *angle; // whirlpool and jet stream bubbles: angle around the source
+    s32 *dist;  // whirlpool and jet stream bubbles: distance from the source
+    s32 *bubbleY;
+    f32 *scratch[3]; // random numbers and sines of the current update
+};
+#endif
+
 extern struct EnvFxParticle *gEnvFxBuffer;
 extern Vec3i gSnowCylinderLastPos;
 extern s16 gSnowParticleCount;
 
+#ifndef TARGET_N64
+extern struct EnvFxParticleArrays gEnvFxArrays;
+
+/**
+ * Number of particles drawn for each particle of the original game. The
+ * first particles of an effect use the game's random numbers, exactly like
+ * in the original game, while the extra ones draw from their own seed, so
+ * the density doesn't change the simulation.
+ */
+extern s32 gEnvFxDensity;
+#endif
+
 Gfx *envfx_update_particles(s32 snowMode, Vec3s marioPos, Vec3s camTo, Vec3s camFrom);
 void orbit_from_positions(Vec3s from, Vec3s to, s16 *radius, s16 *pitch, s16 *yaw);
 void rotate_triangle_vertices(Vec3s vertex1, Vec3s vertex2, Vec3s vertex3, s16 pitch, s16 yaw);
+#ifndef TARGET_N64
+void *envfx_alloc_particle_arrays(s32 count);
+u16 envfx_random_u16(s32 gameRandom);
+f32 envfx_random_float(s32 gameRandom);
+#endif
 
 #endif // ENVFX_SNOW_H
@@ -0,0 +1,454 @@
+#include <PR/ultratypes.h>
+#include <math.h>
+
+#include "sm64.h"
+#include "engine/math_util.h"
+#include "frame_interp.h"
+#include "skybox.h"
+
+/**
+ * @file frame_interp.c
+ * Renders intermediate frames between two game ticks without running the
+ * game logic again. While the scene graph is processed, every modelview
+ * matrix written for the camera, objects and their parts is recorded together
+ * with the scene graph node that produced it. Before each intermediate frame
+ * is drawn, the matrices in the retained display list are overwritten with an
+ * interpolation between the previous tick's and the current tick's values:
+ * translation and scale are lerped, rotation is slerped. The field of view of
+ * the perspective projection is lerped, and the skybox is redrawn for a
+ * camera position and focus lerped between the two ticks.
+ *
+ * The last intermediate frame (t = 1) restores the current tick's matrices,
+ * so the display lags at most one tick behind the simulation.
+ */
+
+#define FRAME_INTERP_MAX_MATRICES 2048
+
+// Power of two, larger than FRAME_INTERP_MAX_MATRICES to keep probing short
+#define FRAME_INTERP_LOOKUP_SIZE 4096
+
+// Perspective and skybox nodes, one per view
+#define FRAME_INTERP_MAX_VIEWS 2
+
+// Something that moved further than this in world space between two ticks is
+// assumed to have warped, and is not interpolated
+#define FRAME_INTERP_MAX_DISTANCE 1000.0f
+
+struct InterpMatrix {
+    void *node;
+    void *context;
+    Mtx *mtx;
+    Mat4 value;
+    Vec3f worldPos;
+};
+
+struct InterpPerspective {
+    void *node;
+    Mtx *mtx;
+    f32 fov;
+    f32 aspect;
+    f32 near;
+    f32 far;
+};
+
+struct InterpSkybox {
+    void *node;
+    Gfx *gfx;
+    s8 player;
+    s8 background;
+    f32 fov;
+    Vec3f pos;
+    Vec3f focus;
+};
+
+struct InterpMatrixList {
+    struct InterpMatrix matrices[FRAME_INTERP_MAX_MATRICES];
+    s32 count;
+    s16 lookup[FRAME_INTERP_LOOKUP_SIZE];
+    struct InterpPerspective perspectives[FRAME_INTERP_MAX_VIEWS];
+    s32 numPerspectives;
+    struct InterpSkybox skyboxes[FRAME_INTERP_MAX_VIEWS];
+    s32 numSkyboxes;
+};
+
+s32 gFrameInterpFramesPerTick = 1;
+
+static struct InterpMatrixList sInterpLists[2];
+static struct InterpMatrixList *sPrevList = &sInterpLists[0];
+static struct InterpMatrixList *sCurList = &sInterpLists[1];
+
+static u32 frame_interp_hash(void *node, void *context) {
+    return ((u32) ((uintptr_t) node >> 3) * 2654435761U) ^ ((u32) ((uintptr_t) context >> 3) * 40503U);
+}
+
+static struct InterpMatrix *frame_interp_find_prev(void *node, void *context) {
+    u32 slot = frame_interp_hash(node, context) & (FRAME_INTERP_LOOKUP_SIZE - 1);
+
+    // The lookup table is only initialized once something was recorded
+    if (sPrevList->count == 0) {
+        return NULL;
+    }
+
+    while (sPrevList->lookup[slot] >= 0) {
+        struct InterpMatrix *entry = &sPrevList->matrices[sPrevList->lookup[slot]];
+
+        if (entry->node == node && entry->context == context) {
+            return entry;
+        }
+        slot = (slot + 1) & (FRAME_INTERP_LOOKUP_SIZE - 1);
+    }
+    return NULL;
+}
+
+/**
+ * Start recording a new game tick. The matrices of the last tick become the
+ * starting point of the interpolation.
+ */
+void frame_interp_begin_tick(void) {
+    struct InterpMatrixList *swap = sPrevList;
+    s32 i;
+
+    sPrevList = sCurList;
+    sCurList = swap;
+
+    sCurList->count = 0;
+    sCurList->numPerspectives = 0;
+    sCurList->numSkyboxes = 0;
+
+    // Nothing is recorded without intermediate frames, and an empty list is
+    // never looked up
+    if (gFrameInterpFramesPerTick <= 1) {
+        return;
+    }
+    for (i = 0; i < FRAME_INTERP_LOOKUP_SIZE; i++) {
+        sCurList->lookup[i] = -1;
+    }
+}
+
+/**
+ * Record a modelview matrix written to the display list. The node and context
+ * identify the matrix across ticks: the node alone isn't enough since the
+ * geo layouts of objects are shared. worldPos is the world space position of
+ * the matrix's origin, which decides whether it warped.
+ */
+void frame_interp_record_mtx(void *node, void *context, Mtx *mtx, Mat4 src, Vec3f worldPos) {
+    struct InterpMatrix *entry;
+    u32 slot;
+
+    if (gFrameInterpFramesPerTick <= 1 || sCurList->count >= FRAME_INTERP_MAX_MATRICES) {
+        return;
+    }
+
+    entry = &sCurList->matrices[sCurList->count];
+    entry->node = node;
+    entry->context = context;
+    entry->mtx = mtx;
+    mtxf_copy(entry->value, src);
+    vec3f_copy(entry->worldPos, worldPos);
+
+    // If a node is drawn twice in the same context, the first one is matched
+    slot = frame_interp_hash(node, context) & (FRAME_INTERP_LOOKUP_SIZE - 1);
+    while (sCurList->lookup[slot] >= 0) {
+        slot = (slot + 1) & (FRAME_INTERP_LOOKUP_SIZE - 1);
+    }
+    sCurList->lookup[slot] = sCurList->count;
+    sCurList->count++;
+}
+
+/**
+ * Record a perspective projection written to the display list, so that its
+ * field of view can be interpolated.
+ */
+void frame_interp_record_perspective(void *node, Mtx *mtx, f32 fov, f32 aspect, f32 near, f32 far) {
+    struct InterpPerspective *entry;
+
+    if (gFrameInterpFramesPerTick <= 1 || sCurList->numPerspectives >= FRAME_INTERP_MAX_VIEWS) {
+        return;
+    }
+
+    entry = &sCurList->perspectives[sCurList->numPerspectives++];
+    entry->node = node;
+    entry->mtx = mtx;
+    entry->fov = fov;
+    entry->aspect = aspect;
+    entry->near = near;
+    entry->far = far;
+}
+
+/**
+ * Record a skybox made by create_skybox_facing_camera, so that it can be
+ * redrawn for the camera's interpolated direction.
+ */
+void frame_interp_record_skybox(void *node, Gfx *gfx, s8 player, s8 background, f32 fov,
+                                Vec3f pos, Vec3f focus) {
+    struct InterpSkybox *entry;
+
+    if (gFrameInterpFramesPerTick <= 1 || gfx == NULL || sCurList->numSkyboxes >= FRAME_INTERP_MAX_VIEWS) {
+        return;
+    }
+
+    entry = &sCurList->skyboxes[sCurList->numSkyboxes++];
+    entry->node = node;
+    entry->gfx = gfx;
+    entry->player = player;
+    entry->background = background;
+    entry->fov = fov;
+    vec3f_copy(entry->pos, pos);
+    vec3f_copy(entry->focus, focus);
+}
+
+static struct InterpPerspective *frame_interp_find_prev_perspective(void *node) {
+    s32 i;
+
+    for (i = 0; i < sPrevList->numPerspectives; i++) {
+        if (sPrevList->perspectives[i].node == node) {
+            return &sPrevList->perspectives[i];
+        }
+    }
+    return NULL;
+}
+
+static struct InterpSkybox *frame_interp_find_prev_skybox(void *node) {
+    s32 i;
+
+    for (i = 0; i < sPrevList->numSkyboxes; i++) {
+        if (sPrevList->skyboxes[i].node == node) {
+            return &sPrevList->skyboxes[i];
+        }
+    }
+    return NULL;
+}
+
+static s32 frame_interp_warped(Vec3f a, Vec3f b) {
+    f32 dx = b[0] - a[0];
+    f32 dy = b[1] - a[1];
+    f32 dz = b[2] - a[2];
+
+    return dx * dx + dy * dy + dz * dz > FRAME_INTERP_MAX_DISTANCE * FRAME_INTERP_MAX_DISTANCE;
+}
+
+static void frame_interp_vec3f(Vec3f dest, Vec3f a, Vec3f b, f32 t) {
+    dest[0] = a[0] + (b[0] - a[0]) * t;
+    dest[1] = a[1] + (b[1] - a[1]) * t;
+    dest[2] = a[2] + (b[2] - a[2]) * t;
+}
+
+static void frame_interp_apply_views(f32 t) {
+    struct InterpPerspective *curPersp;
+    struct InterpPerspective *prevPersp;
+    struct InterpSkybox *curSky;
+    struct InterpSkybox *prevSky;
+    Vec3f pos;
+    Vec3f focus;
+    u16 perspNorm;
+    f32 fov;
+    s32 i;
+
+    for (i = 0; i < sCurList->numPerspectives; i++) {
+        curPersp = &sCurList->perspectives[i];
+        prevPersp = frame_interp_find_prev_perspective(curPersp->node);
+
+        fov = curPersp->fov;
+        if (t < 1.0f && prevPersp != NULL) {
+            fov = prevPersp->fov + (curPersp->fov - prevPersp->fov) * t;
+        }
+        // The near and far planes, and so perspNorm, are the same as this tick's
+        guPerspective(curPersp->mtx, &perspNorm, fov, curPersp->aspect, curPersp->near, curPersp->far,
+                      1.0f);
+    }
+
+    for (i = 0; i < sCurList->numSkyboxes; i++) {
+        curSky = &sCurList->skyboxes[i];
+        prevSky = frame_interp_find_prev_skybox(curSky->node);
+
+        if (t < 1.0f && prevSky != NULL && !frame_interp_warped(prevSky->pos, curSky->pos)) {
+            frame_interp_vec3f(pos, prevSky->pos, curSky->pos, t);
+            frame_interp_vec3f(focus, prevSky->focus, curSky->focus, t);
+        } else {
+            vec3f_copy(pos, curSky->pos);
+            vec3f_copy(focus, curSky->focus);
+        }
+        redraw_skybox_facing_camera(curSky->gfx, curSky->player, curSky->background, curSky->fov,
+                                    pos[0], pos[1], pos[2], focus[0], focus[1], focus[2]);
+    }
+}
+
+/**
+ * Convert the rotation part of a matrix with normalized rows to a quaternion.
+ */
+static void frame_interp_mtx_to_quat(f32 q[4], f32 m[3][3]) {
+    f32 trace = m[0][0] + m[1][1] + m[2][2];
+    f32 s;
+
+    if (trace > 0.0f) {
+        s = sqrtf(trace + 1.0f) * 2.0f;
+        q[0] = 0.25f * s;
+        q[1] = (m[2][1] - m[1][2]) / s;
+        q[2] = (m[0][2] - m[2][0]) / s;
+        q[3] = (m[1][0] - m[0][1]) / s;
+    } else if (m[0][0] > m[1][1] && m[0][0] > m[2][2]) {
+        s = sqrtf(1.0f + m[0][0] - m[1][1] - m[2][2]) * 2.0f;
+        q[0] = (m[2][1] - m[1][2]) / s;
+        q[1] = 0.25f * s;
+        q[2] = (m[0][1] + m[1][0]) / s;
+        q[3] = (m[0][2] + m[2][0]) / s;
+    } else if (m[1][1] > m[2][2]) {
+        s = sqrtf(1.0f + m[1][1] - m[0][0] - m[2][2]) * 2.0f;
+        q[0] = (m[0][2] - m[2][0]) / s;
+        q[1] = (m[0][1] + m[1][0]) / s;
+        q[2] = 0.25f * s;
+        q[3] = (m[1][2] + m[2][1]) / s;
+    } else {
+        s = sqrtf(1.0f + m[2][2] - m[0][0] - m[1][1]) * 2.0f;
+        q[0] = (m[1][0] - m[0][1]) / s;
+        q[1] = (m[0][2] + m[2][0]) / s;
+        q[2] = (m[1][2] + m[2][1]) / s;
+        q[3] = 0.25f * s;
+    }
+}
+
+static void frame_interp_quat_to_mtx(f32 m[3][3], f32 q[4]) {
+    f32 w = q[0];
+    f32 x = q[1];
+    f32 y = q[2];
+    f32 z = q[3];
+
+    m[0][0] = 1.0f - 2.0f * (y * y + z * z);
+    m[0][1] = 2.0f * (x * y - z * w);
+    m[0][2] = 2.0f * (x * z + y * w);
+    m[1][0] = 2.0f * (x * y + z * w);
+    m[1][1] = 1.0f - 2.0f * (x * x + z * z);
+    m[1][2] = 2.0f * (y * z - x * w);
+    m[2][0] = 2.0f * (x * z - y * w);
+    m[2][1] = 2.0f * (y * z + x * w);
+    m[2][2] = 1.0f - 2.0f * (x * x + y * y);
+}
+
+/**
+ * Split a matrix into a rotation with normalized rows and a per-row scale.
+ * Return FALSE if the matrix is degenerate or mirrored, since those can't be
+ * represented by a quaternion.
+ */
+static s32 frame_interp_decompose(f32 rot[3][3], Vec3f scale, Mat4 src) {
+    s32 i;
+    s32 j;
+    f32 det;
+
+    for (i = 0; i < 3; i++) {
+        scale[i] = sqrtf(src[i][0] * src[i][0] + src[i][1] * src[i][1] + src[i][2] * src[i][2]);
+        if (scale[i] < 0.0001f) {
+            return FALSE;
+        }
+        for (j = 0; j < 3; j++) {
+            rot[i][j] = src[i][j] / scale[i];
+        }
+    }
+
+    det = rot[0][0] * (rot[1][1] * rot[2][2] - rot[1][2] * rot[2][1])
+          - rot[0][1] * (rot[1][0] * rot[2][2] - rot[1][2] * rot[2][0])
+          + rot[0][2] * (rot[1][0] * rot[2][1] - rot[1][1] * rot[2][0]);
+    return det > 0.0f;
+}
+
+static void frame_interp_mtxf(Mat4 dest, Mat4 a, Mat4 b, f32 t) {
+    f32 rotA[3][3];
+    f32 rotB[3][3];
+    f32 rot[3][3];
+    Vec3f scaleA;
+    Vec3f scaleB;
+    f32 qa[4];
+    f32 qb[4];
+    f32 q[4];
+    f32 dot;
+    f32 len;
+    f32 s;
+    s32 i;
+    s32 j;
+
+    // The translation row and the w column are always lerped
+    for (i = 0; i < 4; i++) {
+        dest[3][i] = a[3][i] + (b[3][i] - a[3][i]) * t;
+        dest[i][3] = a[i][3] + (b[i][3] - a[i][3]) * t;
+    }
+
+    if (!frame_interp_decompose(rotA, scaleA, a) || !frame_interp_decompose(rotB, scaleB, b)) {
+        for (i = 0; i < 3; i++) {
+            for (j = 0; j < 3; j++) {
+                dest[i][j] = a[i][j] + (b[i][j] - a[i][j]) * t;
+            }
+        }
+        return;
+    }
+
+    frame_interp_mtx_to_quat(qa, rotA);
+    frame_interp_mtx_to_quat(qb, rotB);
+
+    // Take the shortest path
+    dot = qa[0] * qb[0] + qa[1] * qb[1] + qa[2] * qb[2] + qa[3] * qb[3];
+    if (dot < 0.0f) {
+        for (i = 0; i < 4; i++) {
+            qb[i] = -qb[i];
+        }
+        dot = -dot;
+    }
+
+    if (dot > 0.9995f) {
+        // Nearly identical, normalized lerp is accurate enough
+        for (i = 0; i < 4; i++) {
+            q[i] = qa[i] + (qb[i] - qa[i]) * t;
+        }
+    } else {
+        f32 theta = acosf(dot);
+        f32 sinTheta = sinf(theta);
+        f32 wa = sinf((1.0f - t) * theta) / sinTheta;
+        f32 wb = sinf(t * theta) / sinTheta;
+
+        for (i = 0; i < 4; i++) {
+            q[i] = qa[i] * wa + qb[i] * wb;
+        }
+    }
+
+    len = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+    for (i = 0; i < 4; i++) {
+        q[i] /= len;
+    }
+    frame_interp_quat_to_mtx(rot, q);
+
+    for (i = 0; i < 3; i++) {
+        s = scaleA[i] + (scaleB[i] - scaleA[i]) * t;
+        for (j = 0; j < 3; j++) {
+            dest[i][j] = rot[i][j] * s;
+        }
+    }
+}
+
+/**
+ * Overwrite the recorded matrices of the current tick with the state at t,
+ * where 0 is the previous tick and 1 is the current tick.
+ */
+void frame_interp_apply(f32 t) {
+    struct InterpMatrix *cur;
+    struct InterpMatrix *prev;
+    Mat4 mtxf;
+    s32 i;
+
+    frame_interp_apply_views(t);
+
+    for (i = 0; i < sCurList->count; i++) {
+        cur = &sCurList->matrices[i];
+        prev = frame_interp_find_prev(cur->node, cur->context);
+
+        if (t >= 1.0f || prev == NULL) {
+            mtxf_to_mtx(cur->mtx, cur->value);
+            continue;
+        }
+
+        if (frame_interp_warped(prev->worldPos, cur->worldPos)) {
+            mtxf_to_mtx(cur->mtx, cur->value);
+            continue;
+        }
+
+        frame_interp_mtxf(mtxf, prev->value, cur->value, t);
+        mtxf_to_mtx(cur->mtx, mtxf);
+    }
+}
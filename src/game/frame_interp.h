@@ -0,0 +1,21 @@
+#ifndef FRAME_INTERP_H
+#define FRAME_INTERP_H
+
+#include <PR/ultratypes.h>
+#include <PR/gbi.h>
+
+#include "types.h"
+
+/**
+ * Number of frames rendered for every game tick. 1 disables interpolation.
+ */
+extern s32 gFrameInterpFramesPerTick;
+
+void frame_interp_begin_tick(void);
+void frame_interp_record_mtx(void *node, void *context, Mtx *mtx, Mat4 src, Vec3f worldPos);
+void frame_interp_record_perspective(void *node, Mtx *mtx, f32 fov, f32 aspect, f32 near, f32 far);
+void frame_interp_record_skybox(void *node, Gfx *gfx, s8 player, s8 background, f32 fov,
+                                Vec3f pos, Vec3f focus);
+void frame_interp_apply(f32 t);
+
+#endif // FRAME_INTERP_H
@@ -15,6 +15,7 @@
 #include "save_file.h"
 #include "seq_ids.h"
 #include "sound_init.h"
+#include "state_hash.h"
 #include "print.h"
 #include "segment2.h"
 #include "segment_symbols.h"
@@ -356,7 +357,7 @@ void render_init(void) {
 #ifdef USE_SYSTEM_MALLOC
 Gfx **alloc_next_dl(void) {
     u32 size = 1000;
-    Gfx *new_chunk = alloc_only_pool_alloc(gGfxAllocOnlyPool, size * sizeof(Gfx));
+    Gfx *new_chunk = alloc_display_list_category(size * sizeof(Gfx), GFX_ALLOC_COMMANDS);
     gSPBranchList(gDisplayListHeadInChunk++, new_chunk);
     gDisplayListHeadInChunk = new_chunk;
     gDisplayListEndInChunk = new_chunk + size;
@@ -374,7 +375,10 @@ void select_gfx_pool(void) {
 #ifdef USE_SYSTEM_MALLOC
     gDisplayListHeadInChunk = gGfxPool->buffer;
     gDisplayListEndInChunk = gDisplayListHeadInChunk + 1;
-    alloc_only_pool_clear(gGfxAllocOnlyPool);
+    // The memory of the last frame that used this pool is reused as-is
+    gGfxAllocOnlyPool = gGfxPool->allocOnlyPool;
+    alloc_display_list_reset();
+    frame_pool_begin_frame();
 #else
     gDisplayListHead = gGfxPool->buffer;
     gGfxPoolEnd = (u8 *) (gGfxPool->buffer + GFX_POOL_SIZE);
@@ -730,6 +734,9 @@ void game_loop_one_iteration(void) {
         select_gfx_pool();
         read_controller_inputs();
         levelCommandAddr = level_script_execute(levelCommandAddr);
+#ifndef TARGET_N64
+        state_hash_frame();
+#endif
 
         display_and_vsync();
 
@@ -18,6 +18,10 @@
 struct GfxPool {
     Gfx buffer[GFX_POOL_SIZE];
     struct SPTask spTask;
+#ifdef USE_SYSTEM_MALLOC
+    // Backing memory of the display lists, matrices and vertices built in this pool
+    struct AllocOnlyPool *allocOnlyPool;
+#endif
 };
 
 struct DemoInput
@@ -7,6 +7,7 @@
 #include "engine/math_util.h"
 #include "camera.h"
 #include "envfx_snow.h"
+#include "frame_interp.h"
 #include "level_geo.h"
 
 /**
@@ -73,6 +74,10 @@ Gfx *geo_skybox_main(s32 callContext, struct GraphNode *node, UNUSED Mat4 *mtx)
         gfx = create_skybox_facing_camera(0, backgroundNode->background, camFrustum->fov, gLakituState.pos[0],
                             gLakituState.pos[1], gLakituState.pos[2], gLakituState.focus[0],
                             gLakituState.focus[1], gLakituState.focus[2]);
+#ifndef TARGET_N64
+        frame_interp_record_skybox(node, gfx, 0, backgroundNode->background, camFrustum->fov,
+                                   gLakituState.pos, gLakituState.focus);
+#endif
     }
 
     return gfx;
@@ -28,6 +28,9 @@
 #include "level_table.h"
 #include "course_table.h"
 #include "rumble_init.h"
+#ifndef TARGET_N64
+#include "pc/level_prefetch.h"
+#endif
 
 #define PLAY_MODE_NORMAL 0
 #define PLAY_MODE_PAUSED 2
@@ -634,6 +637,12 @@ void initiate_warp(s16 destLevel, s16 destArea, s16 destWarpNode, s32 arg3) {
     sWarpDest.areaIdx = destArea;
     sWarpDest.nodeId = destWarpNode;
     sWarpDest.arg = arg3;
+
+#ifndef TARGET_N64
+    if (sWarpDest.type == WARP_TYPE_CHANGE_LEVEL) {
+        level_prefetch_start(destLevel);
+    }
+#endif
 }
 
 // From Surface 0xD3 to 0xFC
@@ -698,6 +707,35 @@ void initiate_painting_warp(void) {
     }
 }
 
+#ifndef TARGET_N64
+/**
+ * Start decoding the textures of the level that the delayed warp leads to, so
+ * that they are ready when its fade ends. The warps that don't go through a
+ * warp node of the area start their prefetch in initiate_warp.
+ */
+static void prefetch_delayed_warp_level(void) {
+    struct ObjectWarpNode *warpNode;
+
+    if ((gDebugLevelSelect && (sDelayedWarpOp & WARP_OP_TRIGGERS_LEVEL_SELECT))
+        || gCurrDemoInput != NULL) {
+        return;
+    }
+    switch (sDelayedWarpOp) {
+        case WARP_OP_GAME_OVER:
+        case WARP_OP_CREDITS_END:
+        case WARP_OP_DEMO_NEXT:
+        case WARP_OP_CREDITS_START:
+        case WARP_OP_CREDITS_NEXT:
+            return;
+    }
+
+    warpNode = area_get_warp_node(sSourceWarpNodeId);
+    if (warpNode != NULL && (warpNode->node.destLevel & 0x7F) != gCurrLevelNum) {
+        level_prefetch_start(warpNode->node.destLevel & 0x7F);
+    }
+}
+#endif
+
 /**
  * If there is not already a delayed warp, schedule one. The source node is
  * based on the warp operation and sometimes Mario's used object.
@@ -815,6 +853,9 @@ s16 level_trigger_warp(struct MarioState *m, s32 warpOp) {
         if (val04 && gCurrDemoInput == NULL) {
             fadeout_music((3 * sDelayedWarpTimer / 2) * 8 - 2);
         }
+#ifndef TARGET_N64
+        prefetch_delayed_warp_level();
+#endif
     }
 
     return sDelayedWarpTimer;
@@ -4,6 +4,7 @@
 #include "object_helpers.h"
 #include "macro_special_objects.h"
 #include "object_list_processor.h"
+#include "spawn_object.h"
 
 #include "behavior_data.h"
 
@@ -98,6 +99,58 @@ struct LoadedPreset {
     /*0x06*/ s16 model;
 };
 
+#ifndef TARGET_N64
+/**
+ * Count the objects in a macro object list, including the ones that won't
+ * respawn.
+ */
+static s32 count_macro_objects(s16 *macroObjList) {
+    s32 count = 0;
+
+    while (*macroObjList != -1 && (*macroObjList & 0x1FF) - 31 >= 0) {
+        macroObjList += 5;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Count the objects in a hardcoded macro object list.
+ */
+static s32 count_macro_objects_hardcoded(s16 *macroObjList) {
+    s32 count = 0;
+
+    while (*macroObjList >= 0) {
+        macroObjList += 5;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * Return the index of the first SpecialObjectPresets entry for presetID,
+ * from a table that is built on the first call instead of searching the
+ * presets for every object. An unknown preset, which the search would run
+ * past the end of the presets for, gets the last entry, which spawns nothing.
+ */
+static s32 find_special_preset(u8 presetID) {
+    static s16 sPresetIndices[256];
+    static s32 sPresetIndicesBuilt = FALSE;
+    s32 i;
+
+    if (!sPresetIndicesBuilt) {
+        for (i = 0; i < 256; i++) {
+            sPresetIndices[i] = ARRAY_COUNT(SpecialObjectPresets) - 1;
+        }
+        for (i = ARRAY_COUNT(SpecialObjectPresets) - 1; i >= 0; i--) {
+            sPresetIndices[SpecialObjectPresets[i].preset_id] = i;
+        }
+        sPresetIndicesBuilt = TRUE;
+    }
+    return sPresetIndices[presetID];
+}
+#endif
+
 #define MACRO_OBJ_Y_ROT 0
 #define MACRO_OBJ_X 1
 #define MACRO_OBJ_Y 2
@@ -115,6 +168,9 @@ void spawn_macro_objects(s16 areaIndex, s16 *macroObjList) {
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+#ifndef TARGET_N64
+    begin_object_spawn_batch(count_macro_objects(macroObjList));
+#endif
     while (TRUE) {
         if (*macroObjList == -1) { // An encountered value of -1 means the list has ended.
             break;
@@ -169,6 +225,9 @@ void spawn_macro_objects(s16 areaIndex, s16 *macroObjList) {
             newObj->parentObj = newObj;
         }
     }
+#ifndef TARGET_N64
+    end_object_spawn_batch();
+#endif
 }
 
 void spawn_macro_objects_hardcoded(s16 areaIndex, s16 *macroObjList) {
@@ -187,6 +246,9 @@ void spawn_macro_objects_hardcoded(s16 areaIndex, s16 *macroObjList) {
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+#ifndef TARGET_N64
+    begin_object_spawn_batch(count_macro_objects_hardcoded(macroObjList));
+#endif
     while (TRUE) {
         macroObjPreset = *macroObjList++;
 
@@ -235,6 +297,9 @@ void spawn_macro_objects_hardcoded(s16 areaIndex, s16 *macroObjList) {
                 break;
         }
     }
+#ifndef TARGET_N64
+    end_object_spawn_batch();
+#endif
 }
 
 void spawn_special_objects(s16 areaIndex, s16 **specialObjList) {
@@ -257,6 +322,9 @@ void spawn_special_objects(s16 areaIndex, s16 **specialObjList) {
     gMacroObjectDefaultParent.header.gfx.areaIndex = areaIndex;
     gMacroObjectDefaultParent.header.gfx.activeAreaIndex = areaIndex;
 
+#ifndef TARGET_N64
+    begin_object_spawn_batch(numOfSpecialObjects);
+#endif
     for (i = 0; i < numOfSpecialObjects; i++) {
         presetID = (u8) **specialObjList;
         (*specialObjList)++;
@@ -267,6 +335,9 @@ void spawn_special_objects(s16 areaIndex, s16 **specialObjList) {
         z = **specialObjList;
         (*specialObjList)++;
 
+#ifndef TARGET_N64
+        offset = find_special_preset(presetID);
+#else
         offset = 0;
         while (TRUE) {
             if (SpecialObjectPresets[offset].preset_id == presetID) {
@@ -278,6 +349,7 @@ void spawn_special_objects(s16 areaIndex, s16 **specialObjList) {
 
             offset++;
         }
+#endif
 
         model = SpecialObjectPresets[offset].model;
         behavior = SpecialObjectPresets[offset].behavior;
@@ -322,6 +394,9 @@ void spawn_special_objects(s16 areaIndex, s16 **specialObjList) {
                 break;
         }
     }
+#ifndef TARGET_N64
+    end_object_spawn_batch();
+#endif
 }
 
 #ifdef NO_SEGMENTED_MEMORY
@@ -337,6 +412,9 @@ u32 get_special_objects_size(s16 *data) {
     for (i = 0; i < numOfSpecialObjects; i++) {
         presetID = (u8) *data++;
         data += 3;
+#ifndef TARGET_N64
+        offset = find_special_preset(presetID);
+#else
         offset = 0;
 
         while (TRUE) {
@@ -345,6 +423,7 @@ u32 get_special_objects_size(s16 *data) {
             }
             offset++;
         }
+#endif
 
         switch (SpecialObjectPresets[offset].type) {
             case SPTYPE_NO_YROT_OR_PARAMS:
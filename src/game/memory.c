@@ -38,21 +38,45 @@ struct MainPoolBlock {
     struct MainPoolBlock *next;
 #ifdef USE_SYSTEM_MALLOC
     void (*releaseHandler)(void *addr);
+    struct MainPoolChunk *chunk;
+    u32 size;
 #endif
 };
 
 #ifdef USE_SYSTEM_MALLOC
+/**
+ * A large region of memory that main pool blocks are bump allocated from.
+ * Since main pool blocks are freed in reverse allocation order, freeing only
+ * has to move the bump position back.
+ */
+struct MainPoolChunk {
+    struct MainPoolChunk *prev;
+    u32 size;
+    u32 pos;
+};
+
+#define MAIN_POOL_CHUNK_SIZE (4 * 1024 * 1024)
+#define MAIN_POOL_CHUNK_HEADER_SIZE ALIGN16(sizeof(struct MainPoolChunk))
+#define MAIN_POOL_BLOCK_HEADER_SIZE ALIGN16(sizeof(struct MainPoolBlock))
+#define MAIN_POOL_CHUNK_DATA(chunk) ((u8 *) (chunk) + MAIN_POOL_CHUNK_HEADER_SIZE)
+#define MAIN_POOL_BLOCK_DATA(block) ((void *) ((u8 *) (block) + MAIN_POOL_BLOCK_HEADER_SIZE))
+#define MAIN_POOL_DATA_BLOCK(addr) ((struct MainPoolBlock *) ((u8 *) (addr) - MAIN_POOL_BLOCK_HEADER_SIZE))
+
+// Fill patterns of MEMORY_POOL_POISON builds
+#define POISON_ALLOCATED 0xCD
+#define POISON_FREED 0xDD
+
 struct AllocOnlyPoolBlock {
     struct AllocOnlyPoolBlock *prev;
-#if !IS_64_BIT
-    void *pad; // require 8 bytes alignment
-#endif
+    u32 size; // also keeps the data 8 bytes aligned on 32-bit
 };
 
 struct AllocOnlyPool {
     struct AllocOnlyPoolBlock *lastBlock;
     u32 lastBlockSize;
     u32 lastBlockNextPos;
+    u32 usedSpace;
+    u32 peakSpace;
 };
 
 struct FreeListNode {
@@ -74,6 +98,7 @@ struct MemoryPool {
 #ifdef USE_SYSTEM_MALLOC
     struct AllocOnlyPool *allocOnlyPool;
     struct FreeListNode *bins[27];
+    u32 liveBytes;
 #else
     u32 totalSpace;
     struct MemoryBlock *firstBlock;
@@ -102,6 +127,23 @@ u8 *sPoolEnd;
 struct MainPoolBlock *sPoolListHeadL;
 struct MainPoolBlock *sPoolListHeadR;
 
+#ifdef USE_SYSTEM_MALLOC
+static struct GfxAllocStats sGfxAllocStats;
+static struct MemoryStats sMemoryStats;
+static struct FramePoolStats sFramePoolStats;
+
+// Allocations from the frame pools live until FRAME_POOL_COUNT frames have
+// started, so data allocated after a frame was drawn is still valid while
+// the next one is built
+#define FRAME_POOL_COUNT 2
+static struct AllocOnlyPool *sFramePools[FRAME_POOL_COUNT];
+static s32 sFramePoolIndex = 0;
+
+static struct MainPoolChunk *sMainPoolChunk = NULL;
+// The most recently emptied chunk, kept to not reallocate it when the pool
+// repeatedly crosses a chunk boundary
+static struct MainPoolChunk *sMainPoolSpareChunk = NULL;
+#endif
 
 static struct MainPoolState *gMainPoolState = NULL;
 
@@ -151,8 +193,12 @@ void move_segment_table_to_dmem(void) {
 #ifdef USE_SYSTEM_MALLOC
 static void main_pool_free_all(void) {
     while (sPoolListHeadL != NULL) {
-        main_pool_free(sPoolListHeadL + 1);
+        main_pool_free(MAIN_POOL_BLOCK_DATA(sPoolListHeadL));
     }
+    free(sMainPoolChunk);
+    free(sMainPoolSpareChunk);
+    sMainPoolChunk = NULL;
+    sMainPoolSpareChunk = NULL;
 }
 
 void main_pool_init(void) {
@@ -180,38 +226,113 @@ void main_pool_init(void *start, void *end) {
 #endif
 
 #ifdef USE_SYSTEM_MALLOC
-void *main_pool_alloc(u32 size, void (*releaseHandler)(void *addr)) {
-    struct MainPoolBlock *newListHead = (struct MainPoolBlock *) malloc(sizeof(struct MainPoolBlock) + size);
-    if (newListHead == NULL) {
-        abort();
+static void memory_stats_alloc(struct MemoryPoolStats *stats, u32 size) {
+    stats->liveBytes += size;
+    if (stats->liveBytes > stats->peakBytes) {
+        stats->peakBytes = stats->liveBytes;
     }
+    stats->numAllocs++;
+}
+
+static void memory_stats_free(struct MemoryPoolStats *stats, u32 size) {
+    stats->liveBytes -= size;
+    stats->numFrees++;
+}
+
+/**
+ * Make sure the current chunk has room for size bytes.
+ */
+static void main_pool_reserve(u32 size) {
+    struct MainPoolChunk *chunk;
+    u32 chunkSize;
+
+    if (sMainPoolChunk != NULL && sMainPoolChunk->size - sMainPoolChunk->pos >= size) {
+        return;
+    }
+
+    chunk = sMainPoolSpareChunk;
+    sMainPoolSpareChunk = NULL;
+    if (chunk == NULL || chunk->size < size) {
+        if (chunk != NULL) {
+            sMemoryStats.reservedBytes -= chunk->size;
+            free(chunk);
+        }
+        chunkSize = size > MAIN_POOL_CHUNK_SIZE ? size : MAIN_POOL_CHUNK_SIZE;
+        chunk = (struct MainPoolChunk *) malloc(MAIN_POOL_CHUNK_HEADER_SIZE + chunkSize);
+        if (chunk == NULL) {
+            abort();
+        }
+        chunk->size = chunkSize;
+        sMemoryStats.reservedBytes += chunkSize;
+    }
+    chunk->pos = 0;
+    chunk->prev = sMainPoolChunk;
+    sMainPoolChunk = chunk;
+}
+
+void *main_pool_alloc(u32 size, void (*releaseHandler)(void *addr)) {
+    u32 blockSize = MAIN_POOL_BLOCK_HEADER_SIZE + ALIGN16(size);
+    struct MainPoolBlock *newListHead;
+
+    main_pool_reserve(blockSize);
+    newListHead = (struct MainPoolBlock *) (MAIN_POOL_CHUNK_DATA(sMainPoolChunk) + sMainPoolChunk->pos);
+    sMainPoolChunk->pos += blockSize;
+
     if (sPoolListHeadL != NULL) {
         sPoolListHeadL->next = newListHead;
     }
     newListHead->prev = sPoolListHeadL;
     newListHead->next = NULL;
     newListHead->releaseHandler = releaseHandler;
+    newListHead->chunk = sMainPoolChunk;
+    newListHead->size = size;
     sPoolListHeadL = newListHead;
-    return newListHead + 1;
+
+    memory_stats_alloc(&sMemoryStats.mainPool, size);
+#ifdef MEMORY_POOL_POISON
+    memset(MAIN_POOL_BLOCK_DATA(newListHead), POISON_ALLOCATED, size);
+#endif
+    return MAIN_POOL_BLOCK_DATA(newListHead);
 }
 
+/**
+ * Free a block and all blocks that were allocated after it. Their release
+ * handlers are called in reverse allocation order, then the memory is
+ * returned to the chunks at once.
+ */
 u32 main_pool_free(void *addr) {
-    struct MainPoolBlock *block = ((struct MainPoolBlock *) addr) - 1;
-    void *toFree;
+    struct MainPoolBlock *block = MAIN_POOL_DATA_BLOCK(addr);
+    struct MainPoolBlock *toFree;
     do {
         if (sPoolListHeadL == NULL) {
             abort();
         }
         if (sPoolListHeadL->releaseHandler != NULL) {
-            sPoolListHeadL->releaseHandler(sPoolListHeadL + 1);
+            sPoolListHeadL->releaseHandler(MAIN_POOL_BLOCK_DATA(sPoolListHeadL));
         }
         toFree = sPoolListHeadL;
+        memory_stats_free(&sMemoryStats.mainPool, toFree->size);
         sPoolListHeadL = sPoolListHeadL->prev;
         if (sPoolListHeadL != NULL) {
             sPoolListHeadL->next = NULL;
         }
-        free(toFree);
     } while (toFree != block);
+
+    // Release the chunks that only held freed blocks, keeping one as a spare
+    while (sMainPoolChunk != block->chunk) {
+        struct MainPoolChunk *prev = sMainPoolChunk->prev;
+
+        if (sMainPoolSpareChunk != NULL) {
+            sMemoryStats.reservedBytes -= sMainPoolSpareChunk->size;
+            free(sMainPoolSpareChunk);
+        }
+        sMainPoolSpareChunk = sMainPoolChunk;
+        sMainPoolChunk = prev;
+    }
+    sMainPoolChunk->pos = (u8 *) block - MAIN_POOL_CHUNK_DATA(sMainPoolChunk);
+#ifdef MEMORY_POOL_POISON
+    memset(block, POISON_FREED, sMainPoolChunk->size - sMainPoolChunk->pos);
+#endif
     return 0;
 }
 
@@ -492,9 +613,22 @@ static void alloc_only_pool_release_handler(void *addr) {
     struct AllocOnlyPoolBlock *block = pool->lastBlock;
     while (block != NULL) {
         struct AllocOnlyPoolBlock *prev = block->prev;
+        sMemoryStats.reservedBytes -= block->size;
         free(block);
         block = prev;
     }
+    sMemoryStats.allocOnlyPools.liveBytes -= pool->usedSpace;
+}
+
+static struct AllocOnlyPoolBlock *alloc_only_pool_new_block(u32 size) {
+    struct AllocOnlyPoolBlock *block =
+        (struct AllocOnlyPoolBlock *) malloc(sizeof(struct AllocOnlyPoolBlock) + size);
+    if (block == NULL) {
+        abort();
+    }
+    block->size = size;
+    sMemoryStats.reservedBytes += size;
+    return block;
 }
 
 struct AllocOnlyPool *alloc_only_pool_init(void) {
@@ -505,6 +639,8 @@ struct AllocOnlyPool *alloc_only_pool_init(void) {
     pool->lastBlock = NULL;
     pool->lastBlockSize = 0;
     pool->lastBlockNextPos = 0;
+    pool->usedSpace = 0;
+    pool->peakSpace = 0;
 
     return pool;
 }
@@ -514,6 +650,37 @@ void alloc_only_pool_clear(struct AllocOnlyPool *pool) {
     pool->lastBlock = NULL;
     pool->lastBlockSize = 0;
     pool->lastBlockNextPos = 0;
+    pool->usedSpace = 0;
+    pool->peakSpace = 0;
+}
+
+/**
+ * Free everything allocated from the pool, but keep its memory for reuse.
+ * If the allocations didn't fit in one block, the blocks are replaced by a
+ * single one as large as the most the pool has ever held, so after a few
+ * resets the pool settles on one block and resetting is only a pointer reset.
+ */
+void alloc_only_pool_reset(struct AllocOnlyPool *pool) {
+    if (pool->usedSpace > pool->peakSpace) {
+        pool->peakSpace = pool->usedSpace;
+    }
+
+    if (pool->lastBlock != NULL && pool->lastBlock->prev != NULL) {
+        alloc_only_pool_release_handler(pool);
+        pool->lastBlock = alloc_only_pool_new_block(pool->peakSpace);
+        pool->lastBlock->prev = NULL;
+        pool->lastBlockSize = pool->peakSpace;
+    } else {
+        sMemoryStats.allocOnlyPools.liveBytes -= pool->usedSpace;
+#ifdef MEMORY_POOL_POISON
+        if (pool->lastBlock != NULL) {
+            memset(pool->lastBlock + 1, POISON_FREED, pool->lastBlockNextPos);
+        }
+#endif
+    }
+    sMemoryStats.allocOnlyPools.numFrees++;
+    pool->usedSpace = 0;
+    pool->lastBlockNextPos = 0;
 }
 
 void *alloc_only_pool_alloc(struct AllocOnlyPool *pool, s32 size) {
@@ -528,10 +695,7 @@ void *alloc_only_pool_alloc(struct AllocOnlyPool *pool, s32 size) {
         if (nextSize < s) {
             nextSize = s;
         }
-        block = (struct AllocOnlyPoolBlock *) malloc(sizeof(struct AllocOnlyPoolBlock) + nextSize);
-        if (block == NULL) {
-            abort();
-        }
+        block = alloc_only_pool_new_block(nextSize);
         block->prev = pool->lastBlock;
         pool->lastBlock = block;
         pool->lastBlockSize = nextSize;
@@ -539,12 +703,22 @@ void *alloc_only_pool_alloc(struct AllocOnlyPool *pool, s32 size) {
     }
     addr = (u8 *) (pool->lastBlock + 1) + pool->lastBlockNextPos;
     pool->lastBlockNextPos += s;
+    pool->usedSpace += s;
+    memory_stats_alloc(&sMemoryStats.allocOnlyPools, s);
+#ifdef MEMORY_POOL_POISON
+    memset(addr, POISON_ALLOCATED, s);
+#endif
     return addr;
 }
 
+static void mem_pool_release_handler(void *addr) {
+    struct MemoryPool *pool = (struct MemoryPool *) addr;
+    sMemoryStats.memPools.liveBytes -= pool->liveBytes;
+}
+
 struct MemoryPool *mem_pool_init(UNUSED u32 size, UNUSED u32 side) {
     struct MemoryPool *pool;
-    void *addr = main_pool_alloc(sizeof(struct MemoryPool), NULL);
+    void *addr = main_pool_alloc(sizeof(struct MemoryPool), mem_pool_release_handler);
     u32 i;
 
     pool = (struct MemoryPool *) addr;
@@ -552,6 +726,7 @@ struct MemoryPool *mem_pool_init(UNUSED u32 size, UNUSED u32 side) {
     for (i = 0; i < ARRAY_COUNT(pool->bins); i++) {
         pool->bins[i] = NULL;
     }
+    pool->liveBytes = 0;
 
     return pool;
 }
@@ -582,6 +757,11 @@ void *mem_pool_alloc(struct MemoryPool *pool, u32 size) {
     an = (struct AllocatedNode *) node;
     pool->bins[bin - 3] = node->next;
     an->bin = bin;
+    pool->liveBytes += itemSize;
+    memory_stats_alloc(&sMemoryStats.memPools, itemSize);
+#ifdef MEMORY_POOL_POISON
+    memset(an + 1, POISON_ALLOCATED, itemSize);
+#endif
     return an + 1;
 }
 
@@ -589,14 +769,112 @@ void mem_pool_free(struct MemoryPool *pool, void *addr) {
     struct AllocatedNode *an = ((struct AllocatedNode *) addr) - 1;
     struct FreeListNode *node = (struct FreeListNode *) an;
     s32 bin = an->bin;
+    pool->liveBytes -= 1 << bin;
+    memory_stats_free(&sMemoryStats.memPools, 1 << bin);
+#ifdef MEMORY_POOL_POISON
+    memset(addr, POISON_FREED, 1 << bin);
+#endif
     node->next = pool->bins[bin - 3];
     pool->bins[bin - 3] = node;
 }
 
 void *alloc_display_list(u32 size) {
+    return alloc_display_list_category(size, GFX_ALLOC_OTHER);
+}
+
+/**
+ * Allocate graphics memory for the current frame, and count it towards the
+ * given GFX_ALLOC_* category.
+ */
+void *alloc_display_list_category(u32 size, s32 category) {
     size = ALIGN8(size);
+    sGfxAllocStats.frameBytes[category] += size;
     return alloc_only_pool_alloc(gGfxAllocOnlyPool, size);
 }
+
+/**
+ * Release the graphics memory of the last frame that used gGfxAllocOnlyPool,
+ * and update the peak usage counters.
+ */
+void alloc_display_list_reset(void) {
+    s32 i;
+
+    for (i = 0; i < GFX_ALLOC_CATEGORY_COUNT; i++) {
+        if (sGfxAllocStats.frameBytes[i] > sGfxAllocStats.peakBytes[i]) {
+            sGfxAllocStats.peakBytes[i] = sGfxAllocStats.frameBytes[i];
+        }
+        sGfxAllocStats.lastFrameBytes[i] = sGfxAllocStats.frameBytes[i];
+        sGfxAllocStats.frameBytes[i] = 0;
+    }
+
+    alloc_only_pool_reset(gGfxAllocOnlyPool);
+    sGfxAllocStats.reservedBytes = gGfxAllocOnlyPool->lastBlockSize;
+}
+
+/**
+ * Return the graphics memory usage counters, for profiling.
+ */
+struct GfxAllocStats *alloc_display_list_get_stats(void) {
+    return &sGfxAllocStats;
+}
+
+/**
+ * Create the frame pools. Must be called before any main pool state is pushed,
+ * since they are never freed.
+ */
+void frame_pool_init(void) {
+    s32 i;
+
+    for (i = 0; i < FRAME_POOL_COUNT; i++) {
+        sFramePools[i] = alloc_only_pool_init();
+    }
+}
+
+/**
+ * Start a new frame. The oldest frame pool is reset wholesale and becomes the
+ * one that frame_pool_alloc allocates from.
+ */
+void frame_pool_begin_frame(void) {
+    if (sFramePoolStats.frameBytes > sFramePoolStats.peakBytes) {
+        sFramePoolStats.peakBytes = sFramePoolStats.frameBytes;
+    }
+    sFramePoolStats.lastFrameBytes = sFramePoolStats.frameBytes;
+    sFramePoolStats.lastFrameAllocs = sFramePoolStats.frameAllocs;
+    sFramePoolStats.frameBytes = 0;
+    sFramePoolStats.frameAllocs = 0;
+
+    sFramePoolIndex = (sFramePoolIndex + 1) % FRAME_POOL_COUNT;
+    alloc_only_pool_reset(sFramePools[sFramePoolIndex]);
+}
+
+/**
+ * Allocate memory that is only needed during this frame and the next one.
+ * It doesn't need to be freed, frame_pool_free only exists for the callers
+ * that also build for N64, where this is an allocation from the effects pool.
+ */
+void *frame_pool_alloc(u32 size) {
+    size = ALIGN8(size);
+    sFramePoolStats.frameBytes += size;
+    sFramePoolStats.frameAllocs++;
+    return alloc_only_pool_alloc(sFramePools[sFramePoolIndex], size);
+}
+
+void frame_pool_free(UNUSED void *addr) {
+}
+
+/**
+ * Return the frame pool usage counters, for profiling.
+ */
+struct FramePoolStats *frame_pool_get_stats(void) {
+    return &sFramePoolStats;
+}
+
+/**
+ * Return the usage counters of the main pool and the pools built on it.
+ */
+struct MemoryStats *memory_get_stats(void) {
+    return &sMemoryStats;
+}
 #else
 /**
  * Allocate an allocation-only pool from the main pool. This pool doesn't
@@ -23,6 +23,60 @@ struct AllocOnlyPool
 
 struct MemoryPool;
 
+#ifdef USE_SYSTEM_MALLOC
+enum GfxAllocCategory {
+    GFX_ALLOC_COMMANDS, // master display list
+    GFX_ALLOC_MATRICES,
+    GFX_ALLOC_VERTICES,
+    GFX_ALLOC_OTHER, // everything else, including display lists built by geo asm functions
+    GFX_ALLOC_CATEGORY_COUNT
+};
+
+/**
+ * Graphics memory usage per GFX_ALLOC_* category, in bytes.
+ */
+struct GfxAllocStats {
+    u32 frameBytes[GFX_ALLOC_CATEGORY_COUNT];
+    u32 lastFrameBytes[GFX_ALLOC_CATEGORY_COUNT];
+    u32 peakBytes[GFX_ALLOC_CATEGORY_COUNT];
+    u32 reservedBytes;
+};
+
+/**
+ * Usage counters of one kind of pool. liveBytes counts the bytes requested
+ * by the callers, excluding headers and rounding of the pool itself.
+ */
+struct MemoryPoolStats {
+    u32 liveBytes;
+    u32 peakBytes;
+    u32 numAllocs;
+    u32 numFrees;
+};
+
+/**
+ * Usage of the main pool and of the pools allocated from it. For the
+ * alloc-only pools, numFrees counts resets. reservedBytes is the memory taken
+ * from the system by the main pool and alloc-only pools.
+ */
+struct MemoryStats {
+    struct MemoryPoolStats mainPool;
+    struct MemoryPoolStats allocOnlyPools;
+    struct MemoryPoolStats memPools;
+    u32 reservedBytes;
+};
+
+/**
+ * Usage of the frame pools, in bytes.
+ */
+struct FramePoolStats {
+    u32 frameBytes;
+    u32 frameAllocs;
+    u32 lastFrameBytes;
+    u32 lastFrameAllocs;
+    u32 peakBytes;
+};
+#endif
+
 struct OffsetSizePair
 {
     u32 offset;
@@ -86,6 +140,7 @@ void load_engine_code_segment(void);
 #ifdef USE_SYSTEM_MALLOC
 struct AllocOnlyPool *alloc_only_pool_init(void);
 void alloc_only_pool_clear(struct AllocOnlyPool *pool);
+void alloc_only_pool_reset(struct AllocOnlyPool *pool);
 void *alloc_only_pool_alloc(struct AllocOnlyPool *pool, s32 size);
 #else
 struct AllocOnlyPool *alloc_only_pool_init(u32 size, u32 side);
@@ -98,6 +153,23 @@ void *mem_pool_alloc(struct MemoryPool *pool, u32 size);
 void mem_pool_free(struct MemoryPool *pool, void *addr);
 
 void *alloc_display_list(u32 size);
+#ifdef USE_SYSTEM_MALLOC
+void *alloc_display_list_category(u32 size, s32 category);
+void alloc_display_list_reset(void);
+struct GfxAllocStats *alloc_display_list_get_stats(void);
+struct MemoryStats *memory_get_stats(void);
+
+void frame_pool_init(void);
+void frame_pool_begin_frame(void);
+void *frame_pool_alloc(u32 size);
+void frame_pool_free(void *addr);
+struct FramePoolStats *frame_pool_get_stats(void);
+#else
+#define alloc_display_list_category(size, category) alloc_display_list(size)
+
+#define frame_pool_alloc(size) mem_pool_alloc(gEffectsMemoryPool, size)
+#define frame_pool_free(addr) mem_pool_free(gEffectsMemoryPool, addr)
+#endif
 void setup_dma_table_list(struct DmaHandlerList *list, void *srcAddr, void *buffer);
 s32 load_patchable_table(struct DmaHandlerList *list, s32 index);
 
@@ -16,6 +16,9 @@
 #include "object_collision.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
+#ifndef TARGET_N64
+#include "object_lod.h"
+#endif
 #include "platform_displacement.h"
 #include "profiler.h"
 #include "spawn_object.h"
@@ -299,7 +302,13 @@ s32 update_objects_starting_at(struct ObjectNode *objList, struct ObjectNode *fi
         gCurrentObject = (struct Object *) firstObj;
 
         gCurrentObject->header.gfx.node.flags |= GRAPH_RENDER_HAS_ANIMATION;
+#ifndef TARGET_N64
+        if (!object_lod_skip_update(gCurrentObject)) {
+            cur_obj_update();
+        }
+#else
         cur_obj_update();
+#endif
 
         firstObj = firstObj->next;
         count += 1;
@@ -434,6 +443,9 @@ void unload_objects_from_area(UNUSED s32 unused, s32 areaIndex) {
     s32 i;
     gObjectLists = gObjectListArray;
 
+#ifndef TARGET_N64
+    begin_object_unload_batch();
+#endif
     for (i = 0; i < NUM_OBJ_LISTS; i++) {
         list = gObjectLists + i;
         node = list->next;
@@ -447,7 +459,27 @@ void unload_objects_from_area(UNUSED s32 unused, s32 areaIndex) {
             }
         }
     }
+#ifndef TARGET_N64
+    end_object_unload_batch();
+#endif
+}
+
+#ifndef TARGET_N64
+/**
+ * Count the objects that spawn_objects_from_info will spawn from spawnInfo.
+ */
+static s32 count_spawn_infos(struct SpawnInfo *spawnInfo) {
+    s32 count = 0;
+
+    for (; spawnInfo != NULL; spawnInfo = spawnInfo->next) {
+        if ((spawnInfo->behaviorArg & (RESPAWN_INFO_DONT_RESPAWN << 8))
+            != (RESPAWN_INFO_DONT_RESPAWN << 8)) {
+            count++;
+        }
+    }
+    return count;
 }
+#endif
 
 /**
  * Spawn objects given a list of SpawnInfos. Called when loading an area.
@@ -470,6 +502,9 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
         gCCMEnteredSlide |= 1;
     }
 
+#ifndef TARGET_N64
+    begin_object_spawn_batch(count_spawn_infos(spawnInfo));
+#endif
     while (spawnInfo != NULL) {
         struct Object *object;
         UNUSED s32 unused;
@@ -519,6 +554,9 @@ void spawn_objects_from_info(UNUSED s32 unused, struct SpawnInfo *spawnInfo) {
 
         spawnInfo = spawnInfo->next;
     }
+#ifndef TARGET_N64
+    end_object_spawn_batch();
+#endif
 }
 
 void stub_obj_list_processor_1(void) {
@@ -595,10 +633,16 @@ void unload_deactivated_objects(void) {
     s32 listIndex;
 
     s32 i = 0;
+#ifndef TARGET_N64
+    begin_object_unload_batch();
+#endif
     while ((listIndex = sObjectListUpdateOrder[i]) != -1) {
         unload_deactivated_objects_in_list(&gObjectLists[listIndex]);
         i += 1;
     }
+#ifndef TARGET_N64
+    end_object_unload_batch();
+#endif
 
     // TIME_STOP_UNKNOWN_0 was most likely intended to be used to track whether
     // any objects had been deactivated
@@ -0,0 +1,101 @@
+#ifndef TARGET_N64
+#include <PR/ultratypes.h>
+
+#include "sm64.h"
+#include "behavior_data.h"
+#include "game_init.h"
+#include "object_list_processor.h"
+#include "object_lod.h"
+
+/**
+ * @file object_lod.c
+ * Updates distant decorative objects less often, to leave CPU time for levels
+ * with many objects. Only the behaviors in sLodBehaviors, which nothing else
+ * depends on, are scheduled: beyond OBJECT_LOD_HALF_RATE_DIST from Mario they
+ * are updated every 2nd tick, beyond OBJECT_LOD_QUARTER_RATE_DIST every 4th
+ * tick. An object that can interact, carries surfaces or has collided stays
+ * at the full rate.
+ *
+ * Each object gets a phase when it's allocated, so the reduced updates are
+ * spread over the ticks. The phases and the schedule only depend on the game
+ * state, so runs with the same settings stay deterministic. A run with the
+ * scheduler on doesn't match one with it off, so input recordings must be
+ * replayed with the same setting.
+ */
+
+#define OBJECT_LOD_HALF_RATE_DIST 2000.0f
+#define OBJECT_LOD_QUARTER_RATE_DIST 4000.0f
+
+s32 gObjectLodEnabled = FALSE;
+
+static u16 sNextLodPhase;
+
+static const BehaviorScript *const sLodBehaviors[] = {
+    bhvButterfly,
+    bhvBird,
+    bhvFish,
+    bhvBlueFish,
+};
+
+/**
+ * Give a newly allocated object its phase in the reduced update rates.
+ */
+void object_lod_init_object(struct Object *obj) {
+    obj->lodPhase = sNextLodPhase++;
+}
+
+static s32 object_lod_is_decorative(struct Object *obj) {
+    s32 i;
+
+    for (i = 0; i < ARRAY_COUNT(sLodBehaviors); i++) {
+        if (obj->behavior == sLodBehaviors[i]) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/**
+ * Return the number of ticks between two updates of obj.
+ */
+static s32 object_lod_interval(struct Object *obj) {
+    f32 dx, dy, dz, distSq;
+
+    if (gMarioObject == NULL || obj == gMarioObject) {
+        return 1;
+    }
+    if (obj->oInteractType != 0 || obj->oInteractStatus != 0 || obj->numCollidedObjs != 0
+        || obj->collisionData != NULL || obj->oHeldState != HELD_FREE) {
+        return 1;
+    }
+    if (!object_lod_is_decorative(obj)) {
+        return 1;
+    }
+
+    dx = obj->oPosX - gMarioObject->oPosX;
+    dy = obj->oPosY - gMarioObject->oPosY;
+    dz = obj->oPosZ - gMarioObject->oPosZ;
+    distSq = dx * dx + dy * dy + dz * dz;
+
+    if (distSq > OBJECT_LOD_QUARTER_RATE_DIST * OBJECT_LOD_QUARTER_RATE_DIST) {
+        return 4;
+    }
+    if (distSq > OBJECT_LOD_HALF_RATE_DIST * OBJECT_LOD_HALF_RATE_DIST) {
+        return 2;
+    }
+    return 1;
+}
+
+/**
+ * Return whether obj's update is skipped this tick.
+ */
+s32 object_lod_skip_update(struct Object *obj) {
+    s32 interval;
+
+    if (!gObjectLodEnabled) {
+        return FALSE;
+    }
+    interval = object_lod_interval(obj);
+    return ((gGlobalTimer + obj->lodPhase) & (interval - 1)) != 0;
+}
+#endif
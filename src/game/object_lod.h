@@ -0,0 +1,17 @@
+#ifndef OBJECT_LOD_H
+#define OBJECT_LOD_H
+
+#include <PR/ultratypes.h>
+
+#include "types.h"
+
+/**
+ * Whether distant decorative objects are updated at a reduced rate. Off keeps
+ * the simulation identical to the original game.
+ */
+extern s32 gObjectLodEnabled;
+
+void object_lod_init_object(struct Object *obj);
+s32 object_lod_skip_update(struct Object *obj);
+
+#endif // OBJECT_LOD_H
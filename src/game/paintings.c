@@ -17,6 +17,13 @@
 #include "save_file.h"
 #include "segment2.h"
 
+#ifndef TARGET_N64
+#include <stdlib.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+#endif
+
 /**
  * @file paintings.c
  *
@@ -151,6 +158,7 @@ struct PaintingMeshVertex *gPaintingMesh;
 
 /**
  * The painting's surface normals, used to approximate each of the vertex normals (for gouraud shading).
+ * On PC they are kept in sPaintingMeshCache instead.
  */
 Vec3f *gPaintingTriNorms;
 
@@ -159,6 +167,67 @@ Vec3f *gPaintingTriNorms;
  */
 struct Painting *gRipplingPainting;
 
+#ifndef TARGET_N64
+/**
+ * On PC the ripple mesh and its normals persist between frames instead of being regenerated every
+ * frame. The distance from each vertex to the ripple's origin is only computed when a new ripple
+ * starts, and the normals and the vertices mapped from the mesh are only rebuilt when the mesh
+ * moved. A painting whose ripple hasn't reached any vertex yet, or has settled down to a flat
+ * surface, reuses the previous frame's display lists.
+ */
+struct PaintingMeshCache {
+    /// The base mesh this cache was built from, seg2_painting_triangle_mesh
+    s16 *baseMesh;
+    s16 numVtx;
+    s16 numTris;
+
+    struct PaintingMeshVertex *mesh;
+    /// The vertex positions as floats, one array per axis
+    f32 *vtxX;
+    f32 *vtxY;
+    f32 *vtxZ;
+    /// The triangle normals, one array per axis
+    f32 *triNormX;
+    f32 *triNormY;
+    f32 *triNormZ;
+    /// Distance from each vertex to the ripple's origin, divided by the dispersion factor
+    f32 *rippleDistance;
+
+    /// The ripple that rippleDistance was computed for
+    f32 rippleX;
+    f32 rippleY;
+    f32 size;
+    f32 dispersionFactor;
+
+    /// Incremented every time the mesh changes
+    u32 version;
+    /// The mesh versions the triangle and vertex normals were computed for
+    u32 triNormsVersion;
+    u32 vtxNormsVersion;
+};
+
+/**
+ * The vertices and display list render_painting built for one texture map.
+ */
+struct PaintingRenderCache {
+    s16 *textureMap;
+    u8 *img;
+    u8 alpha;
+    u32 meshVersion;
+    Vtx *verts;
+    Gfx *dlist;
+};
+
+/**
+ * Enough for every texture map of one painting. Paintings have at most 2 images.
+ */
+#define PAINTING_RENDER_CACHE_SIZE 4
+
+static struct PaintingMeshCache sPaintingMeshCache;
+static struct PaintingRenderCache sPaintingRenderCache[PAINTING_RENDER_CACHE_SIZE];
+static s32 sPaintingRenderCacheNext;
+#endif
+
 /**
  * Whether the DDD painting is moved forward, should being moving backwards, or has already moved backwards.
  */
@@ -681,10 +750,11 @@ s16 ripple_if_movable(struct Painting *painting, s16 movable, s16 posX, s16 posY
  *
  * The mesh used in game, seg2_painting_triangle_mesh, is in bin/segment2.c.
  */
+#ifdef TARGET_N64
 void painting_generate_mesh(struct Painting *painting, s16 *mesh, s16 numTris) {
     s16 i;
 
-    gPaintingMesh = mem_pool_alloc(gEffectsMemoryPool, numTris * sizeof(struct PaintingMeshVertex));
+    gPaintingMesh = frame_pool_alloc(numTris * sizeof(struct PaintingMeshVertex));
     if (gPaintingMesh == NULL) {
     }
     // accesses are off by 1 since the first entry is the number of vertices
@@ -697,6 +767,119 @@ void painting_generate_mesh(struct Painting *painting, s16 *mesh, s16 numTris) {
                                                     gPaintingMesh[i].pos[0], gPaintingMesh[i].pos[1]);
     }
 }
+#else
+/**
+ * Allocate the mesh cache for `mesh` and fill in the parts of the mesh that never move.
+ */
+static void painting_mesh_cache_init(s16 *mesh, s16 numVtx) {
+    struct PaintingMeshCache *cache = &sPaintingMeshCache;
+    s16 numTris = mesh[numVtx * 3 + 1];
+    s16 i;
+
+    free(cache->mesh);
+    free(cache->vtxX);
+    cache->mesh = malloc(numVtx * sizeof(struct PaintingMeshVertex));
+    cache->vtxX = malloc((4 * numVtx + 3 * numTris) * sizeof(f32));
+    cache->vtxY = cache->vtxX + numVtx;
+    cache->vtxZ = cache->vtxY + numVtx;
+    cache->rippleDistance = cache->vtxZ + numVtx;
+    cache->triNormX = cache->rippleDistance + numVtx;
+    cache->triNormY = cache->triNormX + numTris;
+    cache->triNormZ = cache->triNormY + numTris;
+
+    for (i = 0; i < numVtx; i++) {
+        cache->mesh[i].pos[0] = mesh[i * 3 + 1];
+        cache->mesh[i].pos[1] = mesh[i * 3 + 2];
+        cache->mesh[i].pos[2] = 0;
+        cache->vtxX[i] = cache->mesh[i].pos[0];
+        cache->vtxY[i] = cache->mesh[i].pos[1];
+        cache->vtxZ[i] = 0.0f;
+    }
+
+    cache->baseMesh = mesh;
+    cache->numVtx = numVtx;
+    cache->numTris = numTris;
+    // No painting has a size of 0, so the distances are computed on first use
+    cache->size = 0.0f;
+    cache->version++;
+}
+
+/**
+ * Compute the distance from each movable vertex to the painting's ripple origin, the part of
+ * calculate_ripple_at_point that stays the same for as long as the ripple lasts.
+ */
+static void painting_update_ripple_distances(struct Painting *painting) {
+    struct PaintingMeshCache *cache = &sPaintingMeshCache;
+    f32 dispersionFactor = painting->dispersionFactor;
+    f32 rippleX = painting->rippleX;
+    f32 rippleY = painting->rippleY;
+    f32 posX;
+    f32 posY;
+    f32 distanceToOrigin;
+    s16 i;
+
+    if (cache->rippleX == rippleX && cache->rippleY == rippleY && cache->size == painting->size
+        && cache->dispersionFactor == dispersionFactor) {
+        return;
+    }
+    cache->rippleX = rippleX;
+    cache->rippleY = rippleY;
+    cache->size = painting->size;
+    cache->dispersionFactor = dispersionFactor;
+
+    for (i = 0; i < cache->numVtx; i++) {
+        posX = cache->mesh[i].pos[0];
+        posY = cache->mesh[i].pos[1];
+        posX *= painting->size / PAINTING_SIZE;
+        posY *= painting->size / PAINTING_SIZE;
+        distanceToOrigin = sqrtf((posX - rippleX) * (posX - rippleX) + (posY - rippleY) * (posY - rippleY));
+        cache->rippleDistance[i] = distanceToOrigin / dispersionFactor;
+    }
+}
+
+/**
+ * Update the cached mesh to the painting's current ripple state. This computes the same positions
+ * as ripple_if_movable, and bumps the mesh version if any of them moved.
+ */
+void painting_generate_mesh(struct Painting *painting, s16 *mesh, s16 numTris) {
+    struct PaintingMeshCache *cache = &sPaintingMeshCache;
+    f32 rippleMag = painting->currRippleMag;
+    f32 rippleRate = painting->currRippleRate;
+    f32 rippleTimer = painting->rippleTimer;
+    f32 rippleDistance;
+    f32 rippleZ;
+    s16 z;
+    s16 i;
+    s32 moved = FALSE;
+
+    if (cache->baseMesh != mesh || cache->numVtx != numTris) {
+        painting_mesh_cache_init(mesh, numTris);
+    }
+    painting_update_ripple_distances(painting);
+    gPaintingMesh = cache->mesh;
+
+    for (i = 0; i < numTris; i++) {
+        if (!mesh[i * 3 + 3]) {
+            continue;
+        }
+        rippleDistance = cache->rippleDistance[i];
+        if (rippleTimer < rippleDistance) {
+            z = 0;
+        } else {
+            rippleZ = rippleMag * cosf(rippleRate * (2 * M_PI) * (rippleTimer - rippleDistance));
+            z = round_float(rippleZ);
+        }
+        if (cache->mesh[i].pos[2] != z) {
+            cache->mesh[i].pos[2] = z;
+            cache->vtxZ[i] = z;
+            moved = TRUE;
+        }
+    }
+    if (moved) {
+        cache->version++;
+    }
+}
+#endif
 
 /**
  * Calculate the surface normals of each triangle in the generated ripple mesh.
@@ -713,10 +896,11 @@ void painting_generate_mesh(struct Painting *painting, s16 *mesh, s16 numTris) {
  *
  * The mesh used in game, seg2_painting_triangle_mesh, is in bin/segment2.c.
  */
+#ifdef TARGET_N64
 void painting_calculate_triangle_normals(s16 *mesh, s16 numVtx, s16 numTris) {
     s16 i;
 
-    gPaintingTriNorms = mem_pool_alloc(gEffectsMemoryPool, numTris * sizeof(Vec3f));
+    gPaintingTriNorms = frame_pool_alloc(numTris * sizeof(Vec3f));
     if (gPaintingTriNorms == NULL) {
     }
     for (i = 0; i < numTris; i++) {
@@ -743,6 +927,79 @@ void painting_calculate_triangle_normals(s16 *mesh, s16 numVtx, s16 numTris) {
         gPaintingTriNorms[i][2] = (x1 - x0) * (y2 - y1) - (y1 - y0) * (x2 - x1);
     }
 }
+#else
+#ifdef __SSE2__
+/**
+ * Load coordinate `k` of four consecutive triangles' vertices.
+ */
+static __m128 painting_gather_vtx(const f32 *coords, const s16 *tris, s32 k) {
+    return _mm_setr_ps(coords[tris[k]], coords[tris[3 + k]], coords[tris[6 + k]], coords[tris[9 + k]]);
+}
+#endif
+
+/**
+ * Recompute the triangle normals of the cached mesh if it moved. The vertex positions are whole
+ * numbers, so the cross products are exact and the vectorized loop gives the same normals as
+ * the scalar one.
+ */
+void painting_calculate_triangle_normals(s16 *mesh, s16 numVtx, s16 numTris) {
+    struct PaintingMeshCache *cache = &sPaintingMeshCache;
+    s16 *tris = &mesh[numVtx * 3 + 2]; // Skip the 2 length entries preceding the list
+    s32 i = 0;
+
+    if (cache->triNormsVersion == cache->version) {
+        return;
+    }
+    cache->triNormsVersion = cache->version;
+
+#ifdef __SSE2__
+    for (; i + 4 <= numTris; i += 4) {
+        const s16 *tri = &tris[i * 3];
+        __m128 x0 = painting_gather_vtx(cache->vtxX, tri, 0);
+        __m128 y0 = painting_gather_vtx(cache->vtxY, tri, 0);
+        __m128 z0 = painting_gather_vtx(cache->vtxZ, tri, 0);
+        __m128 x1 = painting_gather_vtx(cache->vtxX, tri, 1);
+        __m128 y1 = painting_gather_vtx(cache->vtxY, tri, 1);
+        __m128 z1 = painting_gather_vtx(cache->vtxZ, tri, 1);
+        __m128 x2 = painting_gather_vtx(cache->vtxX, tri, 2);
+        __m128 y2 = painting_gather_vtx(cache->vtxY, tri, 2);
+        __m128 z2 = painting_gather_vtx(cache->vtxZ, tri, 2);
+        __m128 dx10 = _mm_sub_ps(x1, x0);
+        __m128 dy10 = _mm_sub_ps(y1, y0);
+        __m128 dz10 = _mm_sub_ps(z1, z0);
+        __m128 dx21 = _mm_sub_ps(x2, x1);
+        __m128 dy21 = _mm_sub_ps(y2, y1);
+        __m128 dz21 = _mm_sub_ps(z2, z1);
+
+        // Cross product to find each triangle's normal vector
+        _mm_storeu_ps(&cache->triNormX[i], _mm_sub_ps(_mm_mul_ps(dy10, dz21), _mm_mul_ps(dz10, dy21)));
+        _mm_storeu_ps(&cache->triNormY[i], _mm_sub_ps(_mm_mul_ps(dz10, dx21), _mm_mul_ps(dx10, dz21)));
+        _mm_storeu_ps(&cache->triNormZ[i], _mm_sub_ps(_mm_mul_ps(dx10, dy21), _mm_mul_ps(dy10, dx21)));
+    }
+#endif
+    for (; i < numTris; i++) {
+        s16 v0 = tris[i * 3];
+        s16 v1 = tris[i * 3 + 1];
+        s16 v2 = tris[i * 3 + 2];
+
+        f32 x0 = cache->vtxX[v0];
+        f32 y0 = cache->vtxY[v0];
+        f32 z0 = cache->vtxZ[v0];
+
+        f32 x1 = cache->vtxX[v1];
+        f32 y1 = cache->vtxY[v1];
+        f32 z1 = cache->vtxZ[v1];
+
+        f32 x2 = cache->vtxX[v2];
+        f32 y2 = cache->vtxY[v2];
+        f32 z2 = cache->vtxZ[v2];
+
+        cache->triNormX[i] = (y1 - y0) * (z2 - z1) - (z1 - z0) * (y2 - y1);
+        cache->triNormY[i] = (z1 - z0) * (x2 - x1) - (x1 - x0) * (z2 - z1);
+        cache->triNormZ[i] = (x1 - x0) * (y2 - y1) - (y1 - y0) * (x2 - x1);
+    }
+}
+#endif
 
 /**
  * Rounds a floating-point component of a normal vector to an s8 by multiplying it by 127 or 128 and
@@ -776,6 +1033,7 @@ s8 normalize_component(f32 comp) {
  *
  * The table used in game, seg2_painting_mesh_neighbor_tris, is in bin/segment2.c.
  */
+#ifdef TARGET_N64
 void painting_average_vertex_normals(s16 *neighborTris, s16 numVtx) {
     UNUSED s16 unused;
     s16 tri;
@@ -818,6 +1076,82 @@ void painting_average_vertex_normals(s16 *neighborTris, s16 numVtx) {
         }
     }
 }
+#else
+/**
+ * Recompute the vertex normals of the cached mesh if it moved.
+ */
+void painting_average_vertex_normals(s16 *neighborTris, s16 numVtx) {
+    struct PaintingMeshCache *cache = &sPaintingMeshCache;
+    s16 tri;
+    s16 i;
+    s16 j;
+    s16 neighbors;
+    s16 entry = 0;
+
+    if (cache->vtxNormsVersion == cache->version) {
+        return;
+    }
+    cache->vtxNormsVersion = cache->version;
+
+    for (i = 0; i < numVtx; i++) {
+        f32 nx = 0.0f;
+        f32 ny = 0.0f;
+        f32 nz = 0.0f;
+        f32 nlen;
+
+        neighbors = neighborTris[entry];
+        for (j = 0; j < neighbors; j++) {
+            tri = neighborTris[entry + j + 1];
+            nx += cache->triNormX[tri];
+            ny += cache->triNormY[tri];
+            nz += cache->triNormZ[tri];
+        }
+        entry += neighbors + 1;
+
+        nx /= neighbors;
+        ny /= neighbors;
+        nz /= neighbors;
+        nlen = sqrtf(nx * nx + ny * ny + nz * nz);
+
+        if (nlen == 0.0) {
+            cache->mesh[i].norm[0] = 0;
+            cache->mesh[i].norm[1] = 0;
+            cache->mesh[i].norm[2] = 0;
+        } else {
+            cache->mesh[i].norm[0] = normalize_component(nx / nlen);
+            cache->mesh[i].norm[1] = normalize_component(ny / nlen);
+            cache->mesh[i].norm[2] = normalize_component(nz / nlen);
+        }
+    }
+}
+#endif
+
+#ifndef TARGET_N64
+/**
+ * Find the render cache entry of `textureMap`, or replace the least recently added entry with one
+ * for it.
+ */
+static struct PaintingRenderCache *painting_render_cache_get(s16 *textureMap, s16 numVtx, s16 commands) {
+    struct PaintingRenderCache *cache;
+    s32 i;
+
+    for (i = 0; i < PAINTING_RENDER_CACHE_SIZE; i++) {
+        if (sPaintingRenderCache[i].textureMap == textureMap) {
+            return &sPaintingRenderCache[i];
+        }
+    }
+
+    cache = &sPaintingRenderCache[sPaintingRenderCacheNext];
+    sPaintingRenderCacheNext = (sPaintingRenderCacheNext + 1) % PAINTING_RENDER_CACHE_SIZE;
+    free(cache->verts);
+    free(cache->dlist);
+    cache->textureMap = textureMap;
+    cache->meshVersion = 0;
+    cache->verts = malloc(numVtx * sizeof(Vtx));
+    cache->dlist = malloc(commands * sizeof(Gfx));
+    return cache;
+}
+#endif
 
 /**
  * Creates a display list that draws the rippling painting, with 'img' mapped to the painting's mesh,
@@ -842,12 +1176,27 @@ Gfx *render_painting(u8 *img, s16 tWidth, s16 tHeight, s16 *textureMap, s16 mapV
     s16 numVtx = mapTris * 3;
 
     s16 commands = triGroups * 2 + remGroupTris + 7;
-    Vtx *verts = alloc_display_list(numVtx * sizeof(Vtx));
+#ifdef TARGET_N64
+    Vtx *verts = alloc_display_list_category(numVtx * sizeof(Vtx), GFX_ALLOC_VERTICES);
     Gfx *dlist = alloc_display_list(commands * sizeof(Gfx));
+#else
+    struct PaintingRenderCache *cache = painting_render_cache_get(textureMap, numVtx, commands);
+    Vtx *verts = cache->verts;
+    Gfx *dlist = cache->dlist;
+#endif
     Gfx *gfx = dlist;
 
     if (verts == NULL || dlist == NULL) {
     }
+#ifndef TARGET_N64
+    // The vertices only need to be mapped again if the mesh moved
+    if (cache->meshVersion == sPaintingMeshCache.version && cache->img == img && cache->alpha == alpha) {
+        return dlist;
+    }
+    cache->meshVersion = sPaintingMeshCache.version;
+    cache->img = img;
+    cache->alpha = alpha;
+#endif
 
     gLoadBlockTexture(gfx++, tWidth, tHeight, G_IM_FMT_RGBA, img);
 
@@ -1012,7 +1361,8 @@ Gfx *painting_ripple_env_mapped(struct Painting *painting) {
 
 /**
  * Generates a mesh, calculates vertex normals for lighting, and renders a rippling painting.
- * The mesh and vertex normals are regenerated and freed every frame.
+ * The mesh and vertex normals are regenerated and freed every frame. On PC they are kept in
+ * sPaintingMeshCache and only updated where the ripple moved them.
  */
 Gfx *display_painting_rippling(struct Painting *painting) {
     s16 *mesh = segmented_to_virtual(seg2_painting_triangle_mesh);
@@ -1036,9 +1386,11 @@ Gfx *display_painting_rippling(struct Painting *painting) {
             break;
     }
 
+#ifdef TARGET_N64
     // The mesh data is freed every frame.
-    mem_pool_free(gEffectsMemoryPool, gPaintingMesh);
-    mem_pool_free(gEffectsMemoryPool, gPaintingTriNorms);
+    frame_pool_free(gPaintingMesh);
+    frame_pool_free(gPaintingTriNorms);
+#endif
     return dlist;
 }
 
@@ -177,8 +177,7 @@ void print_text_fmt_int(s32 x, s32 y, const char *str, s32 n) {
     s32 srcIndex = 0;
 
     // Don't continue if there is no memory to do so.
-    if ((sTextLabels[sTextLabelsCount] = mem_pool_alloc(gEffectsMemoryPool,
-                                                        sizeof(struct TextLabel))) == NULL) {
+    if ((sTextLabels[sTextLabelsCount] = frame_pool_alloc(sizeof(struct TextLabel))) == NULL) {
         return;
     }
 
@@ -228,8 +227,7 @@ void print_text(s32 x, s32 y, const char *str) {
     s32 srcIndex = 0;
 
     // Don't continue if there is no memory to do so.
-    if ((sTextLabels[sTextLabelsCount] = mem_pool_alloc(gEffectsMemoryPool,
-                                                        sizeof(struct TextLabel))) == NULL) {
+    if ((sTextLabels[sTextLabelsCount] = frame_pool_alloc(sizeof(struct TextLabel))) == NULL) {
         return;
     }
 
@@ -261,8 +259,7 @@ void print_text_centered(s32 x, s32 y, const char *str) {
     s32 srcIndex = 0;
 
     // Don't continue if there is no memory to do so.
-    if ((sTextLabels[sTextLabelsCount] = mem_pool_alloc(gEffectsMemoryPool,
-                                                        sizeof(struct TextLabel))) == NULL) {
+    if ((sTextLabels[sTextLabelsCount] = frame_pool_alloc(sizeof(struct TextLabel))) == NULL) {
         return;
     }
 
@@ -453,7 +450,7 @@ void render_text_labels(void) {
             }
         }
 
-        mem_pool_free(gEffectsMemoryPool, sTextLabels[i]);
+        frame_pool_free(sTextLabels[i]);
     }
 
     gSPDisplayList(gDisplayListHead++, dl_hud_img_end);
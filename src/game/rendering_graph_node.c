@@ -1,7 +1,10 @@
 #include <PR/ultratypes.h>
 
+#include "anim_pose.h"
 #include "area.h"
+#include "engine/geo_layout.h"
 #include "engine/math_util.h"
+#include "frame_interp.h"
 #include "game_init.h"
 #include "gfx_dimensions.h"
 #include "main.h"
@@ -65,6 +68,15 @@ f32 gCurAnimTranslationMultiplier;
 u16 *gCurrAnimAttribute;
 s16 *gCurAnimData;
 
+#ifdef TARGET_N64
+#define geo_next_anim_value() gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+#else
+// The pose evaluated for the current object by anim_pose_evaluate_objects, if any
+static struct AnimPose *sCurAnimPose;
+static u16 *sCurAnimAttributeBase;
+static s32 sCurAnimChannelsRead;
+#endif
+
 struct AllocOnlyPool *gDisplayListHeap;
 
 struct RenderModeContainer {
@@ -129,6 +141,39 @@ u16 gAreaUpdateCounter = 0;
 LookAt lookAt;
 #endif
 
+#ifdef TARGET_N64
+#define geo_record_interp_mtx(node, mtx)
+#else
+/**
+ * Record a modelview matrix so intermediate frames can interpolate it. Shared
+ * geo layouts are told apart by the object (or held object) drawing them.
+ */
+static void geo_record_interp_mtx(void *node, Mtx *mtx) {
+    void *context = gCurGraphNodeHeldObject != NULL ? (void *) gCurGraphNodeHeldObject
+                                                    : (void *) gCurGraphNodeObject;
+    f32 *viewPos = gMatStack[gMatStackIndex][3];
+    Vec3f worldPos;
+
+    if (gCurGraphNodeCamera != NULL) {
+        // The look-at matrix is a rotation and a translation, so the inverse
+        // rotation is its transpose
+        Mat4 *camera = gCurGraphNodeCamera->matrixPtr;
+        f32 dx = viewPos[0] - (*camera)[3][0];
+        f32 dy = viewPos[1] - (*camera)[3][1];
+        f32 dz = viewPos[2] - (*camera)[3][2];
+        s32 i;
+
+        for (i = 0; i < 3; i++) {
+            worldPos[i] = dx * (*camera)[i][0] + dy * (*camera)[i][1] + dz * (*camera)[i][2];
+        }
+    } else {
+        vec3f_copy(worldPos, viewPos);
+    }
+
+    frame_interp_record_mtx(node, context, mtx, gMatStack[gMatStackIndex], worldPos);
+}
+#endif
+
 /**
  * Process a master list node.
  */
@@ -218,7 +263,7 @@ static void geo_process_master_list(struct GraphNodeMasterList *node) {
  */
 static void geo_process_ortho_projection(struct GraphNodeOrthoProjection *node) {
     if (node->node.children != NULL) {
-        Mtx *mtx = alloc_display_list(sizeof(*mtx));
+        Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
         f32 left = (gCurGraphNodeRoot->x - gCurGraphNodeRoot->width) / 2.0f * node->scale;
         f32 right = (gCurGraphNodeRoot->x + gCurGraphNodeRoot->width) / 2.0f * node->scale;
         f32 top = (gCurGraphNodeRoot->y - gCurGraphNodeRoot->height) / 2.0f * node->scale;
@@ -241,7 +286,7 @@ static void geo_process_perspective(struct GraphNodePerspective *node) {
     }
     if (node->fnNode.node.children != NULL) {
         u16 perspNorm;
-        Mtx *mtx = alloc_display_list(sizeof(*mtx));
+        Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
 #ifdef VERSION_EU
         f32 aspect = ((f32) gCurGraphNodeRoot->width / (f32) gCurGraphNodeRoot->height) * 1.1f;
@@ -250,6 +295,9 @@ static void geo_process_perspective(struct GraphNodePerspective *node) {
 #endif
 
         guPerspective(mtx, &perspNorm, node->fov, aspect, node->near, node->far, 1.0f);
+#ifndef TARGET_N64
+        frame_interp_record_perspective(node, mtx, node->fov, aspect, node->near, node->far);
+#endif
         gSPPerspNormalize(gDisplayListHead++, perspNorm);
 
         gSPMatrix(gDisplayListHead++, VIRTUAL_TO_PHYSICAL(mtx), G_MTX_PROJECTION | G_MTX_LOAD | G_MTX_NOPUSH);
@@ -314,8 +362,8 @@ static void geo_process_switch(struct GraphNodeSwitchCase *node) {
  */
 static void geo_process_camera(struct GraphNodeCamera *node) {
     Mat4 cameraTransform;
-    Mtx *rollMtx = alloc_display_list(sizeof(*rollMtx));
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *rollMtx = alloc_display_list_category(sizeof(*rollMtx), GFX_ALLOC_MATRICES);
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
     if (node->fnNode.func != NULL) {
         node->fnNode.func(GEO_CONTEXT_RENDER, &node->fnNode.node, gMatStack[gMatStackIndex]);
@@ -329,6 +377,9 @@ static void geo_process_camera(struct GraphNodeCamera *node) {
     gMatStackIndex++;
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+#ifndef TARGET_N64
+    frame_interp_record_mtx(node, NULL, mtx, gMatStack[gMatStackIndex], node->pos);
+#endif
     if (node->fnNode.node.children != 0) {
         gCurGraphNodeCamera = node;
         node->matrixPtr = &gMatStack[gMatStackIndex];
@@ -347,7 +398,7 @@ static void geo_process_camera(struct GraphNodeCamera *node) {
 static void geo_process_translation_rotation(struct GraphNodeTranslationRotation *node) {
     Mat4 mtxf;
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
     vec3s_to_vec3f(translation, node->translation);
     mtxf_rotate_zxy_and_translate(mtxf, translation, node->rotation);
@@ -355,6 +406,7 @@ static void geo_process_translation_rotation(struct GraphNodeTranslationRotation
     gMatStackIndex++;
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+    geo_record_interp_mtx(node, mtx);
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -372,7 +424,7 @@ static void geo_process_translation_rotation(struct GraphNodeTranslationRotation
 static void geo_process_translation(struct GraphNodeTranslation *node) {
     Mat4 mtxf;
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
     vec3s_to_vec3f(translation, node->translation);
     mtxf_rotate_zxy_and_translate(mtxf, translation, gVec3sZero);
@@ -380,6 +432,7 @@ static void geo_process_translation(struct GraphNodeTranslation *node) {
     gMatStackIndex++;
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+    geo_record_interp_mtx(node, mtx);
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -396,13 +449,14 @@ static void geo_process_translation(struct GraphNodeTranslation *node) {
  */
 static void geo_process_rotation(struct GraphNodeRotation *node) {
     Mat4 mtxf;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
     mtxf_rotate_zxy_and_translate(mtxf, gVec3fZero, node->rotation);
     mtxf_mul(gMatStack[gMatStackIndex + 1], mtxf, gMatStack[gMatStackIndex]);
     gMatStackIndex++;
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+    geo_record_interp_mtx(node, mtx);
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -420,13 +474,14 @@ static void geo_process_rotation(struct GraphNodeRotation *node) {
 static void geo_process_scale(struct GraphNodeScale *node) {
     UNUSED Mat4 transform;
     Vec3f scaleVec;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
     vec3f_set(scaleVec, node->scale, node->scale, node->scale);
     mtxf_scale_vec3f(gMatStack[gMatStackIndex + 1], gMatStack[gMatStackIndex], scaleVec);
     gMatStackIndex++;
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+    geo_record_interp_mtx(node, mtx);
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -444,7 +499,7 @@ static void geo_process_scale(struct GraphNodeScale *node) {
  */
 static void geo_process_billboard(struct GraphNodeBillboard *node) {
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
     gMatStackIndex++;
     vec3s_to_vec3f(translation, node->translation);
@@ -460,6 +515,7 @@ static void geo_process_billboard(struct GraphNodeBillboard *node) {
 
     mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = mtx;
+    geo_record_interp_mtx(node, mtx);
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -539,6 +595,26 @@ static void geo_process_background(struct GraphNodeBackground *node) {
     }
 }
 
+#ifndef TARGET_N64
+/**
+ * Read the next animation value. Reads it from the pose evaluated ahead of time
+ * when possible, and remembers how many channels the object consumed so that
+ * later frames can evaluate them ahead of time as well.
+ */
+static s16 geo_next_anim_value(void) {
+    s32 channel = (gCurrAnimAttribute - sCurAnimAttributeBase) / 2;
+
+    if (channel >= sCurAnimChannelsRead) {
+        sCurAnimChannelsRead = channel + 1;
+    }
+    if (sCurAnimPose != NULL && channel < sCurAnimPose->numChannels) {
+        gCurrAnimAttribute += 2;
+        return sCurAnimPose->values[channel];
+    }
+    return gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
+}
+#endif
+
 /**
  * Render an animated part. The current animation state is not part of the node
  * but set in global variables. If an animated part is skipped, everything afterwards desyncs.
@@ -547,33 +623,33 @@ static void geo_process_animated_part(struct GraphNodeAnimatedPart *node) {
     Mat4 matrix;
     Vec3s rotation;
     Vec3f translation;
-    Mtx *matrixPtr = alloc_display_list(sizeof(*matrixPtr));
+    Mtx *matrixPtr = alloc_display_list_category(sizeof(*matrixPtr), GFX_ALLOC_MATRICES);
 
     vec3s_copy(rotation, gVec3sZero);
     vec3f_set(translation, node->translation[0], node->translation[1], node->translation[2]);
     if (gCurAnimType == ANIM_TYPE_TRANSLATION) {
-        translation[0] += gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+        translation[0] += geo_next_anim_value()
                           * gCurAnimTranslationMultiplier;
-        translation[1] += gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+        translation[1] += geo_next_anim_value()
                           * gCurAnimTranslationMultiplier;
-        translation[2] += gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+        translation[2] += geo_next_anim_value()
                           * gCurAnimTranslationMultiplier;
         gCurAnimType = ANIM_TYPE_ROTATION;
     } else {
         if (gCurAnimType == ANIM_TYPE_LATERAL_TRANSLATION) {
             translation[0] +=
-                gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+                geo_next_anim_value()
                 * gCurAnimTranslationMultiplier;
             gCurrAnimAttribute += 2;
             translation[2] +=
-                gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+                geo_next_anim_value()
                 * gCurAnimTranslationMultiplier;
             gCurAnimType = ANIM_TYPE_ROTATION;
         } else {
             if (gCurAnimType == ANIM_TYPE_VERTICAL_TRANSLATION) {
                 gCurrAnimAttribute += 2;
                 translation[1] +=
-                    gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+                    geo_next_anim_value()
                     * gCurAnimTranslationMultiplier;
                 gCurrAnimAttribute += 2;
                 gCurAnimType = ANIM_TYPE_ROTATION;
@@ -585,15 +661,16 @@ static void geo_process_animated_part(struct GraphNodeAnimatedPart *node) {
     }
 
     if (gCurAnimType == ANIM_TYPE_ROTATION) {
-        rotation[0] = gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
-        rotation[1] = gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
-        rotation[2] = gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)];
+        rotation[0] = geo_next_anim_value();
+        rotation[1] = geo_next_anim_value();
+        rotation[2] = geo_next_anim_value();
     }
     mtxf_rotate_xyz_and_translate(matrix, translation, rotation);
     mtxf_mul(gMatStack[gMatStackIndex + 1], matrix, gMatStack[gMatStackIndex]);
     gMatStackIndex++;
     mtxf_to_mtx(matrixPtr, gMatStack[gMatStackIndex]);
     gMatStackFixed[gMatStackIndex] = matrixPtr;
+    geo_record_interp_mtx(node, matrixPtr);
     if (node->displayList != NULL) {
         geo_append_display_list(node->displayList, node->node.flags >> 8);
     }
@@ -634,6 +711,15 @@ void geo_set_animation_globals(struct AnimInfo *node, s32 hasAnimation) {
     } else {
         gCurAnimTranslationMultiplier = (f32) node->animYTrans / (f32) anim->animYTransDivisor;
     }
+
+#ifndef TARGET_N64
+    sCurAnimAttributeBase = gCurrAnimAttribute;
+    sCurAnimChannelsRead = 0;
+    sCurAnimPose = anim_pose_find(node);
+    if (sCurAnimPose != NULL && (sCurAnimPose->anim != anim || sCurAnimPose->frame != gCurrAnimFrame)) {
+        sCurAnimPose = NULL;
+    }
+#endif
 }
 
 /**
@@ -672,12 +758,12 @@ static void geo_process_shadow(struct GraphNodeShadow *node) {
                     objScale = ((struct GraphNodeScale *) geo)->scale;
                 }
                 animOffset[0] =
-                    gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+                    geo_next_anim_value()
                     * gCurAnimTranslationMultiplier * objScale;
                 animOffset[1] = 0.0f;
                 gCurrAnimAttribute += 2;
                 animOffset[2] =
-                    gCurAnimData[retrieve_animation_index(gCurrAnimFrame, &gCurrAnimAttribute)]
+                    geo_next_anim_value()
                     * gCurAnimTranslationMultiplier * objScale;
                 gCurrAnimAttribute -= 6;
 
@@ -693,12 +779,13 @@ static void geo_process_shadow(struct GraphNodeShadow *node) {
         shadowList = create_shadow_below_xyz(shadowPos[0], shadowPos[1], shadowPos[2], shadowScale,
                                              node->shadowSolidity, node->shadowType);
         if (shadowList != NULL) {
-            mtx = alloc_display_list(sizeof(*mtx));
+            mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
             gMatStackIndex++;
             mtxf_translate(mtxf, shadowPos);
             mtxf_mul(gMatStack[gMatStackIndex], mtxf, *gCurGraphNodeCamera->matrixPtr);
             mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
             gMatStackFixed[gMatStackIndex] = mtx;
+            geo_record_interp_mtx(node, mtx);
             if (gShadowAboveWaterOrLava == TRUE) {
                 geo_append_display_list((void *) VIRTUAL_TO_PHYSICAL(shadowList), 4);
             } else if (gMarioOnIceOrCarpet == 1) {
@@ -803,6 +890,28 @@ static s32 obj_is_in_view(struct GraphNodeObject *node, Mat4 matrix) {
     return TRUE;
 }
 
+#ifndef TARGET_N64
+/**
+ * Whether geo_process_object will draw the object with this camera matrix.
+ * Only the translation of the object's matrix is used by obj_is_in_view, so
+ * only that row is computed, the same way geo_process_object computes it.
+ */
+s32 geo_obj_is_in_view(struct GraphNodeObject *node, Mat4 cameraMatrix) {
+    Mat4 matrix;
+    f32 *pos = node->pos;
+    s32 i;
+
+    if (node->throwMatrix != NULL) {
+        pos = (*node->throwMatrix)[3];
+    }
+    for (i = 0; i < 3; i++) {
+        matrix[3][i] = pos[0] * cameraMatrix[0][i] + pos[1] * cameraMatrix[1][i]
+                       + pos[2] * cameraMatrix[2][i] + cameraMatrix[3][i];
+    }
+    return obj_is_in_view(node, matrix);
+}
+#endif
+
 /**
  * Process an object node.
  */
@@ -834,10 +943,11 @@ static void geo_process_object(struct Object *node) {
             geo_set_animation_globals(&node->header.gfx.animInfo, hasAnimation);
         }
         if (obj_is_in_view(&node->header.gfx, gMatStack[gMatStackIndex])) {
-            Mtx *mtx = alloc_display_list(sizeof(*mtx));
+            Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
 
             mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
             gMatStackFixed[gMatStackIndex] = mtx;
+            geo_record_interp_mtx(node, mtx);
             if (node->header.gfx.sharedChild != NULL) {
                 gCurGraphNodeObject = (struct GraphNodeObject *) node;
                 node->header.gfx.sharedChild->parent = &node->header.gfx.node;
@@ -851,6 +961,12 @@ static void geo_process_object(struct Object *node) {
         }
 
         gMatStackIndex--;
+#ifndef TARGET_N64
+        if (node->header.gfx.animInfo.curAnim != NULL) {
+            anim_pose_record_channels(node->header.gfx.animInfo.curAnim, sCurAnimChannelsRead);
+        }
+        sCurAnimPose = NULL;
+#endif
         gCurAnimType = ANIM_TYPE_NONE;
         node->header.gfx.throwMatrix = NULL;
     }
@@ -863,6 +979,10 @@ static void geo_process_object(struct Object *node) {
  */
 static void geo_process_object_parent(struct GraphNodeObjectParent *node) {
     if (node->sharedChild != NULL) {
+#ifndef TARGET_N64
+        anim_pose_evaluate_objects(node->sharedChild, gCurGraphNodeRoot->areaIndex,
+                                   gMatStack[gMatStackIndex]);
+#endif
         node->sharedChild->parent = (struct GraphNode *) node;
         geo_process_node_and_siblings(node->sharedChild);
         node->sharedChild->parent = NULL;
@@ -878,7 +998,12 @@ static void geo_process_object_parent(struct GraphNodeObjectParent *node) {
 void geo_process_held_object(struct GraphNodeHeldObject *node) {
     Mat4 mat;
     Vec3f translation;
-    Mtx *mtx = alloc_display_list(sizeof(*mtx));
+    Mtx *mtx = alloc_display_list_category(sizeof(*mtx), GFX_ALLOC_MATRICES);
+#ifndef TARGET_N64
+    struct AnimPose *savedPose;
+    u16 *savedAttributeBase;
+    s32 savedChannelsRead;
+#endif
 
 #ifdef F3DEX_GBI_2
     gSPLookAt(gDisplayListHead++, &lookAt);
@@ -909,12 +1034,19 @@ void geo_process_held_object(struct GraphNodeHeldObject *node) {
         gMatStackIndex++;
         mtxf_to_mtx(mtx, gMatStack[gMatStackIndex]);
         gMatStackFixed[gMatStackIndex] = mtx;
+        geo_record_interp_mtx(node, mtx);
         gGeoTempState.type = gCurAnimType;
         gGeoTempState.enabled = gCurAnimEnabled;
         gGeoTempState.frame = gCurrAnimFrame;
         gGeoTempState.translationMultiplier = gCurAnimTranslationMultiplier;
         gGeoTempState.attribute = gCurrAnimAttribute;
         gGeoTempState.data = gCurAnimData;
+#ifndef TARGET_N64
+        savedPose = sCurAnimPose;
+        savedAttributeBase = sCurAnimAttributeBase;
+        savedChannelsRead = sCurAnimChannelsRead;
+        sCurAnimPose = NULL;
+#endif
         gCurAnimType = 0;
         gCurGraphNodeHeldObject = (void *) node;
         if (node->objNode->header.gfx.animInfo.curAnim != NULL) {
@@ -922,6 +1054,14 @@ void geo_process_held_object(struct GraphNodeHeldObject *node) {
         }
 
         geo_process_node_and_siblings(node->objNode->header.gfx.sharedChild);
+#ifndef TARGET_N64
+        if (node->objNode->header.gfx.animInfo.curAnim != NULL) {
+            anim_pose_record_channels(node->objNode->header.gfx.animInfo.curAnim, sCurAnimChannelsRead);
+        }
+        sCurAnimPose = savedPose;
+        sCurAnimAttributeBase = savedAttributeBase;
+        sCurAnimChannelsRead = savedChannelsRead;
+#endif
         gCurGraphNodeHeldObject = NULL;
         gCurAnimType = gGeoTempState.type;
         gCurAnimEnabled = gGeoTempState.enabled;
@@ -1057,7 +1197,7 @@ void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor)
         gDisplayListHeap = alloc_only_pool_init(main_pool_available() - sizeof(struct AllocOnlyPool),
                                                 MEMORY_POOL_LEFT);
 #endif
-        initialMatrix = alloc_display_list(sizeof(*initialMatrix));
+        initialMatrix = alloc_display_list_category(sizeof(*initialMatrix), GFX_ALLOC_MATRICES);
         gMatStackIndex = 0;
         gCurAnimType = 0;
         vec3s_set(viewport->vp.vtrans, node->x * 4, node->y * 4, 511);
@@ -1083,6 +1223,9 @@ void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor)
         if (node->node.children != NULL) {
             geo_process_node_and_siblings(node->node.children);
         }
+#ifndef TARGET_N64
+        shadow_flush_batch();
+#endif
         gCurGraphNodeRoot = NULL;
         if (gShowDebugText) {
 #ifndef USE_SYSTEM_MALLOC
@@ -29,5 +29,8 @@ extern u16 gAreaUpdateCounter;
 
 void geo_process_node_and_siblings(struct GraphNode *firstNode);
 void geo_process_root(struct GraphNodeRoot *node, Vp *b, Vp *c, s32 clearColor);
+#ifndef TARGET_N64
+s32 geo_obj_is_in_view(struct GraphNodeObject *node, Mat4 cameraMatrix);
+#endif
 
 #endif // RENDERING_GRAPH_NODE_H
@@ -15,7 +15,7 @@
 
 #ifndef TARGET_N64
 // Avoid Z-fighting
-#define find_floor_height_and_data 0.4 + find_floor_height_and_data
+#define find_floor_height_and_data 0.4 + shadow_find_floor_height_and_data
 #endif
 
 /**
@@ -111,6 +111,114 @@ s8 gMarioOnIceOrCarpet;
 s8 sMarioOnFlyingCarpet;
 s16 sSurfaceTypeBelowShadow;
 
+#ifndef TARGET_N64
+/**
+ * On PC the floor queries of the shadows are cached by position until the end of the frame. The
+ * floor below a shadow's center is found by create_shadow_below_xyz and then again by init_shadow
+ * or get_shadow_height_solidity, and objects at the same spot share their queries. The cache is
+ * only filled while rendering, when the collision doesn't change anymore. The floors the objects
+ * found during their own update can't be reused, since other objects were still loading their
+ * collision then.
+ */
+#define SHADOW_FLOOR_CACHE_SIZE 256
+
+struct ShadowFloorQuery {
+    f32 x;
+    f32 y;
+    f32 z;
+    f32 floorHeight;
+    struct Surface *floor;
+    /* Value of sShadowFloorCacheFrame when this query was made. */
+    u32 frame;
+};
+
+static struct ShadowFloorQuery sShadowFloorCache[SHADOW_FLOOR_CACHE_SIZE];
+static u32 sShadowFloorCacheFrame = 1;
+static struct FloorGeometry sShadowFloorGeo;
+
+/**
+ * The vertices of the circular shadows are generated for all shadows at once at the end of the
+ * frame by shadow_flush_batch, instead of one shadow at a time while the scene graph is processed.
+ */
+#define SHADOW_BATCH_MAX_SHADOWS 128
+#define SHADOW_BATCH_MAX_VERTS (SHADOW_BATCH_MAX_SHADOWS * 9)
+
+struct ShadowBatchEntry {
+    Vtx *verts;
+    struct Shadow shadow;
+    s8 shadowVertexType;
+    /* Copies of the globals that make_shadow_vertex would have read. */
+    s8 aboveWaterOrLava;
+    s8 onFlyingCarpet;
+};
+
+static struct ShadowBatchEntry sShadowBatch[SHADOW_BATCH_MAX_SHADOWS];
+static s32 sShadowBatchCount;
+
+/* Per vertex inputs and outputs of the vertex position loop in shadow_flush_batch. */
+static f32 sBatchHalfScale[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchHalfTiltedScale[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchSinAngle[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchCosAngle[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchParentX[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchParentZ[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchX[SHADOW_BATCH_MAX_VERTS];
+static f32 sBatchZ[SHADOW_BATCH_MAX_VERTS];
+
+static u32 shadow_floor_cache_slot(f32 x, f32 y, f32 z) {
+    union {
+        f32 f;
+        u32 u;
+    } bx, by, bz;
+    u32 hash;
+
+    bx.f = x;
+    by.f = y;
+    bz.f = z;
+    hash = bx.u * 0x9E3779B1 ^ by.u * 0x85EBCA77 ^ bz.u * 0xC2B2AE3D;
+    return (hash ^ (hash >> 15)) & (SHADOW_FLOOR_CACHE_SIZE - 1);
+}
+
+/**
+ * find_floor, with the result cached for the rest of the frame.
+ */
+static f32 shadow_find_floor(f32 xPos, f32 yPos, f32 zPos, struct Surface **pfloor) {
+    struct ShadowFloorQuery *query = &sShadowFloorCache[shadow_floor_cache_slot(xPos, yPos, zPos)];
+
+    if (query->frame != sShadowFloorCacheFrame || query->x != xPos || query->y != yPos
+        || query->z != zPos) {
+        query->x = xPos;
+        query->y = yPos;
+        query->z = zPos;
+        query->floorHeight = find_floor(xPos, yPos, zPos, &query->floor);
+        query->frame = sShadowFloorCacheFrame;
+    }
+    *pfloor = query->floor;
+    return query->floorHeight;
+}
+
+/**
+ * find_floor_height_and_data on top of shadow_find_floor.
+ */
+static f32 shadow_find_floor_height_and_data(f32 xPos, f32 yPos, f32 zPos,
+                                             struct FloorGeometry **floorGeo) {
+    struct Surface *floor;
+    f32 floorHeight = shadow_find_floor(xPos, yPos, zPos, &floor);
+
+    *floorGeo = NULL;
+
+    if (floor != NULL) {
+        sShadowFloorGeo.normalX = floor->normal.x;
+        sShadowFloorGeo.normalY = floor->normal.y;
+        sShadowFloorGeo.normalZ = floor->normal.z;
+        sShadowFloorGeo.originOffset = floor->originOffset;
+
+        *floorGeo = &sShadowFloorGeo;
+    }
+    return floorHeight;
+}
+#endif
+
 /**
  * Let (oldZ, oldX) be the relative coordinates of a point on a rectangle,
  * assumed to be centered at the origin on the standard SM64 X-Z plane. This
@@ -465,6 +573,112 @@ void make_shadow_vertex(Vtx *vertices, s8 index, struct Shadow s, s8 shadowVerte
     make_shadow_vertex_at_xyz(vertices, index, relX, relY, relZ, solidity, shadowVertexType);
 }
 
+#ifndef TARGET_N64
+/**
+ * Queue the vertices of a circular shadow to be made by shadow_flush_batch.
+ */
+static void shadow_batch_add(Vtx *vertices, struct Shadow *s, s8 shadowVertexType) {
+    struct ShadowBatchEntry *entry;
+
+    if (sShadowBatchCount == SHADOW_BATCH_MAX_SHADOWS) {
+        shadow_flush_batch();
+    }
+    entry = &sShadowBatch[sShadowBatchCount++];
+    entry->verts = vertices;
+    entry->shadow = *s;
+    entry->shadowVertexType = shadowVertexType;
+    entry->aboveWaterOrLava = gShadowAboveWaterOrLava;
+    entry->onFlyingCarpet = sMarioOnFlyingCarpet;
+}
+
+/**
+ * Make the vertices of all queued shadows, the same way make_shadow_vertex does. The horizontal
+ * positions of all vertices are computed in one loop over flat arrays, which the compiler can
+ * vectorize. The heights need floor queries and are done one vertex at a time afterwards.
+ */
+void shadow_flush_batch(void) {
+    struct ShadowBatchEntry *entry;
+    struct Shadow *s;
+    struct FloorGeometry *dummy;
+    s8 savedOnFlyingCarpet = sMarioOnFlyingCarpet;
+    s8 xCoordUnit;
+    s8 zCoordUnit;
+    s32 numVerts = 0;
+    s32 shadowVerts;
+    s32 i;
+    s32 j;
+
+    for (i = 0; i < sShadowBatchCount; i++) {
+        f32 tiltedScale;
+        f32 downwardAngle;
+        f32 sinAngle;
+        f32 cosAngle;
+
+        entry = &sShadowBatch[i];
+        s = &entry->shadow;
+        tiltedScale = cosf(s->floorTilt * M_PI / 180.0) * s->shadowScale;
+        downwardAngle = s->floorDownwardAngle * M_PI / 180.0;
+        sinAngle = sinf(downwardAngle);
+        cosAngle = cosf(downwardAngle);
+        shadowVerts = entry->shadowVertexType == SHADOW_WITH_9_VERTS ? 9 : 4;
+
+        for (j = 0; j < shadowVerts; j++) {
+            get_vertex_coords(j, entry->shadowVertexType, &xCoordUnit, &zCoordUnit);
+            sBatchHalfScale[numVerts] = (xCoordUnit * s->shadowScale) / 2.0;
+            sBatchHalfTiltedScale[numVerts] = (zCoordUnit * tiltedScale) / 2.0;
+            sBatchSinAngle[numVerts] = sinAngle;
+            sBatchCosAngle[numVerts] = cosAngle;
+            sBatchParentX[numVerts] = s->parentX;
+            sBatchParentZ[numVerts] = s->parentZ;
+            numVerts++;
+        }
+    }
+
+    for (i = 0; i < numVerts; i++) {
+        sBatchX[i] = (sBatchHalfTiltedScale[i] * sBatchSinAngle[i])
+                     + (sBatchHalfScale[i] * sBatchCosAngle[i]) + sBatchParentX[i];
+        sBatchZ[i] = (sBatchHalfTiltedScale[i] * sBatchCosAngle[i])
+                     - (sBatchHalfScale[i] * sBatchSinAngle[i]) + sBatchParentZ[i];
+    }
+
+    numVerts = 0;
+    for (i = 0; i < sShadowBatchCount; i++) {
+        entry = &sShadowBatch[i];
+        s = &entry->shadow;
+        shadowVerts = entry->shadowVertexType == SHADOW_WITH_9_VERTS ? 9 : 4;
+        sMarioOnFlyingCarpet = entry->onFlyingCarpet;
+
+        for (j = 0; j < shadowVerts; j++, numVerts++) {
+            f32 xPosVtx = sBatchX[numVerts];
+            f32 zPosVtx = sBatchZ[numVerts];
+            f32 yPosVtx;
+            u8 solidity = s->solidity;
+
+            if (entry->aboveWaterOrLava) {
+                solidity = 200;
+                yPosVtx = s->floorHeight;
+            } else if (entry->shadowVertexType == SHADOW_WITH_9_VERTS) {
+                // See make_shadow_vertex
+                yPosVtx = find_floor_height_and_data(xPosVtx, s->parentY, zPosVtx, &dummy);
+                if (floor_local_tilt(*s, xPosVtx, yPosVtx, zPosVtx) != 0) {
+                    yPosVtx = extrapolate_vertex_y_position(*s, xPosVtx, zPosVtx);
+                    solidity = 0;
+                }
+            } else {
+                yPosVtx = extrapolate_vertex_y_position(*s, xPosVtx, zPosVtx);
+            }
+
+            make_shadow_vertex_at_xyz(entry->verts, j, xPosVtx - s->parentX, yPosVtx - s->parentY,
+                                      zPosVtx - s->parentZ, solidity, entry->shadowVertexType);
+        }
+    }
+
+    sMarioOnFlyingCarpet = savedOnFlyingCarpet;
+    sShadowBatchCount = 0;
+    sShadowFloorCacheFrame++;
+}
+#endif
+
 /**
  * Add a shadow to the given display list.
  */
@@ -600,7 +814,9 @@ Gfx *create_shadow_player(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 soli
     Gfx *displayList;
     struct Shadow shadow;
     s8 ret;
+#ifdef TARGET_N64
     s32 i;
+#endif
 
     // Update global variables about whether Mario is on a flying carpet.
     if (gCurrLevelNum == LEVEL_RR && sSurfaceTypeBelowShadow != SURFACE_DEATH_PLANE) {
@@ -630,7 +846,7 @@ Gfx *create_shadow_player(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 soli
         return NULL;
     }
 
-    verts = alloc_display_list(9 * sizeof(Vtx));
+    verts = alloc_display_list_category(9 * sizeof(Vtx), GFX_ALLOC_VERTICES);
     displayList = alloc_display_list(5 * sizeof(Gfx));
     if (verts == NULL || displayList == NULL) {
         return NULL;
@@ -638,9 +854,13 @@ Gfx *create_shadow_player(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 soli
 
     correct_lava_shadow_height(&shadow);
 
+#ifdef TARGET_N64
     for (i = 0; i < 9; i++) {
         make_shadow_vertex(verts, i, shadow, SHADOW_WITH_9_VERTS);
     }
+#else
+    shadow_batch_add(verts, &shadow, SHADOW_WITH_9_VERTS);
+#endif
     add_shadow_to_display_list(displayList, verts, SHADOW_WITH_9_VERTS, SHADOW_SHAPE_CIRCLE);
     return displayList;
 }
@@ -652,21 +872,27 @@ Gfx *create_shadow_circle_9_verts(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale,
     Vtx *verts;
     Gfx *displayList;
     struct Shadow shadow;
+#ifdef TARGET_N64
     s32 i;
+#endif
 
     if (init_shadow(&shadow, xPos, yPos, zPos, shadowScale, solidity) != 0) {
         return NULL;
     }
 
-    verts = alloc_display_list(9 * sizeof(Vtx));
+    verts = alloc_display_list_category(9 * sizeof(Vtx), GFX_ALLOC_VERTICES);
     displayList = alloc_display_list(5 * sizeof(Gfx));
 
     if (verts == NULL || displayList == NULL) {
         return 0;
     }
+#ifdef TARGET_N64
     for (i = 0; i < 9; i++) {
         make_shadow_vertex(verts, i, shadow, SHADOW_WITH_9_VERTS);
     }
+#else
+    shadow_batch_add(verts, &shadow, SHADOW_WITH_9_VERTS);
+#endif
     add_shadow_to_display_list(displayList, verts, SHADOW_WITH_9_VERTS, SHADOW_SHAPE_CIRCLE);
     return displayList;
 }
@@ -678,22 +904,28 @@ Gfx *create_shadow_circle_4_verts(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale,
     Vtx *verts;
     Gfx *displayList;
     struct Shadow shadow;
+#ifdef TARGET_N64
     s32 i;
+#endif
 
     if (init_shadow(&shadow, xPos, yPos, zPos, shadowScale, solidity) != 0) {
         return NULL;
     }
 
-    verts = alloc_display_list(4 * sizeof(Vtx));
+    verts = alloc_display_list_category(4 * sizeof(Vtx), GFX_ALLOC_VERTICES);
     displayList = alloc_display_list(5 * sizeof(Gfx));
 
     if (verts == NULL || displayList == NULL) {
         return 0;
     }
 
+#ifdef TARGET_N64
     for (i = 0; i < 4; i++) {
         make_shadow_vertex(verts, i, shadow, SHADOW_WITH_4_VERTS);
     }
+#else
+    shadow_batch_add(verts, &shadow, SHADOW_WITH_4_VERTS);
+#endif
     add_shadow_to_display_list(displayList, verts, SHADOW_WITH_4_VERTS, SHADOW_SHAPE_CIRCLE);
     return displayList;
 }
@@ -717,7 +949,7 @@ Gfx *create_shadow_circle_assuming_flat_ground(f32 xPos, f32 yPos, f32 zPos, s16
         distBelowFloor = floorHeight - yPos;
     }
 
-    verts = alloc_display_list(4 * sizeof(Vtx));
+    verts = alloc_display_list_category(4 * sizeof(Vtx), GFX_ALLOC_VERTICES);
     displayList = alloc_display_list(5 * sizeof(Gfx));
 
     if (verts == NULL || displayList == NULL) {
@@ -738,7 +970,7 @@ Gfx *create_shadow_circle_assuming_flat_ground(f32 xPos, f32 yPos, f32 zPos, s16
  * underneath the shadow is totally flat.
  */
 Gfx *create_shadow_rectangle(f32 halfWidth, f32 halfLength, f32 relY, u8 solidity) {
-    Vtx *verts = alloc_display_list(4 * sizeof(Vtx));
+    Vtx *verts = alloc_display_list_category(4 * sizeof(Vtx), GFX_ALLOC_VERTICES);
     Gfx *displayList = alloc_display_list(5 * sizeof(Gfx));
     f32 frontLeftX, frontLeftZ, frontRightX, frontRightZ, backLeftX, backLeftZ, backRightX, backRightZ;
 
@@ -858,7 +1090,11 @@ Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 s
                              s8 shadowType) {
     Gfx *displayList = NULL;
     struct Surface *pfloor;
+#ifdef TARGET_N64
     find_floor(xPos, yPos, zPos, &pfloor);
+#else
+    shadow_find_floor(xPos, yPos, zPos, &pfloor);
+#endif
 
     gShadowAboveWaterOrLava = FALSE;
     gMarioOnIceOrCarpet = 0;
@@ -49,5 +49,8 @@ extern s8 gMarioOnIceOrCarpet;
  * with the given initial solidity and "shadowType" (described above).
  */
 Gfx *create_shadow_below_xyz(f32 xPos, f32 yPos, f32 zPos, s16 shadowScale, u8 shadowSolidity, s8 shadowType);
+#ifndef TARGET_N64
+void shadow_flush_batch(void);
+#endif
 
 #endif // SHADOW_H
@@ -134,6 +134,25 @@ u8 sSkyboxColors[][3] = {
  */
 #define SKYBOX_ROWS (8)
 
+#ifndef TARGET_N64
+/**
+ * On PC the skybox's display list, ortho matrix and tile vertices are allocated together, so that
+ * redraw_skybox_facing_camera can rewrite them in place for the frames rendered between two ticks.
+ */
+struct SkyboxDisplayList {
+    Gfx gfx[5 + (3 * 3) * 7]; // 5 for the start and end, plus 9 skybox tiles
+    Mtx ortho;
+    Vtx vertices[3 * 3][4];
+};
+
+// The block init_skybox_display_list writes to, and the next tile's vertices in it
+static struct SkyboxDisplayList *sCurSkybox = NULL;
+static s32 sCurSkyboxTile;
+
+// If not NULL, the skybox that create_skybox_facing_camera rewrites instead of allocating one
+static struct SkyboxDisplayList *sRedrawSkybox = NULL;
+#endif
+
 
 /**
  * Convert the camera's yaw into an x position into the scaled skybox image.
@@ -229,7 +248,11 @@ static s32 get_top_left_tile_idx(s8 player) {
  *                  SKYBOX_TILE_WIDTH to get a point in world space.
  */
 Vtx *make_skybox_rect(s32 tileIndex, s8 colorIndex) {
+#ifdef TARGET_N64
     Vtx *verts = alloc_display_list(4 * sizeof(*verts));
+#else
+    Vtx *verts = sCurSkybox->vertices[sCurSkyboxTile++];
+#endif
     s16 x = tileIndex % SKYBOX_COLS * SKYBOX_TILE_WIDTH;
     s16 y = SKYBOX_HEIGHT - tileIndex / SKYBOX_COLS * SKYBOX_TILE_HEIGHT;
 
@@ -275,7 +298,11 @@ void *create_skybox_ortho_matrix(s8 player) {
     f32 right = sSkyBoxInfo[player].scaledX + SCREEN_WIDTH;
     f32 bottom = sSkyBoxInfo[player].scaledY - SCREEN_HEIGHT;
     f32 top = sSkyBoxInfo[player].scaledY;
+#ifdef TARGET_N64
     Mtx *mtx = alloc_display_list(sizeof(*mtx));
+#else
+    Mtx *mtx = &sCurSkybox->ortho;
+#endif
 
 #ifdef WIDESCREEN
     f32 half_width = (4.0f / 3.0f) / GFX_DIMENSIONS_ASPECT_RATIO * SCREEN_WIDTH / 2;
@@ -299,14 +326,25 @@ void *create_skybox_ortho_matrix(s8 player) {
  * Creates the skybox's display list, then draws the 3x3 grid of tiles.
  */
 Gfx *init_skybox_display_list(s8 player, s8 background, s8 colorIndex) {
+#ifdef TARGET_N64
     s32 dlCommandCount = 5 + (3 * 3) * 7; // 5 for the start and end, plus 9 skybox tiles
     void *skybox = alloc_display_list(dlCommandCount * sizeof(Gfx));
-    Gfx *dlist = skybox;
+#else
+    struct SkyboxDisplayList *skybox =
+        sRedrawSkybox != NULL ? sRedrawSkybox : alloc_display_list(sizeof(struct SkyboxDisplayList));
+#endif
+    Gfx *dlist = (Gfx *) skybox;
 
     if (skybox == NULL) {
         return NULL;
     } else {
-        Mtx *ortho = create_skybox_ortho_matrix(player);
+        Mtx *ortho;
+
+#ifndef TARGET_N64
+        sCurSkybox = skybox;
+        sCurSkyboxTile = 0;
+#endif
+        ortho = create_skybox_ortho_matrix(player);
 
         gSPDisplayList(dlist++, dl_skybox_begin);
         gSPMatrix(dlist++, VIRTUAL_TO_PHYSICAL(ortho), G_MTX_PROJECTION | G_MTX_MUL | G_MTX_NOPUSH);
@@ -315,7 +353,7 @@ Gfx *init_skybox_display_list(s8 player, s8 background, s8 colorIndex) {
         gSPDisplayList(dlist++, dl_skybox_end);
         gSPEndDisplayList(dlist);
     }
-    return skybox;
+    return (Gfx *) skybox;
 }
 
 /**
@@ -353,3 +391,17 @@ Gfx *create_skybox_facing_camera(s8 player, s8 background, f32 fov,
 
     return init_skybox_display_list(player, background, colorIndex);
 }
+
+#ifndef TARGET_N64
+/**
+ * Rewrite a skybox display list returned by create_skybox_facing_camera this tick, so that it faces
+ * from pos to foc instead. Used to interpolate the skybox in the frames rendered between two ticks.
+ */
+void redraw_skybox_facing_camera(Gfx *skybox, s8 player, s8 background, f32 fov,
+                                 f32 posX, f32 posY, f32 posZ,
+                                 f32 focX, f32 focY, f32 focZ) {
+    sRedrawSkybox = (struct SkyboxDisplayList *) skybox;
+    create_skybox_facing_camera(player, background, fov, posX, posY, posZ, focX, focY, focZ);
+    sRedrawSkybox = NULL;
+}
+#endif
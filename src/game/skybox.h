@@ -7,5 +7,10 @@
 Gfx *create_skybox_facing_camera(s8 player, s8 background, f32 fov,
                                  f32 posX, f32 posY, f32 posZ,
                                  f32 focX, f32 focY, f32 focZ);
+#ifndef TARGET_N64
+void redraw_skybox_facing_camera(Gfx *skybox, s8 player, s8 background, f32 fov,
+                                 f32 posX, f32 posY, f32 posZ,
+                                 f32 focX, f32 focY, f32 focZ);
+#endif
 
 #endif // SKYBOX_H
@@ -13,9 +13,31 @@
 #include "object_fields.h"
 #include "object_helpers.h"
 #include "object_list_processor.h"
+#ifndef TARGET_N64
+#include "object_lod.h"
+#endif
 #include "spawn_object.h"
 #include "types.h"
 
+#ifndef TARGET_N64
+#define UNLOAD_BATCH_MAX_SOUND_SOURCES 64
+
+// Set between begin_object_spawn_batch and end_object_spawn_batch
+static s32 sSpawnBatchActive = FALSE;
+// The floor that snap_object_to_floor found during the spawn batch
+static s32 sSpawnBatchFloorValid;
+static Vec3f sSpawnBatchFloorPos;
+static f32 sSpawnBatchFloorHeight;
+static struct Surface *sSpawnBatchFloor;
+
+// Set between begin_object_unload_batch and end_object_unload_batch
+static s32 sUnloadBatchActive = FALSE;
+// Positions that sounds are played from, read on the first unload of the
+// batch, or -1 if they haven't been read yet
+static s32 sNumUnloadSoundSources;
+static f32 *sUnloadSoundSources[UNLOAD_BATCH_MAX_SOUND_SOURCES];
+#endif
+
 /**
  * An unused linked list struct that seems to have been replaced by ObjectNode.
  */
@@ -169,12 +191,104 @@ void init_free_object_list(void) {
 }
 #endif
 
+#ifdef USE_SYSTEM_MALLOC
+/**
+ * Make sure that the free list holds at least count objects, allocating the
+ * missing ones in a single block at the end of the list.
+ */
+static void reserve_free_objects(s32 count) {
+    struct ObjectNode *tail = &gFreeObjectList;
+    struct Object *block;
+    s32 i;
+
+    while (count > 0 && tail->next != NULL) {
+        tail = tail->next;
+        count--;
+    }
+    if (count <= 0) {
+        return;
+    }
+
+    block = (struct Object *) malloc(count * sizeof(struct Object));
+    if (block == NULL) {
+        abort();
+    }
+    for (i = 0; i < count; i++) {
+        tail->next = &block[i].header;
+        tail = tail->next;
+    }
+    tail->next = NULL;
+}
+#endif
+
+#ifndef TARGET_N64
+/**
+ * Start spawning a group of up to count objects, such as the objects of an
+ * area. The objects are allocated at once, and the surfaces must not change
+ * until end_object_spawn_batch, so that create_object can look for the floor
+ * below a spot once for all of them.
+ */
+void begin_object_spawn_batch(s32 count) {
+#ifdef USE_SYSTEM_MALLOC
+    reserve_free_objects(count);
+#endif
+    sSpawnBatchActive = TRUE;
+    sSpawnBatchFloorValid = FALSE;
+}
+
+void end_object_spawn_batch(void) {
+    sSpawnBatchActive = FALSE;
+}
+
+/**
+ * Start unloading a group of objects, such as the objects of an area. The
+ * sounds are only searched for the sources of the unloaded objects that
+ * are playing sounds, instead of for every object.
+ */
+void begin_object_unload_batch(void) {
+    sUnloadBatchActive = TRUE;
+    sNumUnloadSoundSources = -1;
+}
+
+void end_object_unload_batch(void) {
+    sUnloadBatchActive = FALSE;
+}
+
+/**
+ * Return whether stop_sounds_from_source may find sounds to stop for pos.
+ */
+static s32 unload_batch_source_has_sounds(f32 *pos) {
+    s32 i;
+
+    if (!sUnloadBatchActive) {
+        return TRUE;
+    }
+    // No sounds are played while the objects are unloaded, so the sources
+    // read on the first unload stay valid for the whole batch
+    if (sNumUnloadSoundSources < 0) {
+        sNumUnloadSoundSources = get_sound_sources(sUnloadSoundSources, UNLOAD_BATCH_MAX_SOUND_SOURCES);
+    }
+    if (sNumUnloadSoundSources > UNLOAD_BATCH_MAX_SOUND_SOURCES) {
+        return TRUE;
+    }
+    for (i = 0; i < sNumUnloadSoundSources; i++) {
+        if (sUnloadSoundSources[i] == pos) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+#endif
+
 /**
  * Clear each object list, without adding the objects back to the free list.
  */
 void clear_object_lists(struct ObjectNode *objLists) {
     s32 i;
 
+#ifdef USE_SYSTEM_MALLOC
+    begin_object_unload_batch();
+#endif
     for (i = 0; i < NUM_OBJ_LISTS; i++) {
 #ifdef USE_SYSTEM_MALLOC
         struct ObjectNode *list = objLists + i;
@@ -190,6 +304,9 @@ void clear_object_lists(struct ObjectNode *objLists) {
         objLists[i].next = &objLists[i];
         objLists[i].prev = &objLists[i];
     }
+#ifdef USE_SYSTEM_MALLOC
+    end_object_unload_batch();
+#endif
 }
 
 /**
@@ -223,7 +340,13 @@ void unload_object(struct Object *obj) {
     obj->prevObj = NULL;
 
     obj->header.gfx.throwMatrix = NULL;
+#ifndef TARGET_N64
+    if (unload_batch_source_has_sounds(obj->header.gfx.cameraToObject)) {
+        stop_sounds_from_source(obj->header.gfx.cameraToObject);
+    }
+#else
     stop_sounds_from_source(obj->header.gfx.cameraToObject);
+#endif
     geo_remove_child(&obj->header.gfx.node);
 #ifndef USE_SYSTEM_MALLOC
     geo_add_child(&gObjParentGraphNode, &obj->header.gfx.node);
@@ -327,6 +450,10 @@ struct Object *allocate_object(struct ObjectNode *objList) {
     obj->header.gfx.pos[2] = -10000.0f;
     obj->header.gfx.throwMatrix = NULL;
 
+#ifndef TARGET_N64
+    object_lod_init_object(obj);
+#endif
+
     return obj;
 }
 
@@ -336,7 +463,30 @@ struct Object *allocate_object(struct ObjectNode *objList) {
 static void snap_object_to_floor(struct Object *obj) {
     struct Surface *surface;
 
+#ifndef TARGET_N64
+    // The objects of a batch are snapped before they're moved, so they all look
+    // below the same spot. find_floor includes intangible floors once when asked
+    // to, so that query isn't reused.
+    if (!sSpawnBatchActive || gFindFloorIncludeSurfaceIntangible) {
+        obj->oFloorHeight = find_floor(obj->oPosX, obj->oPosY, obj->oPosZ, &surface);
+    } else if (sSpawnBatchFloorValid && sSpawnBatchFloorPos[0] == obj->oPosX
+               && sSpawnBatchFloorPos[1] == obj->oPosY && sSpawnBatchFloorPos[2] == obj->oPosZ) {
+        obj->oFloorHeight = sSpawnBatchFloorHeight;
+        // Keep the debug counters as if find_floor was called
+        if (sSpawnBatchFloor == NULL) {
+            gNumFindFloorMisses++;
+        }
+        gNumCalls.floor++;
+    } else {
+        obj->oFloorHeight = find_floor(obj->oPosX, obj->oPosY, obj->oPosZ, &surface);
+        sSpawnBatchFloorValid = TRUE;
+        vec3f_set(sSpawnBatchFloorPos, obj->oPosX, obj->oPosY, obj->oPosZ);
+        sSpawnBatchFloorHeight = obj->oFloorHeight;
+        sSpawnBatchFloor = surface;
+    }
+#else
     obj->oFloorHeight = find_floor(obj->oPosX, obj->oPosY, obj->oPosZ, &surface);
+#endif
 
     if (obj->oFloorHeight + 2.0f > obj->oPosY && obj->oPosY > obj->oFloorHeight - 10.0f) {
         obj->oPosY = obj->oFloorHeight;
@@ -8,5 +8,11 @@ void clear_object_lists(struct ObjectNode *objLists);
 void unload_object(struct Object *obj);
 struct Object *create_object(const BehaviorScript *bhvScript);
 void mark_obj_for_deletion(struct Object *obj);
+#ifndef TARGET_N64
+void begin_object_spawn_batch(s32 count);
+void end_object_spawn_batch(void);
+void begin_object_unload_batch(void);
+void end_object_unload_batch(void);
+#endif
 
 #endif // SPAWN_OBJECT_H
@@ -0,0 +1,252 @@
+#ifndef TARGET_N64
+#include <PR/ultratypes.h>
+#include <stdio.h>
+
+#include "sm64.h"
+#include "area.h"
+#include "camera.h"
+#include "engine/behavior_script.h"
+#include "game_init.h"
+#include "level_update.h"
+#include "object_list_processor.h"
+#include "state_hash.h"
+
+/**
+ * @file state_hash.c
+ * Hashes the simulated state after every game tick and writes the hashes to a
+ * log, to check that two builds (another compiler, SIMD paths, the web port)
+ * run the game identically. Only values that the simulation computes are
+ * hashed, never pointers, so the hashes of two builds are comparable.
+ * tools/statehashdiff compares two logs and reports the first tick that
+ * differs and in which part of the state.
+ *
+ * The log is a header, "SM64HSH\0" followed by the version and the number of
+ * parts as u32s, then for each tick its index and the hash of every part in
+ * StateHashPart order, all u32 little endian.
+ */
+
+#define STATE_HASH_VERSION 1
+#define STATE_HASH_BUFFER_WORDS 4096
+
+#define XXH_PRIME32_1 2654435761U
+#define XXH_PRIME32_2 2246822519U
+#define XXH_PRIME32_3 3266489917U
+#define XXH_PRIME32_4 668265263U
+#define XXH_PRIME32_5 374761393U
+
+static FILE *sStateHashLog;
+static u32 sStateHashTick;
+
+// Words of the part being hashed, hashed once the part is complete or the
+// buffer is full
+static u32 sWords[STATE_HASH_BUFFER_WORDS];
+static u32 sNumWords;
+static u32 sSeed;
+
+static u32 rotl32(u32 x, u32 r) {
+    return (x << r) | (x >> (32 - r));
+}
+
+static u32 xxh32_round(u32 acc, u32 input) {
+    return rotl32(acc + input * XXH_PRIME32_2, 13) * XXH_PRIME32_1;
+}
+
+/**
+ * xxHash32 of an array of words.
+ */
+static u32 xxh32_words(const u32 *words, u32 count, u32 seed) {
+    const u32 *end = words + count;
+    u32 h;
+
+    if (count >= 4) {
+        u32 v1 = seed + XXH_PRIME32_1 + XXH_PRIME32_2;
+        u32 v2 = seed + XXH_PRIME32_2;
+        u32 v3 = seed;
+        u32 v4 = seed - XXH_PRIME32_1;
+
+        do {
+            v1 = xxh32_round(v1, words[0]);
+            v2 = xxh32_round(v2, words[1]);
+            v3 = xxh32_round(v3, words[2]);
+            v4 = xxh32_round(v4, words[3]);
+            words += 4;
+        } while (words + 4 <= end);
+        h = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) + rotl32(v4, 18);
+    } else {
+        h = seed + XXH_PRIME32_5;
+    }
+
+    h += count * 4;
+    while (words < end) {
+        h = rotl32(h + *words++ * XXH_PRIME32_3, 17) * XXH_PRIME32_4;
+    }
+
+    h ^= h >> 15;
+    h *= XXH_PRIME32_2;
+    h ^= h >> 13;
+    h *= XXH_PRIME32_3;
+    h ^= h >> 16;
+    return h;
+}
+
+static void hash_u32(u32 value) {
+    if (sNumWords == STATE_HASH_BUFFER_WORDS) {
+        sSeed = xxh32_words(sWords, sNumWords, sSeed);
+        sNumWords = 0;
+    }
+    sWords[sNumWords++] = value;
+}
+
+static void hash_f32(f32 value) {
+    union {
+        f32 f;
+        u32 u;
+    } bits;
+
+    bits.f = value;
+    hash_u32(bits.u);
+}
+
+static void hash_vec3f(Vec3f v) {
+    hash_f32(v[0]);
+    hash_f32(v[1]);
+    hash_f32(v[2]);
+}
+
+static void hash_vec3s(Vec3s v) {
+    hash_u32((u16) v[0] | ((u32) (u16) v[1] << 16));
+    hash_u32((u16) v[2]);
+}
+
+static u32 hash_finish(void) {
+    u32 hash = xxh32_words(sWords, sNumWords, sSeed);
+
+    sNumWords = 0;
+    sSeed = 0;
+    return hash;
+}
+
+static u32 state_hash_mario(void) {
+    struct MarioState *m = &gMarioStates[0];
+
+    hash_u32(m->action);
+    hash_u32(m->prevAction);
+    hash_u32(m->actionState | ((u32) m->actionTimer << 16));
+    hash_u32(m->actionArg);
+    hash_u32(m->flags);
+    hash_u32(m->input);
+    hash_vec3f(m->pos);
+    hash_vec3f(m->vel);
+    hash_f32(m->forwardVel);
+    hash_vec3s(m->faceAngle);
+    hash_vec3s(m->angleVel);
+    hash_f32(m->peakHeight);
+    hash_u32((u16) m->health | ((u32) (u16) m->numCoins << 16));
+    hash_u32((u16) m->numStars | ((u32) (u16) m->invincTimer << 16));
+    return hash_finish();
+}
+
+static u32 state_hash_objects(void) {
+    struct ObjectNode *listHead;
+    struct Object *obj;
+    s32 i;
+
+    if (gObjectLists == NULL) {
+        return hash_finish();
+    }
+
+    for (i = 0; i < NUM_OBJ_LISTS; i++) {
+        listHead = &gObjectLists[i];
+        hash_u32(i);
+        for (obj = (struct Object *) listHead->next; obj != (struct Object *) listHead;
+             obj = (struct Object *) obj->header.next) {
+            if (!(obj->activeFlags & ACTIVE_FLAG_ACTIVE)) {
+                continue;
+            }
+            hash_u32(obj->activeFlags);
+            hash_f32(obj->oPosX);
+            hash_f32(obj->oPosY);
+            hash_f32(obj->oPosZ);
+            hash_f32(obj->oVelX);
+            hash_f32(obj->oVelY);
+            hash_f32(obj->oVelZ);
+            hash_f32(obj->oForwardVel);
+            hash_u32(obj->oFaceAnglePitch);
+            hash_u32(obj->oFaceAngleYaw);
+            hash_u32(obj->oFaceAngleRoll);
+            hash_u32(obj->oMoveAngleYaw);
+            hash_u32(obj->oAction);
+            hash_u32(obj->oPrevAction);
+            hash_u32(obj->oSubAction);
+            hash_u32(obj->oTimer);
+            hash_u32(obj->oHealth);
+        }
+    }
+    return hash_finish();
+}
+
+static u32 state_hash_globals(void) {
+    hash_u32(gGlobalTimer);
+    hash_u32(random_get_seed());
+    return hash_finish();
+}
+
+static u32 state_hash_camera(void) {
+    // gCamera isn't cleared when its area is unloaded
+    struct Camera *c = gCurrentArea != NULL ? gCurrentArea->camera : NULL;
+
+    hash_vec3f(gLakituState.curFocus);
+    hash_vec3f(gLakituState.curPos);
+    hash_vec3f(gLakituState.goalFocus);
+    hash_vec3f(gLakituState.goalPos);
+    hash_u32(gLakituState.mode);
+    if (c != NULL) {
+        hash_u32(c->mode | ((u32) (u16) c->yaw << 16));
+        hash_vec3f(c->focus);
+        hash_vec3f(c->pos);
+    }
+    return hash_finish();
+}
+
+static void write_u32(u8 *dest, u32 value) {
+    dest[0] = value;
+    dest[1] = value >> 8;
+    dest[2] = value >> 16;
+    dest[3] = value >> 24;
+}
+
+/**
+ * Start logging the state hashes to a file. Return FALSE if it can't be
+ * created.
+ */
+s32 state_hash_open(const char *path) {
+    u8 header[16] = "SM64HSH";
+
+    sStateHashLog = fopen(path, "wb");
+    if (sStateHashLog == NULL) {
+        return FALSE;
+    }
+    write_u32(header + 8, STATE_HASH_VERSION);
+    write_u32(header + 12, STATE_HASH_NUM_PARTS);
+    fwrite(header, 1, sizeof(header), sStateHashLog);
+    return TRUE;
+}
+
+/**
+ * Hash the state at the end of a game tick and log it.
+ */
+void state_hash_frame(void) {
+    u8 record[4 * (1 + STATE_HASH_NUM_PARTS)];
+
+    if (sStateHashLog == NULL) {
+        return;
+    }
+
+    write_u32(record, sStateHashTick++);
+    write_u32(record + 4 * (1 + STATE_HASH_MARIO), state_hash_mario());
+    write_u32(record + 4 * (1 + STATE_HASH_OBJECTS), state_hash_objects());
+    write_u32(record + 4 * (1 + STATE_HASH_GLOBALS), state_hash_globals());
+    write_u32(record + 4 * (1 + STATE_HASH_CAMERA), state_hash_camera());
+    fwrite(record, 1, sizeof(record), sStateHashLog);
+}
+#endif
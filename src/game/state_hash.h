@@ -0,0 +1,21 @@
+#ifndef STATE_HASH_H
+#define STATE_HASH_H
+
+#include <PR/ultratypes.h>
+
+/**
+ * Parts of the game state that are hashed separately, so that a diff of two
+ * logs can tell where a desync started.
+ */
+enum StateHashPart {
+    STATE_HASH_MARIO,
+    STATE_HASH_OBJECTS,
+    STATE_HASH_GLOBALS,
+    STATE_HASH_CAMERA,
+    STATE_HASH_NUM_PARTS
+};
+
+s32 state_hash_open(const char *path);
+void state_hash_frame(void);
+
+#endif // STATE_HASH_H
@@ -224,7 +224,10 @@ struct ObjJoint {
     /* 0x20C */ struct GdObj *attachedToObj;  // object that this object is attached to
     /* 0x210 */ u8  pad210[0x228-0x210];
     /* 0x228 */ f32 unk228;
-}; /* sizeof = 0x22C */
+#ifndef TARGET_N64
+    /* 0x22C */ struct GdSkinWeights *skinWeights; // weightGrp flattened by func_80181894
+#endif
+}; /* sizeof = 0x22C on N64, larger on PC where skinWeights is appended */
 
 /* Particle Types (+60)
    3 = Has groups of other particles in 6C?
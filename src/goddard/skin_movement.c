@@ -1,11 +1,13 @@
 #include <PR/ultratypes.h>
 
 #include "debug_utils.h"
+#include "gd_macros.h"
 #include "gd_math.h"
 #include "gd_types.h"
 #include "joints.h"
 #include "macros.h"
 #include "objects.h"
+#include "renderer.h"
 #include "skin.h"
 #include "skin_movement.h"
 
@@ -14,6 +16,28 @@ struct ObjWeight *sResetCurWeight;
 static Mat4f D_801B9EA8; // TODO: rename to sHead2Mtx?
 static struct ObjJoint *D_801B9EE8;  // set but not used
 
+#ifndef TARGET_N64
+#define SKIN_WEIGHTS_CHUNK 16
+
+/**
+ * The positive weights of a joint's weightGrp, in group order, with their
+ * offsets in struct of arrays form, so that the offsets can be transformed
+ * several at a time instead of following the group's linked list and
+ * transforming them one by one. The offsets are padded with zeros to a whole
+ * number of chunks.
+ */
+struct GdSkinWeights {
+    s32 count;
+    s32 capacity;
+    s32 memberCount; // memberCount of weightGrp when this was built, -1 once stale
+    f32 *x;
+    f32 *y;
+    f32 *z;
+    f32 *weight;
+    struct ObjVertex **vtx;
+};
+#endif
+
 /* @ 22FDB0 for 0x180 */
 void func_801815E0(Mat4f *mtx) {
     struct GdVec3f scratchVec;
@@ -73,8 +97,134 @@ void move_skin(struct ObjNet *net) {
     }
 }
 
+#ifndef TARGET_N64
+/**
+ * Flatten the positive weights of `joint` into its GdSkinWeights, allocating
+ * it from the goddard heap the first time or when the group has grown.
+ */
+static struct GdSkinWeights *build_skin_weights(struct ObjJoint *joint, struct ObjGroup *weightGroup) {
+    struct GdSkinWeights *sw = joint->skinWeights;
+    struct ListNode *link;
+    struct ObjWeight *curWeight;
+    s32 capacity;
+    s32 i;
+    u8 *mem;
+
+    // Padded to whole chunks, since skin_transform_chunk always transforms a full chunk
+    capacity = ALIGN(weightGroup->memberCount, SKIN_WEIGHTS_CHUNK);
+    if (sw == NULL || sw->capacity < capacity) {
+        mem = gd_malloc_perm(sizeof(struct GdSkinWeights)
+                             + capacity * (4 * sizeof(f32) + sizeof(struct ObjVertex *)));
+        if (mem == NULL) {
+            return NULL;
+        }
+        sw = (struct GdSkinWeights *) mem;
+        mem += sizeof(struct GdSkinWeights);
+        sw->vtx = (struct ObjVertex **) mem;
+        mem += capacity * sizeof(struct ObjVertex *);
+        sw->x = (f32 *) mem;
+        sw->y = sw->x + capacity;
+        sw->z = sw->y + capacity;
+        sw->weight = sw->z + capacity;
+        sw->capacity = capacity;
+        joint->skinWeights = sw;
+    }
+
+    sw->count = 0;
+    for (link = weightGroup->firstMember; link != NULL; link = link->next) {
+        curWeight = (struct ObjWeight *) link->obj;
+        if (curWeight->weightVal > 0.0) {
+            sw->x[sw->count] = curWeight->vec20.x;
+            sw->y[sw->count] = curWeight->vec20.y;
+            sw->z[sw->count] = curWeight->vec20.z;
+            sw->weight[sw->count] = curWeight->weightVal;
+            sw->vtx[sw->count] = curWeight->vtx;
+            sw->count++;
+        }
+    }
+    for (i = sw->count; i < sw->capacity; i++) {
+        sw->x[i] = sw->y[i] = sw->z[i] = 0.0f;
+    }
+    sw->memberCount = weightGroup->memberCount;
+    return sw;
+}
+
+/**
+ * Transform a chunk of weight offsets by `mtx` with the same operations as
+ * gd_rotate_and_translate_vec3f, so the results are identical. The chunk has
+ * a fixed size and the pointers don't alias, so that the compiler vectorizes
+ * the loop.
+ */
+static void skin_transform_chunk(f32 *__restrict outX, f32 *__restrict outY, f32 *__restrict outZ,
+                                 const f32 *__restrict x, const f32 *__restrict y,
+                                 const f32 *__restrict z, const Mat4f *mtx) {
+    f32 m00 = (*mtx)[0][0];
+    f32 m01 = (*mtx)[0][1];
+    f32 m02 = (*mtx)[0][2];
+    f32 m10 = (*mtx)[1][0];
+    f32 m11 = (*mtx)[1][1];
+    f32 m12 = (*mtx)[1][2];
+    f32 m20 = (*mtx)[2][0];
+    f32 m21 = (*mtx)[2][1];
+    f32 m22 = (*mtx)[2][2];
+    f32 m30 = (*mtx)[3][0];
+    f32 m31 = (*mtx)[3][1];
+    f32 m32 = (*mtx)[3][2];
+    s32 i;
+
+    for (i = 0; i < SKIN_WEIGHTS_CHUNK; i++) {
+        outX[i] = m00 * x[i] + m10 * y[i] + m20 * z[i];
+        outY[i] = m01 * x[i] + m11 * y[i] + m21 * z[i];
+        outZ[i] = m02 * x[i] + m12 * y[i] + m22 * z[i];
+        outX[i] += m30;
+        outY[i] += m31;
+        outZ[i] += m32;
+    }
+}
+#endif
+
 /* @ 230064 for 0x13C*/
 void func_80181894(struct ObjJoint *joint) {
+#ifndef TARGET_N64
+    static f32 sOutX[SKIN_WEIGHTS_CHUNK];
+    static f32 sOutY[SKIN_WEIGHTS_CHUNK];
+    static f32 sOutZ[SKIN_WEIGHTS_CHUNK];
+    struct ObjGroup *weightGroup;
+    struct GdSkinWeights *sw;
+    struct ObjVertex *connectedVtx;
+    s32 start;
+    s32 n;
+    s32 i;
+
+    weightGroup = joint->weightGrp;
+    if (weightGroup == NULL) {
+        return;
+    }
+    sw = joint->skinWeights;
+    if (sw == NULL || sw->memberCount != weightGroup->memberCount) {
+        sw = build_skin_weights(joint, weightGroup);
+        if (sw == NULL) {
+            return;
+        }
+    }
+
+    for (start = 0; start < sw->count; start += SKIN_WEIGHTS_CHUNK) {
+        skin_transform_chunk(sOutX, sOutY, sOutZ, &sw->x[start], &sw->y[start], &sw->z[start],
+                             &joint->matE8);
+
+        // Several weights can move the same vertex, so add them in group order
+        n = sw->count - start;
+        if (n > SKIN_WEIGHTS_CHUNK) {
+            n = SKIN_WEIGHTS_CHUNK;
+        }
+        for (i = 0; i < n; i++) {
+            connectedVtx = sw->vtx[start + i];
+            connectedVtx->pos.x += sOutX[i] * sw->weight[start + i];
+            connectedVtx->pos.y += sOutY[i] * sw->weight[start + i];
+            connectedVtx->pos.z += sOutZ[i] * sw->weight[start + i];
+        }
+    }
+#else
     register struct ObjGroup *weightGroup; // baseGroup? weights Only?
     struct GdVec3f stackVec;
     register struct ObjWeight *curWeight;
@@ -105,6 +255,7 @@ void func_80181894(struct ObjJoint *joint) {
             }
         }
     }
+#endif
 }
 
 /* @ 2301A0 for 0x110 */
@@ -152,6 +303,12 @@ void reset_joint_weights(struct ObjJoint *joint) {
 
     gd_inverse_mat4f(&joint->matE8, &D_801B9EA8);
     D_801B9EE8 = joint;
+#ifndef TARGET_N64
+    // The weights get new offsets and vertices
+    if (joint->skinWeights != NULL) {
+        joint->skinWeights->memberCount = -1;
+    }
+#endif
     if ((group = joint->weightGrp) != NULL) {
         apply_to_obj_types_in_group(OBJ_TYPE_WEIGHTS, (applyproc_t) reset_weight, group);
     }
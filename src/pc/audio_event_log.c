@@ -0,0 +1,69 @@
+#include <stdio.h>
+
+#include "sm64.h"
+
+#include "audio_event_log.h"
+
+/**
+ * @file audio_event_log.c
+ * Logs the sounds and music that the game starts and stops, in the event log
+ * format read by audio_render (-e), so that the audio of a play session can
+ * be rendered again without the game. Like the input recorder it is enabled
+ * from the config file, with audio_event_log.
+ *
+ * Only the sound bits are kept, not the position of the source: audio_render
+ * plays every sound at the global source. Ticks count the calls to
+ * audio_signal_game_loop_tick, the first tick is 0.
+ */
+
+static FILE *sAudioEventLog;
+static u32 sAudioEventTicks;
+
+/**
+ * Start logging the audio events to a file. Return FALSE if it can't be
+ * created.
+ */
+s32 audio_event_log_open(const char *path) {
+    sAudioEventLog = fopen(path, "w");
+    if (sAudioEventLog == NULL) {
+        return FALSE;
+    }
+    fprintf(sAudioEventLog, "# Audio events of a play session, render with audio_render -e\n");
+    return TRUE;
+}
+
+/**
+ * Count a game tick, the events after it are logged with its index.
+ */
+void audio_event_log_tick(void) {
+    sAudioEventTicks++;
+}
+
+static u32 audio_event_log_current_tick(void) {
+    return sAudioEventTicks != 0 ? sAudioEventTicks - 1 : 0;
+}
+
+void audio_event_log_sound(u32 soundBits) {
+    if (sAudioEventLog != NULL) {
+        fprintf(sAudioEventLog, "%u sound 0x%08X\n", audio_event_log_current_tick(), soundBits);
+    }
+}
+
+void audio_event_log_stop_sound(u32 soundBits) {
+    if (sAudioEventLog != NULL) {
+        fprintf(sAudioEventLog, "%u stop 0x%08X\n", audio_event_log_current_tick(), soundBits);
+    }
+}
+
+void audio_event_log_music(u8 player, u16 seqArgs, u16 fadeTimer) {
+    if (sAudioEventLog != NULL) {
+        fprintf(sAudioEventLog, "%u music %u 0x%04X %u\n", audio_event_log_current_tick(), player, seqArgs,
+                fadeTimer);
+    }
+}
+
+void audio_event_log_fade_out(u8 player, u16 fadeDuration) {
+    if (sAudioEventLog != NULL) {
+        fprintf(sAudioEventLog, "%u fadeout %u %u\n", audio_event_log_current_tick(), player, fadeDuration);
+    }
+}
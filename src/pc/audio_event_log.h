@@ -0,0 +1,13 @@
+#ifndef AUDIO_EVENT_LOG_H
+#define AUDIO_EVENT_LOG_H
+
+#include <PR/ultratypes.h>
+
+s32 audio_event_log_open(const char *path);
+void audio_event_log_tick(void);
+void audio_event_log_sound(u32 soundBits);
+void audio_event_log_stop_sound(u32 soundBits);
+void audio_event_log_music(u8 player, u16 seqArgs, u16 fadeTimer);
+void audio_event_log_fade_out(u8 player, u16 fadeDuration);
+
+#endif // AUDIO_EVENT_LOG_H
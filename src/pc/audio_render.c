@@ -0,0 +1,318 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "sm64.h"
+
+#include "audio/external.h"
+#include "seq_ids.h"
+
+#include "compat.h"
+
+/**
+ * @file audio_render.c
+ * Standalone entry point that runs the audio engine without the game loop
+ * and writes the result to a WAV file, as fast as the synthesis allows.
+ * It is linked with the same objects as the game, except pc_main.o, and is
+ * built with `make audio_render`.
+ *
+ * Usage:
+ *   sm64.<version>-audio-render [options] <output.wav>
+ *     -s <seq id>     play a sequence on the level music player
+ *     -e <event log>  play the events of a log, see below
+ *     -t <seconds>    length of the output (default: 60)
+ *     -p <preset>     audio session preset passed to sound_reset (default: 0)
+ *
+ * An event log has one event per line, and lines starting with # are ignored:
+ *   <tick> music <player> <seq args> <fade timer>   play_music
+ *   <tick> sound <sound bits>                        play_sound at the global source
+ *   <tick> stop <sound bits>                         stop_sound at the global source
+ *   <tick> fadeout <player> <fade duration>          seq_player_fade_out
+ * Ticks count game frames from the start of the output, numbers may be given
+ * in decimal or with a 0x prefix. The game writes such a log of a play session
+ * when audio_event_log is enabled in its config file, see audio_event_log.c.
+ *
+ * The audio engine keeps all of its state in globals, so one process renders
+ * one output. To render many sequences at once, run several processes.
+ * Rendering is deterministic: `make audio_render_test` renders a sequence
+ * twice and checks that both outputs are the same.
+ */
+
+#ifdef VERSION_EU
+#define TICKS_PER_SECOND 25
+#define SAMPLES_HIGH 656
+#define SAMPLES_LOW 640
+#else
+#define TICKS_PER_SECOND 30
+#define SAMPLES_HIGH 544
+#define SAMPLES_LOW 528
+#endif
+
+#define SAMPLE_RATE 32000
+
+// Two audio buffers are created for every game tick, like in pc_main.c
+#define BUFFERS_PER_TICK 2
+
+enum AudioEventType {
+    AUDIO_EVENT_MUSIC,
+    AUDIO_EVENT_SOUND,
+    AUDIO_EVENT_STOP,
+    AUDIO_EVENT_FADEOUT
+};
+
+struct AudioEvent {
+    u32 tick;
+    u32 index; // Position in the log
+    enum AudioEventType type;
+    u32 args[3];
+};
+
+// The game gets these from pc_main.c
+OSMesg gMainReceivedMesg;
+OSMesgQueue gSIEventMesgQueue;
+
+s8 gResetTimer;
+s8 gNmiResetBarsTimer;
+s8 gDebugLevelSelect;
+s8 gShowProfiler;
+s8 gShowDebugText;
+
+extern void create_next_audio_buffer(s16 *samples, u32 num_samples);
+
+static struct AudioEvent *sEvents;
+static u32 sNumEvents;
+static u32 sMaxEvents;
+
+void dispatch_audio_sptask(UNUSED struct SPTask *spTask) {
+}
+
+void set_vblank_handler(UNUSED s32 index, UNUSED struct VblankHandler *handler, UNUSED OSMesgQueue *queue, UNUSED OSMesg *msg) {
+}
+
+void exec_display_list(UNUSED struct SPTask *spTask) {
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-s seq_id | -e event_log] [-t seconds] [-p preset] output.wav\n", name);
+    exit(1);
+}
+
+static int add_event(u32 tick, enum AudioEventType type, u32 arg0, u32 arg1, u32 arg2) {
+    struct AudioEvent *event;
+
+    // Logs of play sessions have an event for most ticks, grow as needed
+    if (sNumEvents >= sMaxEvents) {
+        u32 maxEvents = sMaxEvents != 0 ? sMaxEvents * 2 : 1024;
+        struct AudioEvent *events = realloc(sEvents, maxEvents * sizeof(struct AudioEvent));
+
+        if (events == NULL) {
+            return 0;
+        }
+        sEvents = events;
+        sMaxEvents = maxEvents;
+    }
+    event = &sEvents[sNumEvents++];
+    event->tick = tick;
+    event->index = sNumEvents - 1;
+    event->type = type;
+    event->args[0] = arg0;
+    event->args[1] = arg1;
+    event->args[2] = arg2;
+    return 1;
+}
+
+static int compare_events(const void *a, const void *b) {
+    const struct AudioEvent *eventA = a;
+    const struct AudioEvent *eventB = b;
+
+    if (eventA->tick != eventB->tick) {
+        return eventA->tick < eventB->tick ? -1 : 1;
+    }
+    // Keep the order of the log for events of the same tick, qsort isn't stable
+    return eventA->index < eventB->index ? -1 : 1;
+}
+
+static int load_event_log(const char *path) {
+    char line[256];
+    char type[16];
+    unsigned long tick;
+    long long args[3]; // Sound bits don't fit in a 32-bit long
+    int lineNum = 0;
+    int ok = 1;
+    FILE *f = fopen(path, "r");
+
+    if (f == NULL) {
+        fprintf(stderr, "Could not open %s\n", path);
+        return 0;
+    }
+
+    while (ok && fgets(line, sizeof(line), f) != NULL) {
+        int n;
+
+        lineNum++;
+        if (line[0] == '#' || line[strspn(line, " \t\r\n")] == '\0') {
+            continue;
+        }
+
+        args[0] = args[1] = args[2] = 0;
+        n = sscanf(line, "%lu %15s %lli %lli %lli", &tick, type, &args[0], &args[1], &args[2]);
+        if (n >= 5 && strcmp(type, "music") == 0) {
+            ok = add_event(tick, AUDIO_EVENT_MUSIC, args[0], args[1], args[2]);
+        } else if (n >= 3 && strcmp(type, "sound") == 0) {
+            ok = add_event(tick, AUDIO_EVENT_SOUND, args[0], 0, 0);
+        } else if (n >= 3 && strcmp(type, "stop") == 0) {
+            ok = add_event(tick, AUDIO_EVENT_STOP, args[0], 0, 0);
+        } else if (n >= 4 && strcmp(type, "fadeout") == 0) {
+            ok = add_event(tick, AUDIO_EVENT_FADEOUT, args[0], args[1], 0);
+        } else {
+            fprintf(stderr, "%s:%d: invalid event\n", path, lineNum);
+            fclose(f);
+            return 0;
+        }
+        if (!ok) {
+            fprintf(stderr, "%s: out of memory\n", path);
+        }
+    }
+    fclose(f);
+
+    qsort(sEvents, sNumEvents, sizeof(sEvents[0]), compare_events);
+    return ok;
+}
+
+static void run_event(struct AudioEvent *event) {
+    switch (event->type) {
+        case AUDIO_EVENT_MUSIC:
+            play_music(event->args[0], event->args[1], event->args[2]);
+            break;
+        case AUDIO_EVENT_SOUND:
+            play_sound(event->args[0], gGlobalSoundSource);
+            break;
+        case AUDIO_EVENT_STOP:
+            stop_sound(event->args[0], gGlobalSoundSource);
+            break;
+        case AUDIO_EVENT_FADEOUT:
+            seq_player_fade_out(event->args[0], event->args[1]);
+            break;
+    }
+}
+
+static void write_u16(u8 *dest, u32 value) {
+    dest[0] = value & 0xff;
+    dest[1] = (value >> 8) & 0xff;
+}
+
+static void write_u32(u8 *dest, u32 value) {
+    write_u16(dest, value & 0xffff);
+    write_u16(dest + 2, value >> 16);
+}
+
+static void write_wav_header(FILE *f, u32 numFrames) {
+    u32 dataSize = numFrames * 2 * sizeof(s16);
+    u8 header[44];
+
+    memcpy(header, "RIFF", 4);
+    write_u32(header + 4, 36 + dataSize);
+    memcpy(header + 8, "WAVEfmt ", 8);
+    write_u32(header + 16, 16);
+    write_u16(header + 20, 1); // PCM
+    write_u16(header + 22, 2); // Stereo
+    write_u32(header + 24, SAMPLE_RATE);
+    write_u32(header + 28, SAMPLE_RATE * 2 * sizeof(s16));
+    write_u16(header + 32, 2 * sizeof(s16));
+    write_u16(header + 34, 16);
+    memcpy(header + 36, "data", 4);
+    write_u32(header + 40, dataSize);
+
+    fseek(f, 0, SEEK_SET);
+    fwrite(header, sizeof(header), 1, f);
+}
+
+int main(int argc, char *argv[]) {
+    s16 samples[SAMPLES_HIGH * 2];
+    const char *outPath = NULL;
+    const char *eventLog = NULL;
+    int seqId = -1;
+    int preset = 0;
+    double seconds = 60.0;
+    u32 numTicks;
+    u32 numBuffers = 0;
+    u32 numFrames = 0;
+    u32 nextEvent = 0;
+    u32 tick;
+    clock_t start;
+    double elapsed;
+    FILE *f;
+    int i;
+
+    for (i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+            seqId = strtol(argv[++i], NULL, 0);
+        } else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+            eventLog = argv[++i];
+        } else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc) {
+            seconds = atof(argv[++i]);
+        } else if (strcmp(argv[i], "-p") == 0 && i + 1 < argc) {
+            preset = strtol(argv[++i], NULL, 0);
+        } else if (argv[i][0] != '-' && outPath == NULL) {
+            outPath = argv[i];
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (outPath == NULL || (seqId < 0) == (eventLog == NULL) || seqId >= SEQ_COUNT || seconds <= 0.0) {
+        usage(argv[0]);
+    }
+
+    if (eventLog != NULL) {
+        if (!load_event_log(eventLog)) {
+            return 1;
+        }
+    } else {
+        add_event(0, AUDIO_EVENT_MUSIC, SEQ_PLAYER_LEVEL, SEQUENCE_ARGS(4, seqId), 0);
+    }
+
+    f = fopen(outPath, "wb");
+    if (f == NULL) {
+        fprintf(stderr, "Could not open %s\n", outPath);
+        return 1;
+    }
+    // Reserve space for the header, which is written once the length is known
+    write_wav_header(f, 0);
+
+    audio_init();
+    sound_init();
+    sound_reset(preset);
+
+    numTicks = (u32) (seconds * TICKS_PER_SECOND + 0.5);
+    start = clock();
+
+    for (tick = 0; tick < numTicks; tick++) {
+        // The game signals the tick before its objects play sounds
+        audio_signal_game_loop_tick();
+        while (nextEvent < sNumEvents && sEvents[nextEvent].tick <= tick) {
+            run_event(&sEvents[nextEvent++]);
+        }
+
+        for (i = 0; i < BUFFERS_PER_TICK; i++) {
+            // Alternate the buffer sizes so that the output stays at exactly SAMPLE_RATE
+            u32 expected = (u32) ((u64) (numBuffers + 1) * SAMPLE_RATE / (TICKS_PER_SECOND * BUFFERS_PER_TICK));
+            u32 numSamples = numFrames + SAMPLES_LOW < expected ? SAMPLES_HIGH : SAMPLES_LOW;
+
+            create_next_audio_buffer(samples, numSamples);
+            fwrite(samples, sizeof(s16), numSamples * 2, f);
+            numBuffers++;
+            numFrames += numSamples;
+        }
+    }
+
+    elapsed = (double) (clock() - start) / CLOCKS_PER_SEC;
+
+    write_wav_header(f, numFrames);
+    fclose(f);
+
+    fprintf(stderr, "%s: %.2f s of audio in %.3f s of CPU time (%.1fx realtime)\n", outPath,
+            (double) numFrames / SAMPLE_RATE, elapsed,
+            elapsed > 0.0 ? (double) numFrames / SAMPLE_RATE / elapsed : 0.0);
+    return 0;
+}
@@ -30,6 +30,19 @@ struct ConfigOption {
  *Config options and default values
  */
 bool configFullscreen            = false;
+// Frames rendered per 30 Hz game tick, frames in between are interpolated
+unsigned int configFramesPerTick = 1;
+// Record the inputs to sm64_inputs.bin, or replay sm64_replay.bin instead
+bool configRecordInputs          = true;
+bool configReplayInputs          = false;
+// Log the sounds and music that are played to sm64_audio_events.txt, for audio_render
+bool configAudioEventLog         = false;
+// Log a hash of the game state after every tick to sm64_state_hashes.bin
+bool configStateHashLog          = false;
+// Update distant decorative objects at a reduced rate, which changes the simulation
+bool configObjectLod             = false;
+// Environment effect particles drawn per particle of the original game, 1 to 4
+unsigned int configEnvFxDensity  = 2;
 // Keyboard mappings (scancode values)
 unsigned int configKeyA          = 0x26;
 unsigned int configKeyB          = 0x33;
@@ -48,6 +61,13 @@ unsigned int configKeyStickRight = 0x20;
 
 static const struct ConfigOption options[] = {
     {.name = "fullscreen",     .type = CONFIG_TYPE_BOOL, .boolValue = &configFullscreen},
+    {.name = "frames_per_tick", .type = CONFIG_TYPE_UINT, .uintValue = &configFramesPerTick},
+    {.name = "record_inputs",  .type = CONFIG_TYPE_BOOL, .boolValue = &configRecordInputs},
+    {.name = "replay_inputs",  .type = CONFIG_TYPE_BOOL, .boolValue = &configReplayInputs},
+    {.name = "audio_event_log", .type = CONFIG_TYPE_BOOL, .boolValue = &configAudioEventLog},
+    {.name = "state_hash_log", .type = CONFIG_TYPE_BOOL, .boolValue = &configStateHashLog},
+    {.name = "object_lod",     .type = CONFIG_TYPE_BOOL, .boolValue = &configObjectLod},
+    {.name = "envfx_density",  .type = CONFIG_TYPE_UINT, .uintValue = &configEnvFxDensity},
     {.name = "key_a",          .type = CONFIG_TYPE_UINT, .uintValue = &configKeyA},
     {.name = "key_b",          .type = CONFIG_TYPE_UINT, .uintValue = &configKeyB},
     {.name = "key_start",      .type = CONFIG_TYPE_UINT, .uintValue = &configKeyStart},
@@ -2,6 +2,13 @@
 #define CONFIGFILE_H
 
 extern bool         configFullscreen;
+extern unsigned int configFramesPerTick;
+extern bool         configRecordInputs;
+extern bool         configReplayInputs;
+extern bool         configAudioEventLog;
+extern bool         configStateHashLog;
+extern bool         configObjectLod;
+extern unsigned int configEnvFxDensity;
 extern unsigned int configKeyA;
 extern unsigned int configKeyB;
 extern unsigned int configKeyStart;
@@ -4,6 +4,7 @@
 #include "lib/src/osContInternal.h"
 
 #include "controller_recorded_tas.h"
+#include "input_recorder.h"
 #include "controller_keyboard.h"
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -33,7 +34,8 @@ s32 osContInit(UNUSED OSMesgQueue *mq, u8 *controllerBits, UNUSED OSContStatus *
     for (size_t i = 0; i < sizeof(controller_implementations) / sizeof(struct ControllerAPI *); i++) {
         controller_implementations[i]->init();
     }
-    *controllerBits = 1;
+    *controllerBits = 1 | tas_controller_bits();
+    input_recorder_init(controllerBits);
     return 0;
 }
 
@@ -50,4 +52,6 @@ void osContGetReadData(OSContPad *pad) {
     for (size_t i = 0; i < sizeof(controller_implementations) / sizeof(struct ControllerAPI *); i++) {
         controller_implementations[i]->read(pad);
     }
+    tas_end_frame(pad);
+    input_recorder_update(pad);
 }
@@ -1,26 +1,227 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ultra64.h>
 
-#include "controller_api.h"
+#if !defined(_WIN32) && !defined(TARGET_WEB)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TAS_USE_MMAP
+#endif
 
-static FILE *fp;
+#include "controller_recorded_tas.h"
+
+/**
+ * Replays the inputs of a Mupen64 movie, cont.m64. The whole file is mapped
+ * in memory (or read at once where mmap isn't available), so replaying never
+ * waits for the disk and any frame can be served directly.
+ *
+ * The header gives the number of controllers and the ports they are plugged
+ * into. Every frame has one 4 byte sample per controller, in port order.
+ * Files without the M64 signature are read like before: a 0x400 byte header
+ * followed by the samples of a single controller.
+ */
+
+#define M64_SIGNATURE 0x1A34364D // "M64\x1A" little endian
+#define M64_HEADER_SIZE_V3 0x400
+#define M64_HEADER_SIZE_V1 0x200
+#define M64_SAMPLE_SIZE 4
+
+static const uint8_t *sMovieData;
+static size_t sMovieSize;
+static int sMovieMapped;
+
+static const uint8_t *sSamples;
+static uint32_t sNumFrames;
+static uint32_t sCurFrame;
+static int sNumControllers;
+// Ports of the samples of each frame, in order
+static int sPorts[MAXCONTROLLERS];
+
+static uint32_t read_u32_le(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static int tas_map_file(const char *path) {
+#ifdef TAS_USE_MMAP
+    struct stat st;
+    void *map;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0) {
+        return 0;
+    }
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            close(fd);
+            sMovieData = map;
+            sMovieSize = st.st_size;
+            sMovieMapped = 1;
+            return 1;
+        }
+    }
+    close(fd);
+#endif
+    {
+        FILE *fp = fopen(path, "rb");
+        long size;
+        uint8_t *data;
+
+        if (fp == NULL) {
+            return 0;
+        }
+        fseek(fp, 0, SEEK_END);
+        size = ftell(fp);
+        fseek(fp, 0, SEEK_SET);
+        data = size > 0 ? malloc(size) : NULL;
+        if (data == NULL || fread(data, 1, size, fp) != (size_t) size) {
+            free(data);
+            fclose(fp);
+            return 0;
+        }
+        fclose(fp);
+        sMovieData = data;
+        sMovieSize = size;
+        return 1;
+    }
+}
+
+static void tas_unmap_file(void) {
+#ifdef TAS_USE_MMAP
+    if (sMovieMapped) {
+        munmap((void *) sMovieData, sMovieSize);
+    } else
+#endif
+    {
+        free((void *) sMovieData);
+    }
+    sMovieData = NULL;
+    sMovieSize = 0;
+    sMovieMapped = 0;
+}
+
+static int tas_parse_header(void) {
+    size_t headerSize = M64_HEADER_SIZE_V3;
+    uint32_t numSamples;
+    uint32_t controllerFlags;
+    int port;
+
+    sNumControllers = 0;
+    if (sMovieSize >= M64_HEADER_SIZE_V1 && read_u32_le(sMovieData) == M64_SIGNATURE) {
+        if (read_u32_le(sMovieData + 0x04) < 3) {
+            headerSize = M64_HEADER_SIZE_V1;
+        }
+        numSamples = read_u32_le(sMovieData + 0x18);
+        controllerFlags = read_u32_le(sMovieData + 0x20);
+        for (port = 0; port < 4; port++) {
+            if (controllerFlags & (1 << port)) {
+                sPorts[sNumControllers++] = port;
+            }
+        }
+    } else {
+        numSamples = UINT32_MAX;
+    }
+    if (sNumControllers == 0) {
+        sPorts[sNumControllers++] = 0;
+    }
+    if (sMovieSize < headerSize) {
+        return 0;
+    }
+
+    if (numSamples > (sMovieSize - headerSize) / M64_SAMPLE_SIZE) {
+        numSamples = (sMovieSize - headerSize) / M64_SAMPLE_SIZE;
+    }
+    sSamples = sMovieData + headerSize;
+    sNumFrames = numSamples / sNumControllers;
+    sCurFrame = 0;
+    return 1;
+}
 
 static void tas_init(void) {
-    fp = fopen("cont.m64", "rb");
-    if (fp != NULL) {
-        uint8_t buf[0x400];
-        fread(buf, 1, sizeof(buf), fp);
+    if (!tas_map_file("cont.m64")) {
+        return;
+    }
+    if (!tas_parse_header()) {
+        tas_unmap_file();
     }
 }
 
+static void tas_read_sample(OSContPad *pad, const uint8_t *sample) {
+    pad->button = (sample[0] << 8) | sample[1];
+    pad->stick_x = sample[2];
+    pad->stick_y = sample[3];
+}
+
 static void tas_read(OSContPad *pad) {
-    if (fp != NULL) {
-        uint8_t bytes[4] = {0};
-        fread(bytes, 1, 4, fp);
-        pad->button = (bytes[0] << 8) | bytes[1];
-        pad->stick_x = bytes[2];
-        pad->stick_y = bytes[3];
+    static const uint8_t noInput[M64_SAMPLE_SIZE];
+
+    if (sMovieData == NULL || sPorts[0] != 0) {
+        return;
+    }
+    // Past the end of the movie, the controller is left idle
+    tas_read_sample(pad, sCurFrame < sNumFrames ? sSamples + sCurFrame * sNumControllers * M64_SAMPLE_SIZE
+                                                : noInput);
+}
+
+/**
+ * Fill the pads of the other ports of the movie, then move to the next frame.
+ * Called once per read of the controllers, after the port 0 pad was read.
+ */
+void tas_end_frame(OSContPad *pads) {
+    const uint8_t *frame;
+    int i;
+
+    if (sMovieData == NULL) {
+        return;
+    }
+    frame = sSamples + sCurFrame * sNumControllers * M64_SAMPLE_SIZE;
+    for (i = 0; i < sNumControllers; i++) {
+        if (sPorts[i] == 0) {
+            continue;
+        }
+        if (sCurFrame < sNumFrames) {
+            tas_read_sample(&pads[sPorts[i]], frame + i * M64_SAMPLE_SIZE);
+        } else {
+            memset(&pads[sPorts[i]], 0, sizeof(OSContPad));
+        }
     }
+    if (sCurFrame < sNumFrames) {
+        sCurFrame++;
+    }
+}
+
+/**
+ * Return a bit for every port that has a controller in the movie.
+ */
+u8 tas_controller_bits(void) {
+    u8 bits = 0;
+    int i;
+
+    if (sMovieData != NULL) {
+        for (i = 0; i < sNumControllers; i++) {
+            bits |= 1 << sPorts[i];
+        }
+    }
+    return bits;
+}
+
+u32 tas_frame_count(void) {
+    return sMovieData != NULL ? sNumFrames : 0;
+}
+
+u32 tas_current_frame(void) {
+    return sCurFrame;
+}
+
+/**
+ * Make the next read return the inputs of the given frame, for example after
+ * restoring the state of the game at that frame.
+ */
+void tas_seek(u32 frame) {
+    sCurFrame = frame < sNumFrames ? frame : sNumFrames;
 }
 
 struct ControllerAPI controller_recorded_tas = {
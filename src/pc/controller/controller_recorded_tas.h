@@ -5,4 +5,10 @@
 
 extern struct ControllerAPI controller_recorded_tas;
 
+void tas_end_frame(OSContPad *pads);
+u8 tas_controller_bits(void);
+u32 tas_frame_count(void);
+u32 tas_current_frame(void);
+void tas_seek(u32 frame);
+
 #endif
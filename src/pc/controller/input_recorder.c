@@ -0,0 +1,525 @@
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ultra64.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif !defined(TARGET_WEB)
+#include <pthread.h>
+#endif
+
+#include "sm64.h"
+#include "engine/behavior_script.h"
+#include "game/level_update.h"
+#include "game/object_list_processor.h"
+#include "pc/configfile.h"
+
+#include "input_recorder.h"
+
+/**
+ * Records the controller inputs of every frame to sm64_inputs.bin, and can
+ * replay a recording from sm64_replay.bin. Every INPUT_LOG_CHECKSUM_INTERVAL
+ * frames a checksum of the game state is stored in the log, a replay compares
+ * it with its own state and reports the first frame where they differ.
+ *
+ * The log starts with a header:
+ *   char magic[8]       "SM64INP\0"
+ *   u8 version          INPUT_LOG_VERSION
+ *   u8 controllerBits   ports read by the game
+ *   u16 checksumInterval
+ * followed by records, all values are little endian:
+ *   0x1p mask [u16 button] [s8 stick_x] [s8 stick_y]
+ *       port p changed, mask bits 0/1/2 tell which fields follow
+ *   0x01  end of a frame whose inputs changed
+ *   0x02 count  count frames with the same inputs as the last one, count is
+ *               a LEB128 varint
+ *   0x03 u32 frame, u32 checksum  state at the start of the frame
+ *
+ * Recording only appends to a buffer, a writer thread saves it to the disk.
+ */
+
+#define INPUT_LOG_PATH "sm64_inputs.bin"
+#define INPUT_REPLAY_PATH "sm64_replay.bin"
+#define INPUT_LOG_VERSION 1
+#define INPUT_LOG_HEADER_SIZE 12
+#define INPUT_LOG_CHECKSUM_INTERVAL 30
+
+#define REC_FRAME 0x01
+#define REC_REPEAT 0x02
+#define REC_CHECKSUM 0x03
+#define REC_PAD 0x10
+
+#define PAD_BUTTON 0x01
+#define PAD_STICK_X 0x02
+#define PAD_STICK_Y 0x04
+
+// Longest encoding of one frame: a checksum, all pads and the end of the frame
+#define MAX_FRAME_RECORD_SIZE (9 + 4 * 5 + 1)
+
+#define INPUT_LOG_BUFFER_SIZE 0x10000
+
+enum InputRecorderMode {
+    INPUT_RECORDER_OFF,
+    INPUT_RECORDER_RECORD,
+    INPUT_RECORDER_REPLAY
+};
+
+static enum InputRecorderMode sMode;
+static u8 sControllerBits;
+static u32 sFrame;
+static OSContPad sLastPads[4];
+
+// Recording
+static u32 sPendingRepeat;
+static FILE *sLogFile;
+
+// Replay
+static u8 *sReplayData;
+static u32 sReplaySize;
+static u32 sReplayPos;
+static u32 sReplayRepeat;
+static u32 sNumChecksums;
+static u32 sNumMismatches;
+static u32 sFirstMismatch;
+
+#ifndef TARGET_WEB
+#ifdef _WIN32
+static CRITICAL_SECTION sLogLock;
+static CONDITION_VARIABLE sLogCond;
+#define LOG_LOCK() EnterCriticalSection(&sLogLock)
+#define LOG_UNLOCK() LeaveCriticalSection(&sLogLock)
+#define LOG_WAIT() SleepConditionVariableCS(&sLogCond, &sLogLock, INFINITE)
+#define LOG_SIGNAL() WakeAllConditionVariable(&sLogCond)
+#else
+static pthread_mutex_t sLogLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sLogCond = PTHREAD_COND_INITIALIZER;
+#define LOG_LOCK() pthread_mutex_lock(&sLogLock)
+#define LOG_UNLOCK() pthread_mutex_unlock(&sLogLock)
+#define LOG_WAIT() pthread_cond_wait(&sLogCond, &sLogLock)
+#define LOG_SIGNAL() pthread_cond_broadcast(&sLogCond)
+#endif
+
+static bool sWriterStarted;
+static bool sWriterQuit;
+static bool sWriterBusy;
+// Ring buffer between the game and the writer thread, positions only grow
+static u8 sLogBuffer[INPUT_LOG_BUFFER_SIZE];
+static u32 sLogHead;
+static u32 sLogTail;
+#endif
+
+/**
+ * Checksum of the state that a desync shows up in first: Mario's position,
+ * the number of objects and the random seed.
+ */
+static u32 input_recorder_state_checksum(void) {
+    u32 words[5];
+    u32 hash = 2166136261U;
+    u32 i;
+
+    memcpy(&words[0], gMarioState->pos, sizeof(Vec3f));
+    words[3] = gObjectCounter;
+    words[4] = random_get_seed();
+
+    for (i = 0; i < sizeof(words); i++) {
+        hash = (hash ^ ((u8 *) words)[i]) * 16777619U;
+    }
+    return hash;
+}
+
+static u32 put_u32(u8 *dest, u32 value) {
+    dest[0] = value;
+    dest[1] = value >> 8;
+    dest[2] = value >> 16;
+    dest[3] = value >> 24;
+    return 4;
+}
+
+static u32 put_repeat(u8 *dest, u32 count) {
+    u32 size = 0;
+
+    dest[size++] = REC_REPEAT;
+    for (; count >= 0x80; count >>= 7) {
+        dest[size++] = (count & 0x7F) | 0x80;
+    }
+    dest[size++] = count;
+    return size;
+}
+
+static u32 get_u32(const u8 *src) {
+    return src[0] | (src[1] << 8) | (src[2] << 16) | ((u32) src[3] << 24);
+}
+
+#ifndef TARGET_WEB
+#ifdef _WIN32
+static DWORD WINAPI input_log_writer_thread(UNUSED LPVOID arg) {
+#else
+static void *input_log_writer_thread(UNUSED void *arg) {
+#endif
+    u32 tail;
+    u32 size;
+
+    LOG_LOCK();
+    for (;;) {
+        while (sLogHead == sLogTail && !sWriterQuit) {
+            LOG_WAIT();
+        }
+        if (sLogHead == sLogTail) {
+            break;
+        }
+        // Write up to the end of the buffer, the rest is written by the next pass
+        tail = sLogTail % INPUT_LOG_BUFFER_SIZE;
+        size = sLogHead - sLogTail;
+        if (size > INPUT_LOG_BUFFER_SIZE - tail) {
+            size = INPUT_LOG_BUFFER_SIZE - tail;
+        }
+        sWriterBusy = true;
+        LOG_UNLOCK();
+
+        fwrite(sLogBuffer + tail, 1, size, sLogFile);
+        fflush(sLogFile);
+
+        LOG_LOCK();
+        sWriterBusy = false;
+        sLogTail += size;
+        LOG_SIGNAL();
+    }
+    LOG_UNLOCK();
+    return 0;
+}
+
+static void input_log_start_writer(void) {
+#ifdef _WIN32
+    HANDLE thread;
+
+    InitializeCriticalSection(&sLogLock);
+    InitializeConditionVariable(&sLogCond);
+    thread = CreateThread(NULL, 0, input_log_writer_thread, NULL, 0, NULL);
+    sWriterStarted = thread != NULL;
+    if (thread != NULL) {
+        CloseHandle(thread);
+    }
+#else
+    pthread_t thread;
+
+    sWriterStarted = pthread_create(&thread, NULL, input_log_writer_thread, NULL) == 0;
+    if (sWriterStarted) {
+        pthread_detach(thread);
+    }
+#endif
+}
+#endif
+
+static void input_log_write(const u8 *data, u32 size) {
+#ifndef TARGET_WEB
+    u32 head;
+    u32 part;
+
+    if (sWriterStarted) {
+        LOG_LOCK();
+        while (sLogHead + size - sLogTail > INPUT_LOG_BUFFER_SIZE) {
+            LOG_WAIT();
+        }
+        head = sLogHead % INPUT_LOG_BUFFER_SIZE;
+        part = size < INPUT_LOG_BUFFER_SIZE - head ? size : INPUT_LOG_BUFFER_SIZE - head;
+        memcpy(sLogBuffer + head, data, part);
+        memcpy(sLogBuffer, data + part, size - part);
+        sLogHead += size;
+        LOG_SIGNAL();
+        LOG_UNLOCK();
+        return;
+    }
+#endif
+    fwrite(data, 1, size, sLogFile);
+}
+
+/**
+ * Write the frames that are still counted as a repeat and wait until the
+ * writer thread has saved everything.
+ */
+static void input_log_flush(void) {
+    u8 record[6];
+
+    if (sPendingRepeat != 0) {
+        input_log_write(record, put_repeat(record, sPendingRepeat));
+        sPendingRepeat = 0;
+    }
+
+#ifndef TARGET_WEB
+    if (sWriterStarted) {
+        LOG_LOCK();
+        sWriterQuit = true;
+        LOG_SIGNAL();
+        while (sLogHead != sLogTail || sWriterBusy) {
+            LOG_WAIT();
+        }
+        LOG_UNLOCK();
+    }
+#endif
+    fflush(sLogFile);
+}
+
+static void input_recorder_start_recording(void) {
+    u8 header[INPUT_LOG_HEADER_SIZE];
+
+    sLogFile = fopen(INPUT_LOG_PATH, "wb");
+    if (sLogFile == NULL) {
+        fprintf(stderr, "Could not open " INPUT_LOG_PATH " for recording\n");
+        return;
+    }
+    memcpy(header, "SM64INP", 8);
+    header[8] = INPUT_LOG_VERSION;
+    header[9] = sControllerBits;
+    header[10] = INPUT_LOG_CHECKSUM_INTERVAL & 0xFF;
+    header[11] = INPUT_LOG_CHECKSUM_INTERVAL >> 8;
+    fwrite(header, 1, sizeof(header), sLogFile);
+
+#ifndef TARGET_WEB
+    input_log_start_writer();
+#endif
+    atexit(input_log_flush);
+    sMode = INPUT_RECORDER_RECORD;
+}
+
+static void input_recorder_record(OSContPad *pads) {
+    u8 record[MAX_FRAME_RECORD_SIZE];
+    u32 size = 0;
+    u32 padsStart;
+    u8 mask;
+    int port;
+
+    if (sFrame % INPUT_LOG_CHECKSUM_INTERVAL == 0) {
+        record[size++] = REC_CHECKSUM;
+        size += put_u32(record + size, sFrame);
+        size += put_u32(record + size, input_recorder_state_checksum());
+    }
+
+    padsStart = size;
+    for (port = 0; port < 4; port++) {
+        if (!(sControllerBits & (1 << port))) {
+            continue;
+        }
+        mask = 0;
+        if (pads[port].button != sLastPads[port].button) {
+            mask |= PAD_BUTTON;
+        }
+        if (pads[port].stick_x != sLastPads[port].stick_x) {
+            mask |= PAD_STICK_X;
+        }
+        if (pads[port].stick_y != sLastPads[port].stick_y) {
+            mask |= PAD_STICK_Y;
+        }
+        if (mask == 0) {
+            continue;
+        }
+        record[size++] = REC_PAD | port;
+        record[size++] = mask;
+        if (mask & PAD_BUTTON) {
+            record[size++] = pads[port].button & 0xFF;
+            record[size++] = pads[port].button >> 8;
+        }
+        if (mask & PAD_STICK_X) {
+            record[size++] = pads[port].stick_x;
+        }
+        if (mask & PAD_STICK_Y) {
+            record[size++] = pads[port].stick_y;
+        }
+        sLastPads[port] = pads[port];
+    }
+
+    if (size == padsStart) {
+        if (size == 0) {
+            sPendingRepeat++;
+            return;
+        }
+        // Only a checksum, the frame itself repeats the last inputs
+        size += put_repeat(record + size, 1);
+    } else {
+        record[size++] = REC_FRAME;
+    }
+
+    // The frames before this one repeated the last inputs
+    if (sPendingRepeat != 0) {
+        u8 repeat[6];
+
+        input_log_write(repeat, put_repeat(repeat, sPendingRepeat));
+        sPendingRepeat = 0;
+    }
+    input_log_write(record, size);
+}
+
+static void input_recorder_start_replay(void) {
+    FILE *fp = fopen(INPUT_REPLAY_PATH, "rb");
+    long size;
+
+    if (fp == NULL) {
+        fprintf(stderr, "Could not open " INPUT_REPLAY_PATH " for replay\n");
+        return;
+    }
+    fseek(fp, 0, SEEK_END);
+    size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    sReplayData = size >= INPUT_LOG_HEADER_SIZE ? malloc(size) : NULL;
+    if (sReplayData == NULL || fread(sReplayData, 1, size, fp) != (size_t) size
+        || memcmp(sReplayData, "SM64INP", 8) != 0 || sReplayData[8] != INPUT_LOG_VERSION) {
+        fprintf(stderr, INPUT_REPLAY_PATH " is not an input log\n");
+        free(sReplayData);
+        sReplayData = NULL;
+        fclose(fp);
+        return;
+    }
+    fclose(fp);
+
+    sReplaySize = size;
+    sReplayPos = INPUT_LOG_HEADER_SIZE;
+    sControllerBits = sReplayData[9];
+    sMode = INPUT_RECORDER_REPLAY;
+}
+
+static void input_recorder_end_replay(bool corrupt) {
+    if (corrupt) {
+        fprintf(stderr, "Replay: corrupt record at offset %u\n", sReplayPos);
+    }
+    if (sNumMismatches == 0) {
+        printf("Replay: %u frames, all %u checksums matched\n", sFrame, sNumChecksums);
+    } else {
+        printf("Replay: %u frames, %u of %u checksums differ, first at frame %u\n", sFrame,
+               sNumMismatches, sNumChecksums, sFirstMismatch);
+    }
+    free(sReplayData);
+    sReplayData = NULL;
+    sMode = INPUT_RECORDER_OFF;
+}
+
+/**
+ * Read the records of the current frame. Return false at the end of the log.
+ */
+static bool input_recorder_replay(OSContPad *pads) {
+    const u8 *data = sReplayData;
+    u32 shift;
+    u32 port;
+    u8 mask;
+    int i;
+
+    if (sReplayRepeat != 0) {
+        sReplayRepeat--;
+    } else {
+        for (;;) {
+            if (sReplayPos >= sReplaySize) {
+                input_recorder_end_replay(false);
+                return false;
+            }
+
+            switch (data[sReplayPos]) {
+                case REC_FRAME:
+                    sReplayPos++;
+                    break;
+
+                case REC_REPEAT:
+                    sReplayPos++;
+                    sReplayRepeat = 0;
+                    for (shift = 0; sReplayPos < sReplaySize && shift < 32; shift += 7) {
+                        sReplayRepeat |= (data[sReplayPos] & 0x7F) << shift;
+                        if (!(data[sReplayPos++] & 0x80)) {
+                            break;
+                        }
+                    }
+                    if (sReplayRepeat == 0) {
+                        input_recorder_end_replay(true);
+                        return false;
+                    }
+                    sReplayRepeat--;
+                    break;
+
+                case REC_CHECKSUM:
+                    if (sReplayPos + 9 > sReplaySize) {
+                        input_recorder_end_replay(true);
+                        return false;
+                    }
+                    sNumChecksums++;
+                    if (get_u32(data + sReplayPos + 1) != sFrame
+                        || get_u32(data + sReplayPos + 5) != input_recorder_state_checksum()) {
+                        if (sNumMismatches++ == 0) {
+                            sFirstMismatch = sFrame;
+                            fprintf(stderr, "Replay: state differs from the recording at frame %u\n", sFrame);
+                        }
+                    }
+                    sReplayPos += 9;
+                    continue;
+
+                default:
+                    port = data[sReplayPos] ^ REC_PAD;
+                    if (port >= 4 || sReplayPos + 2 > sReplaySize) {
+                        input_recorder_end_replay(true);
+                        return false;
+                    }
+                    mask = data[sReplayPos + 1];
+                    sReplayPos += 2;
+                    if (sReplayPos + ((mask & PAD_BUTTON) ? 2 : 0) + ((mask & PAD_STICK_X) ? 1 : 0)
+                            + ((mask & PAD_STICK_Y) ? 1 : 0) > sReplaySize) {
+                        input_recorder_end_replay(true);
+                        return false;
+                    }
+                    if (mask & PAD_BUTTON) {
+                        sLastPads[port].button = data[sReplayPos] | (data[sReplayPos + 1] << 8);
+                        sReplayPos += 2;
+                    }
+                    if (mask & PAD_STICK_X) {
+                        sLastPads[port].stick_x = data[sReplayPos++];
+                    }
+                    if (mask & PAD_STICK_Y) {
+                        sLastPads[port].stick_y = data[sReplayPos++];
+                    }
+                    continue;
+            }
+            break;
+        }
+    }
+
+    for (i = 0; i < 4; i++) {
+        if (sControllerBits & (1 << i)) {
+            pads[i].button = sLastPads[i].button;
+            pads[i].stick_x = sLastPads[i].stick_x;
+            pads[i].stick_y = sLastPads[i].stick_y;
+        }
+    }
+    return true;
+}
+
+/**
+ * Start recording or replaying, depending on the configuration. A replay
+ * plugs in the controllers of the recording.
+ */
+void input_recorder_init(u8 *controllerBits) {
+    sControllerBits = *controllerBits;
+    if (configReplayInputs) {
+        input_recorder_start_replay();
+        if (sMode == INPUT_RECORDER_REPLAY) {
+            *controllerBits = sControllerBits;
+        }
+    } else if (configRecordInputs) {
+        input_recorder_start_recording();
+    }
+}
+
+/**
+ * Record the inputs that were read for this frame, or replace them with the
+ * ones of the replay.
+ */
+void input_recorder_update(OSContPad *pads) {
+    switch (sMode) {
+        case INPUT_RECORDER_OFF:
+            return;
+        case INPUT_RECORDER_RECORD:
+            input_recorder_record(pads);
+            break;
+        case INPUT_RECORDER_REPLAY:
+            if (!input_recorder_replay(pads)) {
+                return;
+            }
+            break;
+    }
+    sFrame++;
+}
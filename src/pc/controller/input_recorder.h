@@ -0,0 +1,9 @@
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+#include <ultra64.h>
+
+void input_recorder_init(u8 *controllerBits);
+void input_recorder_update(OSContPad *pads);
+
+#endif
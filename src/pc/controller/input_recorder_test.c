@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/**
+ * @file input_recorder_test.c
+ * Records the inputs of a simulated play session with input_recorder.c, then
+ * replays the log and checks that every frame gets back the same pads and
+ * that all checksums match. Two more replays check the first divergent frame
+ * that is reported: one where the state is changed in the middle of the
+ * session, and one where a button press in the log is changed. The game state
+ * that the checksums cover is a small simulation driven by the pads, so the
+ * test doesn't need the rest of the game. Built and run with
+ * `make input_recorder_test`, it writes its logs to the directory given as
+ * argument and exits with a non-zero status on a failure.
+ */
+
+#include "input_recorder.c"
+
+#define NUM_FRAMES 5000
+#define NUM_PORTS 2
+
+// Frame at which the state of the desynced replay is changed
+#define DESYNC_FRAME 2345
+
+struct MarioState gTestMarioState;
+struct MarioState *gMarioState = &gTestMarioState;
+u32 gObjectCounter;
+bool configRecordInputs = true;
+bool configReplayInputs = false;
+
+static u16 sTestSeed;
+static OSContPad sRecordedPads[NUM_FRAMES][4];
+static u32 sLogSize;
+
+u16 random_get_seed(void) {
+    return sTestSeed;
+}
+
+static u32 test_random(u32 *seed) {
+    *seed = *seed * 1664525 + 1013904223;
+    return *seed >> 16;
+}
+
+/**
+ * Inputs of a player: the buttons and the stick stay the same for a random
+ * number of frames, and the stick often only moves on one axis.
+ */
+static void test_generate_inputs(void) {
+    u32 seed = 1;
+    u32 hold[4] = { 0 };
+    int frame;
+    int port;
+
+    for (frame = 0; frame < NUM_FRAMES; frame++) {
+        for (port = 0; port < NUM_PORTS; port++) {
+            OSContPad *pad = &sRecordedPads[frame][port];
+
+            if (frame > 0) {
+                *pad = sRecordedPads[frame - 1][port];
+            }
+            if (hold[port] > 0) {
+                hold[port]--;
+                continue;
+            }
+            hold[port] = test_random(&seed) % 90;
+            switch (test_random(&seed) % 3) {
+                case 0:
+                    pad->button = test_random(&seed);
+                    break;
+                case 1:
+                    pad->stick_x = test_random(&seed);
+                    break;
+                default:
+                    pad->stick_x = test_random(&seed);
+                    pad->stick_y = test_random(&seed);
+                    break;
+            }
+        }
+    }
+}
+
+/**
+ * Advance the simulated game by one frame with the pads it has read.
+ */
+static void test_step(OSContPad *pads) {
+    int port;
+
+    for (port = 0; port < NUM_PORTS; port++) {
+        gMarioState->pos[0] += pads[port].stick_x * 0.25f;
+        gMarioState->pos[2] -= pads[port].stick_y * 0.25f;
+        if (pads[port].button & A_BUTTON) {
+            gMarioState->pos[1] += 1.0f;
+        }
+        sTestSeed = sTestSeed * 31 + pads[port].button;
+    }
+    gObjectCounter = 100 + (sTestSeed & 0x1F);
+}
+
+static void test_reset(void) {
+    memset(&gTestMarioState, 0, sizeof(gTestMarioState));
+    gObjectCounter = 0;
+    sTestSeed = 0;
+
+    sMode = INPUT_RECORDER_OFF;
+    sFrame = 0;
+    memset(sLastPads, 0, sizeof(sLastPads));
+    sReplayRepeat = 0;
+    sNumChecksums = 0;
+    sNumMismatches = 0;
+    sFirstMismatch = 0;
+}
+
+static void test_record(void) {
+    u8 controllerBits = (1 << NUM_PORTS) - 1;
+    OSContPad pads[4];
+    FILE *fp;
+    int frame;
+
+    test_reset();
+    input_recorder_init(&controllerBits);
+    if (sMode != INPUT_RECORDER_RECORD) {
+        fprintf(stderr, "input_recorder_test: recording didn't start\n");
+        exit(1);
+    }
+    for (frame = 0; frame < NUM_FRAMES; frame++) {
+        memcpy(pads, sRecordedPads[frame], sizeof(pads));
+        input_recorder_update(pads);
+        test_step(pads);
+    }
+    input_log_flush();
+
+    fp = fopen(INPUT_LOG_PATH, "rb");
+    if (fp == NULL) {
+        fprintf(stderr, "input_recorder_test: " INPUT_LOG_PATH " wasn't written\n");
+        exit(1);
+    }
+    fseek(fp, 0, SEEK_END);
+    sLogSize = ftell(fp);
+    fclose(fp);
+}
+
+/**
+ * Copy the recording to the replay path, with the byte at patchOffset xored
+ * with patchValue if it's not zero.
+ */
+static void test_write_replay(u32 patchOffset, u8 patchValue) {
+    u8 *data = malloc(sLogSize);
+    FILE *fp = fopen(INPUT_LOG_PATH, "rb");
+
+    if (data == NULL || fp == NULL || fread(data, 1, sLogSize, fp) != sLogSize) {
+        fprintf(stderr, "input_recorder_test: can't read " INPUT_LOG_PATH "\n");
+        exit(1);
+    }
+    fclose(fp);
+    data[patchOffset] ^= patchValue;
+
+    fp = fopen(INPUT_REPLAY_PATH, "wb");
+    if (fp == NULL || fwrite(data, 1, sLogSize, fp) != sLogSize) {
+        fprintf(stderr, "input_recorder_test: can't write " INPUT_REPLAY_PATH "\n");
+        exit(1);
+    }
+    fclose(fp);
+    free(data);
+}
+
+/**
+ * Replay the log and return the number of frames whose pads differ from the
+ * recording. If desyncFrame is not zero, the state is changed at the end of
+ * that frame.
+ */
+static int test_replay(int desyncFrame) {
+    u8 controllerBits = 0;
+    OSContPad pads[4];
+    int mismatchedFrames = 0;
+    int frame;
+
+    test_reset();
+    configReplayInputs = true;
+    input_recorder_init(&controllerBits);
+    configReplayInputs = false;
+    if (sMode != INPUT_RECORDER_REPLAY || controllerBits != (1 << NUM_PORTS) - 1) {
+        fprintf(stderr, "input_recorder_test: replay didn't start\n");
+        exit(1);
+    }
+
+    for (frame = 0; frame < NUM_FRAMES; frame++) {
+        memset(pads, 0, sizeof(pads));
+        input_recorder_update(pads);
+        if (sMode != INPUT_RECORDER_REPLAY) {
+            fprintf(stderr, "input_recorder_test: replay ended after %d of %d frames\n", frame, NUM_FRAMES);
+            exit(1);
+        }
+        if (memcmp(pads, sRecordedPads[frame], NUM_PORTS * sizeof(OSContPad)) != 0) {
+            mismatchedFrames++;
+        }
+        test_step(pads);
+        if (frame == desyncFrame && desyncFrame != 0) {
+            gMarioState->pos[1] += 1.0f;
+        }
+    }
+
+    // The log ends here, which reports the result
+    input_recorder_update(pads);
+    if (sMode != INPUT_RECORDER_OFF || sFrame != NUM_FRAMES) {
+        fprintf(stderr, "input_recorder_test: replay has more than %d frames\n", NUM_FRAMES);
+        exit(1);
+    }
+    if (sNumChecksums != (NUM_FRAMES + INPUT_LOG_CHECKSUM_INTERVAL - 1) / INPUT_LOG_CHECKSUM_INTERVAL) {
+        fprintf(stderr, "input_recorder_test: %u checksums were replayed\n", sNumChecksums);
+        exit(1);
+    }
+    return mismatchedFrames;
+}
+
+/**
+ * Find the first change of the A button on port 0 after the frame, and return
+ * the offset of its button record in the log.
+ */
+static u32 test_find_button_record(int afterFrame, int *recordFrame) {
+    u32 pos = INPUT_LOG_HEADER_SIZE;
+    u32 shift;
+    u32 count;
+    int frame = 0;
+    u8 mask;
+    u8 *data = malloc(sLogSize);
+    FILE *fp = fopen(INPUT_LOG_PATH, "rb");
+
+    if (data == NULL || fp == NULL || fread(data, 1, sLogSize, fp) != sLogSize) {
+        fprintf(stderr, "input_recorder_test: can't read " INPUT_LOG_PATH "\n");
+        exit(1);
+    }
+    fclose(fp);
+
+    while (pos < sLogSize) {
+        switch (data[pos]) {
+            case REC_FRAME:
+                frame++;
+                pos++;
+                break;
+            case REC_REPEAT:
+                count = 0;
+                for (pos++, shift = 0; data[pos] & 0x80; pos++, shift += 7) {
+                    count |= (data[pos] & 0x7F) << shift;
+                }
+                count |= data[pos++] << shift;
+                frame += count;
+                break;
+            case REC_CHECKSUM:
+                pos += 9;
+                break;
+            default:
+                mask = data[pos + 1];
+                if (data[pos] == REC_PAD && (mask & PAD_BUTTON) && frame > afterFrame
+                    && ((sRecordedPads[frame][0].button ^ sRecordedPads[frame - 1][0].button) & A_BUTTON)) {
+                    free(data);
+                    *recordFrame = frame;
+                    return pos + 3;
+                }
+                pos += 2 + ((mask & PAD_BUTTON) ? 2 : 0) + ((mask & PAD_STICK_X) ? 1 : 0)
+                       + ((mask & PAD_STICK_Y) ? 1 : 0);
+                break;
+        }
+    }
+    fprintf(stderr, "input_recorder_test: no A button change after frame %d\n", afterFrame);
+    exit(1);
+}
+
+static int test_expected_mismatch(int frame) {
+    // The first checksum taken after the state changed during the frame
+    return (frame + INPUT_LOG_CHECKSUM_INTERVAL) / INPUT_LOG_CHECKSUM_INTERVAL * INPUT_LOG_CHECKSUM_INTERVAL;
+}
+
+int main(int argc, char *argv[]) {
+    int patchedFrame;
+    u32 patchOffset;
+
+    if (argc > 1 && chdir(argv[1]) != 0) {
+        fprintf(stderr, "input_recorder_test: can't enter %s\n", argv[1]);
+        return 1;
+    }
+
+    test_generate_inputs();
+    test_record();
+
+    // The same inputs and state give back every frame and every checksum
+    test_write_replay(0, 0);
+    if (test_replay(0) != 0 || sNumMismatches != 0) {
+        fprintf(stderr, "input_recorder_test: the replay differs from the recording\n");
+        return 1;
+    }
+
+    // A state that differs is reported at the next checksum
+    if (test_replay(DESYNC_FRAME) != 0 || sNumMismatches == 0
+        || sFirstMismatch != (u32) test_expected_mismatch(DESYNC_FRAME)) {
+        fprintf(stderr, "input_recorder_test: the desync at frame %d was reported at frame %u\n",
+                DESYNC_FRAME, sFirstMismatch);
+        return 1;
+    }
+
+    // A different A press in the log changes the state from its frame on
+    patchOffset = test_find_button_record(DESYNC_FRAME, &patchedFrame);
+    test_write_replay(patchOffset, A_BUTTON >> 8);
+    if (test_replay(0) == 0 || sNumMismatches == 0
+        || sFirstMismatch != (u32) test_expected_mismatch(patchedFrame)) {
+        fprintf(stderr, "input_recorder_test: the input change at frame %d was reported at frame %u\n",
+                patchedFrame, sFirstMismatch);
+        return 1;
+    }
+
+    remove(INPUT_LOG_PATH);
+    remove(INPUT_REPLAY_PATH);
+    printf("input_recorder_test: %d frames of %d controllers recorded in %u bytes, replays match, "
+           "desyncs at frames %d and %d reported at frames %u and %d\n",
+           NUM_FRAMES, NUM_PORTS, sLogSize, DESYNC_FRAME, patchedFrame,
+           (u32) test_expected_mismatch(DESYNC_FRAME), test_expected_mismatch(patchedFrame));
+    return 0;
+}
@@ -30,6 +30,9 @@ enum {
 #define SHADER_OPT_FOG (1 << 25)
 #define SHADER_OPT_TEXTURE_EDGE (1 << 26)
 #define SHADER_OPT_NOISE (1 << 27)
+// Only set for rendering APIs that take packed vertices: input i + 1 is the
+// same for all vertices of a draw, and is given as a uniform
+#define SHADER_OPT_INPUT_UNIFORM(i) (1U << (28 + (i)))
 
 struct CCFeatures {
     uint8_t c[2][4];
@@ -39,6 +42,7 @@ struct CCFeatures {
     bool opt_noise;
     bool used_textures[2];
     int num_inputs;
+    bool input_uniform[4];
     bool do_single[2];
     bool do_multiply[2];
     bool do_mix[2];
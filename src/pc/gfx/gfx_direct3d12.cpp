@@ -956,6 +956,8 @@ struct GfxRenderingAPI gfx_direct3d12_api = {
     gfx_direct3d12_set_scissor,
     gfx_direct3d12_set_use_alpha,
     gfx_direct3d12_draw_triangles,
+    nullptr,
+    nullptr,
     gfx_direct3d12_init,
     gfx_direct3d12_on_resize,
     gfx_direct3d12_start_frame,
@@ -136,6 +136,12 @@ static void gfx_dummy_renderer_set_use_alpha(bool use_alpha) {
 static void gfx_dummy_renderer_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris) {
 }
 
+static void gfx_dummy_renderer_draw_triangles_indexed(float buf_vbo[], size_t buf_vbo_len, uint16_t buf_ibo[], size_t buf_vbo_num_tris) {
+}
+
+static void gfx_dummy_renderer_draw_triangles_packed(uint8_t buf_vbo[], size_t buf_vbo_size, uint16_t buf_ibo[], size_t buf_vbo_num_tris, const struct GfxDrawConstants *constants) {
+}
+
 static void gfx_dummy_renderer_init(void) {
 }
 
@@ -183,6 +189,8 @@ struct GfxRenderingAPI gfx_dummy_renderer_api = {
     gfx_dummy_renderer_set_scissor,
     gfx_dummy_renderer_set_use_alpha,
     gfx_dummy_renderer_draw_triangles,
+    gfx_dummy_renderer_draw_triangles_indexed,
+    gfx_dummy_renderer_draw_triangles_packed,
     gfx_dummy_renderer_init,
     gfx_dummy_renderer_on_resize,
     gfx_dummy_renderer_start_frame,
@@ -32,11 +32,12 @@
 #define WINCLASS_NAME L"N64GAME"
 #define GFX_API_NAME "DirectX"
 
+// One game tick is split into gfx_frames_per_tick presented frames
 #ifdef VERSION_EU
-#define FRAME_INTERVAL_US_NUMERATOR 40000
+#define FRAME_INTERVAL_US_NUMERATOR (40000 / gfx_frames_per_tick)
 #define FRAME_INTERVAL_US_DENOMINATOR 1
 #else
-#define FRAME_INTERVAL_US_NUMERATOR 100000
+#define FRAME_INTERVAL_US_NUMERATOR (100000 / gfx_frames_per_tick)
 #define FRAME_INTERVAL_US_DENOMINATOR 3
 #endif
 
@@ -19,12 +19,13 @@
 
 #define GFX_API_NAME "GLX - OpenGL"
 
+// One game tick is split into gfx_frames_per_tick presented frames
 #ifdef VERSION_EU
 #define FRAME_INTERVAL_US_NUMERATOR 40000
-#define FRAME_INTERVAL_US_DENOMINATOR 1
+#define FRAME_INTERVAL_US_DENOMINATOR gfx_frames_per_tick
 #else
 #define FRAME_INTERVAL_US_NUMERATOR 100000
-#define FRAME_INTERVAL_US_DENOMINATOR 3
+#define FRAME_INTERVAL_US_DENOMINATOR (3 * gfx_frames_per_tick)
 #endif
 
 const struct {
@@ -453,7 +454,7 @@ static bool gfx_glx_start_frame(void) {
 }
 
 static void gfx_glx_swap_buffers_begin(void) {
-    glx.wanted_ust += FRAME_INTERVAL_US_NUMERATOR; // advance 1/30 seconds on JP/US or 1/25 seconds on EU
+    glx.wanted_ust += FRAME_INTERVAL_US_NUMERATOR; // advance one frame, a game tick is 1/30 seconds on JP/US or 1/25 seconds on EU
     
     if (!glx.has_oml_sync_control && !glx.has_sgi_video_sync) {
         glFlush();
@@ -33,10 +33,16 @@ struct ShaderProgram {
     GLuint opengl_program_id;
     uint8_t num_inputs;
     bool used_textures[2];
-    uint8_t num_floats;
+    uint8_t vertex_size;
     GLint attrib_locations[7];
     uint8_t attrib_sizes[7];
+    GLenum attrib_types[7];
+    uint8_t attrib_offsets[7];
     uint8_t num_attribs;
+    GLint input_locations[4];
+    GLint fog_color_location;
+    GLint tex_offset_location;
+    GLint tex_scale_location;
     bool used_noise;
     GLint frame_count_location;
     GLint window_height_location;
@@ -45,6 +51,8 @@ struct ShaderProgram {
 static struct ShaderProgram shader_program_pool[64];
 static uint8_t shader_program_pool_size;
 static GLuint opengl_vbo;
+static GLuint opengl_ibo;
+static struct ShaderProgram *current_program;
 
 static uint32_t frame_count;
 static uint32_t current_height;
@@ -54,13 +62,12 @@ static bool gfx_opengl_z_is_from_0_to_1(void) {
 }
 
 static void gfx_opengl_vertex_array_set_attribs(struct ShaderProgram *prg) {
-    size_t num_floats = prg->num_floats;
-    size_t pos = 0;
-
     for (int i = 0; i < prg->num_attribs; i++) {
+        // Colors and the fog factor are bytes, which are normalized
+        GLboolean normalized = prg->attrib_types[i] == GL_UNSIGNED_BYTE;
+
         glEnableVertexAttribArray(prg->attrib_locations[i]);
-        glVertexAttribPointer(prg->attrib_locations[i], prg->attrib_sizes[i], GL_FLOAT, GL_FALSE, num_floats * sizeof(float), (void *) (pos * sizeof(float)));
-        pos += prg->attrib_sizes[i];
+        glVertexAttribPointer(prg->attrib_locations[i], prg->attrib_sizes[i], prg->attrib_types[i], normalized, prg->vertex_size, (void *) (uintptr_t) prg->attrib_offsets[i]);
     }
 }
 
@@ -80,6 +87,7 @@ static void gfx_opengl_unload_shader(struct ShaderProgram *old_prg) {
 }
 
 static void gfx_opengl_load_shader(struct ShaderProgram *new_prg) {
+    current_program = new_prg;
     glUseProgram(new_prg->opengl_program_id);
     gfx_opengl_vertex_array_set_attribs(new_prg);
     gfx_opengl_set_uniforms(new_prg);
@@ -168,39 +176,42 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(uint32_t shad
     struct CCFeatures cc_features;
     gfx_cc_get_features(shader_id, &cc_features);
 
-    char vs_buf[1024];
-    char fs_buf[1024];
+    char vs_buf[2048];
+    char fs_buf[2048];
     size_t vs_len = 0;
     size_t fs_len = 0;
-    size_t num_floats = 4;
 
-    // Vertex shader
+    // Vertex shader, see gfx_rendering_api.h for the packed vertex format
     append_line(vs_buf, &vs_len, "#version 110");
     append_line(vs_buf, &vs_len, "attribute vec4 aVtxPos;");
     if (cc_features.used_textures[0] || cc_features.used_textures[1]) {
         append_line(vs_buf, &vs_len, "attribute vec2 aTexCoord;");
+        append_line(vs_buf, &vs_len, "uniform vec2 uTexOffset;");
+        append_line(vs_buf, &vs_len, "uniform vec2 uTexScale;");
         append_line(vs_buf, &vs_len, "varying vec2 vTexCoord;");
-        num_floats += 2;
     }
     if (cc_features.opt_fog) {
-        append_line(vs_buf, &vs_len, "attribute vec4 aFog;");
+        append_line(vs_buf, &vs_len, "attribute float aFog;");
+        append_line(vs_buf, &vs_len, "uniform vec3 uFogColor;");
         append_line(vs_buf, &vs_len, "varying vec4 vFog;");
-        num_floats += 4;
     }
     for (int i = 0; i < cc_features.num_inputs; i++) {
-        vs_len += sprintf(vs_buf + vs_len, "attribute vec%d aInput%d;\n", cc_features.opt_alpha ? 4 : 3, i + 1);
-        vs_len += sprintf(vs_buf + vs_len, "varying vec%d vInput%d;\n", cc_features.opt_alpha ? 4 : 3, i + 1);
-        num_floats += cc_features.opt_alpha ? 4 : 3;
+        if (!cc_features.input_uniform[i]) {
+            vs_len += sprintf(vs_buf + vs_len, "attribute vec%d aInput%d;\n", cc_features.opt_alpha ? 4 : 3, i + 1);
+            vs_len += sprintf(vs_buf + vs_len, "varying vec%d vInput%d;\n", cc_features.opt_alpha ? 4 : 3, i + 1);
+        }
     }
     append_line(vs_buf, &vs_len, "void main() {");
     if (cc_features.used_textures[0] || cc_features.used_textures[1]) {
-        append_line(vs_buf, &vs_len, "vTexCoord = aTexCoord;");
+        append_line(vs_buf, &vs_len, "vTexCoord = (aTexCoord - uTexOffset) * uTexScale;");
     }
     if (cc_features.opt_fog) {
-        append_line(vs_buf, &vs_len, "vFog = aFog;");
+        append_line(vs_buf, &vs_len, "vFog = vec4(uFogColor, aFog);");
     }
     for (int i = 0; i < cc_features.num_inputs; i++) {
-        vs_len += sprintf(vs_buf + vs_len, "vInput%d = aInput%d;\n", i + 1, i + 1);
+        if (!cc_features.input_uniform[i]) {
+            vs_len += sprintf(vs_buf + vs_len, "vInput%d = aInput%d;\n", i + 1, i + 1);
+        }
     }
     append_line(vs_buf, &vs_len, "gl_Position = aVtxPos;");
     append_line(vs_buf, &vs_len, "}");
@@ -215,7 +226,11 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(uint32_t shad
         append_line(fs_buf, &fs_len, "varying vec4 vFog;");
     }
     for (int i = 0; i < cc_features.num_inputs; i++) {
-        fs_len += sprintf(fs_buf + fs_len, "varying vec%d vInput%d;\n", cc_features.opt_alpha ? 4 : 3, i + 1);
+        if (cc_features.input_uniform[i]) {
+            fs_len += sprintf(fs_buf + fs_len, "uniform vec4 uInput%d;\n", i + 1);
+        } else {
+            fs_len += sprintf(fs_buf + fs_len, "varying vec%d vInput%d;\n", cc_features.opt_alpha ? 4 : 3, i + 1);
+        }
     }
     if (cc_features.used_textures[0]) {
         append_line(fs_buf, &fs_len, "uniform sampler2D uTex0;");
@@ -236,6 +251,13 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(uint32_t shad
 
     append_line(fs_buf, &fs_len, "void main() {");
 
+    // The combiner formula reads the inputs by their varying names
+    for (int i = 0; i < cc_features.num_inputs; i++) {
+        if (cc_features.input_uniform[i]) {
+            fs_len += sprintf(fs_buf + fs_len, "vec%d vInput%d = uInput%d%s;\n", cc_features.opt_alpha ? 4 : 3, i + 1, i + 1, cc_features.opt_alpha ? "" : ".rgb");
+        }
+    }
+
     if (cc_features.used_textures[0]) {
         append_line(fs_buf, &fs_len, "vec4 texVal0 = texture2D(uTex0, vTexCoord);");
     }
@@ -325,38 +347,61 @@ static struct ShaderProgram *gfx_opengl_create_and_load_new_shader(uint32_t shad
     glLinkProgram(shader_program);
 
     size_t cnt = 0;
+    size_t offset = 0;
 
     struct ShaderProgram *prg = &shader_program_pool[shader_program_pool_size++];
     prg->attrib_locations[cnt] = glGetAttribLocation(shader_program, "aVtxPos");
     prg->attrib_sizes[cnt] = 4;
+    prg->attrib_types[cnt] = GL_FLOAT;
+    prg->attrib_offsets[cnt] = offset;
+    offset += 4 * sizeof(float);
     ++cnt;
 
     if (cc_features.used_textures[0] || cc_features.used_textures[1]) {
         prg->attrib_locations[cnt] = glGetAttribLocation(shader_program, "aTexCoord");
         prg->attrib_sizes[cnt] = 2;
+        prg->attrib_types[cnt] = GL_SHORT;
+        prg->attrib_offsets[cnt] = offset;
+        offset += 4;
         ++cnt;
     }
 
     if (cc_features.opt_fog) {
         prg->attrib_locations[cnt] = glGetAttribLocation(shader_program, "aFog");
-        prg->attrib_sizes[cnt] = 4;
+        prg->attrib_sizes[cnt] = 1;
+        prg->attrib_types[cnt] = GL_UNSIGNED_BYTE;
+        prg->attrib_offsets[cnt] = offset;
+        offset += 4;
         ++cnt;
     }
 
     for (int i = 0; i < cc_features.num_inputs; i++) {
         char name[16];
+        if (cc_features.input_uniform[i]) {
+            sprintf(name, "uInput%d", i + 1);
+            prg->input_locations[i] = glGetUniformLocation(shader_program, name);
+            continue;
+        }
         sprintf(name, "aInput%d", i + 1);
         prg->attrib_locations[cnt] = glGetAttribLocation(shader_program, name);
         prg->attrib_sizes[cnt] = cc_features.opt_alpha ? 4 : 3;
+        prg->attrib_types[cnt] = GL_UNSIGNED_BYTE;
+        prg->attrib_offsets[cnt] = offset;
+        prg->input_locations[i] = -1;
+        offset += 4;
         ++cnt;
     }
 
+    prg->fog_color_location = glGetUniformLocation(shader_program, "uFogColor");
+    prg->tex_offset_location = glGetUniformLocation(shader_program, "uTexOffset");
+    prg->tex_scale_location = glGetUniformLocation(shader_program, "uTexScale");
+
     prg->shader_id = shader_id;
     prg->opengl_program_id = shader_program;
     prg->num_inputs = cc_features.num_inputs;
     prg->used_textures[0] = cc_features.used_textures[0];
     prg->used_textures[1] = cc_features.used_textures[1];
-    prg->num_floats = num_floats;
+    prg->vertex_size = offset;
     prg->num_attribs = cnt;
 
     gfx_opengl_load_shader(prg);
@@ -465,10 +510,25 @@ static void gfx_opengl_set_use_alpha(bool use_alpha) {
     }
 }
 
-static void gfx_opengl_draw_triangles(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris) {
-    //printf("flushing %d tris\n", buf_vbo_num_tris);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * buf_vbo_len, buf_vbo, GL_STREAM_DRAW);
-    glDrawArrays(GL_TRIANGLES, 0, 3 * buf_vbo_num_tris);
+static void gfx_opengl_draw_triangles_packed(uint8_t buf_vbo[], size_t buf_vbo_size, uint16_t buf_ibo[], size_t buf_vbo_num_tris, const struct GfxDrawConstants *constants) {
+    struct ShaderProgram *prg = current_program;
+
+    for (int i = 0; i < prg->num_inputs; i++) {
+        if (prg->input_locations[i] >= 0) {
+            glUniform4fv(prg->input_locations[i], 1, constants->inputs[i]);
+        }
+    }
+    if (prg->fog_color_location >= 0) {
+        glUniform3fv(prg->fog_color_location, 1, constants->fog_color);
+    }
+    if (prg->tex_offset_location >= 0) {
+        glUniform2fv(prg->tex_offset_location, 1, constants->tex_offset);
+        glUniform2fv(prg->tex_scale_location, 1, constants->tex_scale);
+    }
+
+    glBufferData(GL_ARRAY_BUFFER, buf_vbo_size, buf_vbo, GL_STREAM_DRAW);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(uint16_t) * 3 * buf_vbo_num_tris, buf_ibo, GL_STREAM_DRAW);
+    glDrawElements(GL_TRIANGLES, 3 * buf_vbo_num_tris, GL_UNSIGNED_SHORT, 0);
 }
 
 static void gfx_opengl_init(void) {
@@ -477,8 +537,10 @@ static void gfx_opengl_init(void) {
 #endif
     
     glGenBuffers(1, &opengl_vbo);
+    glGenBuffers(1, &opengl_ibo);
     
     glBindBuffer(GL_ARRAY_BUFFER, opengl_vbo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, opengl_ibo);
     
     glDepthFunc(GL_LEQUAL);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
@@ -520,7 +582,9 @@ struct GfxRenderingAPI gfx_opengl_api = {
     gfx_opengl_set_viewport,
     gfx_opengl_set_scissor,
     gfx_opengl_set_use_alpha,
-    gfx_opengl_draw_triangles,
+    NULL,
+    NULL,
+    gfx_opengl_draw_triangles_packed,
     gfx_opengl_init,
     gfx_opengl_on_resize,
     gfx_opengl_start_frame,
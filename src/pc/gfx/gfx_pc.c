@@ -10,6 +10,13 @@
 #endif
 #include <PR/gbi.h>
 
+#if defined(__SSSE3__) && !defined(GFX_PC_SCALAR)
+#include <tmmintrin.h>
+#define HAS_SSSE3 1
+#else
+#define HAS_SSSE3 0
+#endif
+
 #include "gfx_pc.h"
 #include "gfx_cc.h"
 #include "gfx_window_manager_api.h"
@@ -48,6 +55,7 @@ struct XYWidthHeight {
 
 struct LoadedVertex {
     float x, y, z, w;
+    float x_w, y_w; // x / w and y / w, for back face culling
     float u, v;
     struct RGBA color;
     uint8_t clip_rej;
@@ -69,15 +77,80 @@ static struct {
     uint32_t pool_pos;
 } gfx_texture_cache;
 
+// Decoded RGBA32 data of textures, kept when they are evicted from
+// gfx_texture_cache so that they can be uploaded again without decoding.
+// A copy of the source (and palette) bytes is kept to detect textures whose
+// memory was rewritten, comparing them is much cheaper than decoding.
+// When the table is full, the least recently used textures are dropped.
+struct ConvertedTexture {
+    struct ConvertedTexture *next;
+    struct ConvertedTexture *lru_prev, *lru_next; // lru_prev is more recently used
+    size_t total_bytes;
+
+    const uint8_t *texture_addr;
+    uint8_t fmt, siz;
+    uint32_t size_bytes;
+    uint32_t line_size_bytes;
+    uint32_t palette_size;
+    uint32_t width, height;
+
+    const uint8_t *src_copy;
+    const uint8_t *palette_copy;
+    const uint8_t *rgba32;
+};
+#define CONVERTED_TEXTURES_MAX_BYTES (64 * 1024 * 1024)
+static struct {
+    struct ConvertedTexture *hashmap[1024];
+    struct ConvertedTexture *lru_first, *lru_last;
+    size_t total_bytes;
+} gfx_converted_textures;
+
+// A texture as it is loaded in a tile, which is what the decode functions read
+struct TextureSource {
+    const uint8_t *addr;
+    uint32_t size_bytes;
+    uint32_t line_size_bytes;
+    const uint8_t *palette;
+    uint32_t palette_size;
+};
+
+// Largest decoded texture, 4096 bytes of 4-bit texels
+#define DECODED_TEXTURE_MAX_BYTES 32768
+
+// Textures decoded ahead of their first draw, see gfx_texture_prefetch_display_list
+struct GfxTexturePrefetch {
+    struct ConvertedTexture *hashmap[1024];
+    size_t total_bytes;
+};
+
 struct ColorCombiner {
     uint32_t cc_id;
     struct ShaderProgram *prg;
     uint8_t shader_input_mapping[2][4];
+    bool input_uniform[4];
 };
 
 static struct ColorCombiner color_combiner_pool[64];
 static uint8_t color_combiner_pool_size;
 
+// Most triangles drawn at once from consecutive G_TRI1 and G_TRI2 commands
+#define MAX_TRI_RUN 64
+
+// What is needed to write the vertices of triangles drawn with the same state
+struct TriangleSetup {
+    uint8_t num_inputs;
+    bool use_alpha;
+    bool use_fog;
+    bool use_texture;
+    bool linear_filter;
+    bool use_lod;
+    bool z_is_from_0_to_1;
+    uint32_t tex_width, tex_height;
+    uint8_t input_sources[2][4];
+    struct RGBA input_colors[2][4];
+    const bool *input_uniform;
+};
+
 static struct RSP {
     float modelview_matrix_stack[11][4][4];
     uint8_t modelview_matrix_stack_size;
@@ -109,6 +182,7 @@ static struct RSP {
 
 static struct RDP {
     const uint8_t *palette;
+    uint32_t palette_size; // Bytes loaded by the last G_LOADTLUT
     struct {
         const uint8_t *addr;
         uint8_t siz;
@@ -148,6 +222,7 @@ static struct RenderingState {
 } rendering_state;
 
 struct GfxDimensions gfx_current_dimensions;
+uint32_t gfx_frames_per_tick = 1;
 
 static bool dropped_frame;
 
@@ -155,6 +230,16 @@ static float buf_vbo[MAX_BUFFERED * (26 * 3)]; // 3 vertices in a triangle and 2
 static size_t buf_vbo_len;
 static size_t buf_vbo_num_tris;
 
+// When the rendering API supports indexed drawing, each loaded vertex is only
+// written once to buf_vbo for the triangles drawn with the same state
+static uint16_t buf_ibo[MAX_BUFFERED * 3];
+static size_t buf_vbo_num_verts;
+static uint16_t buf_vbo_vertex_ids[MAX_VERTICES + 4]; // index in buf_vbo + 1, 0 if not written
+
+// With packed vertices, the values that are the same for all of them. buf_vbo
+// then holds the vertices as bytes, and buf_vbo_len counts 4 byte words
+static struct GfxDrawConstants buf_vbo_constants;
+
 static struct GfxWindowManagerAPI *gfx_wapi;
 static struct GfxRenderingAPI *gfx_rapi;
 
@@ -169,9 +254,17 @@ static void gfx_flush(void) {
     if (buf_vbo_len > 0) {
         int num = buf_vbo_num_tris;
         unsigned long t0 = get_time();
-        gfx_rapi->draw_triangles(buf_vbo, buf_vbo_len, buf_vbo_num_tris);
+        if (gfx_rapi->draw_triangles_packed != NULL) {
+            gfx_rapi->draw_triangles_packed((uint8_t *) buf_vbo, buf_vbo_len * sizeof(float), buf_ibo, buf_vbo_num_tris, &buf_vbo_constants);
+        } else if (gfx_rapi->draw_triangles_indexed != NULL) {
+            gfx_rapi->draw_triangles_indexed(buf_vbo, buf_vbo_len, buf_ibo, buf_vbo_num_tris);
+        } else {
+            gfx_rapi->draw_triangles(buf_vbo, buf_vbo_len, buf_vbo_num_tris);
+        }
         buf_vbo_len = 0;
         buf_vbo_num_tris = 0;
+        buf_vbo_num_verts = 0;
+        memset(buf_vbo_vertex_ids, 0, sizeof(buf_vbo_vertex_ids));
         unsigned long t1 = get_time();
         /*if (t1 - t0 > 1000) {
             printf("f: %d %d\n", num, (int)(t1 - t0));
@@ -231,6 +324,17 @@ static void gfx_generate_cc(struct ColorCombiner *comb, uint32_t cc_id) {
             shader_id |= val << (i * 12 + j * 3);
         }
     }
+    // With packed vertices, inputs that don't depend on the vertex are uniforms
+    for (int i = 0; i < 4; i++) {
+        bool per_vertex = false;
+        for (int j = 0; j < 2; j++) {
+            per_vertex |= shader_input_mapping[j][i] == CC_SHADE || shader_input_mapping[j][i] == CC_LOD;
+        }
+        comb->input_uniform[i] = gfx_rapi->draw_triangles_packed != NULL && !per_vertex;
+        if (comb->input_uniform[i]) {
+            shader_id |= SHADER_OPT_INPUT_UNIFORM(i);
+        }
+    }
     comb->cc_id = cc_id;
     comb->prg = gfx_lookup_or_create_shader_program(shader_id);
     memcpy(comb->shader_input_mapping, shader_input_mapping, sizeof(shader_input_mapping));
@@ -288,11 +392,234 @@ static bool gfx_texture_cache_lookup(int tile, struct TextureHashmapNode **n, co
     return false;
 }
 
-static void import_texture_rgba16(int tile) {
-    uint8_t rgba32_buf[8192];
-    
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes / 2; i++) {
-        uint16_t col16 = (rdp.loaded_texture[tile].addr[2 * i] << 8) | rdp.loaded_texture[tile].addr[2 * i + 1];
+static struct TextureSource gfx_loaded_texture_source(int tile) {
+    struct TextureSource src = {
+        rdp.loaded_texture[tile].addr, rdp.loaded_texture[tile].size_bytes,
+        rdp.texture_tile.line_size_bytes, rdp.palette, rdp.palette_size
+    };
+    return src;
+}
+
+static uint32_t gfx_texture_palette_size(uint8_t fmt, uint8_t siz, uint32_t loaded_palette_size) {
+    if (fmt != G_IM_FMT_CI) {
+        return 0;
+    }
+    uint32_t size = siz == G_IM_SIZ_4b ? 16 * 2 : 256 * 2;
+    // Bytes past the loaded TLUT are not part of the palette
+    return size < loaded_palette_size ? size : loaded_palette_size;
+}
+
+static struct ConvertedTexture **gfx_converted_texture_bucket(struct ConvertedTexture **hashmap, const uint8_t *addr) {
+    return &hashmap[((uintptr_t)addr >> 5) & 0x3ff];
+}
+
+static void gfx_converted_texture_lru_unlink(struct ConvertedTexture *ct) {
+    if (ct->lru_prev != NULL) {
+        ct->lru_prev->lru_next = ct->lru_next;
+    } else {
+        gfx_converted_textures.lru_first = ct->lru_next;
+    }
+    if (ct->lru_next != NULL) {
+        ct->lru_next->lru_prev = ct->lru_prev;
+    } else {
+        gfx_converted_textures.lru_last = ct->lru_prev;
+    }
+}
+
+static void gfx_converted_texture_lru_push_first(struct ConvertedTexture *ct) {
+    ct->lru_prev = NULL;
+    ct->lru_next = gfx_converted_textures.lru_first;
+    if (ct->lru_next != NULL) {
+        ct->lru_next->lru_prev = ct;
+    } else {
+        gfx_converted_textures.lru_last = ct;
+    }
+    gfx_converted_textures.lru_first = ct;
+}
+
+// Unlink ct, which is *prev in its bucket, and free it
+static void gfx_converted_texture_free(struct ConvertedTexture **prev) {
+    struct ConvertedTexture *ct = *prev;
+
+    *prev = ct->next;
+    gfx_converted_texture_lru_unlink(ct);
+    gfx_converted_textures.total_bytes -= ct->total_bytes;
+    free(ct);
+}
+
+static void gfx_converted_texture_evict_last(void) {
+    struct ConvertedTexture *ct = gfx_converted_textures.lru_last;
+    struct ConvertedTexture **prev = gfx_converted_texture_bucket(gfx_converted_textures.hashmap, ct->texture_addr);
+
+    while (*prev != ct) {
+        prev = &(*prev)->next;
+    }
+    gfx_converted_texture_free(prev);
+}
+
+static bool gfx_converted_texture_matches(const struct ConvertedTexture *ct, const struct TextureSource *src, uint8_t fmt, uint8_t siz) {
+    return ct->texture_addr == src->addr && ct->fmt == fmt && ct->siz == siz
+        && ct->size_bytes == src->size_bytes
+        && ct->line_size_bytes == src->line_size_bytes
+        && memcmp(ct->src_copy, src->addr, ct->size_bytes) == 0
+        && (ct->palette_size == 0 || memcmp(ct->palette_copy, src->palette, ct->palette_size) == 0);
+}
+
+// Upload the texture of the tile if it was decoded before. Returns false if it has to be decoded.
+static bool gfx_upload_cached_conversion(int tile, uint8_t fmt, uint8_t siz) {
+    struct TextureSource src = gfx_loaded_texture_source(tile);
+    struct ConvertedTexture *ct = *gfx_converted_texture_bucket(gfx_converted_textures.hashmap, src.addr);
+
+    while (ct != NULL) {
+        if (gfx_converted_texture_matches(ct, &src, fmt, siz)) {
+            gfx_rapi->upload_texture(ct->rgba32, ct->width, ct->height);
+            gfx_converted_texture_lru_unlink(ct);
+            gfx_converted_texture_lru_push_first(ct);
+            return true;
+        }
+        ct = ct->next;
+    }
+    return false;
+}
+
+// Allocate a conversion with copies of the source and palette it was decoded from
+static struct ConvertedTexture *gfx_converted_texture_create(const struct TextureSource *src, uint8_t fmt, uint8_t siz,
+                                                             const uint8_t *rgba32_buf, uint32_t width, uint32_t height) {
+    uint32_t palette_size = gfx_texture_palette_size(fmt, siz, src->palette_size);
+    size_t rgba32_size = (size_t)width * height * 4;
+    size_t total = sizeof(struct ConvertedTexture) + src->size_bytes + palette_size + rgba32_size;
+    struct ConvertedTexture *ct;
+
+    if (total > CONVERTED_TEXTURES_MAX_BYTES) {
+        return NULL;
+    }
+    ct = malloc(total);
+    if (ct == NULL) {
+        return NULL;
+    }
+
+    uint8_t *data = (uint8_t *)(ct + 1);
+    memcpy(data, src->addr, src->size_bytes);
+    ct->src_copy = data;
+    data += src->size_bytes;
+    if (palette_size != 0) {
+        memcpy(data, src->palette, palette_size);
+    }
+    ct->palette_copy = data;
+    data += palette_size;
+    memcpy(data, rgba32_buf, rgba32_size);
+    ct->rgba32 = data;
+
+    ct->texture_addr = src->addr;
+    ct->fmt = fmt;
+    ct->siz = siz;
+    ct->size_bytes = src->size_bytes;
+    ct->line_size_bytes = src->line_size_bytes;
+    ct->palette_size = palette_size;
+    ct->width = width;
+    ct->height = height;
+    ct->total_bytes = total;
+    ct->next = NULL;
+    return ct;
+}
+
+// Add a conversion to the table, in place of an outdated conversion of the same texture address
+static void gfx_converted_texture_insert(struct ConvertedTexture *ct) {
+    struct ConvertedTexture **bucket = gfx_converted_texture_bucket(gfx_converted_textures.hashmap, ct->texture_addr);
+    struct ConvertedTexture **prev = bucket;
+
+    while (*prev != NULL) {
+        if ((*prev)->texture_addr == ct->texture_addr && (*prev)->fmt == ct->fmt && (*prev)->siz == ct->siz) {
+            gfx_converted_texture_free(prev);
+            break;
+        }
+        prev = &(*prev)->next;
+    }
+    while (gfx_converted_textures.total_bytes + ct->total_bytes > CONVERTED_TEXTURES_MAX_BYTES) {
+        gfx_converted_texture_evict_last();
+    }
+    ct->next = *bucket;
+    *bucket = ct;
+    gfx_converted_texture_lru_push_first(ct);
+    gfx_converted_textures.total_bytes += ct->total_bytes;
+}
+
+static void gfx_upload_converted_texture(int tile, const uint8_t *rgba32_buf, uint32_t width, uint32_t height) {
+    struct TextureSource src = gfx_loaded_texture_source(tile);
+    struct ConvertedTexture *ct;
+
+    gfx_rapi->upload_texture(rgba32_buf, width, height);
+
+    ct = gfx_converted_texture_create(&src, rdp.texture_tile.fmt, rdp.texture_tile.siz, rgba32_buf, width, height);
+    if (ct != NULL) {
+        gfx_converted_texture_insert(ct);
+    }
+}
+
+#if HAS_SSSE3
+// Interleave 16 values of each channel into 16 RGBA32 texels
+static inline void store_rgba32_x16(uint8_t *dest, __m128i r, __m128i g, __m128i b, __m128i a) {
+    __m128i rg_lo = _mm_unpacklo_epi8(r, g);
+    __m128i rg_hi = _mm_unpackhi_epi8(r, g);
+    __m128i ba_lo = _mm_unpacklo_epi8(b, a);
+    __m128i ba_hi = _mm_unpackhi_epi8(b, a);
+    _mm_storeu_si128((__m128i *)dest, _mm_unpacklo_epi16(rg_lo, ba_lo));
+    _mm_storeu_si128((__m128i *)(dest + 16), _mm_unpackhi_epi16(rg_lo, ba_lo));
+    _mm_storeu_si128((__m128i *)(dest + 32), _mm_unpacklo_epi16(rg_hi, ba_hi));
+    _mm_storeu_si128((__m128i *)(dest + 48), _mm_unpackhi_epi16(rg_hi, ba_hi));
+}
+
+// Split 16 bytes into 32 4-bit texels, high nibble first like the scalar loops
+static inline void unpack_nibbles_x32(const uint8_t *src, __m128i *first, __m128i *second) {
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    __m128i bytes = _mm_loadu_si128((const __m128i *)src);
+    __m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    __m128i low = _mm_and_si128(bytes, mask);
+    *first = _mm_unpacklo_epi8(high, low);
+    *second = _mm_unpackhi_epi8(high, low);
+}
+
+// SCALE_5_8 on 16-bit lanes, 8 * v + 7 * v / 31 computed with a multiplication
+static inline __m128i scale_5_8_epi16(__m128i v) {
+    return _mm_add_epi16(_mm_slli_epi16(v, 3), _mm_srli_epi16(_mm_mullo_epi16(v, _mm_set1_epi16(1855)), 13));
+}
+
+// Decode 16 big endian RGBA5551 texels into separate 8-bit channels
+static inline void decode_rgba16_x16(const uint8_t *src, __m128i *r, __m128i *g, __m128i *b, __m128i *a) {
+    const __m128i bswap = _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    const __m128i mask5 = _mm_set1_epi16(0x1f);
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i alpha = _mm_set1_epi16(255);
+    __m128i col[2];
+    __m128i ch[4][2];
+
+    col[0] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)src), bswap);
+    col[1] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(src + 16)), bswap);
+    for (int i = 0; i < 2; i++) {
+        ch[0][i] = scale_5_8_epi16(_mm_srli_epi16(col[i], 11));
+        ch[1][i] = scale_5_8_epi16(_mm_and_si128(_mm_srli_epi16(col[i], 6), mask5));
+        ch[2][i] = scale_5_8_epi16(_mm_and_si128(_mm_srli_epi16(col[i], 1), mask5));
+        ch[3][i] = _mm_mullo_epi16(_mm_and_si128(col[i], one), alpha);
+    }
+    *r = _mm_packus_epi16(ch[0][0], ch[0][1]);
+    *g = _mm_packus_epi16(ch[1][0], ch[1][1]);
+    *b = _mm_packus_epi16(ch[2][0], ch[2][1]);
+    *a = _mm_packus_epi16(ch[3][0], ch[3][1]);
+}
+#endif
+
+static void decode_texture_rgba16(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    for (; i + 16 <= src->size_bytes / 2; i += 16) {
+        __m128i r, g, b, a;
+        decode_rgba16_x16(src->addr + 2 * i, &r, &g, &b, &a);
+        store_rgba32_x16(rgba32_buf + 4 * i, r, g, b, a);
+    }
+#endif
+    for (; i < src->size_bytes / 2; i++) {
+        uint16_t col16 = (src->addr[2 * i] << 8) | src->addr[2 * i + 1];
         uint8_t a = col16 & 1;
         uint8_t r = col16 >> 11;
         uint8_t g = (col16 >> 6) & 0x1f;
@@ -303,23 +630,30 @@ static void import_texture_rgba16(int tile) {
         rgba32_buf[4*i + 3] = a ? 255 : 0;
     }
     
-    uint32_t width = rdp.texture_tile.line_size_bytes / 2;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-    
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
-}
-
-static void import_texture_rgba32(int tile) {
-    uint32_t width = rdp.texture_tile.line_size_bytes / 2;
-    uint32_t height = (rdp.loaded_texture[tile].size_bytes / 2) / rdp.texture_tile.line_size_bytes;
-    gfx_rapi->upload_texture(rdp.loaded_texture[tile].addr, width, height);
+    *width = src->line_size_bytes / 2;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture_ia4(int tile) {
-    uint8_t rgba32_buf[32768];
-    
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
+static void decode_texture_ia4(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    const __m128i intensity_lut = _mm_setr_epi8(0, 0, 36, 36, 72, 72, 108, 108,
+                                                (char)144, (char)144, (char)180, (char)180,
+                                                (char)216, (char)216, (char)252, (char)252);
+    const __m128i alpha_lut = _mm_setr_epi8(0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1);
+    for (; i + 32 <= src->size_bytes * 2; i += 32) {
+        __m128i parts[2];
+        unpack_nibbles_x32(src->addr + i / 2, &parts[0], &parts[1]);
+        for (int j = 0; j < 2; j++) {
+            __m128i intensity = _mm_shuffle_epi8(intensity_lut, parts[j]);
+            __m128i alpha = _mm_shuffle_epi8(alpha_lut, parts[j]);
+            store_rgba32_x16(rgba32_buf + 4 * (i + 16 * j), intensity, intensity, intensity, alpha);
+        }
+    }
+#endif
+    for (; i < src->size_bytes * 2; i++) {
+        uint8_t byte = src->addr[i / 2];
         uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
         uint8_t intensity = part >> 1;
         uint8_t alpha = part & 1;
@@ -332,18 +666,28 @@ static void import_texture_ia4(int tile) {
         rgba32_buf[4*i + 3] = alpha ? 255 : 0;
     }
     
-    uint32_t width = rdp.texture_tile.line_size_bytes * 2;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-    
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes * 2;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture_ia8(int tile) {
-    uint8_t rgba32_buf[16384];
-    
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[i] >> 4;
-        uint8_t alpha = rdp.loaded_texture[tile].addr[i] & 0xf;
+static void decode_texture_ia8(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    for (; i + 16 <= src->size_bytes; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(src->addr + i));
+        __m128i intensity = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+        __m128i alpha = _mm_and_si128(bytes, mask);
+        // SCALE_4_8, a nibble times 0x11 is the nibble repeated
+        intensity = _mm_or_si128(intensity, _mm_slli_epi16(intensity, 4));
+        alpha = _mm_or_si128(alpha, _mm_slli_epi16(alpha, 4));
+        store_rgba32_x16(rgba32_buf + 4 * i, intensity, intensity, intensity, alpha);
+    }
+#endif
+    for (; i < src->size_bytes; i++) {
+        uint8_t intensity = src->addr[i] >> 4;
+        uint8_t alpha = src->addr[i] & 0xf;
         uint8_t r = intensity;
         uint8_t g = intensity;
         uint8_t b = intensity;
@@ -353,18 +697,24 @@ static void import_texture_ia8(int tile) {
         rgba32_buf[4*i + 3] = SCALE_4_8(alpha);
     }
     
-    uint32_t width = rdp.texture_tile.line_size_bytes;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-    
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture_ia16(int tile) {
-    uint8_t rgba32_buf[8192];
-    
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes / 2; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[2 * i];
-        uint8_t alpha = rdp.loaded_texture[tile].addr[2 * i + 1];
+static void decode_texture_ia16(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    const __m128i expand = _mm_setr_epi8(0, 0, 0, 1, 2, 2, 2, 3, 4, 4, 4, 5, 6, 6, 6, 7);
+    for (; i + 8 <= src->size_bytes / 2; i += 8) {
+        __m128i texels = _mm_loadu_si128((const __m128i *)(src->addr + 2 * i));
+        _mm_storeu_si128((__m128i *)(rgba32_buf + 4 * i), _mm_shuffle_epi8(texels, expand));
+        _mm_storeu_si128((__m128i *)(rgba32_buf + 4 * i + 16), _mm_shuffle_epi8(_mm_srli_si128(texels, 8), expand));
+    }
+#endif
+    for (; i < src->size_bytes / 2; i++) {
+        uint8_t intensity = src->addr[2 * i];
+        uint8_t alpha = src->addr[2 * i + 1];
         uint8_t r = intensity;
         uint8_t g = intensity;
         uint8_t b = intensity;
@@ -374,17 +724,27 @@ static void import_texture_ia16(int tile) {
         rgba32_buf[4*i + 3] = alpha;
     }
     
-    uint32_t width = rdp.texture_tile.line_size_bytes / 2;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-    
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes / 2;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture_i4(int tile) {
-    uint8_t rgba32_buf[32768];
-
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
+static void decode_texture_i4(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    const __m128i alpha = _mm_set1_epi8(-1);
+    for (; i + 32 <= src->size_bytes * 2; i += 32) {
+        __m128i parts[2];
+        unpack_nibbles_x32(src->addr + i / 2, &parts[0], &parts[1]);
+        for (int j = 0; j < 2; j++) {
+            // SCALE_4_8, a nibble times 0x11 is the nibble repeated
+            __m128i intensity = _mm_or_si128(parts[j], _mm_slli_epi16(parts[j], 4));
+            store_rgba32_x16(rgba32_buf + 4 * (i + 16 * j), intensity, intensity, intensity, alpha);
+        }
+    }
+#endif
+    for (; i < src->size_bytes * 2; i++) {
+        uint8_t byte = src->addr[i / 2];
         uint8_t part = (byte >> (4 - (i % 2) * 4)) & 0xf;
         uint8_t intensity = part;
         uint8_t r = intensity;
@@ -396,17 +756,22 @@ static void import_texture_i4(int tile) {
         rgba32_buf[4*i + 3] = 255;
     }
 
-    uint32_t width = rdp.texture_tile.line_size_bytes * 2;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes * 2;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture_i8(int tile) {
-    uint8_t rgba32_buf[16384];
+static void decode_texture_i8(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
 
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t intensity = rdp.loaded_texture[tile].addr[i];
+#if HAS_SSSE3
+    const __m128i alpha = _mm_set1_epi8(-1);
+    for (; i + 16 <= src->size_bytes; i += 16) {
+        __m128i intensity = _mm_loadu_si128((const __m128i *)(src->addr + i));
+        store_rgba32_x16(rgba32_buf + 4 * i, intensity, intensity, intensity, alpha);
+    }
+#endif
+    for (; i < src->size_bytes; i++) {
+        uint8_t intensity = src->addr[i];
         uint8_t r = intensity;
         uint8_t g = intensity;
         uint8_t b = intensity;
@@ -416,20 +781,35 @@ static void import_texture_i8(int tile) {
         rgba32_buf[4*i + 3] = 255;
     }
 
-    uint32_t width = rdp.texture_tile.line_size_bytes;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
 
-static void import_texture_ci4(int tile) {
-    uint8_t rgba32_buf[32768];
-    
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes * 2; i++) {
-        uint8_t byte = rdp.loaded_texture[tile].addr[i / 2];
+static void decode_texture_ci4(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    // The decoded channels of the 16 palette entries are used as lookup tables.
+    // A shorter TLUT is left to the scalar loop, which only reads the used entries.
+    if (src->palette_size >= 16 * 2) {
+        __m128i pal_r, pal_g, pal_b, pal_a;
+        decode_rgba16_x16(src->palette, &pal_r, &pal_g, &pal_b, &pal_a);
+        for (; i + 32 <= src->size_bytes * 2; i += 32) {
+            __m128i idx[2];
+            unpack_nibbles_x32(src->addr + i / 2, &idx[0], &idx[1]);
+            for (int j = 0; j < 2; j++) {
+                store_rgba32_x16(rgba32_buf + 4 * (i + 16 * j),
+                                 _mm_shuffle_epi8(pal_r, idx[j]), _mm_shuffle_epi8(pal_g, idx[j]),
+                                 _mm_shuffle_epi8(pal_b, idx[j]), _mm_shuffle_epi8(pal_a, idx[j]));
+            }
+        }
+    }
+#endif
+    for (; i < src->size_bytes * 2; i++) {
+        uint8_t byte = src->addr[i / 2];
         uint8_t idx = (byte >> (4 - (i % 2) * 4)) & 0xf;
-        uint16_t col16 = (rdp.palette[idx * 2] << 8) | rdp.palette[idx * 2 + 1]; // Big endian load
+        uint16_t col16 = (src->palette[idx * 2] << 8) | src->palette[idx * 2 + 1]; // Big endian load
         uint8_t a = col16 & 1;
         uint8_t r = col16 >> 11;
         uint8_t g = (col16 >> 6) & 0x1f;
@@ -440,18 +820,30 @@ static void import_texture_ci4(int tile) {
         rgba32_buf[4*i + 3] = a ? 255 : 0;
     }
     
-    uint32_t width = rdp.texture_tile.line_size_bytes * 2;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-    
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes * 2;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture_ci8(int tile) {
-    uint8_t rgba32_buf[16384];
-    
-    for (uint32_t i = 0; i < rdp.loaded_texture[tile].size_bytes; i++) {
-        uint8_t idx = rdp.loaded_texture[tile].addr[i];
-        uint16_t col16 = (rdp.palette[idx * 2] << 8) | rdp.palette[idx * 2 + 1]; // Big endian load
+static void decode_texture_ci8(const struct TextureSource *src, uint8_t *rgba32_buf, uint32_t *width, uint32_t *height) {
+    uint32_t i = 0;
+
+#if HAS_SSSE3
+    // Decode the loaded palette entries once, 16 at a time, then copy one entry
+    // per texel. The scalar loop takes over at the first index that is not decoded.
+    uint8_t palette32[256 * 4];
+    uint32_t num_decoded = (src->palette_size / 2) & ~15u;
+    for (uint32_t j = 0; j < num_decoded; j += 16) {
+        __m128i r, g, b, a;
+        decode_rgba16_x16(src->palette + 2 * j, &r, &g, &b, &a);
+        store_rgba32_x16(palette32 + 4 * j, r, g, b, a);
+    }
+    for (; i < src->size_bytes && src->addr[i] < num_decoded; i++) {
+        memcpy(rgba32_buf + 4 * i, palette32 + 4 * src->addr[i], 4);
+    }
+#endif
+    for (; i < src->size_bytes; i++) {
+        uint8_t idx = src->addr[i];
+        uint16_t col16 = (src->palette[idx * 2] << 8) | src->palette[idx * 2 + 1]; // Big endian load
         uint8_t a = col16 & 1;
         uint8_t r = col16 >> 11;
         uint8_t g = (col16 >> 6) & 0x1f;
@@ -462,60 +854,83 @@ static void import_texture_ci8(int tile) {
         rgba32_buf[4*i + 3] = a ? 255 : 0;
     }
     
-    uint32_t width = rdp.texture_tile.line_size_bytes;
-    uint32_t height = rdp.loaded_texture[tile].size_bytes / rdp.texture_tile.line_size_bytes;
-    
-    gfx_rapi->upload_texture(rgba32_buf, width, height);
+    *width = src->line_size_bytes;
+    *height = src->size_bytes / src->line_size_bytes;
 }
 
-static void import_texture(int tile) {
-    uint8_t fmt = rdp.texture_tile.fmt;
-    uint8_t siz = rdp.texture_tile.siz;
-    
-    if (gfx_texture_cache_lookup(tile, &rendering_state.textures[tile], rdp.loaded_texture[tile].addr, fmt, siz)) {
-        return;
-    }
-    
-    int t0 = get_time();
+static void import_texture_rgba32(int tile) {
+    uint32_t width = rdp.texture_tile.line_size_bytes / 2;
+    uint32_t height = (rdp.loaded_texture[tile].size_bytes / 2) / rdp.texture_tile.line_size_bytes;
+    gfx_rapi->upload_texture(rdp.loaded_texture[tile].addr, width, height);
+}
+
+// Decode a texture that isn't RGBA32 into rgba32_buf, which holds DECODED_TEXTURE_MAX_BYTES.
+// Returns false for a format that isn't supported.
+static bool decode_texture(uint8_t fmt, uint8_t siz, const struct TextureSource *src, uint8_t *rgba32_buf,
+                           uint32_t *width, uint32_t *height) {
     if (fmt == G_IM_FMT_RGBA) {
         if (siz == G_IM_SIZ_16b) {
-            import_texture_rgba16(tile);
-        } else if (siz == G_IM_SIZ_32b) {
-            import_texture_rgba32(tile);
+            decode_texture_rgba16(src, rgba32_buf, width, height);
         } else {
-            abort();
+            return false;
         }
     } else if (fmt == G_IM_FMT_IA) {
         if (siz == G_IM_SIZ_4b) {
-            import_texture_ia4(tile);
+            decode_texture_ia4(src, rgba32_buf, width, height);
         } else if (siz == G_IM_SIZ_8b) {
-            import_texture_ia8(tile);
+            decode_texture_ia8(src, rgba32_buf, width, height);
         } else if (siz == G_IM_SIZ_16b) {
-            import_texture_ia16(tile);
+            decode_texture_ia16(src, rgba32_buf, width, height);
         } else {
-            abort();
+            return false;
         }
     } else if (fmt == G_IM_FMT_CI) {
         if (siz == G_IM_SIZ_4b) {
-            import_texture_ci4(tile);
+            decode_texture_ci4(src, rgba32_buf, width, height);
         } else if (siz == G_IM_SIZ_8b) {
-            import_texture_ci8(tile);
+            decode_texture_ci8(src, rgba32_buf, width, height);
         } else {
-            abort();
+            return false;
         }
     } else if (fmt == G_IM_FMT_I) {
         if (siz == G_IM_SIZ_4b) {
-            import_texture_i4(tile);
+            decode_texture_i4(src, rgba32_buf, width, height);
         } else if (siz == G_IM_SIZ_8b) {
-            import_texture_i8(tile);
+            decode_texture_i8(src, rgba32_buf, width, height);
         } else {
-            abort();
+            return false;
         }
     } else {
+        return false;
+    }
+    return true;
+}
+
+static void import_texture(int tile) {
+    uint8_t fmt = rdp.texture_tile.fmt;
+    uint8_t siz = rdp.texture_tile.siz;
+    
+    if (gfx_texture_cache_lookup(tile, &rendering_state.textures[tile], rdp.loaded_texture[tile].addr, fmt, siz)) {
+        return;
+    }
+    
+    if (fmt == G_IM_FMT_RGBA && siz == G_IM_SIZ_32b) {
+        import_texture_rgba32(tile);
+        return;
+    }
+
+    // Textures of the level were usually decoded when it was loaded
+    if (gfx_upload_cached_conversion(tile, fmt, siz)) {
+        return;
+    }
+
+    uint8_t rgba32_buf[DECODED_TEXTURE_MAX_BYTES];
+    struct TextureSource src = gfx_loaded_texture_source(tile);
+    uint32_t width, height;
+    if (!decode_texture(fmt, siz, &src, rgba32_buf, &width, &height)) {
         abort();
     }
-    int t1 = get_time();
-    //printf("Time diff: %d\n", t1 - t0);
+    gfx_upload_converted_texture(tile, rgba32_buf, width, height);
 }
 
 static void gfx_normalize_vector(float v[3]) {
@@ -690,6 +1105,8 @@ static void gfx_sp_vertex(size_t n_vertices, size_t dest_index, const Vtx *verti
         d->y = y;
         d->z = z;
         d->w = w;
+        d->x_w = x / w;
+        d->y_w = y / w;
         
         if (rsp.geometry_mode & G_FOG) {
             if (fabsf(w) < 0.001f) {
@@ -712,45 +1129,99 @@ static void gfx_sp_vertex(size_t n_vertices, size_t dest_index, const Vtx *verti
     }
 }
 
-static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
-    struct LoadedVertex *v1 = &rsp.loaded_vertices[vtx1_idx];
-    struct LoadedVertex *v2 = &rsp.loaded_vertices[vtx2_idx];
-    struct LoadedVertex *v3 = &rsp.loaded_vertices[vtx3_idx];
-    struct LoadedVertex *v_arr[3] = {v1, v2, v3};
-    
-    //if (rand()%2) return;
-    
-    if (v1->clip_rej & v2->clip_rej & v3->clip_rej) {
-        // The whole triangle lies outside the visible area
-        return;
+/**
+ * Remove the triangles that lie outside the view or are culled by the
+ * geometry mode, and write the remaining ones to visible.
+ */
+static size_t gfx_cull_triangles(const uint8_t (*tris)[3], size_t num_tris, uint8_t (*visible)[3]) {
+    uint32_t cull_mode = rsp.geometry_mode & G_CULL_BOTH;
+    size_t num_visible = 0;
+    
+    if (cull_mode == G_CULL_BOTH) {
+        // Why is this even an option?
+        return 0;
     }
     
-    if ((rsp.geometry_mode & G_CULL_BOTH) != 0) {
-        float dx1 = v1->x / (v1->w) - v2->x / (v2->w);
-        float dy1 = v1->y / (v1->w) - v2->y / (v2->w);
-        float dx2 = v3->x / (v3->w) - v2->x / (v2->w);
-        float dy2 = v3->y / (v3->w) - v2->y / (v2->w);
-        float cross = dx1 * dy2 - dy1 * dx2;
+    for (size_t i = 0; i < num_tris; i++) {
+        struct LoadedVertex *v1 = &rsp.loaded_vertices[tris[i][0]];
+        struct LoadedVertex *v2 = &rsp.loaded_vertices[tris[i][1]];
+        struct LoadedVertex *v3 = &rsp.loaded_vertices[tris[i][2]];
         
-        if ((v1->w < 0) ^ (v2->w < 0) ^ (v3->w < 0)) {
-            // If one vertex lies behind the eye, negating cross will give the correct result.
-            // If all vertices lie behind the eye, the triangle will be rejected anyway.
-            cross = -cross;
+        if (v1->clip_rej & v2->clip_rej & v3->clip_rej) {
+            // The whole triangle lies outside the visible area
+            continue;
         }
         
-        switch (rsp.geometry_mode & G_CULL_BOTH) {
-            case G_CULL_FRONT:
-                if (cross <= 0) return;
-                break;
-            case G_CULL_BACK:
-                if (cross >= 0) return;
-                break;
-            case G_CULL_BOTH:
-                // Why is this even an option?
-                return;
+        if (cull_mode != 0) {
+            float dx1 = v1->x_w - v2->x_w;
+            float dy1 = v1->y_w - v2->y_w;
+            float dx2 = v3->x_w - v2->x_w;
+            float dy2 = v3->y_w - v2->y_w;
+            float cross = dx1 * dy2 - dy1 * dx2;
+            
+            if ((v1->w < 0) ^ (v2->w < 0) ^ (v3->w < 0)) {
+                // If one vertex lies behind the eye, negating cross will give the correct result.
+                // If all vertices lie behind the eye, the triangle will be rejected anyway.
+                cross = -cross;
+            }
+            
+            if (cull_mode == G_CULL_FRONT ? cross <= 0 : cross >= 0) {
+                continue;
+            }
+        }
+        
+        visible[num_visible][0] = tris[i][0];
+        visible[num_visible][1] = tris[i][1];
+        visible[num_visible][2] = tris[i][2];
+        num_visible++;
+    }
+    return num_visible;
+}
+
+/**
+ * Fill in the values that packed vertices leave out, and start a new draw if
+ * they differ from the ones of the triangles already in the buffer.
+ */
+static void gfx_set_draw_constants(const struct TriangleSetup *setup) {
+    struct GfxDrawConstants constants;
+    
+    // Unused values are cleared so that they don't cause flushes
+    memset(&constants, 0, sizeof(constants));
+    
+    for (int j = 0; j < setup->num_inputs; j++) {
+        if (setup->input_uniform[j]) {
+            constants.inputs[j][0] = setup->input_colors[0][j].r / 255.0f;
+            constants.inputs[j][1] = setup->input_colors[0][j].g / 255.0f;
+            constants.inputs[j][2] = setup->input_colors[0][j].b / 255.0f;
+            if (setup->use_alpha) {
+                constants.inputs[j][3] = setup->input_colors[1][j].a / 255.0f;
+            }
         }
     }
+    if (setup->use_fog) {
+        constants.fog_color[0] = rdp.fog_color.r / 255.0f;
+        constants.fog_color[1] = rdp.fog_color.g / 255.0f;
+        constants.fog_color[2] = rdp.fog_color.b / 255.0f;
+    }
+    if (setup->use_texture) {
+        // Linear filter adds 0.5f to the coordinates
+        constants.tex_offset[0] = rdp.texture_tile.uls * 8 - (setup->linear_filter ? 16.0f : 0.0f);
+        constants.tex_offset[1] = rdp.texture_tile.ult * 8 - (setup->linear_filter ? 16.0f : 0.0f);
+        constants.tex_scale[0] = 1.0f / (32.0f * setup->tex_width);
+        constants.tex_scale[1] = 1.0f / (32.0f * setup->tex_height);
+    }
     
+    if (memcmp(&constants, &buf_vbo_constants, sizeof(constants)) != 0) {
+        gfx_flush();
+        buf_vbo_constants = constants;
+    }
+}
+
+/**
+ * Bring the rendering API state up to date for the next triangles, and fill
+ * in what is needed to write their vertices.
+ */
+static void gfx_setup_triangles(struct TriangleSetup *setup) {
     bool depth_test = (rsp.geometry_mode & G_ZBUFFER) == G_ZBUFFER;
     if (depth_test != rendering_state.depth_test) {
         gfx_flush();
@@ -823,6 +1294,7 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
     bool used_textures[2];
     gfx_rapi->shader_get_info(prg, &num_inputs, used_textures);
     
+    bool linear_filter = (rdp.other_mode_h & (3U << G_MDSFT_TEXTFILT)) != G_TF_POINT;
     for (int i = 0; i < 2; i++) {
         if (used_textures[i]) {
             if (rdp.textures_changed[i]) {
@@ -830,7 +1302,6 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
                 import_texture(i);
                 rdp.textures_changed[i] = false;
             }
-            bool linear_filter = (rdp.other_mode_h & (3U << G_MDSFT_TEXTFILT)) != G_TF_POINT;
             if (linear_filter != rendering_state.textures[i]->linear_filter || rdp.texture_tile.cms != rendering_state.textures[i]->cms || rdp.texture_tile.cmt != rendering_state.textures[i]->cmt) {
                 gfx_flush();
                 gfx_rapi->set_sampler_parameters(i, linear_filter, rdp.texture_tile.cms, rdp.texture_tile.cmt);
@@ -841,92 +1312,257 @@ static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
         }
     }
     
-    bool use_texture = used_textures[0] || used_textures[1];
-    uint32_t tex_width = (rdp.texture_tile.lrs - rdp.texture_tile.uls + 4) / 4;
-    uint32_t tex_height = (rdp.texture_tile.lrt - rdp.texture_tile.ult + 4) / 4;
+    setup->num_inputs = num_inputs;
+    setup->use_alpha = use_alpha;
+    setup->use_fog = use_fog;
+    setup->use_texture = used_textures[0] || used_textures[1];
+    setup->linear_filter = linear_filter;
+    setup->use_lod = false;
+    setup->input_uniform = comb->input_uniform;
+    setup->z_is_from_0_to_1 = gfx_rapi->z_is_from_0_to_1();
+    setup->tex_width = (rdp.texture_tile.lrs - rdp.texture_tile.uls + 4) / 4;
+    setup->tex_height = (rdp.texture_tile.lrt - rdp.texture_tile.ult + 4) / 4;
+    
+    // Everything but shade and LOD is the same for all vertices
+    for (int j = 0; j < num_inputs; j++) {
+        for (int k = 0; k < 2; k++) {
+            struct RGBA *color = &setup->input_colors[k][j];
+            
+            setup->input_sources[k][j] = comb->shader_input_mapping[k][j];
+            switch (comb->shader_input_mapping[k][j]) {
+                case CC_PRIM:
+                    *color = rdp.prim_color;
+                    break;
+                case CC_ENV:
+                    *color = rdp.env_color;
+                    break;
+                case CC_LOD:
+                    setup->use_lod = true;
+                    break;
+                case CC_SHADE:
+                    break;
+                default:
+                    memset(color, 0, sizeof(*color));
+                    break;
+            }
+        }
+    }
     
-    bool z_is_from_0_to_1 = gfx_rapi->z_is_from_0_to_1();
+    if (gfx_rapi->draw_triangles_packed != NULL) {
+        gfx_set_draw_constants(setup);
+    }
+}
+
+static float *gfx_emit_vertex(const struct TriangleSetup *setup, struct LoadedVertex *v, const struct RGBA *lod, float *out) {
+    float z = v->z, w = v->w;
+    if (setup->z_is_from_0_to_1) {
+        z = (z + w) / 2.0f;
+    }
+    *out++ = v->x;
+    *out++ = v->y;
+    *out++ = z;
+    *out++ = w;
+    
+    if (setup->use_texture) {
+        float u = (v->u - rdp.texture_tile.uls * 8) / 32.0f;
+        float tv = (v->v - rdp.texture_tile.ult * 8) / 32.0f;
+        if (setup->linear_filter) {
+            // Linear filter adds 0.5f to the coordinates
+            u += 0.5f;
+            tv += 0.5f;
+        }
+        *out++ = u / setup->tex_width;
+        *out++ = tv / setup->tex_height;
+    }
     
-    for (int i = 0; i < 3; i++) {
-        float z = v_arr[i]->z, w = v_arr[i]->w;
-        if (z_is_from_0_to_1) {
-            z = (z + w) / 2.0f;
+    if (setup->use_fog) {
+        *out++ = rdp.fog_color.r / 255.0f;
+        *out++ = rdp.fog_color.g / 255.0f;
+        *out++ = rdp.fog_color.b / 255.0f;
+        *out++ = v->color.a / 255.0f; // fog factor (not alpha)
+    }
+    
+    for (int j = 0; j < setup->num_inputs; j++) {
+        const struct RGBA *color;
+        for (int k = 0; k < 1 + (setup->use_alpha ? 1 : 0); k++) {
+            switch (setup->input_sources[k][j]) {
+                case CC_SHADE:
+                    color = &v->color;
+                    break;
+                case CC_LOD:
+                    color = lod;
+                    break;
+                default:
+                    color = &setup->input_colors[k][j];
+                    break;
+            }
+            if (k == 0) {
+                *out++ = color->r / 255.0f;
+                *out++ = color->g / 255.0f;
+                *out++ = color->b / 255.0f;
+            } else {
+                if (setup->use_fog && color == &v->color) {
+                    // Shade alpha is 100% for fog
+                    *out++ = 1.0f;
+                } else {
+                    *out++ = color->a / 255.0f;
+                }
+            }
         }
-        buf_vbo[buf_vbo_len++] = v_arr[i]->x;
-        buf_vbo[buf_vbo_len++] = v_arr[i]->y;
-        buf_vbo[buf_vbo_len++] = z;
-        buf_vbo[buf_vbo_len++] = w;
-        
-        if (use_texture) {
-            float u = (v_arr[i]->u - rdp.texture_tile.uls * 8) / 32.0f;
-            float v = (v_arr[i]->v - rdp.texture_tile.ult * 8) / 32.0f;
-            if ((rdp.other_mode_h & (3U << G_MDSFT_TEXTFILT)) != G_TF_POINT) {
-                // Linear filter adds 0.5f to the coordinates
-                u += 0.5f;
-                v += 0.5f;
+    }
+    return out;
+}
+
+static int16_t gfx_pack_tex_coord(float tc) {
+    // Texture rectangles can go past the range of vertex texture coordinates
+    if (tc > INT16_MAX) return INT16_MAX;
+    if (tc < INT16_MIN) return INT16_MIN;
+    return (int16_t) tc;
+}
+
+static void gfx_pack_color(uint8_t *out, const struct RGBA *rgb, const struct RGBA *a) {
+    out[0] = rgb->r;
+    out[1] = rgb->g;
+    out[2] = rgb->b;
+    out[3] = a != NULL ? a->a : 0;
+}
+
+static float *gfx_emit_vertex_packed(const struct TriangleSetup *setup, struct LoadedVertex *v, const struct RGBA *lod, float *out) {
+    static const struct RGBA opaque = { 0, 0, 0, 255 };
+    float z = v->z, w = v->w;
+    if (setup->z_is_from_0_to_1) {
+        z = (z + w) / 2.0f;
+    }
+    *out++ = v->x;
+    *out++ = v->y;
+    *out++ = z;
+    *out++ = w;
+    
+    uint8_t *bytes = (uint8_t *) out;
+    
+    if (setup->use_texture) {
+        int16_t tc[2] = { gfx_pack_tex_coord(v->u), gfx_pack_tex_coord(v->v) };
+        memcpy(bytes, tc, sizeof(tc));
+        bytes += 4;
+    }
+    
+    if (setup->use_fog) {
+        bytes[0] = v->color.a; // fog factor
+        bytes[1] = bytes[2] = bytes[3] = 0;
+        bytes += 4;
+    }
+    
+    for (int j = 0; j < setup->num_inputs; j++) {
+        const struct RGBA *colors[2];
+        if (setup->input_uniform[j]) {
+            continue;
+        }
+        for (int k = 0; k < 2; k++) {
+            switch (setup->input_sources[k][j]) {
+                case CC_SHADE:
+                    // Shade alpha is 100% for fog
+                    colors[k] = k == 1 && setup->use_fog ? &opaque : &v->color;
+                    break;
+                case CC_LOD:
+                    colors[k] = lod;
+                    break;
+                default:
+                    colors[k] = &setup->input_colors[k][j];
+                    break;
             }
-            buf_vbo[buf_vbo_len++] = u / tex_width;
-            buf_vbo[buf_vbo_len++] = v / tex_height;
         }
+        gfx_pack_color(bytes, colors[0], setup->use_alpha ? colors[1] : NULL);
+        bytes += 4;
+    }
+    return (float *) bytes;
+}
+
+/**
+ * Write the vertices of triangles that passed culling to the vertex buffer,
+ * flushing it whenever it fills up.
+ */
+static void gfx_emit_triangles(const struct TriangleSetup *setup, const uint8_t (*tris)[3], size_t num_tris) {
+    bool packed = gfx_rapi->draw_triangles_packed != NULL;
+    bool indexed = packed || gfx_rapi->draw_triangles_indexed != NULL;
+    float *(*emit_vertex)(const struct TriangleSetup *, struct LoadedVertex *, const struct RGBA *, float *) =
+        packed ? gfx_emit_vertex_packed : gfx_emit_vertex;
+    
+    // The vertex data depends on the state, so vertices written for earlier
+    // triangles can't be reused by these ones
+    memset(buf_vbo_vertex_ids, 0, sizeof(buf_vbo_vertex_ids));
+    
+    while (num_tris > 0) {
+        size_t num_batch = MAX_BUFFERED - buf_vbo_num_tris;
+        float *out = &buf_vbo[buf_vbo_len];
+        uint16_t *out_idx = &buf_ibo[buf_vbo_num_tris * 3];
         
-        if (use_fog) {
-            buf_vbo[buf_vbo_len++] = rdp.fog_color.r / 255.0f;
-            buf_vbo[buf_vbo_len++] = rdp.fog_color.g / 255.0f;
-            buf_vbo[buf_vbo_len++] = rdp.fog_color.b / 255.0f;
-            buf_vbo[buf_vbo_len++] = v_arr[i]->color.a / 255.0f; // fog factor (not alpha)
+        if (num_batch > num_tris) {
+            num_batch = num_tris;
         }
         
-        for (int j = 0; j < num_inputs; j++) {
-            struct RGBA *color;
-            struct RGBA tmp;
-            for (int k = 0; k < 1 + (use_alpha ? 1 : 0); k++) {
-                switch (comb->shader_input_mapping[k][j]) {
-                    case CC_PRIM:
-                        color = &rdp.prim_color;
-                        break;
-                    case CC_SHADE:
-                        color = &v_arr[i]->color;
-                        break;
-                    case CC_ENV:
-                        color = &rdp.env_color;
-                        break;
-                    case CC_LOD:
-                    {
-                        float distance_frac = (v1->w - 3000.0f) / 3000.0f;
-                        if (distance_frac < 0.0f) distance_frac = 0.0f;
-                        if (distance_frac > 1.0f) distance_frac = 1.0f;
-                        tmp.r = tmp.g = tmp.b = tmp.a = distance_frac * 255.0f;
-                        color = &tmp;
-                        break;
-                    }
-                    default:
-                        memset(&tmp, 0, sizeof(tmp));
-                        color = &tmp;
-                        break;
-                }
-                if (k == 0) {
-                    buf_vbo[buf_vbo_len++] = color->r / 255.0f;
-                    buf_vbo[buf_vbo_len++] = color->g / 255.0f;
-                    buf_vbo[buf_vbo_len++] = color->b / 255.0f;
+        for (size_t t = 0; t < num_batch; t++) {
+            struct LoadedVertex *v1 = &rsp.loaded_vertices[tris[t][0]];
+            struct RGBA lod;
+            
+            if (setup->use_lod) {
+                float distance_frac = (v1->w - 3000.0f) / 3000.0f;
+                if (distance_frac < 0.0f) distance_frac = 0.0f;
+                if (distance_frac > 1.0f) distance_frac = 1.0f;
+                lod.r = lod.g = lod.b = lod.a = distance_frac * 255.0f;
+            }
+            
+            for (int i = 0; i < 3; i++) {
+                uint8_t idx = tris[t][i];
+                
+                if (!indexed) {
+                    out = emit_vertex(setup, &rsp.loaded_vertices[idx], &lod, out);
+                } else if (buf_vbo_vertex_ids[idx] != 0) {
+                    *out_idx++ = buf_vbo_vertex_ids[idx] - 1;
                 } else {
-                    if (use_fog && color == &v_arr[i]->color) {
-                        // Shade alpha is 100% for fog
-                        buf_vbo[buf_vbo_len++] = 1.0f;
-                    } else {
-                        buf_vbo[buf_vbo_len++] = color->a / 255.0f;
+                    out = emit_vertex(setup, &rsp.loaded_vertices[idx], &lod, out);
+                    *out_idx++ = buf_vbo_num_verts;
+                    // The LOD input differs between triangles, so those vertices aren't shared
+                    if (!setup->use_lod) {
+                        buf_vbo_vertex_ids[idx] = buf_vbo_num_verts + 1;
                     }
+                    buf_vbo_num_verts++;
                 }
             }
         }
-        /*struct RGBA *color = &v_arr[i]->color;
-        buf_vbo[buf_vbo_len++] = color->r / 255.0f;
-        buf_vbo[buf_vbo_len++] = color->g / 255.0f;
-        buf_vbo[buf_vbo_len++] = color->b / 255.0f;
-        buf_vbo[buf_vbo_len++] = color->a / 255.0f;*/
+        
+        buf_vbo_len = out - buf_vbo;
+        buf_vbo_num_tris += num_batch;
+        tris += num_batch;
+        num_tris -= num_batch;
+        
+        if (buf_vbo_num_tris == MAX_BUFFERED) {
+            gfx_flush();
+        }
     }
-    if (++buf_vbo_num_tris == MAX_BUFFERED) {
-        gfx_flush();
+}
+
+/**
+ * Draw a run of triangles that share the same RSP and RDP state. The state is
+ * only looked at once, after the triangles that can't be seen are removed.
+ */
+static void gfx_sp_tris(const uint8_t (*tris)[3], size_t num_tris) {
+    uint8_t visible[MAX_TRI_RUN][3];
+    struct TriangleSetup setup;
+    size_t num_visible;
+    
+    num_visible = gfx_cull_triangles(tris, num_tris, visible);
+    if (num_visible == 0) {
+        return;
     }
+    
+    gfx_setup_triangles(&setup);
+    gfx_emit_triangles(&setup, visible, num_visible);
+}
+
+static void gfx_sp_tri1(uint8_t vtx1_idx, uint8_t vtx2_idx, uint8_t vtx3_idx) {
+    uint8_t tri[1][3] = {{vtx1_idx, vtx2_idx, vtx3_idx}};
+    
+    gfx_sp_tris(tri, 1);
 }
 
 static void gfx_sp_geometry_mode(uint32_t clear, uint32_t set) {
@@ -1061,6 +1697,7 @@ static void gfx_dp_load_tlut(uint8_t tile, uint32_t high_index) {
     SUPPORT_CHECK(tile == G_TX_LOADTILE);
     SUPPORT_CHECK(rdp.texture_to_load.siz == G_IM_SIZ_16b);
     rdp.palette = rdp.texture_to_load.addr;
+    rdp.palette_size = (high_index < 256 ? high_index + 1 : 256) * 2;
 }
 
 static void gfx_dp_load_block(uint8_t tile, uint32_t uls, uint32_t ult, uint32_t lrs, uint32_t dxt) {
@@ -1361,6 +1998,64 @@ static inline void *seg_addr(uintptr_t w1) {
 #define C0(pos, width) ((cmd->words.w0 >> (pos)) & ((1U << width) - 1))
 #define C1(pos, width) ((cmd->words.w1 >> (pos)) & ((1U << width) - 1))
 
+static bool gfx_is_tri_cmd(const Gfx *cmd) {
+    uint32_t opcode = cmd->words.w0 >> 24;
+    
+#if defined(F3DEX_GBI) || defined(F3DLP_GBI)
+    return opcode == (uint8_t)G_TRI1 || opcode == (uint8_t)G_TRI2;
+#else
+    return opcode == (uint8_t)G_TRI1;
+#endif
+}
+
+/**
+ * Draw the triangles of consecutive G_TRI1 and G_TRI2 commands together,
+ * starting at cmd. Returns the last command that was used.
+ */
+static Gfx *gfx_run_tris(Gfx *cmd) {
+    uint8_t tris[MAX_TRI_RUN][3];
+    size_t num_tris = 0;
+    
+    for (;;) {
+        uint8_t *tri = tris[num_tris++];
+        
+#if defined(F3DEX_GBI) || defined(F3DLP_GBI)
+        if ((cmd->words.w0 >> 24) == (uint8_t)G_TRI2) {
+            tri[0] = C0(16, 8) / 2;
+            tri[1] = C0(8, 8) / 2;
+            tri[2] = C0(0, 8) / 2;
+            tri = tris[num_tris++];
+            tri[0] = C1(16, 8) / 2;
+            tri[1] = C1(8, 8) / 2;
+            tri[2] = C1(0, 8) / 2;
+        } else
+#endif
+        {
+#ifdef F3DEX_GBI_2
+            tri[0] = C0(16, 8) / 2;
+            tri[1] = C0(8, 8) / 2;
+            tri[2] = C0(0, 8) / 2;
+#elif defined(F3DEX_GBI) || defined(F3DLP_GBI)
+            tri[0] = C1(16, 8) / 2;
+            tri[1] = C1(8, 8) / 2;
+            tri[2] = C1(0, 8) / 2;
+#else
+            tri[0] = C1(16, 8) / 10;
+            tri[1] = C1(8, 8) / 10;
+            tri[2] = C1(0, 8) / 10;
+#endif
+        }
+        
+        if (num_tris > MAX_TRI_RUN - 2 || !gfx_is_tri_cmd(cmd + 1)) {
+            break;
+        }
+        cmd++;
+    }
+    
+    gfx_sp_tris(tris, num_tris);
+    return cmd;
+}
+
 static void gfx_run_dl(Gfx* cmd) {
     int dummy = 0;
     for (;;) {
@@ -1436,20 +2131,11 @@ static void gfx_run_dl(Gfx* cmd) {
                 break;
 #endif
             case (uint8_t)G_TRI1:
-#ifdef F3DEX_GBI_2
-                gfx_sp_tri1(C0(16, 8) / 2, C0(8, 8) / 2, C0(0, 8) / 2);
-#elif defined(F3DEX_GBI) || defined(F3DLP_GBI)
-                gfx_sp_tri1(C1(16, 8) / 2, C1(8, 8) / 2, C1(0, 8) / 2);
-#else
-                gfx_sp_tri1(C1(16, 8) / 10, C1(8, 8) / 10, C1(0, 8) / 10);
-#endif
-                break;
 #if defined(F3DEX_GBI) || defined(F3DLP_GBI)
             case (uint8_t)G_TRI2:
-                gfx_sp_tri1(C0(16, 8) / 2, C0(8, 8) / 2, C0(0, 8) / 2);
-                gfx_sp_tri1(C1(16, 8) / 2, C1(8, 8) / 2, C1(0, 8) / 2);
-                break;
 #endif
+                cmd = gfx_run_tris(cmd);
+                break;
             case (uint8_t)G_SETOTHERMODE_L:
 #ifdef F3DEX_GBI_2
                 gfx_sp_set_other_mode(31 - C0(8, 8) - C0(0, 8), C0(0, 8) + 1, cmd->words.w1);
@@ -1598,6 +2284,217 @@ static void gfx_run_dl(Gfx* cmd) {
     }
 }
 
+// Most nested G_DL calls followed by the prefetch walk, the RSP allows 10 in F3D
+#define TEXTURE_PREFETCH_MAX_DEPTH 16
+// Most commands walked for one display list, in case it loops
+#define TEXTURE_PREFETCH_MAX_COMMANDS (1 << 20)
+
+// The texture state that gfx_run_dl keeps in rdp, as far as the prefetch walk follows it
+struct TexturePrefetchState {
+    const uint8_t *image_addr;
+    uint8_t image_siz;
+    uint8_t load_tile_number;
+    uint8_t fmt, siz;
+    uint32_t line_size_bytes;
+    const uint8_t *palette;
+    uint32_t palette_size;
+    struct {
+        const uint8_t *addr;
+        uint32_t size_bytes;
+    } loaded_texture[2];
+    bool textures_changed[2];
+    uint32_t num_commands;
+};
+
+struct GfxTexturePrefetch *gfx_texture_prefetch_create(void) {
+    return calloc(1, sizeof(struct GfxTexturePrefetch));
+}
+
+// Decode the loaded textures that a draw would import, unless the batch already has them
+static void gfx_texture_prefetch_decode(struct GfxTexturePrefetch *prefetch, struct TexturePrefetchState *state) {
+    for (int i = 0; i < 2; i++) {
+        if (!state->textures_changed[i] || state->loaded_texture[i].addr == NULL) {
+            continue;
+        }
+        state->textures_changed[i] = false;
+
+        struct TextureSource src = {
+            state->loaded_texture[i].addr, state->loaded_texture[i].size_bytes,
+            state->line_size_bytes, state->palette, state->palette_size
+        };
+        if (src.line_size_bytes == 0 || src.size_bytes > 4096
+            || (state->fmt == G_IM_FMT_CI && src.palette == NULL)) {
+            continue;
+        }
+
+        struct ConvertedTexture **bucket = gfx_converted_texture_bucket(prefetch->hashmap, src.addr);
+        struct ConvertedTexture *ct = *bucket;
+        while (ct != NULL && !(ct->texture_addr == src.addr && ct->fmt == state->fmt && ct->siz == state->siz)) {
+            ct = ct->next;
+        }
+        if (ct != NULL || prefetch->total_bytes > CONVERTED_TEXTURES_MAX_BYTES / 2) {
+            continue;
+        }
+
+        uint8_t rgba32_buf[DECODED_TEXTURE_MAX_BYTES];
+        uint32_t width, height;
+        if (!decode_texture(state->fmt, state->siz, &src, rgba32_buf, &width, &height)) {
+            continue;
+        }
+        ct = gfx_converted_texture_create(&src, state->fmt, state->siz, rgba32_buf, width, height);
+        if (ct != NULL) {
+            ct->next = *bucket;
+            *bucket = ct;
+            prefetch->total_bytes += ct->total_bytes;
+        }
+    }
+}
+
+static void gfx_texture_prefetch_run_dl(struct GfxTexturePrefetch *prefetch, struct TexturePrefetchState *state,
+                                        const Gfx *cmd, int depth) {
+    if (cmd == NULL || depth > TEXTURE_PREFETCH_MAX_DEPTH) {
+        return;
+    }
+    for (; state->num_commands++ < TEXTURE_PREFETCH_MAX_COMMANDS; ++cmd) {
+        uint32_t opcode = cmd->words.w0 >> 24;
+
+        switch (opcode) {
+            case G_DL:
+                if (C0(16, 1) == 0) {
+                    gfx_texture_prefetch_run_dl(prefetch, state, (const Gfx *)seg_addr(cmd->words.w1), depth + 1);
+                } else {
+                    cmd = (const Gfx *)seg_addr(cmd->words.w1);
+                    if (cmd == NULL) {
+                        return;
+                    }
+                    --cmd; // increase after break
+                }
+                break;
+            case (uint8_t)G_ENDDL:
+                return;
+            case (uint8_t)G_TRI1:
+#if defined(F3DEX_GBI) || defined(F3DLP_GBI)
+            case (uint8_t)G_TRI2:
+#endif
+            case G_TEXRECT:
+            case G_TEXRECTFLIP:
+                gfx_texture_prefetch_decode(prefetch, state);
+                break;
+            case G_SETTIMG:
+                state->image_addr = seg_addr(cmd->words.w1);
+                state->image_siz = C0(19, 2);
+                break;
+            case G_LOADBLOCK:
+            case G_LOADTILE:
+                // Like gfx_dp_load_block and gfx_dp_load_tile
+                if (C1(24, 3) == G_TX_LOADTILE) {
+                    uint32_t word_size_shift = state->image_siz == G_IM_SIZ_32b ? 2 : state->image_siz == G_IM_SIZ_16b ? 1 : 0;
+                    uint32_t size_bytes;
+                    if (opcode == G_LOADBLOCK) {
+                        size_bytes = (C1(12, 12) + 1) << word_size_shift;
+                    } else {
+                        size_bytes = (((C1(12, 12) >> G_TEXTURE_IMAGE_FRAC) + 1) * ((C1(0, 12) >> G_TEXTURE_IMAGE_FRAC) + 1)) << word_size_shift;
+                    }
+                    state->loaded_texture[state->load_tile_number].addr = state->image_addr;
+                    state->loaded_texture[state->load_tile_number].size_bytes = size_bytes;
+                    state->textures_changed[state->load_tile_number] = true;
+                }
+                break;
+            case G_SETTILE:
+                if (C1(24, 3) == G_TX_RENDERTILE) {
+                    state->fmt = C0(21, 3);
+                    state->siz = C0(19, 2);
+                    state->line_size_bytes = C0(9, 9) * 8;
+                    state->textures_changed[0] = true;
+                    state->textures_changed[1] = true;
+                }
+                if (C1(24, 3) == G_TX_LOADTILE) {
+                    state->load_tile_number = C0(0, 9) / 256;
+                }
+                break;
+            case G_SETTILESIZE:
+                if (C1(24, 3) == G_TX_RENDERTILE) {
+                    state->textures_changed[0] = true;
+                    state->textures_changed[1] = true;
+                }
+                break;
+            case G_LOADTLUT:
+                state->palette = state->image_addr;
+                state->palette_size = (C1(14, 10) < 256 ? C1(14, 10) + 1 : 256) * 2;
+                break;
+        }
+    }
+}
+
+/**
+ * Decode the textures that drawing the display list would decode, without
+ * drawing it. Only the texture commands are followed, so that the display
+ * list and the textures it uses only have to be in memory, and nothing else
+ * of the renderer is used: this can run on any thread, as long as each batch
+ * is only used by one thread at a time.
+ */
+void gfx_texture_prefetch_display_list(struct GfxTexturePrefetch *prefetch, const Gfx *dl) {
+    struct TexturePrefetchState state;
+
+    memset(&state, 0, sizeof(state));
+    gfx_texture_prefetch_run_dl(prefetch, &state, dl, 0);
+}
+
+// Whether both conversions were decoded from the same texture and palette
+static bool gfx_converted_texture_same_source(const struct ConvertedTexture *a, const struct ConvertedTexture *b) {
+    return a->texture_addr == b->texture_addr && a->fmt == b->fmt && a->siz == b->siz
+        && a->size_bytes == b->size_bytes && a->line_size_bytes == b->line_size_bytes
+        && a->palette_size == b->palette_size
+        && memcmp(a->src_copy, b->src_copy, a->size_bytes) == 0
+        && memcmp(a->palette_copy, b->palette_copy, a->palette_size) == 0;
+}
+
+/**
+ * Add the textures of the batch to the converted textures and free it. This
+ * has to run on the thread that renders. A texture that changed since it was
+ * decoded is decoded again on its first draw, since a conversion is only used
+ * when the texture and palette still match its copies of them. Returns the
+ * number of textures that were added.
+ */
+uint32_t gfx_texture_prefetch_commit(struct GfxTexturePrefetch *prefetch) {
+    uint32_t num_added = 0;
+
+    for (size_t i = 0; i < sizeof(prefetch->hashmap) / sizeof(prefetch->hashmap[0]); i++) {
+        struct ConvertedTexture *ct = prefetch->hashmap[i];
+        while (ct != NULL) {
+            struct ConvertedTexture *next = ct->next;
+            struct ConvertedTexture *old = *gfx_converted_texture_bucket(gfx_converted_textures.hashmap, ct->texture_addr);
+
+            // Keep a conversion that is already there, its texture is probably still uploaded
+            while (old != NULL && !gfx_converted_texture_same_source(old, ct)) {
+                old = old->next;
+            }
+            if (old != NULL) {
+                free(ct);
+            } else {
+                gfx_converted_texture_insert(ct);
+                num_added++;
+            }
+            ct = next;
+        }
+    }
+    free(prefetch);
+    return num_added;
+}
+
+// Free the batch and its textures without adding them
+void gfx_texture_prefetch_free(struct GfxTexturePrefetch *prefetch) {
+    for (size_t i = 0; i < sizeof(prefetch->hashmap) / sizeof(prefetch->hashmap[0]); i++) {
+        struct ConvertedTexture *ct = prefetch->hashmap[i];
+        while (ct != NULL) {
+            struct ConvertedTexture *next = ct->next;
+            free(ct);
+            ct = next;
+        }
+    }
+    free(prefetch);
+}
+
 static void gfx_sp_reset() {
     rsp.modelview_matrix_stack_size = 1;
     rsp.current_num_lights = 2;
@@ -2,9 +2,11 @@
 #define GFX_PC_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 struct GfxRenderingAPI;
 struct GfxWindowManagerAPI;
+struct GfxTexturePrefetch;
 
 struct GfxDimensions {
     uint32_t width, height;
@@ -23,6 +25,12 @@ void gfx_start_frame(void);
 void gfx_run(Gfx *commands);
 void gfx_end_frame(void);
 
+// Textures of display lists decoded ahead of their first draw
+struct GfxTexturePrefetch *gfx_texture_prefetch_create(void);
+void gfx_texture_prefetch_display_list(struct GfxTexturePrefetch *prefetch, const Gfx *dl);
+uint32_t gfx_texture_prefetch_commit(struct GfxTexturePrefetch *prefetch);
+void gfx_texture_prefetch_free(struct GfxTexturePrefetch *prefetch);
+
 #ifdef __cplusplus
 }
 #endif
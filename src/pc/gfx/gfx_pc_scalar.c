@@ -0,0 +1,8 @@
+// gfx_pc.c without its SSSE3 texture decoders, under the names of
+// gfx_pc_scalar.h, so that gfx_texture_test can compare both in one program.
+// Only linked into gfx_texture_test.
+
+#define GFX_PC_SCALAR
+#include "gfx_pc_scalar.h"
+#include "gfx_pc.c"
+#include "gfx_texture_test.inc.c"
@@ -0,0 +1,21 @@
+#ifndef GFX_PC_SCALAR_H
+#define GFX_PC_SCALAR_H
+
+// Names of the global symbols of gfx_pc_scalar.c, so that it can be linked
+// next to a build of gfx_pc.c with its SSSE3 paths.
+
+#define gfx_current_dimensions            scalar_gfx_current_dimensions
+#define gfx_frames_per_tick               scalar_gfx_frames_per_tick
+#define gfx_get_dimensions                scalar_gfx_get_dimensions
+#define gfx_init                          scalar_gfx_init
+#define gfx_get_current_rendering_api     scalar_gfx_get_current_rendering_api
+#define gfx_start_frame                   scalar_gfx_start_frame
+#define gfx_run                           scalar_gfx_run
+#define gfx_end_frame                     scalar_gfx_end_frame
+#define gfx_texture_prefetch_create       scalar_gfx_texture_prefetch_create
+#define gfx_texture_prefetch_display_list scalar_gfx_texture_prefetch_display_list
+#define gfx_texture_prefetch_commit       scalar_gfx_texture_prefetch_commit
+#define gfx_texture_prefetch_free         scalar_gfx_texture_prefetch_free
+#define gfx_texture_test_decode           scalar_gfx_texture_test_decode
+
+#endif
@@ -7,6 +7,20 @@
 
 struct ShaderProgram;
 
+// Packed vertex format, used by draw_triangles_packed. Every field is 4 bytes
+// aligned:
+//   float x, y, z, w
+//   int16_t u, v                  if the shader uses a texture, in texels * 32
+//   uint8_t fog factor, 0, 0, 0   if the shader uses fog
+//   uint8_t r, g, b, a            for each combiner input not given as a uniform
+// The rest is the same for all vertices of a draw, see GfxDrawConstants.
+struct GfxDrawConstants {
+    float inputs[4][4]; // RGBA of the inputs flagged with SHADER_OPT_INPUT_UNIFORM
+    float fog_color[3];
+    float tex_offset[2]; // Texture coordinates are (uv - tex_offset) * tex_scale
+    float tex_scale[2];
+};
+
 struct GfxRenderingAPI {
     bool (*z_is_from_0_to_1)(void);
     void (*unload_shader)(struct ShaderProgram *old_prg);
@@ -25,6 +39,13 @@ struct GfxRenderingAPI {
     void (*set_scissor)(int x, int y, int width, int height);
     void (*set_use_alpha)(bool use_alpha);
     void (*draw_triangles)(float buf_vbo[], size_t buf_vbo_len, size_t buf_vbo_num_tris);
+    // Optional, NULL if not supported: draws buf_vbo_num_tris triangles whose
+    // vertices are given by 3 * buf_vbo_num_tris indices into buf_vbo
+    void (*draw_triangles_indexed)(float buf_vbo[], size_t buf_vbo_len, uint16_t buf_ibo[], size_t buf_vbo_num_tris);
+    // Optional, NULL if not supported: like draw_triangles_indexed, but with
+    // packed vertices and shaders that take the constant inputs as uniforms.
+    // Backends that support it only need to implement this draw function
+    void (*draw_triangles_packed)(uint8_t buf_vbo[], size_t buf_vbo_size, uint16_t buf_ibo[], size_t buf_vbo_num_tris, const struct GfxDrawConstants *constants);
     void (*init)(void);
     void (*on_resize)(void);
     void (*start_frame)(void);
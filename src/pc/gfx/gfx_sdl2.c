@@ -138,17 +138,22 @@ int test_vsync(void) {
 
     float average = 4.0 * 1000.0 / (end - start);
 
-    vsync_enabled = 1;
+    // Number of vsyncs per game tick at 30 Hz
+    int vsyncs_per_tick = 0;
     if (average > 27 && average < 33) {
-        SDL_GL_SetSwapInterval(1);
+        vsyncs_per_tick = 1;
     } else if (average > 57 && average < 63) {
-        SDL_GL_SetSwapInterval(2);
+        vsyncs_per_tick = 2;
     } else if (average > 86 && average < 94) {
-        SDL_GL_SetSwapInterval(3);
+        vsyncs_per_tick = 3;
     } else if (average > 115 && average < 125) {
-        SDL_GL_SetSwapInterval(4);
-    } else {
-        vsync_enabled = 0;
+        vsyncs_per_tick = 4;
+    }
+
+    // Every frame of a tick must take the same number of vsyncs
+    vsync_enabled = vsyncs_per_tick != 0 && vsyncs_per_tick % gfx_frames_per_tick == 0;
+    if (vsync_enabled) {
+        SDL_GL_SetSwapInterval(vsyncs_per_tick / gfx_frames_per_tick);
     }
 }
 
@@ -273,14 +278,28 @@ static bool gfx_sdl_start_frame(void) {
 }
 
 static void sync_framerate_with_timer(void) {
-    // Number of milliseconds a frame should take (30 fps)
-    const Uint32 FRAME_TIME = 1000 / 30;
-    static Uint32 last_time;
-    Uint32 elapsed = SDL_GetTicks() - last_time;
-
-    if (elapsed < FRAME_TIME)
-        SDL_Delay(FRAME_TIME - elapsed);
-    last_time += FRAME_TIME;
+    // A frame should take 1 / (30 * gfx_frames_per_tick) seconds. That's rarely
+    // a whole number of performance counter ticks, so the remainder is carried
+    // over to the next frame, and the frames of a game tick add up to exactly
+    // 1/30 seconds.
+    const Uint64 frames_per_second = 30 * gfx_frames_per_tick;
+    const Uint64 frequency = SDL_GetPerformanceFrequency();
+    static Uint64 next_time;
+    static Uint64 remainder;
+    Uint64 now = SDL_GetPerformanceCounter();
+
+    if (next_time == 0) {
+        next_time = now;
+    }
+    if (now < next_time) {
+        SDL_Delay((Uint32)((next_time - now) * 1000 / frequency));
+    }
+    next_time += frequency / frames_per_second;
+    remainder += frequency % frames_per_second;
+    if (remainder >= frames_per_second) {
+        remainder -= frames_per_second;
+        next_time++;
+    }
 }
 
 static void gfx_sdl_swap_buffers_begin(void) {
@@ -0,0 +1,211 @@
+/**
+ * @file gfx_texture_test.c
+ * Decodes the same textures with the SSSE3 texture decoders of gfx_pc.c and
+ * with the scalar ones (gfx_pc_scalar.c) and checks that the RGBA32 output is
+ * bit-identical. Every format with an SSSE3 path is covered, with sizes that
+ * leave a scalar tail, and CI textures with full, short and partly used
+ * TLUTs. It also checks that the textures of a display list that are
+ * decoded ahead of their first draw are found, decoded the same way, by the
+ * draw path. Built and run with `make gfx_texture_test`, it exits with a
+ * non-zero status on a mismatch.
+ */
+
+#include <stdio.h>
+
+// The display list macros of the prefetch test need _SHIFTL
+#ifndef _LANGUAGE_C
+#define _LANGUAGE_C
+#endif
+#include <PR/mbi.h>
+
+#include "gfx_pc.c"
+#include "gfx_texture_test.inc.c"
+
+void scalar_gfx_texture_test_decode(uint8_t fmt, uint8_t siz, const uint8_t *src, uint32_t size_bytes,
+                                    uint32_t line_size_bytes, const uint8_t *palette, uint32_t palette_size,
+                                    uint8_t *rgba32_buf);
+
+#define NUM_ROUNDS 16
+
+// Largest texture the import functions take, 4096 bytes of 4-bit texels
+#define MAX_SIZE_BYTES 4096
+#define MAX_RGBA32_BYTES (MAX_SIZE_BYTES * 2 * 4)
+
+struct TextureTestFormat {
+    const char *name;
+    uint8_t fmt, siz;
+};
+
+static const struct TextureTestFormat sFormats[] = {
+    { "RGBA16", G_IM_FMT_RGBA, G_IM_SIZ_16b },
+    { "IA4", G_IM_FMT_IA, G_IM_SIZ_4b },
+    { "IA8", G_IM_FMT_IA, G_IM_SIZ_8b },
+    { "IA16", G_IM_FMT_IA, G_IM_SIZ_16b },
+    { "I4", G_IM_FMT_I, G_IM_SIZ_4b },
+    { "I8", G_IM_FMT_I, G_IM_SIZ_8b },
+    { "CI4", G_IM_FMT_CI, G_IM_SIZ_4b },
+    { "CI8", G_IM_FMT_CI, G_IM_SIZ_8b },
+};
+
+// Line sizes in bytes, with the number of lines per round
+static const uint32_t sLineSizes[] = { 8, 16, 24, 64 };
+
+// TLUT sizes in entries: a full CI8 and CI4 palette and shorter loads
+static const uint32_t sPaletteEntries[] = { 256, 16, 200, 8 };
+
+static uint32_t sRandomState;
+
+static uint32_t next_random(void) {
+    sRandomState = sRandomState * 1664525 + 1013904223;
+    return sRandomState >> 8;
+}
+
+static uint8_t *sUploadDest;
+
+static void capture_upload(const uint8_t *rgba32_buf, int width, int height) {
+    memcpy(sUploadDest, rgba32_buf, (size_t)width * height * 4);
+}
+
+/**
+ * Decode the textures of a display list ahead of drawing it, then look them
+ * up the way the first draw does and compare them with a decode on the draw
+ * path. Returns the number of textures that are missing or differ.
+ */
+static int test_prefetch(void) {
+    static uint16_t rgba16[32 * 32];
+    static uint8_t ci4[32 * 32 / 2];
+    static uint16_t palette[16];
+    static uint8_t expected[32 * 32 * 4];
+    static uint8_t uploaded[32 * 32 * 4];
+    static const Gfx ci4_dl[] = {
+        gsDPLoadTLUT_pal16(0, palette),
+        gsDPLoadTextureBlock_4b(ci4, G_IM_FMT_CI, 32, 32, 0, G_TX_WRAP | G_TX_NOMIRROR, G_TX_WRAP | G_TX_NOMIRROR,
+                                5, 5, G_TX_NOLOD, G_TX_NOLOD),
+        gsSP1Triangle(0, 1, 2, 0x0),
+        gsSPEndDisplayList(),
+    };
+    static const Gfx dl[] = {
+        gsDPLoadTextureBlock(rgba16, G_IM_FMT_RGBA, G_IM_SIZ_16b, 32, 32, 0, G_TX_WRAP | G_TX_NOMIRROR,
+                             G_TX_WRAP | G_TX_NOMIRROR, 5, 5, G_TX_NOLOD, G_TX_NOLOD),
+        gsSP1Triangle(0, 1, 2, 0x0),
+        gsSPDisplayList(ci4_dl),
+        gsSPEndDisplayList(),
+    };
+    static const struct {
+        const char *name;
+        const void *texture;
+        uint32_t size_bytes;
+        uint32_t line_size_bytes;
+        uint8_t fmt, siz;
+    } textures[] = {
+        { "RGBA16", rgba16, sizeof(rgba16), 32 * 2, G_IM_FMT_RGBA, G_IM_SIZ_16b },
+        { "CI4", ci4, sizeof(ci4), 32 / 2, G_IM_FMT_CI, G_IM_SIZ_4b },
+    };
+    static struct GfxRenderingAPI capture_api = { .upload_texture = capture_upload };
+    struct GfxTexturePrefetch *prefetch = gfx_texture_prefetch_create();
+    uint32_t num_added;
+    int failures = 0;
+
+    sRandomState = 0x5EED1000;
+    for (size_t i = 0; i < sizeof(rgba16) / sizeof(rgba16[0]); i++) {
+        rgba16[i] = (uint16_t)next_random();
+    }
+    for (size_t i = 0; i < sizeof(ci4); i++) {
+        ci4[i] = (uint8_t)next_random();
+    }
+    for (size_t i = 0; i < sizeof(palette) / sizeof(palette[0]); i++) {
+        palette[i] = (uint16_t)next_random();
+    }
+
+    gfx_texture_prefetch_display_list(prefetch, dl);
+    num_added = gfx_texture_prefetch_commit(prefetch);
+    if (num_added != sizeof(textures) / sizeof(textures[0])) {
+        fprintf(stderr, "Prefetch: %u textures were decoded ahead of the draw instead of %zu\n",
+                num_added, sizeof(textures) / sizeof(textures[0]));
+        failures++;
+    }
+
+    gfx_rapi = &capture_api;
+    sUploadDest = uploaded;
+    for (size_t t = 0; t < sizeof(textures) / sizeof(textures[0]); t++) {
+        rdp.loaded_texture[0].addr = textures[t].texture;
+        rdp.loaded_texture[0].size_bytes = textures[t].size_bytes;
+        rdp.texture_tile.fmt = textures[t].fmt;
+        rdp.texture_tile.siz = textures[t].siz;
+        rdp.texture_tile.line_size_bytes = textures[t].line_size_bytes;
+        rdp.palette = (const uint8_t *)palette;
+        rdp.palette_size = sizeof(palette);
+
+        gfx_texture_test_decode(textures[t].fmt, textures[t].siz, textures[t].texture, textures[t].size_bytes,
+                                textures[t].line_size_bytes, (const uint8_t *)palette, sizeof(palette), expected);
+        memset(uploaded, 0, sizeof(uploaded));
+        if (!gfx_upload_cached_conversion(0, textures[t].fmt, textures[t].siz)) {
+            fprintf(stderr, "Prefetch: %s texture wasn't decoded ahead of the draw\n", textures[t].name);
+            failures++;
+        } else if (memcmp(uploaded, expected, sizeof(expected)) != 0) {
+            fprintf(stderr, "Prefetch: %s texture decoded ahead of the draw differs\n", textures[t].name);
+            failures++;
+        }
+    }
+    return failures;
+}
+
+int main(void) {
+    static uint8_t texture[MAX_SIZE_BYTES];
+    // Always 256 entries, so that indices past a short TLUT read the same
+    // bytes in both decoders instead of past the buffer
+    static uint8_t palette[256 * 2];
+    static uint8_t simd[MAX_RGBA32_BYTES];
+    static uint8_t scalar[MAX_RGBA32_BYTES];
+    int failures = 0;
+    int cases = 0;
+
+    for (int round = 0; round < NUM_ROUNDS; round++) {
+        uint32_t line_size_bytes = sLineSizes[round % 4];
+        uint32_t palette_entries = sPaletteEntries[round / 4];
+        uint32_t size_bytes;
+
+        sRandomState = 0x5EED0000 + round;
+        // Random line counts leave tails for the scalar loops
+        size_bytes = line_size_bytes * (1 + next_random() % (MAX_SIZE_BYTES / line_size_bytes));
+        for (size_t i = 0; i < sizeof(texture); i++) {
+            texture[i] = (uint8_t)next_random();
+        }
+        for (size_t i = 0; i < sizeof(palette); i++) {
+            palette[i] = (uint8_t)next_random();
+        }
+
+        for (size_t f = 0; f < sizeof(sFormats) / sizeof(sFormats[0]); f++) {
+            const struct TextureTestFormat *format = &sFormats[f];
+            uint32_t palette_size = format->fmt == G_IM_FMT_CI ? palette_entries * 2 : 0;
+
+            memset(simd, 0, sizeof(simd));
+            memset(scalar, 0, sizeof(scalar));
+            gfx_texture_test_decode(format->fmt, format->siz, texture, size_bytes, line_size_bytes,
+                                    palette, palette_size, simd);
+            scalar_gfx_texture_test_decode(format->fmt, format->siz, texture, size_bytes, line_size_bytes,
+                                           palette, palette_size, scalar);
+            cases++;
+
+            if (memcmp(simd, scalar, sizeof(simd)) != 0) {
+                size_t i = 0;
+                while (simd[i] == scalar[i]) {
+                    i++;
+                }
+                fprintf(stderr, "Round %d, %s with %u bytes: SSSE3 and scalar output differ at byte %zu\n",
+                        round, format->name, size_bytes, i);
+                failures++;
+            }
+        }
+    }
+
+    if (failures != 0) {
+        fprintf(stderr, "%d of %d textures differ\n", failures, cases);
+        return EXIT_FAILURE;
+    }
+    if (test_prefetch() != 0) {
+        return EXIT_FAILURE;
+    }
+    printf("gfx_texture_test: %d textures, SSSE3 output matches scalar output, prefetched textures match\n", cases);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,13 @@
+// Included after gfx_pc.c by gfx_texture_test.c and gfx_pc_scalar.c: decodes a
+// texture with the decode functions of that build of gfx_pc.c.
+
+void gfx_texture_test_decode(uint8_t fmt, uint8_t siz, const uint8_t *src, uint32_t size_bytes,
+                             uint32_t line_size_bytes, const uint8_t *palette, uint32_t palette_size,
+                             uint8_t *rgba32_buf) {
+    struct TextureSource source = { src, size_bytes, line_size_bytes, palette, palette_size };
+    uint32_t width, height;
+
+    if (!decode_texture(fmt, siz, &source, rgba32_buf, &width, &height)) {
+        abort();
+    }
+}
@@ -18,4 +18,7 @@ struct GfxWindowManagerAPI {
     double (*get_time)(void); // For debug
 };
 
+// Number of frames presented per game tick, which window managers pace for
+extern uint32_t gfx_frames_per_tick;
+
 #endif
@@ -0,0 +1,289 @@
+#include <stdbool.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#elif !defined(TARGET_WEB)
+#include <pthread.h>
+#endif
+
+#include "sm64.h"
+#include "level_table.h"
+#include "engine/geo_layout.h"
+#include "engine/level_script.h"
+#include "gfx/gfx_pc.h"
+
+#include "level_headers.h"
+#include "level_prefetch.h"
+
+/**
+ * @file level_prefetch.c
+ * Decodes the textures of a level when it is loaded, so that the first draw
+ * of a texture finds it in the converted textures of gfx_pc.c instead of
+ * decoding it. The display lists are found by walking the level script from
+ * the level's entry and the geo layouts of its models and areas, without
+ * running them. Textures of display lists that asm nodes generate, and of
+ * the models that every level loads, are still decoded on their first draw.
+ *
+ * A warp starts the walk of the level it leads to on a worker thread, so the
+ * textures are decoded during the fade. The walk only reads the level's data
+ * and fills its own batch of textures, which the level load adds to the
+ * converted textures once the worker is done.
+ */
+
+#define MAX_VISITED_SCRIPTS 256
+// Size of the hash set of walked display lists, a power of two
+#define MAX_VISITED_DISPLAY_LISTS 8192
+
+// The level script commands the walk needs, see level_commands.h
+#define LEVEL_CMD_EXECUTE 0x00
+#define LEVEL_CMD_EXIT_AND_EXECUTE 0x01
+#define LEVEL_CMD_EXIT 0x02
+#define LEVEL_CMD_JUMP 0x05
+#define LEVEL_CMD_JUMP_LINK 0x06
+#define LEVEL_CMD_RETURN 0x07
+#define LEVEL_CMD_JUMP_IF 0x0C
+#define LEVEL_CMD_JUMP_LINK_IF 0x0D
+#define LEVEL_CMD_AREA 0x1F
+#define LEVEL_CMD_LOAD_MODEL_FROM_DL 0x21
+#define LEVEL_CMD_LOAD_MODEL_FROM_GEO 0x22
+
+struct LevelCommand {
+    /*00*/ u8 type;
+    /*01*/ u8 size;
+    /*02*/ // variable sized argument data
+};
+
+#define CMD_GET(cmd, type, offset) (*(type *) (CMD_PROCESS_OFFSET(offset) + (u8 *) (cmd)))
+#define CMD_NEXT(cmd) ((const struct LevelCommand *) ((u8 *) (cmd) + ((cmd)->size << CMD_SIZE_SHIFT)))
+
+struct LevelPrefetch {
+    s16 levelNum;
+    u32 decodeTime;
+    struct GfxTexturePrefetch *textures;
+    const struct LevelCommand *visitedScripts[MAX_VISITED_SCRIPTS];
+    s32 numVisitedScripts;
+    const Gfx *visitedDisplayLists[MAX_VISITED_DISPLAY_LISTS];
+    s32 numVisitedDisplayLists;
+};
+
+#define STUB_LEVEL(_0, _1, _2, _3, _4, _5, _6, _7, _8)
+#define DEFINE_LEVEL(_0, levelenum, _2, folder, _4, _5, _6, _7, _8, _9, _10) [levelenum] = level_ ## folder ## _entry,
+static const LevelScript *const sLevelScripts[LEVEL_COUNT] = {
+#include "levels/level_defines.h"
+};
+#undef STUB_LEVEL
+#undef DEFINE_LEVEL
+
+/**
+ * Decode the textures of a display list, unless it was walked before.
+ */
+static void level_prefetch_display_list(const Gfx *displayList, void *arg) {
+    struct LevelPrefetch *prefetch = arg;
+    u32 i = ((uintptr_t) displayList >> 3) & (MAX_VISITED_DISPLAY_LISTS - 1);
+
+    while (prefetch->visitedDisplayLists[i] != NULL) {
+        if (prefetch->visitedDisplayLists[i] == displayList) {
+            return;
+        }
+        i = (i + 1) & (MAX_VISITED_DISPLAY_LISTS - 1);
+    }
+    // Past that, display lists that were already walked are walked again
+    if (prefetch->numVisitedDisplayLists < MAX_VISITED_DISPLAY_LISTS / 2) {
+        prefetch->visitedDisplayLists[i] = displayList;
+        prefetch->numVisitedDisplayLists++;
+    }
+    gfx_texture_prefetch_display_list(prefetch->textures, displayList);
+}
+
+/**
+ * Decode the textures of the models and areas that the script and the scripts
+ * it can jump to load. Every script is walked once.
+ */
+static void level_prefetch_script(struct LevelPrefetch *prefetch, const struct LevelCommand *cmd) {
+    s32 i;
+
+    if (cmd == NULL || prefetch->numVisitedScripts >= MAX_VISITED_SCRIPTS) {
+        return;
+    }
+    for (i = 0; i < prefetch->numVisitedScripts; i++) {
+        if (prefetch->visitedScripts[i] == cmd) {
+            return;
+        }
+    }
+    prefetch->visitedScripts[prefetch->numVisitedScripts++] = cmd;
+
+    for (; cmd->size != 0; cmd = CMD_NEXT(cmd)) {
+        switch (cmd->type) {
+            case LEVEL_CMD_EXECUTE:
+                level_prefetch_script(prefetch, CMD_GET(cmd, const struct LevelCommand *, 12));
+                break;
+            case LEVEL_CMD_EXIT_AND_EXECUTE:
+                level_prefetch_script(prefetch, CMD_GET(cmd, const struct LevelCommand *, 12));
+                return;
+            case LEVEL_CMD_EXIT:
+            case LEVEL_CMD_RETURN:
+                return;
+            case LEVEL_CMD_JUMP:
+                level_prefetch_script(prefetch, CMD_GET(cmd, const struct LevelCommand *, 4));
+                return;
+            case LEVEL_CMD_JUMP_LINK:
+                level_prefetch_script(prefetch, CMD_GET(cmd, const struct LevelCommand *, 4));
+                break;
+            case LEVEL_CMD_JUMP_IF:
+            case LEVEL_CMD_JUMP_LINK_IF:
+                level_prefetch_script(prefetch, CMD_GET(cmd, const struct LevelCommand *, 8));
+                break;
+            case LEVEL_CMD_LOAD_MODEL_FROM_DL:
+                if (CMD_GET(cmd, const Gfx *, 4) != NULL) {
+                    level_prefetch_display_list(CMD_GET(cmd, const Gfx *, 4), prefetch);
+                }
+                break;
+            case LEVEL_CMD_AREA:
+            case LEVEL_CMD_LOAD_MODEL_FROM_GEO:
+                if (CMD_GET(cmd, const GeoLayout *, 4) != NULL) {
+                    geo_layout_find_display_lists(CMD_GET(cmd, const GeoLayout *, 4),
+                                                  level_prefetch_display_list, prefetch);
+                }
+                break;
+        }
+    }
+}
+
+// Prefetch that was started and not committed yet
+static struct LevelPrefetch *sPending;
+
+#ifndef TARGET_WEB
+static bool sWorkerRunning;
+#ifdef _WIN32
+static HANDLE sWorker;
+#else
+static pthread_t sWorker;
+#endif
+#endif
+
+static struct LevelPrefetch *level_prefetch_create(s16 levelNum) {
+    struct LevelPrefetch *prefetch;
+
+    if (levelNum < 0 || levelNum >= LEVEL_COUNT || sLevelScripts[levelNum] == NULL) {
+        return NULL;
+    }
+    prefetch = calloc(1, sizeof(struct LevelPrefetch));
+    if (prefetch == NULL) {
+        return NULL;
+    }
+    prefetch->levelNum = levelNum;
+    prefetch->textures = gfx_texture_prefetch_create();
+    if (prefetch->textures == NULL) {
+        free(prefetch);
+        return NULL;
+    }
+    return prefetch;
+}
+
+/**
+ * Decode the textures of the level's models and areas into the batch.
+ */
+static void level_prefetch_run(struct LevelPrefetch *prefetch) {
+    OSTime start = level_load_get_time();
+
+    level_prefetch_script(prefetch, (const struct LevelCommand *) sLevelScripts[prefetch->levelNum]);
+    prefetch->decodeTime = OS_CYCLES_TO_USEC(level_load_get_time() - start);
+}
+
+#ifndef TARGET_WEB
+#ifdef _WIN32
+static DWORD WINAPI level_prefetch_worker(LPVOID arg) {
+#else
+static void *level_prefetch_worker(void *arg) {
+#endif
+    level_prefetch_run(arg);
+    return 0;
+}
+#endif
+
+/**
+ * Wait until the pending prefetch has finished decoding.
+ */
+static void level_prefetch_wait(void) {
+#ifndef TARGET_WEB
+    if (sWorkerRunning) {
+#ifdef _WIN32
+        WaitForSingleObject(sWorker, INFINITE);
+        CloseHandle(sWorker);
+#else
+        pthread_join(sWorker, NULL);
+#endif
+        sWorkerRunning = false;
+    }
+#endif
+}
+
+/**
+ * Drop the pending prefetch, if any, without adding its textures.
+ */
+static void level_prefetch_cancel(void) {
+    if (sPending != NULL) {
+        level_prefetch_wait();
+        gfx_texture_prefetch_free(sPending->textures);
+        free(sPending);
+        sPending = NULL;
+    }
+}
+
+/**
+ * Start decoding the textures of the level in the background, unless they
+ * already are. A prefetch of another level is dropped. Where threads aren't
+ * available, the textures are decoded right away.
+ */
+void level_prefetch_start(s16 levelNum) {
+    if (sPending != NULL && sPending->levelNum == levelNum) {
+        return;
+    }
+    level_prefetch_cancel();
+
+    sPending = level_prefetch_create(levelNum);
+    if (sPending == NULL) {
+        return;
+    }
+#ifdef TARGET_WEB
+    level_prefetch_run(sPending);
+#elif defined(_WIN32)
+    sWorker = CreateThread(NULL, 0, level_prefetch_worker, sPending, 0, NULL);
+    sWorkerRunning = sWorker != NULL;
+#else
+    sWorkerRunning = pthread_create(&sWorker, NULL, level_prefetch_worker, sPending) == 0;
+#endif
+#ifndef TARGET_WEB
+    if (!sWorkerRunning) {
+        level_prefetch_run(sPending);
+    }
+#endif
+}
+
+/**
+ * Add the decoded textures of the level to the converted textures, once the
+ * level is loaded. If no prefetch of the level was started, they are decoded
+ * now. Records in gLevelLoadStats how long the load waited for them.
+ */
+void level_prefetch_commit(s16 levelNum) {
+    OSTime start = level_load_get_time();
+
+    gLevelLoadStats.numTextures = 0;
+    gLevelLoadStats.textureTime = 0;
+    gLevelLoadStats.textureDecodeTime = 0;
+    if (sPending == NULL || sPending->levelNum != levelNum) {
+        level_prefetch_cancel();
+        sPending = level_prefetch_create(levelNum);
+        if (sPending == NULL) {
+            return;
+        }
+        level_prefetch_run(sPending);
+    }
+    level_prefetch_wait();
+
+    gLevelLoadStats.numTextures = gfx_texture_prefetch_commit(sPending->textures);
+    gLevelLoadStats.textureDecodeTime = sPending->decodeTime;
+    free(sPending);
+    sPending = NULL;
+    gLevelLoadStats.textureTime = OS_CYCLES_TO_USEC(level_load_get_time() - start);
+}
@@ -0,0 +1,9 @@
+#ifndef LEVEL_PREFETCH_H
+#define LEVEL_PREFETCH_H
+
+#include <PR/ultratypes.h>
+
+void level_prefetch_start(s16 levelNum);
+void level_prefetch_commit(s16 levelNum);
+
+#endif // LEVEL_PREFETCH_H
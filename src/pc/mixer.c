@@ -5,17 +5,25 @@
 
 #include "mixer.h"
 
-#ifdef __SSE4_1__
+// MIXER_SCALAR leaves out the SIMD paths, see mixer_scalar.c
+#if defined(__SSE4_1__) && !defined(MIXER_SCALAR)
 #include <immintrin.h>
 #define HAS_SSE41 1
 #define HAS_NEON 0
-#elif __ARM_NEON
+#ifdef __AVX2__
+#define HAS_AVX2 1
+#else
+#define HAS_AVX2 0
+#endif
+#elif defined(__ARM_NEON) && !defined(MIXER_SCALAR)
 #include <arm_neon.h>
 #define HAS_SSE41 0
 #define HAS_NEON 1
+#define HAS_AVX2 0
 #else
 #define HAS_SSE41 0
 #define HAS_NEON 0
+#define HAS_AVX2 0
 #endif
 
 #pragma GCC optimize ("unroll-loops")
@@ -132,6 +140,79 @@ static inline int32_t clamp32(int64_t v) {
     return (int32_t)v;
 }
 
+// clamp16((out * 0x7fff + in * gain + 0x4000) >> 15) for every sample, like the
+// scalar code computes it. The products are summed in 32 bits before rounding.
+#if HAS_SSE41
+static inline __m128i mix_s16(__m128i out, __m128i in, __m128i gain_pairs) {
+    const __m128i round = _mm_set1_epi32(0x4000);
+    __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(out, in), gain_pairs);
+    __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(out, in), gain_pairs);
+
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo, round), 15),
+                           _mm_srai_epi32(_mm_add_epi32(hi, round), 15));
+}
+
+// The (0x7fff, gain) pairs that mix_s16 multiplies the (out, in) pairs with
+static inline __m128i mix_gain_pairs(int16_t gain) {
+    return _mm_set1_epi32((int32_t)((uint32_t)(uint16_t)gain << 16 | 0x7fff));
+}
+#elif HAS_NEON
+static inline int16x8_t mix_s16(int16x8_t out, int16x8_t in, int16_t gain) {
+    int32x4_t lo = vmlal_n_s16(vmull_n_s16(vget_low_s16(out), 0x7fff), vget_low_s16(in), gain);
+    int32x4_t hi = vmlal_n_s16(vmull_n_s16(vget_high_s16(out), 0x7fff), vget_high_s16(in), gain);
+
+    return vcombine_s16(vqrshrn_n_s32(lo, 15), vqrshrn_n_s32(hi, 15));
+}
+#endif
+
+#ifndef NEW_AUDIO_UCODE
+// Like mix_s16 for 8 samples, with a gain per sample. The gains can be 0x8000,
+// so they are 32-bit.
+#if HAS_SSE41
+static inline void mix_s16_gains(int16_t *out, const int16_t *in, const int32_t gains[8]) {
+    const __m128i round = _mm_set1_epi32(0x4000);
+    const __m128i unity = _mm_set1_epi32(0x7fff);
+    __m128i out_vec = _mm_loadu_si128((const __m128i *)out);
+    __m128i in_vec = _mm_loadu_si128((const __m128i *)in);
+    __m128i lo = _mm_add_epi32(_mm_mullo_epi32(_mm_cvtepi16_epi32(out_vec), unity),
+                               _mm_mullo_epi32(_mm_cvtepi16_epi32(in_vec), _mm_loadu_si128((const __m128i *)gains)));
+    __m128i hi = _mm_add_epi32(_mm_mullo_epi32(_mm_cvtepi16_epi32(_mm_srli_si128(out_vec, 8)), unity),
+                               _mm_mullo_epi32(_mm_cvtepi16_epi32(_mm_srli_si128(in_vec, 8)),
+                                               _mm_loadu_si128((const __m128i *)(gains + 4))));
+
+    _mm_storeu_si128((__m128i *)out, _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(lo, round), 15),
+                                                     _mm_srai_epi32(_mm_add_epi32(hi, round), 15)));
+}
+#elif HAS_NEON
+static inline void mix_s16_gains(int16_t *out, const int16_t *in, const int32_t gains[8]) {
+    int16x8_t out_vec = vld1q_s16(out);
+    int16x8_t in_vec = vld1q_s16(in);
+    int32x4_t lo = vmlaq_s32(vmulq_n_s32(vmovl_s16(vget_low_s16(out_vec)), 0x7fff),
+                             vmovl_s16(vget_low_s16(in_vec)), vld1q_s32(gains));
+    int32x4_t hi = vmlaq_s32(vmulq_n_s32(vmovl_s16(vget_high_s16(out_vec)), 0x7fff),
+                             vmovl_s16(vget_high_s16(in_vec)), vld1q_s32(gains + 4));
+
+    vst1q_s16(out, vcombine_s16(vqrshrn_n_s32(lo, 15), vqrshrn_n_s32(hi, 15)));
+}
+#endif
+#endif
+
+#ifdef NEW_AUDIO_UCODE
+// (s * u) >> 16 for signed s and unsigned u, like the scalar code computes it.
+// The signed high multiply treats u >= 0x8000 as u - 0x10000, so s is added back.
+#if HAS_SSE41
+static inline __m128i mulhi_s16_u16(__m128i s, __m128i u) {
+    return _mm_add_epi16(_mm_mulhi_epi16(s, u), _mm_and_si128(s, _mm_srai_epi16(u, 15)));
+}
+#elif HAS_NEON
+static inline int16x8_t mulhi_s16_u16(int16x8_t s, int16x8_t u) {
+    int16x8_t hi = vcombine_s16(vshrn_n_s32(vmull_s16(vget_low_s16(s), vget_low_s16(u)), 16),
+                                vshrn_n_s32(vmull_s16(vget_high_s16(s), vget_high_s16(u)), 16));
+    return vaddq_s16(hi, vandq_s16(s, vshrq_n_s16(u, 15)));
+}
+#endif
+#endif
+
 void aClearBufferImpl(uint16_t addr, int nbytes) {
     nbytes = ROUND_UP_16(nbytes);
     memset(BUF_U8(addr), 0, nbytes);
@@ -623,6 +704,52 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
     uint16_t vol_wet = rspa.vol_wet;
     uint16_t rate_wet = rspa.rate_wet;
 
+#if HAS_SSE41 || HAS_NEON
+    // Same results as the scalar loop below: if the reverb is swapped, the left
+    // wet channel gets the unscaled input and the right one the left dry sample
+    do {
+#if HAS_SSE41
+        __m128i in_loaded = _mm_loadu_si128((const __m128i *)in);
+        __m128i vol_wet_vec = _mm_set1_epi16((int16_t)vol_wet);
+        __m128i samples[2];
+        __m128i wet_src[2];
+
+        samples[0] = _mm_xor_si128(mulhi_s16_u16(in_loaded, _mm_set1_epi16((int16_t)vols[0])), _mm_set1_epi16(negs[0]));
+        samples[1] = _mm_xor_si128(mulhi_s16_u16(in_loaded, _mm_set1_epi16((int16_t)vols[1])), _mm_set1_epi16(negs[1]));
+        wet_src[0] = swap_reverb ? in_loaded : samples[0];
+        wet_src[1] = swap_reverb ? samples[0] : samples[1];
+        for (int j = 0; j < 2; j++) {
+            _mm_storeu_si128((__m128i *)dry[j], _mm_adds_epi16(_mm_loadu_si128((const __m128i *)dry[j]), samples[j]));
+            _mm_storeu_si128((__m128i *)wet[j], _mm_adds_epi16(_mm_loadu_si128((const __m128i *)wet[j]),
+                                                               mulhi_s16_u16(wet_src[j], vol_wet_vec)));
+            dry[j] += 8;
+            wet[j] += 8;
+        }
+#else
+        int16x8_t in_loaded = vld1q_s16(in);
+        int16x8_t vol_wet_vec = vdupq_n_s16((int16_t)vol_wet);
+        int16x8_t samples[2];
+        int16x8_t wet_src[2];
+
+        samples[0] = veorq_s16(mulhi_s16_u16(in_loaded, vdupq_n_s16((int16_t)vols[0])), vdupq_n_s16(negs[0]));
+        samples[1] = veorq_s16(mulhi_s16_u16(in_loaded, vdupq_n_s16((int16_t)vols[1])), vdupq_n_s16(negs[1]));
+        wet_src[0] = swap_reverb ? in_loaded : samples[0];
+        wet_src[1] = swap_reverb ? samples[0] : samples[1];
+        for (int j = 0; j < 2; j++) {
+            vst1q_s16(dry[j], vqaddq_s16(vld1q_s16(dry[j]), samples[j]));
+            vst1q_s16(wet[j], vqaddq_s16(vld1q_s16(wet[j]), mulhi_s16_u16(wet_src[j], vol_wet_vec)));
+            dry[j] += 8;
+            wet[j] += 8;
+        }
+#endif
+        in += 8;
+        vols[0] += rates[0];
+        vols[1] += rates[1];
+        vol_wet += rate_wet;
+
+        n -= 8;
+    } while (n > 0);
+#else
     do {
         for (int i = 0; i < 8; i++) {
             int16_t samples[2] = {*in, *in}; in++;
@@ -638,6 +765,7 @@ void aEnvMixerImpl(uint16_t in_addr, uint16_t n_samples, bool swap_reverb,
 
         n -= 8;
     } while (n > 0);
+#endif
 }
 #else
 void aEnvMixerImpl(uint8_t flags, ENVMIX_STATE state) {
@@ -646,182 +774,6 @@ void aEnvMixerImpl(uint8_t flags, ENVMIX_STATE state) {
     int16_t *wet[2] = {BUF_S16(rspa.wet_left), BUF_S16(rspa.wet_right)};
     int nbytes = ROUND_UP_16(rspa.nbytes);
 
-#if HAS_SSE41
-    __m128 vols[2][2];
-    __m128i dry_factor;
-    __m128i wet_factor;
-    __m128 target[2];
-    __m128 rate[2];
-    __m128i in_loaded;
-    __m128i vol_s16;
-    bool increasing[2];
-
-    int c;
-
-    if (flags & A_INIT) {
-        float vol_init[2] = {rspa.vol[0], rspa.vol[1]};
-        float rate_float[2] = {(float)rspa.rate[0] * (1.0f / 65536.0f), (float)rspa.rate[1] * (1.0f / 65536.0f)};
-        float step_diff[2] = {vol_init[0] * (rate_float[0] - 1.0f), vol_init[1] * (rate_float[1] - 1.0f)};
-
-        for (c = 0; c < 2; c++) {
-            vols[c][0] = _mm_add_ps(
-                _mm_set_ps1(vol_init[c]),
-                _mm_mul_ps(_mm_set1_ps(step_diff[c]), _mm_setr_ps(1.0f / 8.0f, 2.0f / 8.0f, 3.0f / 8.0f, 4.0f / 8.0f)));
-            vols[c][1] = _mm_add_ps(
-                _mm_set_ps1(vol_init[c]),
-                _mm_mul_ps(_mm_set1_ps(step_diff[c]), _mm_setr_ps(5.0f / 8.0f, 6.0f / 8.0f, 7.0f / 8.0f, 8.0f / 8.0f)));
-
-            increasing[c] = rate_float[c] >= 1.0f;
-            target[c] = _mm_set1_ps(rspa.target[c]);
-            rate[c] = _mm_set1_ps(rate_float[c]);
-        }
-
-        dry_factor = _mm_set1_epi16(rspa.vol_dry);
-        wet_factor = _mm_set1_epi16(rspa.vol_wet);
-
-        memcpy(state + 32, &rate_float[0], 4);
-        memcpy(state + 34, &rate_float[1], 4);
-        state[36] = rspa.target[0];
-        state[37] = rspa.target[1];
-        state[38] = rspa.vol_dry;
-        state[39] = rspa.vol_wet;
-    } else {
-        float floats[2];
-        vols[0][0] = _mm_loadu_ps((const float *)state);
-        vols[0][1] = _mm_loadu_ps((const float *)(state + 8));
-        vols[1][0] = _mm_loadu_ps((const float *)(state + 16));
-        vols[1][1] = _mm_loadu_ps((const float *)(state + 24));
-        memcpy(floats, state + 32, 8);
-        rate[0] = _mm_set1_ps(floats[0]);
-        rate[1] = _mm_set1_ps(floats[1]);
-        increasing[0] = floats[0] >= 1.0f;
-        increasing[1] = floats[1] >= 1.0f;
-        target[0] = _mm_set1_ps(state[36]);
-        target[1] = _mm_set1_ps(state[37]);
-        dry_factor = _mm_set1_epi16(state[38]);
-        wet_factor = _mm_set1_epi16(state[39]);
-    }
-    do {
-        in_loaded = _mm_loadu_si128((const __m128i *)in);
-        in += 8;
-        for (c = 0; c < 2; c++) {
-            if (increasing[c]) {
-                vols[c][0] = _mm_min_ps(vols[c][0], target[c]);
-                vols[c][1] = _mm_min_ps(vols[c][1], target[c]);
-            } else {
-                vols[c][0] = _mm_max_ps(vols[c][0], target[c]);
-                vols[c][1] = _mm_max_ps(vols[c][1], target[c]);
-            }
-
-            vol_s16 = _mm_packs_epi32(_mm_cvtps_epi32(vols[c][0]), _mm_cvtps_epi32(vols[c][1]));
-            _mm_storeu_si128((__m128i *)dry[c],
-                             _mm_adds_epi16(
-                                 _mm_loadu_si128((const __m128i *)dry[c]),
-                                 _mm_mulhrs_epi16(in_loaded, _mm_mulhrs_epi16(vol_s16, dry_factor))));
-            dry[c] += 8;
-
-            if (flags & A_AUX) {
-                _mm_storeu_si128((__m128i *)wet[c],
-                                 _mm_adds_epi16(
-                                     _mm_loadu_si128((const __m128i *)wet[c]),
-                                     _mm_mulhrs_epi16(in_loaded, _mm_mulhrs_epi16(vol_s16, wet_factor))));
-                wet[c] += 8;
-            }
-
-            vols[c][0] = _mm_mul_ps(vols[c][0], rate[c]);
-            vols[c][1] = _mm_mul_ps(vols[c][1], rate[c]);
-        }
-
-        nbytes -= 8 * sizeof(int16_t);
-    } while (nbytes > 0);
-
-    _mm_storeu_ps((float *)state, vols[0][0]);
-    _mm_storeu_ps((float *)(state + 8), vols[0][1]);
-    _mm_storeu_ps((float *)(state + 16), vols[1][0]);
-    _mm_storeu_ps((float *)(state + 24), vols[1][1]);
-#elif HAS_NEON
-    float32x4_t vols[2][2];
-    int16_t dry_factor;
-    int16_t wet_factor;
-    float32x4_t target[2];
-    float rate[2];
-    int16x8_t in_loaded;
-    int16x8_t vol_s16;
-    bool increasing[2];
-
-    int c;
-
-    if (flags & A_INIT) {
-        float vol_init[2] = {rspa.vol[0], rspa.vol[1]};
-        float rate_float[2] = {(float)rspa.rate[0] * (1.0f / 65536.0f), (float)rspa.rate[1] * (1.0f / 65536.0f)};
-        float step_diff[2] = {vol_init[0] * (rate_float[0] - 1.0f), vol_init[1] * (rate_float[1] - 1.0f)};
-        static const float step_dividers_data[2][4] = {{1.0f / 8.0f, 2.0f / 8.0f, 3.0f / 8.0f, 4.0f / 8.0f},
-                                                      {5.0f / 8.0f, 6.0f / 8.0f, 7.0f / 8.0f, 8.0f / 8.0f}};
-        float32x4_t step_dividers[2] = {vld1q_f32(step_dividers_data[0]), vld1q_f32(step_dividers_data[1])};
-
-        for (c = 0; c < 2; c++) {
-            vols[c][0] = vaddq_f32(vdupq_n_f32(vol_init[c]), vmulq_n_f32(step_dividers[0], step_diff[c]));
-            vols[c][1] = vaddq_f32(vdupq_n_f32(vol_init[c]), vmulq_n_f32(step_dividers[1], step_diff[c]));
-            increasing[c] = rate_float[c] >= 1.0f;
-            target[c] = vdupq_n_f32(rspa.target[c]);
-            rate[c] = rate_float[c];
-        }
-
-        dry_factor = rspa.vol_dry;
-        wet_factor = rspa.vol_wet;
-
-        memcpy(state + 32, &rate_float[0], 4);
-        memcpy(state + 34, &rate_float[1], 4);
-        state[36] = rspa.target[0];
-        state[37] = rspa.target[1];
-        state[38] = rspa.vol_dry;
-        state[39] = rspa.vol_wet;
-    } else {
-        vols[0][0] = vreinterpretq_f32_s16(vld1q_s16(state));
-        vols[0][1] = vreinterpretq_f32_s16(vld1q_s16(state + 8));
-        vols[1][0] = vreinterpretq_f32_s16(vld1q_s16(state + 16));
-        vols[1][1] = vreinterpretq_f32_s16(vld1q_s16(state + 24));
-        memcpy(&rate[0], state + 32, 4);
-        memcpy(&rate[1], state + 34, 4);
-        increasing[0] = rate[0] >= 1.0f;
-        increasing[1] = rate[1] >= 1.0f;
-        target[0] = vdupq_n_f32(state[36]);
-        target[1] = vdupq_n_f32(state[37]);
-        dry_factor = state[38];
-        wet_factor = state[39];
-    }
-
-    do {
-        in_loaded = vld1q_s16(in);
-        in += 8;
-        for (c = 0; c < 2; c++) {
-            if (increasing[c]) {
-                vols[c][0] = vminq_f32(vols[c][0], target[c]);
-                vols[c][1] = vminq_f32(vols[c][1], target[c]);
-            } else {
-                vols[c][0] = vmaxq_f32(vols[c][0], target[c]);
-                vols[c][1] = vmaxq_f32(vols[c][1], target[c]);
-            }
-
-            vol_s16 = vcombine_s16(vqmovn_s32(vcvtq_s32_f32(vols[c][0])), vqmovn_s32(vcvtq_s32_f32(vols[c][1])));
-            vst1q_s16(dry[c], vqaddq_s16(vld1q_s16(dry[c]), vqrdmulhq_s16(in_loaded, vqrdmulhq_n_s16(vol_s16, dry_factor))));
-            dry[c] += 8;
-            if (flags & A_AUX) {
-                vst1q_s16(wet[c], vqaddq_s16(vld1q_s16(wet[c]), vqrdmulhq_s16(in_loaded, vqrdmulhq_n_s16(vol_s16, wet_factor))));
-                wet[c] += 8;
-            }
-            vols[c][0] = vmulq_n_f32(vols[c][0], rate[c]);
-            vols[c][1] = vmulq_n_f32(vols[c][1], rate[c]);
-        }
-
-        nbytes -= 8 * sizeof(int16_t);
-    } while (nbytes > 0);
-
-    vst1q_s16(state, vreinterpretq_s16_f32(vols[0][0]));
-    vst1q_s16(state + 8, vreinterpretq_s16_f32(vols[0][1]));
-    vst1q_s16(state + 16, vreinterpretq_s16_f32(vols[1][0]));
-    vst1q_s16(state + 24, vreinterpretq_s16_f32(vols[1][1]));
-#else
     int16_t target[2];
     int32_t rate[2];
     int16_t vol_dry, vol_wet;
@@ -830,6 +782,9 @@ void aEnvMixerImpl(uint8_t flags, ENVMIX_STATE state) {
     int32_t vols[2][8];
 
     int c, i;
+#if HAS_SSE41 || HAS_NEON
+    int32_t gains[2][8];
+#endif
 
     if (flags & A_INIT) {
         target[0] = rspa.target[0];
@@ -870,12 +825,24 @@ void aEnvMixerImpl(uint8_t flags, ENVMIX_STATE state) {
                         vols[c][i] = target[c] << 16;
                     }
                 }
+#if HAS_SSE41 || HAS_NEON
+                gains[0][i] = ((vols[c][i] >> 16) * vol_dry + 0x4000) >> 15;
+                gains[1][i] = ((vols[c][i] >> 16) * vol_wet + 0x4000) >> 15;
+#else
                 dry[c][i] = clamp16((dry[c][i] * 0x7fff + in[i] * (((vols[c][i] >> 16) * vol_dry + 0x4000) >> 15) + 0x4000) >> 15);
                 if (flags & A_AUX) {
                     wet[c][i] = clamp16((wet[c][i] * 0x7fff + in[i] * (((vols[c][i] >> 16) * vol_wet + 0x4000) >> 15) + 0x4000) >> 15);
                 }
+#endif
                 vols[c][i] = clamp32((int64_t)vols[c][i] * rate[c] >> 16);
             }
+#if HAS_SSE41 || HAS_NEON
+            // The volume ramp above needs 64-bit products, so only the mixing is vectorized
+            mix_s16_gains(dry[c], in, gains[0]);
+            if (flags & A_AUX) {
+                mix_s16_gains(wet[c], in, gains[1]);
+            }
+#endif
 
             dry[c] += 8;
             if (flags & A_AUX) {
@@ -897,7 +864,7 @@ void aEnvMixerImpl(uint8_t flags, ENVMIX_STATE state) {
     state[37] = (int16_t)rate[1];
     state[38] = vol_dry;
     state[39] = vol_wet;
-#endif
+
 }
 #endif
 
@@ -910,17 +877,26 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
 #endif
     int16_t *in = BUF_S16(in_addr);
     int16_t *out = BUF_S16(out_addr);
-#if HAS_SSE41
-    __m128i gain_vec = _mm_set1_epi16(gain);
+#if HAS_AVX2
+    __m256i gain_pairs = _mm256_broadcastsi128_si256(mix_gain_pairs(gain));
+#elif HAS_SSE41
+    __m128i gain_pairs = mix_gain_pairs(gain);
 #elif !HAS_NEON
     int i;
     int32_t sample;
 #endif
 
-#if !HAS_NEON
     if (gain == -0x8000) {
         while (nbytes > 0) {
-#if HAS_SSE41
+#if HAS_AVX2
+            __m256i out1 = _mm256_loadu_si256((const __m256i *)out);
+            __m256i in1 = _mm256_loadu_si256((const __m256i *)in);
+
+            _mm256_storeu_si256((__m256i *)out, _mm256_subs_epi16(out1, in1));
+
+            out += 16;
+            in += 16;
+#elif HAS_SSE41
             __m128i out1, out2, in1, in2;
             out1 = _mm_loadu_si128((const __m128i *)out);
             out2 = _mm_loadu_si128((const __m128i *)(out + 8));
@@ -933,6 +909,12 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
             _mm_storeu_si128((__m128i *)out, out1);
             _mm_storeu_si128((__m128i *)(out + 8), out2);
 
+            out += 16;
+            in += 16;
+#elif HAS_NEON
+            vst1q_s16(out, vqsubq_s16(vld1q_s16(out), vld1q_s16(in)));
+            vst1q_s16(out + 8, vqsubq_s16(vld1q_s16(out + 8), vld1q_s16(in + 8)));
+
             out += 16;
             in += 16;
 #else
@@ -945,18 +927,31 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
             nbytes -= 16 * sizeof(int16_t);
         }
     }
-#endif
 
     while (nbytes > 0) {
-#if HAS_SSE41
+#if HAS_AVX2
+        const __m256i round = _mm256_set1_epi32(0x4000);
+        __m256i out1 = _mm256_loadu_si256((const __m256i *)out);
+        __m256i in1 = _mm256_loadu_si256((const __m256i *)in);
+        // Unpacking and packing both work within 128-bit lanes, so the order is kept
+        __m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(out1, in1), gain_pairs);
+        __m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(out1, in1), gain_pairs);
+
+        _mm256_storeu_si256((__m256i *)out,
+                            _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(lo, round), 15),
+                                               _mm256_srai_epi32(_mm256_add_epi32(hi, round), 15)));
+
+        out += 16;
+        in += 16;
+#elif HAS_SSE41
         __m128i out1, out2, in1, in2;
         out1 = _mm_loadu_si128((const __m128i *)out);
         out2 = _mm_loadu_si128((const __m128i *)(out + 8));
         in1 = _mm_loadu_si128((const __m128i *)in);
         in2 = _mm_loadu_si128((const __m128i *)(in + 8));
 
-        out1 = _mm_adds_epi16(out1, _mm_mulhrs_epi16(in1, gain_vec));
-        out2 = _mm_adds_epi16(out2, _mm_mulhrs_epi16(in2, gain_vec));
+        out1 = mix_s16(out1, in1, gain_pairs);
+        out2 = mix_s16(out2, in2, gain_pairs);
 
         _mm_storeu_si128((__m128i *)out, out1);
         _mm_storeu_si128((__m128i *)(out + 8), out2);
@@ -970,8 +965,8 @@ void aMixImpl(int16_t gain, uint16_t in_addr, uint16_t out_addr) {
         in1 = vld1q_s16(in);
         in2 = vld1q_s16(in + 8);
 
-        out1 = vqaddq_s16(out1, vqrdmulhq_n_s16(in1, gain));
-        out2 = vqaddq_s16(out2, vqrdmulhq_n_s16(in2, gain));
+        out1 = mix_s16(out1, in1, gain);
+        out2 = mix_s16(out2, in2, gain);
 
         vst1q_s16(out, out1);
         vst1q_s16(out + 8, out2);
@@ -1004,6 +999,24 @@ void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
     out += 16;
 
     while (nbytes > 0) {
+#if HAS_AVX2
+        __m256i samples = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *)in));
+        _mm256_storeu_si256((__m256i *)out, _mm256_slli_epi16(samples, 8));
+        in += 16;
+        out += 16;
+#elif HAS_SSE41
+        __m128i samples = _mm_loadu_si128((const __m128i *)in);
+        _mm_storeu_si128((__m128i *)out, _mm_unpacklo_epi8(_mm_setzero_si128(), samples));
+        _mm_storeu_si128((__m128i *)(out + 8), _mm_unpackhi_epi8(_mm_setzero_si128(), samples));
+        in += 16;
+        out += 16;
+#elif HAS_NEON
+        uint8x16_t samples = vld1q_u8(in);
+        vst1q_s16(out, vreinterpretq_s16_u16(vshll_n_u8(vget_low_u8(samples), 8)));
+        vst1q_s16(out + 8, vreinterpretq_s16_u16(vshll_n_u8(vget_high_u8(samples), 8)));
+        in += 16;
+        out += 16;
+#else
         *out++ = (int16_t)(*in++ << 8);
         *out++ = (int16_t)(*in++ << 8);
         *out++ = (int16_t)(*in++ << 8);
@@ -1020,6 +1033,7 @@ void aS8DecImpl(uint8_t flags, ADPCM_STATE state) {
         *out++ = (int16_t)(*in++ << 8);
         *out++ = (int16_t)(*in++ << 8);
         *out++ = (int16_t)(*in++ << 8);
+#endif
 
         nbytes -= 16 * sizeof(int16_t);
     }
@@ -1033,6 +1047,27 @@ void aAddMixerImpl(uint16_t in_addr, uint16_t out_addr, uint16_t count) {
     int nbytes = ROUND_UP_64(ROUND_DOWN_16(count));
 
     do {
+#if HAS_AVX2
+        __m256i out1 = _mm256_loadu_si256((const __m256i *)out);
+        __m256i in1 = _mm256_loadu_si256((const __m256i *)in);
+        _mm256_storeu_si256((__m256i *)out, _mm256_adds_epi16(out1, in1));
+        in += 16;
+        out += 16;
+#elif HAS_SSE41
+        __m128i out1 = _mm_loadu_si128((const __m128i *)out);
+        __m128i out2 = _mm_loadu_si128((const __m128i *)(out + 8));
+        __m128i in1 = _mm_loadu_si128((const __m128i *)in);
+        __m128i in2 = _mm_loadu_si128((const __m128i *)(in + 8));
+        _mm_storeu_si128((__m128i *)out, _mm_adds_epi16(out1, in1));
+        _mm_storeu_si128((__m128i *)(out + 8), _mm_adds_epi16(out2, in2));
+        in += 16;
+        out += 16;
+#elif HAS_NEON
+        vst1q_s16(out, vqaddq_s16(vld1q_s16(out), vld1q_s16(in)));
+        vst1q_s16(out + 8, vqaddq_s16(vld1q_s16(out + 8), vld1q_s16(in + 8)));
+        in += 16;
+        out += 16;
+#else
         *out = clamp16(*out + *in++); out++;
         *out = clamp16(*out + *in++); out++;
         *out = clamp16(*out + *in++); out++;
@@ -1049,6 +1084,7 @@ void aAddMixerImpl(uint16_t in_addr, uint16_t out_addr, uint16_t count) {
         *out = clamp16(*out + *in++); out++;
         *out = clamp16(*out + *in++); out++;
         *out = clamp16(*out + *in++); out++;
+#endif
 
         nbytes -= 16 * sizeof(int16_t);
     } while (nbytes > 0);
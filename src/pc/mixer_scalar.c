@@ -0,0 +1,7 @@
+// The mixer without its SSE4.1, AVX2 and NEON paths, under the names of
+// mixer_scalar.h, so that mixer_test can compare both in one program.
+// Only linked into mixer_test.
+
+#define MIXER_SCALAR
+#include "mixer_scalar.h"
+#include "mixer.c"
@@ -0,0 +1,32 @@
+#ifndef MIXER_SCALAR_H
+#define MIXER_SCALAR_H
+
+// Names of the functions of mixer_scalar.c. Included before mixer.h, it makes
+// the mixer functions declared and called through mixer.h the scalar ones.
+
+#define aClearBufferImpl    scalar_aClearBufferImpl
+#define aLoadADPCMImpl      scalar_aLoadADPCMImpl
+#define aSetBufferImpl      scalar_aSetBufferImpl
+#define aDMEMMoveImpl       scalar_aDMEMMoveImpl
+#define aSetLoopImpl        scalar_aSetLoopImpl
+#define aADPCMdecImpl       scalar_aADPCMdecImpl
+#define aResampleImpl       scalar_aResampleImpl
+#define aSetVolumeImpl      scalar_aSetVolumeImpl
+#define aLoadBufferImpl     scalar_aLoadBufferImpl
+#define aSaveBufferImpl     scalar_aSaveBufferImpl
+#define aInterleaveImpl     scalar_aInterleaveImpl
+#define aMixImpl            scalar_aMixImpl
+#define aEnvMixerImpl       scalar_aEnvMixerImpl
+#define aEnvSetup1Impl      scalar_aEnvSetup1Impl
+#define aEnvSetup2Impl      scalar_aEnvSetup2Impl
+#define aS8DecImpl          scalar_aS8DecImpl
+#define aAddMixerImpl       scalar_aAddMixerImpl
+#define aDuplicateImpl      scalar_aDuplicateImpl
+#define aDMEMMove2Impl      scalar_aDMEMMove2Impl
+#define aResampleZohImpl    scalar_aResampleZohImpl
+#define aDownsampleHalfImpl scalar_aDownsampleHalfImpl
+#define aFilterImpl         scalar_aFilterImpl
+#define aHiLoGainImpl       scalar_aHiLoGainImpl
+#define aUnknown25Impl      scalar_aUnknown25Impl
+
+#endif
@@ -0,0 +1,158 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @file mixer_test.c
+ * Runs the same audio commands through the mixer with its SIMD paths
+ * (mixer.c) and without them (mixer_scalar.c) and checks that the resulting
+ * sample buffers and states are bit-identical. The inputs are generated from
+ * fixed seeds and include samples and volumes that saturate. Built and run
+ * with `make mixer_test`, it exits with a non-zero status on a mismatch.
+ */
+
+#include "mixer.h"
+
+#ifdef NEW_AUDIO_UCODE
+#define DMEM_BASE 0x450
+#define DMEM_SIZE 2880
+#else
+#define DMEM_SIZE 2512
+#endif
+
+#define NUM_ROUNDS 64
+
+// Number of 9 byte ADPCM frames that the 0x180 byte output decodes from
+#define ADPCM_FRAMES (0x180 / 32)
+
+struct MixerTestInput {
+    uint8_t dmem[DMEM_SIZE];
+    int16_t book[8 * 2 * 8];
+    ADPCM_STATE adpcmState;
+    uint16_t pitch;
+    int16_t gain;
+    uint16_t vols[2];
+    uint16_t rates[2];
+    uint16_t volWet;
+    uint16_t rateWet;
+#ifndef NEW_AUDIO_UCODE
+    int16_t targets[2];
+    int16_t volDry;
+#endif
+};
+
+struct MixerTestOutput {
+    int16_t dmem[DMEM_SIZE / sizeof(int16_t)];
+    ADPCM_STATE adpcmState;
+    ADPCM_STATE s8State;
+    RESAMPLE_STATE resampleState;
+    ENVMIX_STATE envState;
+};
+
+#define MIXER_TEST_RUN mixer_test_run_simd
+#include "mixer_test.inc.c"
+#undef MIXER_TEST_RUN
+
+// Declare and call the functions of mixer_scalar.c from here on
+#undef MIXER_H
+#include "mixer_scalar.h"
+#include "mixer.h"
+
+#define MIXER_TEST_RUN mixer_test_run_scalar
+#include "mixer_test.inc.c"
+#undef MIXER_TEST_RUN
+
+static uint32_t sRandomState;
+
+static uint32_t next_random(void) {
+    sRandomState = sRandomState * 1664525 + 1013904223;
+    return sRandomState >> 8;
+}
+
+/**
+ * A random 16-bit value, a third of them at or next to the extremes.
+ */
+static uint16_t random_u16(void) {
+    static const uint16_t extremes[] = { 0x0000, 0x0001, 0x7FFF, 0x8000, 0x8001, 0xFFFF };
+    uint32_t r = next_random();
+
+    if (r % 3 == 0) {
+        return extremes[(r >> 8) % (sizeof(extremes) / sizeof(extremes[0]))];
+    }
+    return (uint16_t) (r >> 4);
+}
+
+static void make_input(struct MixerTestInput *input, uint32_t seed) {
+    size_t i;
+
+    sRandomState = seed;
+    for (i = 0; i < sizeof(input->dmem); i += 2) {
+        uint16_t v = random_u16();
+
+        input->dmem[i] = v >> 8;
+        input->dmem[i + 1] = v & 0xFF;
+    }
+    // The ADPCM frames at the start of the buffer need valid headers: a shift
+    // of at most 12 and one of the 8 predictors
+    for (i = 0; i < ADPCM_FRAMES * 9; i += 9) {
+        input->dmem[i] = (next_random() % 13) << 4 | (next_random() % 8);
+    }
+    // Real codebooks are small fixed point predictors, keep them in range
+    for (i = 0; i < sizeof(input->book) / sizeof(input->book[0]); i++) {
+        input->book[i] = (int16_t) (next_random() & 0x1FFF) - 0x1000;
+    }
+    for (i = 0; i < sizeof(input->adpcmState) / sizeof(input->adpcmState[0]); i++) {
+        input->adpcmState[i] = (int16_t) random_u16();
+    }
+    // Up to twice the output rate, which is as far as the input buffer reaches
+    input->pitch = (uint16_t) (next_random() % 0x10000);
+    input->gain = (int16_t) random_u16();
+    input->vols[0] = random_u16();
+    input->vols[1] = random_u16();
+    input->rates[0] = random_u16();
+    input->rates[1] = random_u16();
+    input->volWet = random_u16();
+    input->rateWet = random_u16();
+#ifndef NEW_AUDIO_UCODE
+    input->targets[0] = (int16_t) random_u16();
+    input->targets[1] = (int16_t) random_u16();
+    input->volDry = (int16_t) random_u16();
+#endif
+}
+
+static size_t first_difference(const void *a, const void *b, size_t size) {
+    const uint8_t *pa = a;
+    const uint8_t *pb = b;
+    size_t i;
+
+    for (i = 0; i < size && pa[i] == pb[i]; i++) {
+    }
+    return i;
+}
+
+int main(void) {
+    static struct MixerTestInput input;
+    static struct MixerTestOutput simd;
+    static struct MixerTestOutput scalar;
+    int failures = 0;
+    int round;
+
+    for (round = 0; round < NUM_ROUNDS; round++) {
+        make_input(&input, 0x5EED0000 + round);
+        mixer_test_run_simd(&input, &simd);
+        mixer_test_run_scalar(&input, &scalar);
+
+        if (memcmp(&simd, &scalar, sizeof(simd)) != 0) {
+            fprintf(stderr, "Round %d: SIMD and scalar output differ at byte %zu\n", round,
+                    first_difference(&simd, &scalar, sizeof(simd)));
+            failures++;
+        }
+    }
+
+    if (failures != 0) {
+        fprintf(stderr, "%d of %d rounds differ\n", failures, NUM_ROUNDS);
+        return EXIT_FAILURE;
+    }
+    printf("mixer_test: %d rounds, SIMD output matches scalar output\n", NUM_ROUNDS);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,80 @@
+// Included twice by mixer_test.c: MIXER_TEST_RUN runs the commands below with
+// whichever mixer functions mixer.h currently names.
+
+static void MIXER_TEST_RUN(const struct MixerTestInput *input, struct MixerTestOutput *output) {
+#ifdef NEW_AUDIO_UCODE
+    s32 i;
+#endif
+
+    memset(output, 0, sizeof(*output));
+    memcpy(output->adpcmState, input->adpcmState, sizeof(output->adpcmState));
+
+#ifdef NEW_AUDIO_UCODE
+    aLoadBuffer(NULL, input->dmem, DMEM_BASE, DMEM_SIZE);
+    aLoadADPCM(NULL, sizeof(input->book), input->book);
+
+    // ADPCM frames at 0x450, decoded to 0x550
+    aSetBuffer(NULL, 0, 0x450, 0x550, 0x180);
+    aADPCMdec(NULL, A_INIT, output->adpcmState);
+    aADPCMdec(NULL, A_CONTINUE, output->adpcmState);
+
+    // 8-bit samples at 0x450, decoded to 0x700
+    aSetBuffer(NULL, 0, 0x450, 0x700, 0x100);
+    aS8Dec(NULL, A_INIT, output->s8State);
+    aS8Dec(NULL, A_CONTINUE, output->s8State);
+
+    // 0x8A0 resampled to 0xC00
+    aSetBuffer(NULL, 0, 0x8A0, 0xC00, 0x100);
+    aResample(NULL, A_INIT, input->pitch, output->resampleState);
+    aResample(NULL, A_CONTINUE, input->pitch, output->resampleState);
+
+    // 0xC00 mixed to dry 0xD00/0xD80 and wet 0xE00/0xE80, both reverb orders
+    for (i = 0; i < 2; i++) {
+        aEnvSetup1(NULL, input->volWet, input->rateWet, input->rates[0], input->rates[1]);
+        aEnvSetup2(NULL, input->vols[0], input->vols[1]);
+        aEnvMixer(NULL, 0xC00, 0x80, i, i == 0, i == 1, 0xD00, 0xD80, 0xE00, 0xE80);
+    }
+
+    aMix(NULL, input->gain, 0xD00, 0xF00, 0x80);
+    aMix(NULL, -0x8000, 0xD80, 0xF00, 0x80);
+    aAddMixer(NULL, 0xD80, 0xE00, 0x80);
+
+    aSaveBuffer(NULL, DMEM_BASE, output->dmem, DMEM_SIZE);
+#else
+    aSetBuffer(NULL, 0, 0, 0, DMEM_SIZE);
+    aLoadBuffer(NULL, input->dmem);
+    aLoadADPCM(NULL, sizeof(input->book), input->book);
+
+    // ADPCM frames at 0x000, decoded to 0x100
+    aSetBuffer(NULL, 0, 0x000, 0x100, 0x180);
+    aADPCMdec(NULL, A_INIT, output->adpcmState);
+    aADPCMdec(NULL, A_CONTINUE, output->adpcmState);
+
+    // 0x420 resampled to 0x300
+    aSetBuffer(NULL, 0, 0x420, 0x300, 0x100);
+    aResample(NULL, A_INIT, input->pitch, output->resampleState);
+    aResample(NULL, A_CONTINUE, input->pitch, output->resampleState);
+
+    // 0x300 mixed to dry 0x700/0x780 and wet 0x800/0x880, with and without
+    // the wet channels
+    aSetVolume(NULL, A_VOL | A_LEFT, input->vols[0], 0, 0);
+    aSetVolume(NULL, A_VOL | A_RIGHT, input->vols[1], 0, 0);
+    aSetVolume32(NULL, A_RATE | A_LEFT, input->targets[0], input->rates[0]);
+    aSetVolume32(NULL, A_RATE | A_RIGHT, input->targets[1], input->rates[1]);
+    aSetVolume(NULL, A_AUX, input->volDry, 0, input->volWet);
+    aSetBuffer(NULL, A_AUX, 0x780, 0x800, 0x880);
+    aSetBuffer(NULL, A_MAIN, 0x300, 0x700, 0x80);
+    aEnvMixer(NULL, A_INIT | A_AUX, output->envState);
+    aEnvMixer(NULL, A_CONTINUE | A_AUX, output->envState);
+    aEnvMixer(NULL, A_CONTINUE, output->envState);
+
+    aMix(NULL, 0, input->gain, 0x700, 0x900);
+    aMix(NULL, 0, -0x8000, 0x780, 0x900);
+
+    aSetBuffer(NULL, 0, 0, 0x000, 0x40);
+    aInterleave(NULL, 0x700, 0x780);
+
+    aSetBuffer(NULL, 0, 0, 0, DMEM_SIZE);
+    aSaveBuffer(NULL, output->dmem);
+#endif
+}
@@ -1,3 +1,4 @@
+#include <stdio.h>
 #include <stdlib.h>
 
 #ifdef TARGET_WEB
@@ -8,9 +9,15 @@
 #include "sm64.h"
 
 #include "game/memory.h"
+#include "buffers/buffers.h"
+#include "game/frame_interp.h"
+#include "game/envfx_snow.h"
+#include "game/object_lod.h"
+#include "game/state_hash.h"
 #include "audio/external.h"
 
 #include "gfx/gfx_pc.h"
+#include "gfx/gfx_window_manager_api.h"
 #include "gfx/gfx_opengl.h"
 #include "gfx/gfx_direct3d11.h"
 #include "gfx/gfx_direct3d12.h"
@@ -29,10 +36,13 @@
 #include "controller/controller_keyboard.h"
 
 #include "configfile.h"
+#include "audio_event_log.h"
 
 #include "compat.h"
 
 #define CONFIG_FILE "sm64config.txt"
+#define STATE_HASH_LOG_FILE "sm64_state_hashes.bin"
+#define AUDIO_EVENT_LOG_FILE "sm64_audio_events.txt"
 
 OSMesg gMainReceivedMesg;
 OSMesgQueue gSIEventMesgQueue;
@@ -60,12 +70,15 @@ void set_vblank_handler(UNUSED s32 index, UNUSED struct VblankHandler *handler,
 
 static uint8_t inited = 0;
 
+// Display list of the last game tick, run once for every frame of the tick
+static Gfx *pending_display_list;
+
 #include "game/game_init.h" // for gGlobalTimer
 void exec_display_list(struct SPTask *spTask) {
     if (!inited) {
         return;
     }
-    gfx_run((Gfx *)spTask->task.t.data_ptr);
+    pending_display_list = (Gfx *)spTask->task.t.data_ptr;
 }
 
 #define printf
@@ -80,6 +93,7 @@ void exec_display_list(struct SPTask *spTask) {
 
 void produce_one_frame(void) {
     gfx_start_frame();
+    frame_interp_begin_tick();
     game_loop_one_iteration();
     
     int samples_left = audio_api->buffered();
@@ -96,7 +110,19 @@ void produce_one_frame(void) {
     //printf("Audio samples before submitting: %d\n", audio_api->buffered());
     audio_api->play((u8 *)audio_buffer, 2 * num_audio_samples * 4);
     
-    gfx_end_frame();
+    // The display list stays valid until the next tick selects a new gfx pool,
+    // so intermediate frames only need the interpolated matrices patched in
+    for (uint32_t i = 1; i <= gfx_frames_per_tick; i++) {
+        if (i > 1) {
+            gfx_start_frame();
+        }
+        if (pending_display_list != NULL) {
+            frame_interp_apply((float)i / gfx_frames_per_tick);
+            gfx_run(pending_display_list);
+        }
+        gfx_end_frame();
+    }
+    pending_display_list = NULL;
 }
 
 #ifdef TARGET_WEB
@@ -143,7 +169,11 @@ static void on_fullscreen_changed(bool is_now_fullscreen) {
 void main_func(void) {
 #ifdef USE_SYSTEM_MALLOC
     main_pool_init();
-    gGfxAllocOnlyPool = alloc_only_pool_init();
+    for (int i = 0; i < GFX_NUM_POOLS; i++) {
+        gGfxPools[i].allocOnlyPool = alloc_only_pool_init();
+    }
+    gGfxAllocOnlyPool = gGfxPools[0].allocOnlyPool;
+    frame_pool_init();
 #else
     static u64 pool[0x165000/8 / 4 * sizeof(void *)];
     main_pool_init(pool, pool + sizeof(pool) / sizeof(pool[0]));
@@ -153,6 +183,26 @@ void main_func(void) {
     configfile_load(CONFIG_FILE);
     atexit(save_config);
 
+#ifndef TARGET_WEB
+    // The browser presents once per animation frame callback, so the web
+    // build always renders a single frame per tick
+    if (configFramesPerTick >= 1 && configFramesPerTick <= 8) {
+        gfx_frames_per_tick = configFramesPerTick;
+    }
+#endif
+    gFrameInterpFramesPerTick = gfx_frames_per_tick;
+    gObjectLodEnabled = configObjectLod;
+    if (configEnvFxDensity >= 1 && configEnvFxDensity <= 4) {
+        gEnvFxDensity = configEnvFxDensity;
+    }
+
+    if (configStateHashLog && !state_hash_open(STATE_HASH_LOG_FILE)) {
+        fprintf(stderr, "Could not open " STATE_HASH_LOG_FILE "\n");
+    }
+    if (configAudioEventLog && !audio_event_log_open(AUDIO_EVENT_LOG_FILE)) {
+        fprintf(stderr, "Could not open " AUDIO_EVENT_LOG_FILE "\n");
+    }
+
 #ifdef TARGET_WEB
     emscripten_set_main_loop(em_main_loop, 0, 0);
     request_anim_frame(on_anim_frame);
@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sm64.h"
+#include "audio/external.h"
+#include "level_commands.h"
+#include "engine/geo_layout.h"
+#include "engine/surface_load.h"
+#include "game/memory.h"
+#include "game/object_list_processor.h"
+
+#include "level_headers.h"
+
+/**
+ * @file surface_cache_test.c
+ * Loads the collision of every area of every level twice with surface_load.c
+ * built with STATIC_SURFACE_CACHE_VALIDATE (surface_load_validate.c). The
+ * first load of each collision fills the static surface cache. Every later
+ * load finds it there, loads the collision normally anyway, then restores
+ * the cached surfaces into the partition in place of the loaded ones and
+ * aborts if the surfaces, the cell lists or the surface counters differ. It
+ * is linked with the same objects as the game, except pc_main.o and
+ * surface_load.o, and is built and run with `make surface_cache_test`.
+ *
+ * The areas are found by walking the level scripts from each level's entry,
+ * without running them, so the test doesn't need the renderer or a save file.
+ */
+
+#define NUM_PASSES 2
+#define MAX_VISITED_SCRIPTS 256
+
+// The level script commands the walk needs, see level_commands.h
+#define LEVEL_CMD_EXECUTE 0x00
+#define LEVEL_CMD_EXIT_AND_EXECUTE 0x01
+#define LEVEL_CMD_EXIT 0x02
+#define LEVEL_CMD_JUMP 0x05
+#define LEVEL_CMD_JUMP_LINK 0x06
+#define LEVEL_CMD_RETURN 0x07
+#define LEVEL_CMD_JUMP_IF 0x0C
+#define LEVEL_CMD_JUMP_LINK_IF 0x0D
+#define LEVEL_CMD_AREA 0x1F
+#define LEVEL_CMD_END_AREA 0x20
+#define LEVEL_CMD_TERRAIN 0x2E
+#define LEVEL_CMD_ROOMS 0x2F
+
+struct LevelCommand {
+    /*00*/ u8 type;
+    /*01*/ u8 size;
+    /*02*/ // variable sized argument data
+};
+
+#define CMD_GET(cmd, type, offset) (*(type *) (CMD_PROCESS_OFFSET(offset) + (u8 *) (cmd)))
+#define CMD_NEXT(cmd) ((const struct LevelCommand *) ((u8 *) (cmd) + ((cmd)->size << CMD_SIZE_SHIFT)))
+
+struct TestLevel {
+    const char *name;
+    const LevelScript *script;
+};
+
+struct TestArea {
+    s16 *terrainData;
+    s8 *surfaceRooms;
+};
+
+#define STUB_LEVEL(_0, _1, _2, _3, _4, _5, _6, _7, _8)
+#define DEFINE_LEVEL(_0, _1, _2, folder, _4, _5, _6, _7, _8, _9, _10) { #folder, level_ ## folder ## _entry },
+static const struct TestLevel sLevels[] = {
+#include "levels/level_defines.h"
+};
+#undef STUB_LEVEL
+#undef DEFINE_LEVEL
+
+// The game gets these from pc_main.c
+OSMesg gMainReceivedMesg;
+OSMesgQueue gSIEventMesgQueue;
+
+s8 gResetTimer;
+s8 gNmiResetBarsTimer;
+s8 gDebugLevelSelect;
+s8 gShowProfiler;
+s8 gShowDebugText;
+
+static struct TestArea sAreas[8];
+static s32 sCurrAreaIndex;
+static const struct LevelCommand *sVisitedScripts[MAX_VISITED_SCRIPTS];
+static s32 sNumVisitedScripts;
+
+void dispatch_audio_sptask(UNUSED struct SPTask *spTask) {
+}
+
+void set_vblank_handler(UNUSED s32 index, UNUSED struct VblankHandler *handler, UNUSED OSMesgQueue *queue, UNUSED OSMesg *msg) {
+}
+
+void exec_display_list(UNUSED struct SPTask *spTask) {
+}
+
+/**
+ * Collect the terrain and rooms of the areas that the script and the scripts
+ * it can jump to define. Every script is walked once.
+ */
+static void find_areas(const struct LevelCommand *cmd) {
+    s32 i;
+
+    if (cmd == NULL) {
+        return;
+    }
+    for (i = 0; i < sNumVisitedScripts; i++) {
+        if (sVisitedScripts[i] == cmd) {
+            return;
+        }
+    }
+    if (sNumVisitedScripts >= MAX_VISITED_SCRIPTS) {
+        fprintf(stderr, "surface_cache_test: too many level scripts\n");
+        exit(EXIT_FAILURE);
+    }
+    sVisitedScripts[sNumVisitedScripts++] = cmd;
+
+    for (; cmd->size != 0; cmd = CMD_NEXT(cmd)) {
+        switch (cmd->type) {
+            case LEVEL_CMD_EXECUTE:
+                find_areas(CMD_GET(cmd, const struct LevelCommand *, 12));
+                break;
+            case LEVEL_CMD_EXIT_AND_EXECUTE:
+                find_areas(CMD_GET(cmd, const struct LevelCommand *, 12));
+                return;
+            case LEVEL_CMD_EXIT:
+            case LEVEL_CMD_RETURN:
+                return;
+            case LEVEL_CMD_JUMP:
+                find_areas(CMD_GET(cmd, const struct LevelCommand *, 4));
+                return;
+            case LEVEL_CMD_JUMP_LINK:
+                find_areas(CMD_GET(cmd, const struct LevelCommand *, 4));
+                break;
+            case LEVEL_CMD_JUMP_IF:
+            case LEVEL_CMD_JUMP_LINK_IF:
+                find_areas(CMD_GET(cmd, const struct LevelCommand *, 8));
+                break;
+            case LEVEL_CMD_AREA:
+                sCurrAreaIndex = CMD_GET(cmd, u8, 2) < 8 ? CMD_GET(cmd, u8, 2) : -1;
+                break;
+            case LEVEL_CMD_END_AREA:
+                sCurrAreaIndex = -1;
+                break;
+            case LEVEL_CMD_TERRAIN:
+                if (sCurrAreaIndex != -1) {
+                    sAreas[sCurrAreaIndex].terrainData = CMD_GET(cmd, s16 *, 4);
+                }
+                break;
+            case LEVEL_CMD_ROOMS:
+                if (sCurrAreaIndex != -1) {
+                    sAreas[sCurrAreaIndex].surfaceRooms = CMD_GET(cmd, s8 *, 4);
+                }
+                break;
+        }
+    }
+}
+
+/**
+ * Load an area's collision like load_area does. The game modifies the
+ * terrain data, so it is loaded from a copy, as level_cmd_set_terrain_data
+ * does.
+ */
+static void load_test_area(s32 index, struct TestArea *area) {
+    u32 size = get_area_terrain_size(area->terrainData) * sizeof(s16);
+    s16 *terrainData = malloc(size);
+
+    if (terrainData == NULL) {
+        abort();
+    }
+    memcpy(terrainData, area->terrainData, size);
+
+    clear_objects();
+    load_area_terrain(index, terrainData, area->surfaceRooms, NULL);
+    free(terrainData);
+}
+
+int main(void) {
+    s32 numAreas = 0;
+    s32 pass;
+    u32 i;
+    s32 j;
+
+    main_pool_init();
+    alloc_surface_pools();
+    // Unloading the special objects of an area stops their sounds
+    sound_init();
+
+    for (pass = 0; pass < NUM_PASSES; pass++) {
+        numAreas = 0;
+        for (i = 0; i < ARRAY_COUNT(sLevels); i++) {
+            memset(sAreas, 0, sizeof(sAreas));
+            sCurrAreaIndex = -1;
+            sNumVisitedScripts = 0;
+            find_areas((const struct LevelCommand *) sLevels[i].script);
+
+            for (j = 0; j < 8; j++) {
+                if (sAreas[j].terrainData != NULL) {
+                    // STATIC_SURFACE_CACHE_VALIDATE aborts here on a difference
+                    load_test_area(j, &sAreas[j]);
+                    numAreas++;
+                }
+            }
+        }
+    }
+
+    if (numAreas == 0) {
+        fprintf(stderr, "surface_cache_test: no areas found in the level scripts\n");
+        return EXIT_FAILURE;
+    }
+    printf("surface_cache_test: %d areas of %d levels loaded %d times, cached surfaces match\n",
+           numAreas, (int) ARRAY_COUNT(sLevels), NUM_PASSES);
+    return EXIT_SUCCESS;
+}
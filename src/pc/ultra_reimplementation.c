@@ -1,11 +1,20 @@
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "lib/src/libultra_internal.h"
 #include "macros.h"
 
 #ifdef TARGET_WEB
 #include <emscripten.h>
 #endif
+#ifdef _WIN32
+#include <windows.h>
+#include <io.h>
+#elif !defined(TARGET_WEB)
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 extern OSMgrArgs piMgrArgs;
 
@@ -78,6 +87,31 @@ OSTime osGetTime(void) {
     return 0;
 }
 
+/**
+ * Return a monotonic time in CPU counter cycles, like osGetTime on the
+ * console, for measuring durations with OS_CYCLES_TO_USEC. osGetTime itself
+ * stays 0, since the goddard renderer and the crash screen pace themselves
+ * with it.
+ */
+OSTime pc_get_monotonic_time(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+
+    if (frequency.QuadPart == 0) {
+        QueryPerformanceFrequency(&frequency);
+    }
+    QueryPerformanceCounter(&counter);
+    return (OSTime) (counter.QuadPart / frequency.QuadPart) * OS_CPU_COUNTER
+           + (OSTime) (counter.QuadPart % frequency.QuadPart) * OS_CPU_COUNTER / frequency.QuadPart;
+#else
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (OSTime) ts.tv_sec * OS_CPU_COUNTER + OS_NSEC_TO_CYCLES(ts.tv_nsec);
+#endif
+}
+
 void osWritebackDCacheAll(void) {
 }
 
@@ -121,12 +155,145 @@ s32 osEepromProbe(UNUSED OSMesgQueue *mq) {
     return 1;
 }
 
-s32 osEepromLongRead(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes) {
-    u8 content[512];
-    s32 ret = -1;
+/**
+ * The EEPROM image is loaded once and kept in memory, reads are served from
+ * it. Writes update the image and wake a writer thread, which saves the
+ * latest image to a temporary file and renames it over the save file, so a
+ * crash while saving leaves the previous save intact. Writes made while the
+ * thread is busy are saved together by its next pass. On the web, the image
+ * is stored to localStorage right away, which doesn't touch the disk.
+ */
+#define EEPROM_SIZE 512
+#define EEPROM_PATH "sm64_save_file.bin"
+#define EEPROM_TMP_PATH "sm64_save_file.bin.tmp"
+
+static u8 sEepromImage[EEPROM_SIZE];
+static u8 sEepromLoaded;
+// Whether the image holds a save, reads fail until it's loaded or written
+static u8 sEepromValid;
+
+#ifndef TARGET_WEB
+#ifdef _WIN32
+static CRITICAL_SECTION sEepromLock;
+static CONDITION_VARIABLE sEepromCond;
+#define EEPROM_LOCK() EnterCriticalSection(&sEepromLock)
+#define EEPROM_UNLOCK() LeaveCriticalSection(&sEepromLock)
+#define EEPROM_WAIT() SleepConditionVariableCS(&sEepromCond, &sEepromLock, INFINITE)
+#define EEPROM_SIGNAL() WakeAllConditionVariable(&sEepromCond)
+#else
+static pthread_mutex_t sEepromLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t sEepromCond = PTHREAD_COND_INITIALIZER;
+#define EEPROM_LOCK() pthread_mutex_lock(&sEepromLock)
+#define EEPROM_UNLOCK() pthread_mutex_unlock(&sEepromLock)
+#define EEPROM_WAIT() pthread_cond_wait(&sEepromCond, &sEepromLock)
+#define EEPROM_SIGNAL() pthread_cond_broadcast(&sEepromCond)
+#endif
+
+static u8 sEepromThreadStarted;
+static u8 sEepromDirty;
+static u8 sEepromSaving;
+static u8 sEepromQuit;
+
+static int eeprom_save_image(const u8 *image) {
+    FILE *fp = fopen(EEPROM_TMP_PATH, "wb");
+    int ok;
+
+    if (fp == NULL) {
+        return 0;
+    }
+    ok = fwrite(image, 1, EEPROM_SIZE, fp) == EEPROM_SIZE && fflush(fp) == 0;
+#ifdef _WIN32
+    ok = ok && _commit(_fileno(fp)) == 0;
+#else
+    ok = ok && fsync(fileno(fp)) == 0;
+#endif
+    ok = fclose(fp) == 0 && ok;
+    if (!ok) {
+        remove(EEPROM_TMP_PATH);
+        return 0;
+    }
+#ifdef _WIN32
+    return MoveFileExA(EEPROM_TMP_PATH, EEPROM_PATH, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH);
+#else
+    return rename(EEPROM_TMP_PATH, EEPROM_PATH) == 0;
+#endif
+}
+
+#ifdef _WIN32
+static DWORD WINAPI eeprom_writer_thread(UNUSED LPVOID arg) {
+#else
+static void *eeprom_writer_thread(UNUSED void *arg) {
+#endif
+    u8 image[EEPROM_SIZE];
+
+    EEPROM_LOCK();
+    for (;;) {
+        while (!sEepromDirty && !sEepromQuit) {
+            EEPROM_WAIT();
+        }
+        if (!sEepromDirty) {
+            break;
+        }
+        memcpy(image, sEepromImage, EEPROM_SIZE);
+        sEepromDirty = FALSE;
+        sEepromSaving = TRUE;
+        EEPROM_UNLOCK();
+
+        if (!eeprom_save_image(image)) {
+            fprintf(stderr, "Could not save " EEPROM_PATH "\n");
+        }
+
+        EEPROM_LOCK();
+        sEepromSaving = FALSE;
+        EEPROM_SIGNAL();
+    }
+    EEPROM_UNLOCK();
+    return 0;
+}
+
+/**
+ * Wait until the writer thread has saved every write, then stop it.
+ */
+static void eeprom_flush(void) {
+    EEPROM_LOCK();
+    sEepromQuit = TRUE;
+    EEPROM_SIGNAL();
+    while (sEepromDirty || sEepromSaving) {
+        EEPROM_WAIT();
+    }
+    EEPROM_UNLOCK();
+}
+
+static void eeprom_start_writer(void) {
+#ifdef _WIN32
+    HANDLE thread;
+
+    InitializeCriticalSection(&sEepromLock);
+    InitializeConditionVariable(&sEepromCond);
+    thread = CreateThread(NULL, 0, eeprom_writer_thread, NULL, 0, NULL);
+    sEepromThreadStarted = thread != NULL;
+    if (thread != NULL) {
+        CloseHandle(thread);
+    }
+#else
+    pthread_t thread;
+
+    sEepromThreadStarted = pthread_create(&thread, NULL, eeprom_writer_thread, NULL) == 0;
+    if (sEepromThreadStarted) {
+        pthread_detach(thread);
+    }
+#endif
+    if (sEepromThreadStarted) {
+        atexit(eeprom_flush);
+    }
+}
+#endif
+
+static void eeprom_load(void) {
+    sEepromLoaded = TRUE;
 
 #ifdef TARGET_WEB
-    if (EM_ASM_INT({
+    sEepromValid = EM_ASM_INT({
         var s = localStorage.sm64_save_file;
         if (s && s.length === 684) {
             try {
@@ -141,49 +308,62 @@ s32 osEepromLongRead(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes)
             }
         }
         return 0;
-    }, content)) {
-        memcpy(buffer, content + address * 8, nbytes);
-        ret = 0;
-    }
+    }, sEepromImage);
 #else
-    FILE *fp = fopen("sm64_save_file.bin", "rb");
-    if (fp == NULL) {
-        return -1;
-    }
-    if (fread(content, 1, 512, fp) == 512) {
-        memcpy(buffer, content + address * 8, nbytes);
-        ret = 0;
+    FILE *fp = fopen(EEPROM_PATH, "rb");
+    if (fp != NULL) {
+        sEepromValid = fread(sEepromImage, 1, EEPROM_SIZE, fp) == EEPROM_SIZE;
+        fclose(fp);
     }
-    fclose(fp);
+    eeprom_start_writer();
 #endif
-    return ret;
+    if (!sEepromValid) {
+        memset(sEepromImage, 0, EEPROM_SIZE);
+    }
+}
+
+s32 osEepromLongRead(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes) {
+    if (!sEepromLoaded) {
+        eeprom_load();
+    }
+    if (!sEepromValid) {
+        return -1;
+    }
+    memcpy(buffer, sEepromImage + address * 8, nbytes);
+    return 0;
 }
 
 s32 osEepromLongWrite(UNUSED OSMesgQueue *mq, u8 address, u8 *buffer, int nbytes) {
-    u8 content[512] = {0};
-    if (address != 0 || nbytes != 512) {
-        osEepromLongRead(mq, 0, content, 512);
+    if (!sEepromLoaded) {
+        eeprom_load();
     }
-    memcpy(content + address * 8, buffer, nbytes);
 
 #ifdef TARGET_WEB
+    memcpy(sEepromImage + address * 8, buffer, nbytes);
+    sEepromValid = TRUE;
     EM_ASM({
         var str = "";
         for (var i = 0; i < 512; i++) {
             str += String.fromCharCode(HEAPU8[$0 + i]);
         }
         localStorage.sm64_save_file = btoa(str);
-    }, content);
-    s32 ret = 0;
+    }, sEepromImage);
 #else
-    FILE* fp = fopen("sm64_save_file.bin", "wb");
-    if (fp == NULL) {
-        return -1;
+    if (!sEepromThreadStarted) {
+        memcpy(sEepromImage + address * 8, buffer, nbytes);
+        sEepromValid = TRUE;
+        return eeprom_save_image(sEepromImage) ? 0 : -1;
     }
-    s32 ret = fwrite(content, 1, 512, fp) == 512 ? 0 : -1;
-    fclose(fp);
+
+    // The writer thread copies the image under the lock
+    EEPROM_LOCK();
+    memcpy(sEepromImage + address * 8, buffer, nbytes);
+    sEepromValid = TRUE;
+    sEepromDirty = TRUE;
+    EEPROM_SIGNAL();
+    EEPROM_UNLOCK();
 #endif
-    return ret;
+    return 0;
 }
 
 s32 gNumVblanks;
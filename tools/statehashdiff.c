@@ -0,0 +1,124 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+// Compares two state hash logs written by src/game/state_hash.c, and reports
+// the first tick where the simulated state differs and in which parts.
+
+#define HEADER_SIZE 16
+#define MAX_PARTS 16
+
+static const char *part_names[] = { "mario", "objects", "globals", "camera" };
+
+struct HashLog {
+    const char *path;
+    FILE *file;
+    uint32_t num_parts;
+};
+
+static uint32_t read_u32(const uint8_t *p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static int open_log(struct HashLog *log, const char *path) {
+    uint8_t header[HEADER_SIZE];
+
+    log->path = path;
+    log->file = fopen(path, "rb");
+    if (log->file == NULL) {
+        fprintf(stderr, "Could not open %s\n", path);
+        return 0;
+    }
+    if (fread(header, 1, HEADER_SIZE, log->file) != HEADER_SIZE || memcmp(header, "SM64HSH", 8) != 0) {
+        fprintf(stderr, "%s is not a state hash log\n", path);
+        return 0;
+    }
+    if (read_u32(header + 8) != 1) {
+        fprintf(stderr, "%s: unsupported version %u\n", path, read_u32(header + 8));
+        return 0;
+    }
+    log->num_parts = read_u32(header + 12);
+    if (log->num_parts == 0 || log->num_parts > MAX_PARTS) {
+        fprintf(stderr, "%s: invalid number of parts\n", path);
+        return 0;
+    }
+    return 1;
+}
+
+static int read_record(struct HashLog *log, uint32_t *tick, uint32_t *hashes) {
+    uint8_t record[4 * (1 + MAX_PARTS)];
+    uint32_t i;
+
+    if (fread(record, 4, 1 + log->num_parts, log->file) != 1 + log->num_parts) {
+        return 0;
+    }
+    *tick = read_u32(record);
+    for (i = 0; i < log->num_parts; i++) {
+        hashes[i] = read_u32(record + 4 * (1 + i));
+    }
+    return 1;
+}
+
+static const char *part_name(uint32_t part) {
+    return part < sizeof(part_names) / sizeof(part_names[0]) ? part_names[part] : "unknown";
+}
+
+int main(int argc, char *argv[]) {
+    struct HashLog a, b;
+    uint32_t hashes_a[MAX_PARTS], hashes_b[MAX_PARTS];
+    uint32_t tick_a, tick_b;
+    uint32_t num_ticks = 0;
+    uint32_t num_diffs = 0;
+    uint32_t i;
+    int has_a, has_b;
+    int same_length = 1;
+
+    if (argc != 3) {
+        fprintf(stderr, "Usage: %s <log a> <log b>\n", argv[0]);
+        return 2;
+    }
+    if (!open_log(&a, argv[1]) || !open_log(&b, argv[2])) {
+        return 2;
+    }
+    if (a.num_parts != b.num_parts) {
+        fprintf(stderr, "The logs hash a different number of parts\n");
+        return 2;
+    }
+
+    for (;;) {
+        has_a = read_record(&a, &tick_a, hashes_a);
+        has_b = read_record(&b, &tick_b, hashes_b);
+        if (!has_a || !has_b) {
+            if (has_a != has_b) {
+                printf("%s ends after %u ticks\n", has_a ? b.path : a.path, num_ticks);
+                same_length = 0;
+            }
+            break;
+        }
+        if (tick_a != tick_b) {
+            printf("Tick numbers differ at record %u: %u and %u\n", num_ticks, tick_a, tick_b);
+            return 1;
+        }
+        num_ticks++;
+        if (memcmp(hashes_a, hashes_b, a.num_parts * sizeof(uint32_t)) == 0) {
+            continue;
+        }
+        if (num_diffs++ == 0) {
+            printf("First difference at tick %u:", tick_a);
+            for (i = 0; i < a.num_parts; i++) {
+                if (hashes_a[i] != hashes_b[i]) {
+                    printf(" %s", part_name(i));
+                }
+            }
+            printf("\n");
+        }
+    }
+
+    if (num_diffs == 0) {
+        printf("%u ticks compared, no difference\n", num_ticks);
+        return same_length ? 0 : 1;
+    }
+    printf("%u of %u ticks differ\n", num_diffs, num_ticks);
+    return 1;
+}